@@ -0,0 +1,96 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <linux/types.h>
+#include <pthread.h>
+
+
+#include "error_functions.h"
+
+#include "InstructionsSolarSystem.h"
+
+#include "DacSolarSystem.h"
+
+
+DacSolarSystemOutputCallbackNewState_t DacSolarSystemOutputCallbackNewState = NULL;
+
+
+/* Exported Functions ******************************************************************************/
+void DacSolarSystemOutputCallbackNewState_Register(DacSolarSystemOutputCallbackNewState_t callback)
+{
+	 DacSolarSystemOutputCallbackNewState = callback;
+}
+
+
+
+/* The main run routine ****************************************************************************/
+static void * instanceSolarSystem = NULL;
+static size_t threadsNrOfSolarSystem = 0;
+
+int DacSolarSystemCreate(size_t threadsNrOf __attribute__((unused)))
+{
+	DacSolarSystemDestroy();
+
+	instanceSolarSystem = CreateThreads(2);
+	threadsNrOfSolarSystem = 2;
+
+	return 0;
+}
+
+int DacSolarSystemRun(size_t threadsNrOf __attribute__((unused)))
+{
+	if(NULL == DacSolarSystemOutputCallbackNewState)
+	{
+		fatal("DacSolarSystemOutputCallbackNewState == NULL");
+	}
+
+	if((NULL == instanceSolarSystem) || (2 != threadsNrOfSolarSystem))
+	{
+		DacSolarSystemCreate(2);
+	}
+
+	InstructionsSolarSystemResetStatic();
+	RunJobs(instanceSolarSystem, &jobPoolInitSolarSystem);
+
+	return 0;
+}
+
+void DacSolarSystemDestroy(void)
+{
+	if(NULL != instanceSolarSystem)
+	{
+		DestroyThreads(instanceSolarSystem);
+		instanceSolarSystem = NULL;
+		threadsNrOfSolarSystem = 0;
+	}
+}
+
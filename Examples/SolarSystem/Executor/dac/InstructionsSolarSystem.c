@@ -0,0 +1,997 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+
+#include "DacSolarSystem.h"
+#include "InstructionsSolarSystem.h"
+
+extern DacSolarSystemOutputCallbackNewState_t DacSolarSystemOutputCallbackNewState;
+
+static const float Node3[18] __attribute__((aligned(64))) __attribute__((unused)) = {4.999970197677612304688e-01, 4.999970197677612304688e-01, 4.999970197677612304688e-01, 5.236774902343750000000e+02, 5.236774902343750000000e+02, 5.236774902343750000000e+02, 1.750800048828125000000e+03, 1.750800048828125000000e+03, 1.750800048828125000000e+03, 1.143450000000000000000e+04, 1.143450000000000000000e+04, 1.143450000000000000000e+04, 9.657000000000000000000e+03, 9.657000000000000000000e+03, 9.657000000000000000000e+03, 6.499999600000000000000e+07, 6.499999600000000000000e+07, 6.499999600000000000000e+07};
+static const float Node6[810] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -1.000000000000000000000e+00};
+static const float Node9 __attribute__((unused)) = 2.000000000000000000000e+00;
+static const float Node11[675] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node13 __attribute__((unused)) = 5.000000000000000000000e-01;
+static const float Node15 __attribute__((unused)) = -1.000000000000000000000e+00;
+static const float Node17[15] __attribute__((aligned(64))) __attribute__((unused)) = {9.547917870804667472839e-04, 2.855854108929634094238e-04, 4.372757757664658129215e-05, 5.177622369956225156784e-05, 7.692354309085658314871e-09, 2.726713717038364848122e-07, 4.175023349262119154446e-08, 4.943492371012325747870e-08, 7.344508681783601389270e-12, 1.248780989726583356969e-08, 1.478635880403089686297e-08, 2.196798081985362749435e-12, 2.264021858877640624996e-09, 3.363639932991296932485e-13, 3.982762741567419384481e-13};
+static const float Node19 __attribute__((unused)) = 2.959122066386044025421e-04;
+static const float Node24[18] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node25 __attribute__((unused)) = 1.000000000000000000000e+00;
+static const float Node28[18] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node67[18] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const int32_t Node84 __attribute__((unused)) = -1;
+static const int32_t Node4PackedArg[18] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+static const int32_t Node4PackedOp[18] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+static const int32_t Node29PackedArg[18] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+static const int32_t Node29PackedOp[18] __attribute__((aligned(64))) __attribute__((unused)) = {18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35};
+static const int32_t Node34PackedArg[18] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+static const int32_t Node34PackedOp[18] __attribute__((aligned(64))) __attribute__((unused)) = {18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35};
+static const int32_t Node68PackedArg[18] __attribute__((aligned(64))) __attribute__((unused)) = {0, 45, 90, 135, 180, 225, 270, 315, 360, 405, 450, 495, 540, 585, 630, 675, 720, 765};
+static const int32_t Node68PackedOp[18] __attribute__((aligned(64))) __attribute__((unused)) = {0, 45, 90, 135, 180, 225, 270, 315, 360, 405, 450, 495, 540, 585, 630, 675, 720, 765};
+static const int32_t Node78PackedArg[36] __attribute__((aligned(64))) __attribute__((unused)) = {18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+static const int32_t Node78PackedElement[36] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+static const int32_t Node78PackedOp[36] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35};
+static const int32_t Node87PackedArg[18] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+static const int32_t Node87PackedOp[18] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+
+static float Node1[36] __attribute__((aligned(64))) = {0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, -3.502365350723266601562e+00, -3.816984653472900390625e+00, -1.550796270370483398438e+00, 9.075531005859375000000e+00, -3.045835256576538085938e+00, -1.648370742797851562500e+00, 8.310141563415527343750e+00, -1.629010772705078125000e+01, -7.252127647399902343750e+00, 1.147076702117919921875e+01, -2.572948265075683593750e+01, -1.081694602966308593750e+01, -1.553873538970947265625e+01, -2.522255897521972656250e+01, -3.190238237380981445312e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 5.398637313192011788487e-06, -3.938397185265785083175e-06, -1.819717226680950261652e-06, 4.806888114217144902796e-07, 1.380868638989340979606e-06, 5.496401627169689163566e-07, 1.548725236943937488832e-07, 5.995102014821895863861e-08, 2.406270382948605401907e-08, 1.495961470254769665189e-07, 5.929739899102060007863e-08, 2.054312986388140416238e-08, 2.128653850408390724169e-11, -1.313092343191435418248e-11, -1.050030808830149098299e-11};
+static float Node2[18] __attribute__((aligned(64)));
+static float Node4[18] __attribute__((aligned(64)));
+static float Node7[18] __attribute__((aligned(64)));
+static float Node8[45] __attribute__((aligned(64)));
+static float Node10[45] __attribute__((aligned(64)));
+static float Node12[15] __attribute__((aligned(64)));
+static float Node34[36] __attribute__((aligned(64)));
+static float Node41;
+static float Node43[15] __attribute__((aligned(64)));
+static float Node45[3375] __attribute__((aligned(64)));
+static float Node48;
+static float Node50[15] __attribute__((aligned(64)));
+static float Node52[3375] __attribute__((aligned(64)));
+static float Node55[675] __attribute__((aligned(64)));
+static float Node58;
+static float Node60[45] __attribute__((aligned(64)));
+static float Node62[91125] __attribute__((aligned(64)));
+static float Node65[810] __attribute__((aligned(64)));
+static float Node68[1620] __attribute__((aligned(64)));
+static float Node69[1620] __attribute__((aligned(64)));
+static float Node70[540] __attribute__((aligned(64)));
+static float Node71[540] __attribute__((aligned(64)));
+static float Node72[540] __attribute__((aligned(64)));
+static float Node75[36] __attribute__((aligned(64)));
+static float Node77[36] __attribute__((aligned(64)));
+static float Node78[36] __attribute__((aligned(64)));
+static int32_t Node83 = 10000;
+static float Node87[18] __attribute__((aligned(64)));
+
+static void Node2Instruction(void)
+{
+	// VectorProjectionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 18; opIndexRow += 18)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 18; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[0] + 18};
+
+			Node2[opIndex] = Node1[argIndexTuple[0] * 1];
+		}
+	}
+}
+
+static void Node4Instruction(void)
+{
+	// VectorContractionCode
+
+	// PackedContractionCode
+
+	for(size_t opIndex = 0; opIndex < 18; opIndex++)
+	{
+		Node4[opIndex] = 0;
+	}
+
+	for(size_t term = 0; term < 18; term++)
+	{
+		Node4[Node4PackedOp[term]] += Node3[term] * Node2[Node4PackedArg[term]];
+	}
+}
+
+static void Node7Instruction(void)
+{
+	// VectorProjectionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 18; opIndexRow += 18)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 18; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[0]};
+
+			Node7[opIndex] = Node1[argIndexTuple[0] * 1];
+		}
+	}
+}
+
+static void Node8Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 45; opIndexRow += 45)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 45; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 18; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node6[lIndexTuple[0] * 18 + lIndexTuple[1]] * Node7[rIndexTuple[0]];
+			}
+			
+			Node8[opIndex] = sum;
+		}
+	}
+}
+
+static void Node10Instruction(void)
+{
+	// VectorPowerCode
+
+	for(size_t opIndex = 0; opIndex < 45; opIndex++)
+	{
+		Node10[opIndex] = __builtin_powif(Node8[opIndex], 2);
+	}
+}
+
+static void Node12Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 15; opIndexRow += 15)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 15; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 45; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node11[lIndexTuple[0] * 45 + lIndexTuple[1]] * Node10[rIndexTuple[0]];
+			}
+			
+			Node12[opIndex] = sum;
+		}
+	}
+}
+
+static void Node34Instruction(void)
+{
+	// VectorContractionCode
+
+	// PackedContractionCode
+
+	for(size_t opIndex = 0; opIndex < 36; opIndex++)
+	{
+		Node34[opIndex] = 0;
+	}
+
+	for(size_t term = 0; term < 18; term++)
+	{
+		Node34[Node34PackedOp[term]] += Node28[term] * Node87[Node34PackedArg[term]];
+	}
+}
+
+static void Node41Instruction(void)
+{
+	// VectorAdditionCode
+
+	Node41 = Node15 + Node15;
+}
+
+static void Node43Instruction(void)
+{
+	// FusedElementWiseCode
+
+	for(uint32_t dim = 0; dim < 15; dim++)
+	{
+		Node43[dim] = Node15 * (powf((powf(Node12[dim], Node13)), Node41));
+	}
+
+}
+
+static void Node45Instruction(void)
+{
+	// VectorVectorProductCode
+
+	// VectorVectorProductKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 3375; opIndexRow += 15)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 15; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t vecIndexTuple[] = {opIndexTuple[2]};
+			const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1]};
+			Node45[opIndex] = (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f * Node43[vecIndexTuple[0] * 1];
+		}
+		
+		if(15 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node48Instruction(void)
+{
+	// VectorAdditionCode
+
+	Node48 = Node13 + Node15;
+}
+
+static void Node50Instruction(void)
+{
+	// FusedElementWiseCode
+
+	for(uint32_t dim = 0; dim < 15; dim++)
+	{
+		Node50[dim] = Node13 * (powf(Node12[dim], Node48));
+	}
+
+}
+
+static void Node52Instruction(void)
+{
+	// VectorVectorProductCode
+
+	// VectorVectorProductKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 3375; opIndexRow += 15)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 15; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t vecIndexTuple[] = {opIndexTuple[2]};
+			const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1]};
+			Node52[opIndex] = (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f * Node50[vecIndexTuple[0] * 1];
+		}
+		
+		if(15 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node55Instruction(void)
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 675; opIndexRow += 15)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 15; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 45; dim0++)
+			{
+				const uint32_t argIndexTuple[] = {opIndexTuple[1], dim0};
+				const uint32_t kronIndexTuple[] = {opIndexTuple[0], dim0};
+				sum += Node11[argIndexTuple[0] * 45 + argIndexTuple[1] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f;
+			}
+			
+			Node55[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node58Instruction(void)
+{
+	// VectorAdditionCode
+
+	Node58 = Node9 + Node15;
+}
+
+static void Node60Instruction(void)
+{
+	// FusedElementWiseCode
+
+	for(uint32_t dim = 0; dim < 45; dim++)
+	{
+		Node60[dim] = Node9 * (powf(Node8[dim], Node58));
+	}
+
+}
+
+static void Node62Instruction(void)
+{
+	// VectorVectorProductCode
+
+	// VectorVectorProductKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 91125; opIndexRow += 45)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 45; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t vecIndexTuple[] = {opIndexTuple[2]};
+			const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1]};
+			Node62[opIndex] = (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f * Node60[vecIndexTuple[0] * 1];
+		}
+		
+		if(45 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node65Instruction(void)
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 810; opIndexRow += 45)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 45; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 18; dim0++)
+			{
+				const uint32_t argIndexTuple[] = {opIndexTuple[1], dim0};
+				const uint32_t kronIndexTuple[] = {opIndexTuple[0], dim0};
+				sum += Node6[argIndexTuple[0] * 18 + argIndexTuple[1] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f;
+			}
+			
+			Node65[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node68Instruction(void)
+{
+	// VectorContractionCode
+
+	// PackedContractionCode
+
+	for(size_t opIndex = 0; opIndex < 1620; opIndex++)
+	{
+		Node68[opIndex] = 0;
+	}
+
+	for(size_t term = 0; term < 18; term++)
+	{
+		for(size_t free = 0; free < 45; free++)
+		{
+			Node68[Node68PackedOp[term] + free * 1] += Node67[term] * Node65[Node68PackedArg[term] + free * 1];
+		}
+	}
+}
+
+static void Node69Instruction(void)
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node69[36][45] = l[36][45] * r[45][45]
+	for(size_t opIndex = 0; opIndex < 1620; opIndex++)
+	{
+		Node69[opIndex] = 0;
+	}
+
+	float rPacked[45][45] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 45; kBlock += 45)
+	{
+		const size_t kSize = (45 < kBlock + 45) ? 45 - kBlock : 45;
+		for(size_t nBlock = 0; nBlock < 45; nBlock += 45)
+		{
+			const size_t nSize = (45 < nBlock + 45) ? 45 - nBlock : 45;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node62[(kBlock + k) * 2025 + (nBlock + n) * 46];
+				}
+			}
+
+			size_t m = 0;
+			for(; m + 4 <= 36; m += 4)
+			{
+				float * restrict op0 = &Node69[(m + 0) * 45 + nBlock];
+				float * restrict op1 = &Node69[(m + 1) * 45 + nBlock];
+				float * restrict op2 = &Node69[(m + 2) * 45 + nBlock];
+				float * restrict op3 = &Node69[(m + 3) * 45 + nBlock];
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node68[(m + 0) * 45 + (kBlock + k) * 1];
+					const float l1 = Node68[(m + 1) * 45 + (kBlock + k) * 1];
+					const float l2 = Node68[(m + 2) * 45 + (kBlock + k) * 1];
+					const float l3 = Node68[(m + 3) * 45 + (kBlock + k) * 1];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 36; m += 1)
+			{
+				float * restrict op0 = &Node69[(m + 0) * 45 + nBlock];
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node68[(m + 0) * 45 + (kBlock + k) * 1];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node70Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 540; opIndexRow += 15)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 15; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 45; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node69[lIndexTuple[0] * 45 + lIndexTuple[1]] * Node55[rIndexTuple[0] * 15 + rIndexTuple[1]];
+			}
+			
+			Node70[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node71Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 540; opIndexRow += 15)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 15; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 15; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node70[lIndexTuple[0] * 15 + lIndexTuple[1]] * Node52[rIndexTuple[0] * 225 + rIndexTuple[1] * 16];
+			}
+			
+			Node71[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node72Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 540; opIndexRow += 15)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 15; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 15; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node71[lIndexTuple[0] * 15 + lIndexTuple[1]] * Node45[rIndexTuple[0] * 225 + rIndexTuple[1] * 16];
+			}
+			
+			Node72[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node75Instruction(void)
+{
+	// FusedElementWiseCode
+
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 36; opIndexRow += 36)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 36; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 15; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node72[lIndexTuple[0] * 15 + lIndexTuple[1]] * Node17[rIndexTuple[0]];
+			}
+			
+			// Epilogue: Node75
+			const size_t dim __attribute__((unused)) = opIndex;
+			Node75[opIndex] = (sum * Node19) * Node15;
+		}
+	}
+}
+
+static void Node77Instruction(void)
+{
+	// FusedElementWiseCode
+
+	// VectorContractionCode
+
+	// PackedContractionCode
+
+	for(size_t opIndex = 0; opIndex < 36; opIndex++)
+	{
+		Node77[opIndex] = 0;
+	}
+
+	for(size_t term = 0; term < 18; term++)
+	{
+		Node77[Node29PackedOp[term]] += Node28[term] * Node4[Node29PackedArg[term]];
+	}
+	
+	// Epilogue: Node77
+	for(size_t opIndex = 0; opIndex < 36; opIndex++)
+	{
+		const size_t dim __attribute__((unused)) = opIndex;
+		Node77[opIndex] = (Node77[opIndex] + Node34[dim]) + Node75[dim];
+	}
+}
+
+static void Node78Instruction(void)
+{
+	// VectorContractionCode
+
+	// PackedContractionCode
+
+	for(size_t opIndex = 0; opIndex < 36; opIndex++)
+	{
+		Node78[opIndex] = 0;
+	}
+
+	for(size_t term = 0; term < 18; term++)
+	{
+		Node78[Node78PackedOp[term]] += Node24[Node78PackedElement[term]] * Node77[Node78PackedArg[term]];
+	}
+	
+	for(size_t term = 18; term < 36; term++)
+	{
+		Node78[Node78PackedOp[term]] -= Node24[Node78PackedElement[term]] * Node77[Node78PackedArg[term]];
+	}
+}
+
+static void Node81Instruction(void)
+{
+	// VectorAdditionCode
+
+	for(uint32_t dim = 0; dim < 36; dim++)
+	{
+		Node1[dim] = Node1[dim] + Node78[dim];
+	}
+
+}
+
+static void Node82Instruction(void)
+{
+	// OutputCode
+
+	DacSolarSystemOutputCallbackNewState(Node1, 36 * sizeof(float));
+
+	
+}
+
+static void Node85Instruction(void)
+{
+	// VectorAdditionCode
+
+	Node83 = Node83 + Node84;
+}
+
+static uint8_t Node86InstructionRepeat = 0;
+
+static void Node86Instruction(void)
+{
+	// ControlTransferWhileCode
+
+	Node86InstructionRepeat = (Node83) ? 1 : 0;
+}
+
+static void Node87Instruction(void)
+{
+	// VectorContractionCode
+
+	// PackedContractionCode
+
+	for(size_t opIndex = 0; opIndex < 18; opIndex++)
+	{
+		Node87[opIndex] = 0;
+	}
+
+	for(size_t term = 0; term < 18; term++)
+	{
+		Node87[Node87PackedOp[term]] += Node3[term] * Node2[Node87PackedArg[term]];
+	}
+}
+
+static atomic_uint exeCntSolarSystem[31];
+static atomic_uint finalIterationSolarSystem;
+
+void InstructionsSolarSystemResetStatic(void)
+{
+	for(size_t node = 0; node < sizeof(exeCntSolarSystem) / sizeof(exeCntSolarSystem[0]); node++)
+	{
+		atomic_store_explicit(&exeCntSolarSystem[node], 0, memory_order_relaxed);
+	}
+
+	atomic_store_explicit(&finalIterationSolarSystem, UINT32_MAX, memory_order_relaxed);
+}
+
+static void Thread0Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	Node7Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[2], 1, memory_order_release);
+
+	Node8Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[3], 1, memory_order_release);
+
+	WaitForCount(&exeCntSolarSystem[13], 1);
+	Node60Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[14], 1, memory_order_release);
+
+	Node62Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[15], 1, memory_order_release);
+
+	WaitForCount(&exeCntSolarSystem[17], 1);
+	Node69Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[18], 1, memory_order_release);
+
+	WaitForCount(&exeCntSolarSystem[12], 1);
+	Node70Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[19], 1, memory_order_release);
+
+	WaitForCount(&exeCntSolarSystem[11], 1);
+	Node71Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[20], 1, memory_order_release);
+
+	WaitForCount(&exeCntSolarSystem[8], 1);
+	Node72Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[21], 1, memory_order_release);
+
+	Node75Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[22], 1, memory_order_release);
+
+	WaitForCount(&exeCntSolarSystem[1], 1);
+	WaitForCount(&exeCntSolarSystem[25], 1);
+	Node77Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[26], 1, memory_order_release);
+
+	Node78Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[27], 1, memory_order_release);
+
+	Node81Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[28], 1, memory_order_release);
+
+	Node82Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[29], 1, memory_order_release);
+
+	WaitForCount(&exeCntSolarSystem[23], 1);
+	Node86Instruction();
+	if(!Node86InstructionRepeat)
+	{
+		atomic_store_explicit(&finalIterationSolarSystem, 1, memory_order_relaxed);
+	}
+	atomic_store_explicit(&exeCntSolarSystem[30], 1, memory_order_release);
+
+	for(uint32_t iteration = 2; ; iteration++)
+	{
+		WaitForCount(&exeCntSolarSystem[30], iteration - 1);
+		if(iteration - 1 == atomic_load_explicit(&finalIterationSolarSystem, memory_order_relaxed))
+		{
+			break;
+		}
+
+		Node7Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[2], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[4], iteration - 1);
+		Node8Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[3], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[13], iteration);
+		Node60Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[14], iteration, memory_order_release);
+
+		Node62Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[15], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[17], iteration);
+		Node69Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[18], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[12], iteration);
+		Node70Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[19], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[11], iteration);
+		Node71Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[20], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[8], iteration);
+		Node72Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[21], iteration, memory_order_release);
+
+		Node75Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[22], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[1], iteration);
+		WaitForCount(&exeCntSolarSystem[25], iteration);
+		Node77Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[26], iteration, memory_order_release);
+
+		Node78Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[27], iteration, memory_order_release);
+
+		Node81Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[28], iteration, memory_order_release);
+
+		Node82Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[29], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[23], iteration);
+		Node86Instruction();
+		if(!Node86InstructionRepeat)
+		{
+			atomic_store_explicit(&finalIterationSolarSystem, iteration, memory_order_relaxed);
+		}
+		atomic_store_explicit(&exeCntSolarSystem[30], iteration, memory_order_release);
+
+	}
+}
+
+static void Thread1Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	Node58Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[13], 1, memory_order_release);
+
+	Node65Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[16], 1, memory_order_release);
+
+	Node68Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[17], 1, memory_order_release);
+
+	Node55Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[12], 1, memory_order_release);
+
+	WaitForCount(&exeCntSolarSystem[3], 1);
+	Node10Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[4], 1, memory_order_release);
+
+	Node12Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[5], 1, memory_order_release);
+
+	Node48Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[9], 1, memory_order_release);
+
+	Node50Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[10], 1, memory_order_release);
+
+	Node52Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[11], 1, memory_order_release);
+
+	Node41Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[6], 1, memory_order_release);
+
+	Node43Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[7], 1, memory_order_release);
+
+	Node45Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[8], 1, memory_order_release);
+
+	Node2Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[0], 1, memory_order_release);
+
+	Node87Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[24], 1, memory_order_release);
+
+	Node4Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[1], 1, memory_order_release);
+
+	Node34Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[25], 1, memory_order_release);
+
+	Node85Instruction();
+	atomic_store_explicit(&exeCntSolarSystem[23], 1, memory_order_release);
+
+	for(uint32_t iteration = 2; ; iteration++)
+	{
+		WaitForCount(&exeCntSolarSystem[30], iteration - 1);
+		if(iteration - 1 == atomic_load_explicit(&finalIterationSolarSystem, memory_order_relaxed))
+		{
+			break;
+		}
+
+		WaitForCount(&exeCntSolarSystem[14], iteration - 1);
+		Node58Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[13], iteration, memory_order_release);
+
+		Node65Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[16], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[18], iteration - 1);
+		Node68Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[17], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[19], iteration - 1);
+		Node55Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[12], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[3], iteration);
+		Node10Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[4], iteration, memory_order_release);
+
+		Node12Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[5], iteration, memory_order_release);
+
+		Node48Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[9], iteration, memory_order_release);
+
+		Node50Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[10], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[20], iteration - 1);
+		Node52Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[11], iteration, memory_order_release);
+
+		Node41Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[6], iteration, memory_order_release);
+
+		Node43Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[7], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[21], iteration - 1);
+		Node45Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[8], iteration, memory_order_release);
+
+		Node2Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[0], iteration, memory_order_release);
+
+		Node87Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[24], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[26], iteration - 1);
+		Node4Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[1], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[26], iteration - 1);
+		Node34Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[25], iteration, memory_order_release);
+
+		WaitForCount(&exeCntSolarSystem[30], iteration - 1);
+		Node85Instruction();
+		atomic_store_explicit(&exeCntSolarSystem[23], iteration, memory_order_release);
+
+	}
+}
+
+static node_t nodesSolarSystem[] = {
+	{Thread0Instruction, NULL, NULL, 0, 0, 0, 0, 0},
+	{Thread1Instruction, NULL, NULL, 0, 0, 0, 1, 0},
+};
+
+node_t * jobPoolInitNodesSolarSystem[] = {
+	&nodesSolarSystem[0],
+	&nodesSolarSystem[1],
+};
+
+jobPoolInit_t jobPoolInitSolarSystem = {
+	.Nodes = jobPoolInitNodesSolarSystem,
+	.NodesNrOf = 2,
+	.JobsNrOfMax = 2,
+};
@@ -263,6 +263,8 @@ int main(int argc, char* argv[])
 	DacSolarSystemRun(4);
 	clock_t dacEndClock = clock();
 
+	DacSolarSystemDestroy();
+
 	// Check result
 	for(size_t dim = 0; dim < sizeof(expectedTerminationState) / sizeof(expectedTerminationState[0]); dim++)
 	{
@@ -522,6 +522,8 @@ int main(int argc, char* argv[])
 			nullptr);
 
 	// Perform graph optimization
+	graph.Simplify();
+	graph.OrderContractions();
 	graph.RemoveDuplicates();
 
 	// Generate Code
@@ -63,6 +63,66 @@ static void ccMaxPool(const float * data, size_t size)
 	ModuleCNNPt->CCMaxPool(data, size);
 }
 
+static void ccBig(const float * data, size_t size)
+{
+	if(NULL == ModuleCNNPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleCNNPt->CCBig(data, size);
+}
+
+static void ccSparse(const float * data, size_t size)
+{
+	if(NULL == ModuleCNNPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleCNNPt->CCSparse(data, size);
+}
+
+static void ccMaxPool4(const float * data, size_t size)
+{
+	if(NULL == ModuleCNNPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleCNNPt->CCMaxPool4(data, size);
+}
+
+static void ccMaxPool4Derivative(const float * data, size_t size)
+{
+	if(NULL == ModuleCNNPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleCNNPt->CCMaxPool4Derivative(data, size);
+}
+
+static void ccDoubled(const float * data, size_t size)
+{
+	if(NULL == ModuleCNNPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleCNNPt->CCDoubled(data, size);
+}
+
+static void kernelSquaredDerivative(const float * data, size_t size)
+{
+	if(NULL == ModuleCNNPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleCNNPt->KernelSquaredDerivative(data, size);
+}
+
 static void vectorSplit(const float * data, size_t size)
 {
 	if(NULL == ModuleCNNPt)
@@ -164,6 +224,130 @@ void ModuleCNN::CCMaxPool(const float * data, size_t size)
 	called_[CALLED_CCMaxPool] = true;
 }
 
+void ModuleCNN::CCBig(const float * data, size_t size)
+{
+	// Input is 0, 1, 2, ... of dimensions 4 x 8 x 8, kernel elements are (elem % 7) - 3 of dimensions 2 x 5 x 5
+	float expected[3 * 4 * 4];
+	for(size_t i = 0; i < 3; i++)
+	{
+		for(size_t j = 0; j < 4; j++)
+		{
+			for(size_t k = 0; k < 4; k++)
+			{
+				float sum = 0;
+				for(size_t a = 0; a < 2; a++)
+				{
+					for(size_t b = 0; b < 5; b++)
+					{
+						for(size_t c = 0; c < 5; c++)
+						{
+							const float in = (float) ((i + a) * 64 + (j + b) * 8 + k + c);
+							const float kernel = (float) ((a * 25 + b * 5 + c) % 7) - 3.f;
+							sum += in * kernel;
+						}
+					}
+				}
+
+				expected[i * 16 + j * 4 + k] = sum;
+			}
+		}
+	}
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 4);
+	}
+
+	called_[CALLED_CCBig] = true;
+}
+
+void ModuleCNN::CCSparse(const float * data, size_t size)
+{
+	// Input is 1, 2, 3, ... of dimensions 10 x 10
+	const float kernel[3 * 3] = {0, -1, 0, 2, 0, 1, 0, 0, 3};
+
+	float expected[8 * 8];
+	for(size_t i = 0; i < 8; i++)
+	{
+		for(size_t j = 0; j < 8; j++)
+		{
+			float sum = 0;
+			for(size_t a = 0; a < 3; a++)
+			{
+				for(size_t b = 0; b < 3; b++)
+				{
+					sum += (float) ((i + a) * 10 + j + b + 1) * kernel[a * 3 + b];
+				}
+			}
+
+			expected[i * 8 + j] = sum;
+		}
+	}
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 8);
+	}
+
+	called_[CALLED_CCSparse] = true;
+}
+
+void ModuleCNN::CCMaxPool4(const float * data, size_t size)
+{
+	// cc grows along both indices, so the maximum is at the end of each window
+	const float expected[2 * 2] = {
+			2211.000000, 2391.000000,
+			4011.000000, 4191.000000};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 2);
+	}
+
+	called_[CALLED_CCMaxPool4] = true;
+}
+
+void ModuleCNN::CCMaxPool4Derivative(const float * data, size_t size)
+{
+	// Derivative_ij = dMaxPool4(j) / dcc(i), cc is 8 x 8, MaxPool4 is 2 x 2
+	float expected[64 * 4] = {0};
+	for(size_t k = 0; k < 2; k++)
+	{
+		for(size_t l = 0; l < 2; l++)
+		{
+			const size_t argmax = (4 * k + 3) * 8 + 4 * l + 3;
+			expected[argmax * 4 + k * 2 + l] = 1;
+		}
+	}
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 4);
+	}
+
+	called_[CALLED_CCMaxPool4Derivative] = true;
+}
+
 const float * ModuleCNN::VectorInput(size_t identifier, size_t size)
 {
 	switch(identifier)
@@ -223,11 +407,68 @@ void ModuleCNN::CC(const float * data, size_t size)
 	called_[CALLED_CC] = true;
 }
 
+void ModuleCNN::CCDoubled(const float * data, size_t size)
+{
+	const float expected[8 * 8] = {
+			1452.000000, 1542.000000, 1632.000000, 1722.000000, 1812.000000, 1902.000000, 1992.000000, 2082.000000,
+			2352.000000, 2442.000000, 2532.000000, 2622.000000, 2712.000000, 2802.000000, 2892.000000, 2982.000000,
+			3252.000000, 3342.000000, 3432.000000, 3522.000000, 3612.000000, 3702.000000, 3792.000000, 3882.000000,
+			4152.000000, 4242.000000, 4332.000000, 4422.000000, 4512.000000, 4602.000000, 4692.000000, 4782.000000,
+			5052.000000, 5142.000000, 5232.000000, 5322.000000, 5412.000000, 5502.000000, 5592.000000, 5682.000000,
+			5952.000000, 6042.000000, 6132.000000, 6222.000000, 6312.000000, 6402.000000, 6492.000000, 6582.000000,
+			6852.000000, 6942.000000, 7032.000000, 7122.000000, 7212.000000, 7302.000000, 7392.000000, 7482.000000,
+			7752.000000, 7842.000000, 7932.000000, 8022.000000, 8112.000000, 8202.000000, 8292.000000, 8382.000000};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 8);
+	}
+
+	called_[CALLED_CCDoubled] = true;
+}
+
+void ModuleCNN::KernelSquaredDerivative(const float * data, size_t size)
+{
+	const float expected[9 * 9] = {
+			2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000,
+			0.000000, 4.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000,
+			0.000000, 0.000000, 6.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000,
+			0.000000, 0.000000, 0.000000, 8.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000,
+			0.000000, 0.000000, 0.000000, 0.000000, 10.000000, 0.000000, 0.000000, 0.000000, 0.000000,
+			0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 12.000000, 0.000000, 0.000000, 0.000000,
+			0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 14.000000, 0.000000, 0.000000,
+			0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 16.000000, 0.000000,
+			0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 0.000000, 18.000000};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 9);
+	}
+
+	called_[CALLED_KernelSquaredDerivative] = true;
+}
+
 ModuleCNN::ModuleCNN() {
 	ModuleCNNPt = this;
 
 	DacModuleCNNOutputCallbackcc_Register(&cc);
 	DacModuleCNNOutputCallbackccMaxPool_Register(&ccMaxPool);
+	DacModuleCNNOutputCallbackccBig_Register(&ccBig);
+	DacModuleCNNOutputCallbackccSparse_Register(&ccSparse);
+	DacModuleCNNOutputCallbackccMaxPool4_Register(&ccMaxPool4);
+	DacModuleCNNOutputCallbackccMaxPool4Derivative_Register(&ccMaxPool4Derivative);
+	DacModuleCNNOutputCallbackccDoubled_Register(&ccDoubled);
+	DacModuleCNNOutputCallbackkernelSquaredDerivative_Register(&kernelSquaredDerivative);
 	DacModuleCNNOutputCallbackvectorSplit_Register(&vectorSplit);
 	DacModuleCNNOutputCallbackvector21_Register(&vector21);
 	DacModuleCNNOutputCallbackvector42_Register(&vector42);
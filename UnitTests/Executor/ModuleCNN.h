@@ -33,6 +33,12 @@ public:
 
 	void CC(const float * data, size_t size);
 	void CCMaxPool(const float * data, size_t size);
+	void CCBig(const float * data, size_t size);
+	void CCSparse(const float * data, size_t size);
+	void CCMaxPool4(const float * data, size_t size);
+	void CCMaxPool4Derivative(const float * data, size_t size);
+	void CCDoubled(const float * data, size_t size);
+	void KernelSquaredDerivative(const float * data, size_t size);
 	void VectorSplit(const float * data, size_t size);
 	void Vector21(const float * data, size_t size);
 	void Vector42(const float * data, size_t size);
@@ -45,6 +51,12 @@ private:
 	enum {
 		CALLED_CC,
 		CALLED_CCMaxPool,
+		CALLED_CCBig,
+		CALLED_CCSparse,
+		CALLED_CCMaxPool4,
+		CALLED_CCMaxPool4Derivative,
+		CALLED_CCDoubled,
+		CALLED_KernelSquaredDerivative,
 		CALLED_VectorSplit,
 		CALLED_Vector21,
 		CALLED_Vector42,
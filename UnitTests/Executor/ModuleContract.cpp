@@ -25,6 +25,7 @@
 #include "error_functions.h"
 
 #include "DacModuleContract.h"
+#include "DacModuleContractStatic.h"
 
 #include "ModuleContract.h"
 
@@ -61,6 +62,16 @@ static void vecMatrixProd(const float * data, size_t size)
 	ModuleContractPt->VecMatrixProd(data, size);
 }
 
+static void denseLayer(const float * data, size_t size)
+{
+	if(NULL == ModuleContractPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleContractPt->DenseLayer(data, size);
+}
+
 static void tensorVecContr2(const float * data, size_t size)
 {
 	if(NULL == ModuleContractPt)
@@ -121,6 +132,36 @@ static void twoMatrixTrace(const float * data, size_t size)
 	ModuleContractPt->TwoMatrixTrace(data, size);
 }
 
+static void matrixDeltaSumProd(const float * data, size_t size)
+{
+	if(NULL == ModuleContractPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleContractPt->MatrixDeltaSumProd(data, size);
+}
+
+static void tensorDeltaContr(const float * data, size_t size)
+{
+	if(NULL == ModuleContractPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleContractPt->TensorDeltaContr(data, size);
+}
+
+static void matrixPlusDelta(const float * data, size_t size)
+{
+	if(NULL == ModuleContractPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleContractPt->MatrixPlusDelta(data, size);
+}
+
 static void matrixProdLeft(const float * data, size_t size)
 {
 	if(NULL == ModuleContractPt)
@@ -141,6 +182,66 @@ static void matrixProdRight(const float * data, size_t size)
 	ModuleContractPt->MatrixProdRight(data, size);
 }
 
+static void matrixChainVec(const float * data, size_t size)
+{
+	if(NULL == ModuleContractPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleContractPt->MatrixChainVec(data, size);
+}
+
+static void tensorChainVec(const float * data, size_t size)
+{
+	if(NULL == ModuleContractPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleContractPt->TensorChainVec(data, size);
+}
+
+static void shiftPower5(const float * data, size_t size)
+{
+	if(NULL == ModuleContractPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleContractPt->ShiftPower5(data, size);
+}
+
+static void matrixPowerTransposed3(const float * data, size_t size)
+{
+	if(NULL == ModuleContractPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleContractPt->MatrixPowerTransposed3(data, size);
+}
+
+static void matrixDoubled(const float * data, size_t size)
+{
+	if(NULL == ModuleContractPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleContractPt->MatrixDoubled(data, size);
+}
+
+static void matrixDoubledId(const float * data, size_t size)
+{
+	if(NULL == ModuleContractPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleContractPt->MatrixDoubledId(data, size);
+}
+
 void ModuleContract::MatrixProd1(const float * data, size_t size)
 {
 	const float expected[] = {
@@ -196,6 +297,23 @@ void ModuleContract::VecMatrixProd(const float * data, size_t size)
 	called_[CALLED_VecMatrixProd] = true;
 }
 
+void ModuleContract::DenseLayer(const float * data, size_t size)
+{
+	const float expected[] = {30, 68, 106};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_DenseLayer] = true;
+}
+
 void ModuleContract::TensorVecContr2(const float * data, size_t size)
 {
 	const float expected[] = {
@@ -348,11 +466,186 @@ void ModuleContract::MatrixProdRight(const float * data, size_t size)
 	called_[CALLED_MatrixProdRight] = true;
 }
 
+void ModuleContract::MatrixDeltaSumProd(const float * data, size_t size)
+{
+	// 2.5 * matrix1
+	const float expected[] = {2.5, 5, 7.5, 10, 12.5, 15, 17.5, 20, 22.5};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_MatrixDeltaSumProd] = true;
+}
+
+void ModuleContract::TensorDeltaContr(const float * data, size_t size)
+{
+	// tensor[k][i][j]
+	const float expected[] = {
+			1, 10, 20, 2, 11, 21, 3, 12, 22,
+			4, 13, 23, 5, 14, 24, 6, 15, 25,
+			7, 16, 26, 8, 18, 27, 9, 19, 28,
+	};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_TensorDeltaContr] = true;
+}
+
+void ModuleContract::MatrixPlusDelta(const float * data, size_t size)
+{
+	// matrix1 + 2 * identity
+	const float expected[] = {3, 2, 3, 4, 7, 6, 7, 8, 11};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_MatrixPlusDelta] = true;
+}
+
+void ModuleContract::MatrixChainVec(const float * data, size_t size)
+{
+	// matrix1^3 * vector
+	const float expected[] = {3672, 8316, 12960};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_MatrixChainVec] = true;
+}
+
+void ModuleContract::TensorChainVec(const float * data, size_t size)
+{
+	const float expected[] = {
+			468, 576, 684,
+			1149, 1425, 1701,
+			1836, 2286, 2736,
+	};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_TensorChainVec] = true;
+}
+
+void ModuleContract::ShiftPower5(const float * data, size_t size)
+{
+	const float expected[] = {
+			1, 5, 10,
+			0, 1, 5,
+			0, 0, 1,
+	};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_ShiftPower5] = true;
+}
+
+void ModuleContract::MatrixPowerTransposed3(const float * data, size_t size)
+{
+	// C_ik = A_ji A_kj, contracted with A the same way
+	const float expected[] = {
+			228, 552, 876,
+			516, 1245, 1974,
+			804, 1938, 3072,
+	};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_MatrixPowerTransposed3] = true;
+}
+
+void ModuleContract::MatrixDoubled(const float * data, size_t size)
+{
+	const float expected[] = {2, 4, 6, 8, 10, 12, 14, 16, 18};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_MatrixDoubled] = true;
+}
+
+void ModuleContract::MatrixDoubledId(const float * data, size_t size)
+{
+	const float expected[] = {2, 4, 6, 8, 10, 12, 14, 16, 18};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_MatrixDoubledId] = true;
+}
+
 ModuleContract::ModuleContract() {
 	ModuleContractPt = this;
 
 	DacModuleContractOutputCallbackmatrixVecProd_Register(&matrixVecProd);
 	DacModuleContractOutputCallbackvecMatrixProd_Register(&vecMatrixProd);
+	DacModuleContractOutputCallbackdenseLayer_Register(&denseLayer);
 	DacModuleContractOutputCallbackmatrixProd1_Register(&matrixProd1);
 	DacModuleContractOutputCallbacktensorVecContr2_Register(&tensorVecContr2);
 	DacModuleContractOutputCallbacktensorVecContr1_Register(&tensorVecContr1);
@@ -362,20 +655,64 @@ ModuleContract::ModuleContract() {
 	DacModuleContractOutputCallbacktwoMatrixTrace_Register(&twoMatrixTrace);
 	DacModuleContractOutputCallbackmatrixProdRight_Register(&matrixProdRight);
 	DacModuleContractOutputCallbackmatrixProdLeft_Register(&matrixProdLeft);
+	DacModuleContractOutputCallbackmatrixDeltaSumProd_Register(&matrixDeltaSumProd);
+	DacModuleContractOutputCallbacktensorDeltaContr_Register(&tensorDeltaContr);
+	DacModuleContractOutputCallbackmatrixPlusDelta_Register(&matrixPlusDelta);
+	DacModuleContractOutputCallbackmatrixChainVec_Register(&matrixChainVec);
+	DacModuleContractOutputCallbacktensorChainVec_Register(&tensorChainVec);
+	DacModuleContractOutputCallbackshiftPower5_Register(&shiftPower5);
+	DacModuleContractOutputCallbackmatrixPowerTransposed3_Register(&matrixPowerTransposed3);
+	DacModuleContractOutputCallbackmatrixDoubled_Register(&matrixDoubled);
+	DacModuleContractOutputCallbackmatrixDoubledId_Register(&matrixDoubledId);
+
+	DacModuleContractStaticOutputCallbackmatrixVecProd_Register(&matrixVecProd);
+	DacModuleContractStaticOutputCallbackvecMatrixProd_Register(&vecMatrixProd);
+	DacModuleContractStaticOutputCallbackdenseLayer_Register(&denseLayer);
+	DacModuleContractStaticOutputCallbackmatrixProd1_Register(&matrixProd1);
+	DacModuleContractStaticOutputCallbacktensorVecContr2_Register(&tensorVecContr2);
+	DacModuleContractStaticOutputCallbacktensorVecContr1_Register(&tensorVecContr1);
+	DacModuleContractStaticOutputCallbacktensorMatrixContr1_Register(&tensorMatrixContr1);
+	DacModuleContractStaticOutputCallbacktensorMatrixContr12_Register(&tensorMatrixContr12);
+	DacModuleContractStaticOutputCallbackmatrixIdProd_Register(&matrixIdProd);
+	DacModuleContractStaticOutputCallbacktwoMatrixTrace_Register(&twoMatrixTrace);
+	DacModuleContractStaticOutputCallbackmatrixProdRight_Register(&matrixProdRight);
+	DacModuleContractStaticOutputCallbackmatrixProdLeft_Register(&matrixProdLeft);
+	DacModuleContractStaticOutputCallbackmatrixDeltaSumProd_Register(&matrixDeltaSumProd);
+	DacModuleContractStaticOutputCallbacktensorDeltaContr_Register(&tensorDeltaContr);
+	DacModuleContractStaticOutputCallbackmatrixPlusDelta_Register(&matrixPlusDelta);
+	DacModuleContractStaticOutputCallbackmatrixChainVec_Register(&matrixChainVec);
+	DacModuleContractStaticOutputCallbacktensorChainVec_Register(&tensorChainVec);
+	DacModuleContractStaticOutputCallbackshiftPower5_Register(&shiftPower5);
+	DacModuleContractStaticOutputCallbackmatrixPowerTransposed3_Register(&matrixPowerTransposed3);
+	DacModuleContractStaticOutputCallbackmatrixDoubled_Register(&matrixDoubled);
+	DacModuleContractStaticOutputCallbackmatrixDoubledId_Register(&matrixDoubledId);
 }
 
-void ModuleContract::Execute(size_t threadsNrOf)
+void ModuleContract::RunRepeatedly(const char * name, int (*dacRun)(size_t threadsNrOf), void (*dacDestroy)(void))
 {
-	ThreadsNrOf_ = threadsNrOf;
+	// Run several times to check that the thread pool is reused correctly
+	for(size_t run = 0; run < 3; run++)
+	{
+		memset(called_, 0, sizeof(called_));
 
-	DacModuleContractRun(ThreadsNrOf_);
+		dacRun(ThreadsNrOf_);
 
-	for(size_t call = 0; call < sizeof(called_) / sizeof(called_[0]); call++)
-	{
-		if(false == called_[call])
+		for(size_t call = 0; call < sizeof(called_) / sizeof(called_[0]); call++)
 		{
-			Error("Not all callbacks executed: Missing %lu!\n", call);
+			if(false == called_[call])
+			{
+				Error("%s: Not all callbacks executed in run %lu: Missing %lu!\n", name, run, call);
+			}
 		}
 	}
+
+	dacDestroy();
 }
 
+void ModuleContract::Execute(size_t threadsNrOf)
+{
+	ThreadsNrOf_ = threadsNrOf;
+
+	RunRepeatedly("ModuleContract", &DacModuleContractRun, &DacModuleContractDestroy);
+	RunRepeatedly("ModuleContractStatic", &DacModuleContractStaticRun, &DacModuleContractStaticDestroy);
+}
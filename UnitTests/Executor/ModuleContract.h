@@ -34,6 +34,7 @@ public:
 	void MatrixProd1(const float * data, size_t size);
 	void MatrixVecProd(const float * data, size_t size);
 	void VecMatrixProd(const float * data, size_t size);
+	void DenseLayer(const float * data, size_t size);
 	void TensorVecContr2(const float * data, size_t size);
 	void TensorVecContr1(const float * data, size_t size);
 	void TensorMatrixContr1(const float * data, size_t size);
@@ -42,14 +43,26 @@ public:
 	void TwoMatrixTrace(const float * data, size_t size);
 	void MatrixProdRight(const float * data, size_t size);
 	void MatrixProdLeft(const float * data, size_t size);
+	void MatrixDeltaSumProd(const float * data, size_t size);
+	void TensorDeltaContr(const float * data, size_t size);
+	void MatrixPlusDelta(const float * data, size_t size);
+	void MatrixChainVec(const float * data, size_t size);
+	void TensorChainVec(const float * data, size_t size);
+	void ShiftPower5(const float * data, size_t size);
+	void MatrixPowerTransposed3(const float * data, size_t size);
+	void MatrixDoubled(const float * data, size_t size);
+	void MatrixDoubledId(const float * data, size_t size);
 
 private:
 	size_t ThreadsNrOf_ = 0;
 
+	void RunRepeatedly(const char * name, int (*dacRun)(size_t threadsNrOf), void (*dacDestroy)(void));
+
 	enum {
 		CALLED_MatrixProd1,
 		CALLED_MatrixVecProd,
 		CALLED_VecMatrixProd,
+		CALLED_DenseLayer,
 		CALLED_TensorVecContr2,
 		CALLED_TensorVecContr1,
 		CALLED_TensorMatrixContr1,
@@ -58,6 +71,15 @@ private:
 		CALLED_TwoMatrixTrace,
 		CALLED_MatrixProdRight,
 		CALLED_MatrixProdLeft,
+		CALLED_MatrixDeltaSumProd,
+		CALLED_TensorDeltaContr,
+		CALLED_MatrixPlusDelta,
+		CALLED_MatrixChainVec,
+		CALLED_TensorChainVec,
+		CALLED_ShiftPower5,
+		CALLED_MatrixPowerTransposed3,
+		CALLED_MatrixDoubled,
+		CALLED_MatrixDoubledId,
 		CALLED_NrOf,
 	};
 
@@ -80,6 +80,56 @@ static void tensorPermute(const float * data, size_t size)
 	ModulePermutePt->TensorPermute(data, size);
 }
 
+static void tensorPermuteContracted(const float * data, size_t size)
+{
+	if(NULL == ModulePermutePt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModulePermutePt->TensorPermuteContracted(data, size);
+}
+
+static void projMatrixVector(const float * data, size_t size)
+{
+	if(NULL == ModulePermutePt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModulePermutePt->ProjMatrixVector(data, size);
+}
+
+static void diagonalContracted(const float * data, size_t size)
+{
+	if(NULL == ModulePermutePt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModulePermutePt->DiagonalContracted(data, size);
+}
+
+static void matrixTransposeTwice(const float * data, size_t size)
+{
+	if(NULL == ModulePermutePt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModulePermutePt->MatrixTransposeTwice(data, size);
+}
+
+static void tensorPermuteTwice(const float * data, size_t size)
+{
+	if(NULL == ModulePermutePt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModulePermutePt->TensorPermuteTwice(data, size);
+}
+
 void ModulePermute::TensorPermute(const float * data, size_t size)
 {
 	const float expected[] = {
@@ -177,6 +227,94 @@ void ModulePermute::DMatrixTransposeContracted(const float * data, size_t size)
 	called_[CALLED_DMatrixTransposeContracted] = true;
 }
 
+void ModulePermute::TensorPermuteContracted(const float * data, size_t size)
+{
+	const float expected[] = {30, 84, 144, 36, 93, 150, 42, 99, 156};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_TensorPermuteContracted] = true;
+}
+
+void ModulePermute::ProjMatrixVector(const float * data, size_t size)
+{
+	const float expected[] = {32, 50};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 2);
+	}
+
+	called_[CALLED_ProjMatrixVector] = true;
+}
+
+void ModulePermute::DiagonalContracted(const float * data, size_t size)
+{
+	const float expected[] = {38};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 1);
+	}
+
+	called_[CALLED_DiagonalContracted] = true;
+}
+
+void ModulePermute::MatrixTransposeTwice(const float * data, size_t size)
+{
+	const float expected[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_MatrixTransposeTwice] = true;
+}
+
+void ModulePermute::TensorPermuteTwice(const float * data, size_t size)
+{
+	const float expected[] = {
+			1, 10, 20, 2, 11, 21, 3, 12, 22,
+			4, 13, 23, 5, 14, 24, 6, 15, 25,
+			7, 16, 26, 8, 18, 27, 9, 19, 28};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 9);
+	}
+
+	called_[CALLED_TensorPermuteTwice] = true;
+}
+
 ModulePermute::ModulePermute() {
 	ModulePermutePt = this;
 
@@ -185,6 +323,11 @@ ModulePermute::ModulePermute() {
 	DacModulePermuteOutputCallbackdMatrixTransposeContracted_Register(&dMatrixTransposeContracted);
 	DacModulePermuteOutputCallbackprojVector_Register(&projVector);
 	DacModulePermuteOutputCallbackdProjVector_Register(&dProjVector);
+	DacModulePermuteOutputCallbacktensorPermuteContracted_Register(&tensorPermuteContracted);
+	DacModulePermuteOutputCallbackprojMatrixVector_Register(&projMatrixVector);
+	DacModulePermuteOutputCallbackdiagonalContracted_Register(&diagonalContracted);
+	DacModulePermuteOutputCallbackmatrixTransposeTwice_Register(&matrixTransposeTwice);
+	DacModulePermuteOutputCallbacktensorPermuteTwice_Register(&tensorPermuteTwice);
 }
 
 void ModulePermute::Execute(size_t threadsNrOf)
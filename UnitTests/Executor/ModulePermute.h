@@ -35,6 +35,11 @@ public:
 	void TensorPermute(const float * data, size_t size);
 	void ProjVector(const float * data, size_t size);
 	void DProjVector(const float * data, size_t size);
+	void TensorPermuteContracted(const float * data, size_t size);
+	void ProjMatrixVector(const float * data, size_t size);
+	void DiagonalContracted(const float * data, size_t size);
+	void MatrixTransposeTwice(const float * data, size_t size);
+	void TensorPermuteTwice(const float * data, size_t size);
 
 private:
 	size_t ThreadsNrOf_ = 0;
@@ -45,6 +50,11 @@ private:
 		CALLED_TensorPermute,
 		CALLED_ProjVector,
 		CALLED_DProjVector,
+		CALLED_TensorPermuteContracted,
+		CALLED_ProjMatrixVector,
+		CALLED_DiagonalContracted,
+		CALLED_MatrixTransposeTwice,
+		CALLED_TensorPermuteTwice,
 		CALLED_NrOf,
 	};
 
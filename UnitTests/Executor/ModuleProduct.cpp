@@ -190,6 +190,166 @@ static void dvectorSquaredBase(const float * data, size_t size)
 	ModuleProductPt->DvectorSquaredBase(data, size);
 }
 
+static void wideSum(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->WideSum(data, size);
+}
+
+static void matrixProduct(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->MatrixProduct(data, size);
+}
+
+static void matrixProductTransposed(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->MatrixProductTransposed(data, size);
+}
+
+static void matrixProductEpilogue(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->MatrixProductEpilogue(data, size);
+}
+
+static void matrixProductPermuted(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->MatrixProductPermuted(data, size);
+}
+
+static void sparseMatrixVector(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->SparseMatrixVector(data, size);
+}
+
+static void symmetricMatrixVector(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->SymmetricMatrixVector(data, size);
+}
+
+static void symmetricProduct(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->SymmetricProduct(data, size);
+}
+
+static void symmetricProductVector(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->SymmetricProductVector(data, size);
+}
+
+static void longVector(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->LongVector(data, size);
+}
+
+static void longVectorCubed(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->LongVectorCubed(data, size);
+}
+
+static void longVectorIsSmaller(const int32_t * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->LongVectorIsSmaller(data, size);
+}
+
+static void fusedChain(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->FusedChain(data, size);
+}
+
+static void fusedIsSmaller(const int32_t * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->FusedIsSmaller(data, size);
+}
+
+static void vectorSum(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->VectorSum(data, size);
+}
+
+static void vectorSumTimesOne(const float * data, size_t size)
+{
+	if(NULL == ModuleProductPt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleProductPt->VectorSumTimesOne(data, size);
+}
+
 void ModuleProduct::VectorSquared(const float * data, size_t size)
 {
 	const float expected[] = {1, 4, 9};
@@ -227,6 +387,315 @@ void ModuleProduct::DvectorSquaredBase(const float * data, size_t size)
 	called_[CALLED_DvectorSquaredBase] = true;
 }
 
+void ModuleProduct::WideSum(const float * data, size_t size)
+{
+	// vector1 * 42 * (1 + 2 + ... + 100)
+	const float expected[] = {212100, 424200, 636300};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_WideSum] = true;
+}
+
+void ModuleProduct::MatrixProduct(const float * data, size_t size)
+{
+	// Ones times a matrix with entries equal to their column index
+	float expected[64 * 64];
+	for(size_t index = 0; index < sizeof(expected) / sizeof(expected[0]); index++)
+	{
+		expected[index] = 64.f * (float) (index % 64);
+	}
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 64);
+	}
+
+	called_[CALLED_MatrixProduct] = true;
+}
+
+void ModuleProduct::MatrixProductTransposed(const float * data, size_t size)
+{
+	// Transposed column index matrix times ones
+	float expected[64 * 64];
+	for(size_t index = 0; index < sizeof(expected) / sizeof(expected[0]); index++)
+	{
+		expected[index] = 64.f * (float) (index / 64);
+	}
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 64);
+	}
+
+	called_[CALLED_MatrixProductTransposed] = true;
+}
+
+void ModuleProduct::MatrixProductEpilogue(const float * data, size_t size)
+{
+	// (Matrix product + column index) * 2
+	float expected[64 * 64];
+	for(size_t index = 0; index < sizeof(expected) / sizeof(expected[0]); index++)
+	{
+		expected[index] = 130.f * (float) (index % 64);
+	}
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 64);
+	}
+
+	called_[CALLED_MatrixProductEpilogue] = true;
+}
+
+void ModuleProduct::MatrixProductPermuted(const float * data, size_t size)
+{
+	// Transposed columns times columns
+	float expected[64 * 64];
+	for(size_t index = 0; index < sizeof(expected) / sizeof(expected[0]); index++)
+	{
+		expected[index] = 64.f * (float) (index / 64) * (float) (index % 64);
+	}
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 64);
+	}
+
+	called_[CALLED_MatrixProductPermuted] = true;
+}
+
+void ModuleProduct::SparseMatrixVector(const float * data, size_t size)
+{
+	// 2 * anti-diagonal (1, ..., 8) times (0, ..., 7)
+	const float expected[] = {14, 24, 30, 32, 30, 24, 14, 0};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 8);
+	}
+
+	called_[CALLED_SparseMatrixVector] = true;
+}
+
+void ModuleProduct::SymmetricMatrixVector(const float * data, size_t size)
+{
+	// Upper triangle (1, ..., 6) mirrored, times (1, 2, 3)
+	const float expected[] = {14, 25, 31};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_SymmetricMatrixVector] = true;
+}
+
+void ModuleProduct::SymmetricProduct(const float * data, size_t size)
+{
+	// Rows (1, 2), (3, 4), (5, 6) times their transpose
+	const float expected[] = {5, 11, 17, 11, 25, 39, 17, 39, 61};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_SymmetricProduct] = true;
+}
+
+void ModuleProduct::SymmetricProductVector(const float * data, size_t size)
+{
+	// 4 * rows times their transpose, times (1, 2, 3)
+	const float expected[] = {312, 712, 1112};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_SymmetricProductVector] = true;
+}
+
+void ModuleProduct::LongVector(const float * data, size_t size)
+{
+	// index^2 + 2 * index
+	float expected[37];
+	for(size_t index = 0; index < sizeof(expected) / sizeof(expected[0]); index++)
+	{
+		expected[index] = (float) (index * index + 2 * index);
+	}
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 37);
+	}
+
+	called_[CALLED_LongVector] = true;
+}
+
+void ModuleProduct::LongVectorCubed(const float * data, size_t size)
+{
+	float expected[37];
+	for(size_t index = 0; index < sizeof(expected) / sizeof(expected[0]); index++)
+	{
+		expected[index] = (float) (index * index * index);
+	}
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 37);
+	}
+
+	called_[CALLED_LongVectorCubed] = true;
+}
+
+void ModuleProduct::LongVectorIsSmaller(const int32_t * data, size_t size)
+{
+	const int32_t expected[] = {1};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result %i!\n", data[0]);
+	}
+
+	called_[CALLED_LongVectorIsSmaller] = true;
+}
+
+void ModuleProduct::FusedChain(const float * data, size_t size)
+{
+	// (index + index) * 2 + index
+	float expected[37];
+	for(size_t index = 0; index < sizeof(expected) / sizeof(expected[0]); index++)
+	{
+		expected[index] = (float) (5 * index);
+	}
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 37);
+	}
+
+	called_[CALLED_FusedChain] = true;
+}
+
+void ModuleProduct::FusedIsSmaller(const int32_t * data, size_t size)
+{
+	const int32_t expected[] = {1};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result %i!\n", data[0]);
+	}
+
+	called_[CALLED_FusedIsSmaller] = true;
+}
+
+void ModuleProduct::VectorSum(const float * data, size_t size)
+{
+	const float expected[] = {5, 7, 9};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_VectorSum] = true;
+}
+
+void ModuleProduct::VectorSumTimesOne(const float * data, size_t size)
+{
+	const float expected[] = {5, 7, 9};
+
+	if(sizeof(expected) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(expected), size);
+	}
+	else if(memcmp(data, expected, sizeof(expected)))
+	{
+		Error("Unexpected result!\n");
+		PrintMatrix(stderr, data, size, 3);
+	}
+
+	called_[CALLED_VectorSumTimesOne] = true;
+}
+
 void ModuleProduct::ScalarSquared(const float * data, size_t size)
 {
 	const float expected[] = {1764};
@@ -486,6 +955,22 @@ ModuleProduct::ModuleProduct() {
 	DacModuleProductOutputCallbackdScalarSquaredBase_Register(&dScalarSquaredBase);
 	DacModuleProductOutputCallbackvectorSquared_Register(&vectorSquared);
 	DacModuleProductOutputCallbackdvectorSquaredBase_Register(&dvectorSquaredBase);
+	DacModuleProductOutputCallbackwideSum_Register(&wideSum);
+	DacModuleProductOutputCallbackmatrixProduct_Register(&matrixProduct);
+	DacModuleProductOutputCallbackmatrixProductTransposed_Register(&matrixProductTransposed);
+	DacModuleProductOutputCallbackmatrixProductEpilogue_Register(&matrixProductEpilogue);
+	DacModuleProductOutputCallbackmatrixProductPermuted_Register(&matrixProductPermuted);
+	DacModuleProductOutputCallbacksparseMatrixVector_Register(&sparseMatrixVector);
+	DacModuleProductOutputCallbacksymmetricMatrixVector_Register(&symmetricMatrixVector);
+	DacModuleProductOutputCallbacksymmetricProduct_Register(&symmetricProduct);
+	DacModuleProductOutputCallbacksymmetricProductVector_Register(&symmetricProductVector);
+	DacModuleProductOutputCallbacklongVector_Register(&longVector);
+	DacModuleProductOutputCallbacklongVectorCubed_Register(&longVectorCubed);
+	DacModuleProductOutputCallbacklongVectorIsSmaller_Register(&longVectorIsSmaller);
+	DacModuleProductOutputCallbackfusedChain_Register(&fusedChain);
+	DacModuleProductOutputCallbackfusedIsSmaller_Register(&fusedIsSmaller);
+	DacModuleProductOutputCallbackvectorSum_Register(&vectorSum);
+	DacModuleProductOutputCallbackvectorSumTimesOne_Register(&vectorSumTimesOne);
 }
 
 void ModuleProduct::Execute(size_t threadsNrOf)
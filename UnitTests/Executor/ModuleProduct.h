@@ -47,6 +47,22 @@ public:
 	void DScalarSquaredBase(const float * data, size_t size);
 	void VectorSquared(const float * data, size_t size);
 	void DvectorSquaredBase(const float * data, size_t size);
+	void WideSum(const float * data, size_t size);
+	void MatrixProduct(const float * data, size_t size);
+	void MatrixProductTransposed(const float * data, size_t size);
+	void MatrixProductEpilogue(const float * data, size_t size);
+	void MatrixProductPermuted(const float * data, size_t size);
+	void SparseMatrixVector(const float * data, size_t size);
+	void SymmetricMatrixVector(const float * data, size_t size);
+	void SymmetricProduct(const float * data, size_t size);
+	void SymmetricProductVector(const float * data, size_t size);
+	void LongVector(const float * data, size_t size);
+	void LongVectorCubed(const float * data, size_t size);
+	void LongVectorIsSmaller(const int32_t * data, size_t size);
+	void FusedChain(const float * data, size_t size);
+	void FusedIsSmaller(const int32_t * data, size_t size);
+	void VectorSum(const float * data, size_t size);
+	void VectorSumTimesOne(const float * data, size_t size);
 
 private:
 	size_t ThreadsNrOf_ = 0;
@@ -68,6 +84,22 @@ private:
 		CALLED_DScalarSquaredBase,
 		CALLED_VectorSquared,
 		CALLED_DvectorSquaredBase,
+		CALLED_WideSum,
+		CALLED_MatrixProduct,
+		CALLED_MatrixProductTransposed,
+		CALLED_MatrixProductEpilogue,
+		CALLED_MatrixProductPermuted,
+		CALLED_SparseMatrixVector,
+		CALLED_SymmetricMatrixVector,
+		CALLED_SymmetricProduct,
+		CALLED_SymmetricProductVector,
+		CALLED_LongVector,
+		CALLED_LongVectorCubed,
+		CALLED_LongVectorIsSmaller,
+		CALLED_FusedChain,
+		CALLED_FusedIsSmaller,
+		CALLED_VectorSum,
+		CALLED_VectorSumTimesOne,
 		CALLED_NrOf,
 	};
 
@@ -0,0 +1,95 @@
+/*
+ * This file is part of
+ * Distributed Algebraic Computations (https://github.com/siquus/dac)
+ *
+ * GPL-3 (or later)
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "error_functions.h"
+
+#include "DacModuleWhile.h"
+#include "DacModuleWhileFolded.h"
+#include "DacModuleWhileStatic.h"
+
+#include "ModuleWhile.h"
+
+static ModuleWhile * ModuleWhilePt = nullptr;
+
+static void whileState(const float * data, size_t size)
+{
+	if(NULL == ModuleWhilePt)
+	{
+		fatal("Nullpointer!");
+	}
+
+	ModuleWhilePt->WhileState(data, size);
+}
+
+void ModuleWhile::WhileState(const float * data, size_t size)
+{
+	if(sizeof(whileState_) != size)
+	{
+		Error("Size Mismatch! %lu vs %lu\n", sizeof(whileState_), size);
+		return;
+	}
+
+	memcpy(whileState_, data, sizeof(whileState_));
+	whileStateCallsNrOf_++;
+}
+
+ModuleWhile::ModuleWhile() {
+	ModuleWhilePt = this;
+
+	DacModuleWhileOutputCallbackwhileState_Register(&whileState);
+	DacModuleWhileFoldedOutputCallbackwhileState_Register(&whileState);
+	DacModuleWhileStaticOutputCallbackwhileState_Register(&whileState);
+}
+
+void ModuleWhile::CheckWhileState(const char * name)
+{
+	// The state is incremented by (3, 1, 2) once per iteration
+	const float expected[] = {13, 6, 11};
+
+	if(4 != whileStateCallsNrOf_)
+	{
+		Error("%s: Unexpected number of iterations: %lu\n", name, whileStateCallsNrOf_);
+	}
+	else if(memcmp(whileState_, expected, sizeof(expected)))
+	{
+		Error("%s: Unexpected result!\n", name);
+		PrintMatrix(stderr, whileState_, sizeof(whileState_), 3);
+	}
+
+	whileStateCallsNrOf_ = 0;
+}
+
+void ModuleWhile::Execute(size_t threadsNrOf)
+{
+	ThreadsNrOf_ = threadsNrOf;
+
+	DacModuleWhileRun(ThreadsNrOf_);
+	CheckWhileState("ModuleWhile");
+
+	DacModuleWhileFoldedRun(ThreadsNrOf_);
+	CheckWhileState("ModuleWhileFolded");
+
+	DacModuleWhileStaticRun(ThreadsNrOf_);
+	CheckWhileState("ModuleWhileStatic");
+}
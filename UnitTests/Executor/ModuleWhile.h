@@ -0,0 +1,45 @@
+/*
+ * This file is part of
+ * Distributed Algebraic Computations (https://github.com/siquus/dac)
+ *
+ * GPL-3 (or later)
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MODULEWHILE_H_
+#define MODULEWHILE_H_
+
+#include "main.h"
+
+class ModuleWhile: public TestExecutor {
+public:
+	ModuleWhile();
+
+	void Execute(size_t threadsNrOf);
+
+	void WhileState(const float * data, size_t size);
+
+private:
+	size_t ThreadsNrOf_ = 0;
+
+	void CheckWhileState(const char * name);
+
+	size_t whileStateCallsNrOf_ = 0;
+	float whileState_[3] = {0};
+};
+
+#endif /* MODULEWHILE_H_ */
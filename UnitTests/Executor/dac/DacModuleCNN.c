@@ -0,0 +1,216 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <linux/types.h>
+#include <pthread.h>
+
+
+#include "error_functions.h"
+
+#include "InstructionsModuleCNN.h"
+
+#include "DacModuleCNN.h"
+
+
+DacModuleCNNOutputCallbackcc_t DacModuleCNNOutputCallbackcc = NULL;
+DacModuleCNNOutputCallbackccMaxPool_t DacModuleCNNOutputCallbackccMaxPool = NULL;
+DacModuleCNNOutputCallbackccMaxPool4_t DacModuleCNNOutputCallbackccMaxPool4 = NULL;
+DacModuleCNNOutputCallbackccMaxPool4Derivative_t DacModuleCNNOutputCallbackccMaxPool4Derivative = NULL;
+DacModuleCNNOutputCallbackccSparse_t DacModuleCNNOutputCallbackccSparse = NULL;
+DacModuleCNNOutputCallbackccBig_t DacModuleCNNOutputCallbackccBig = NULL;
+DacModuleCNNOutputCallbackccDoubled_t DacModuleCNNOutputCallbackccDoubled = NULL;
+DacModuleCNNOutputCallbackkernelSquaredDerivative_t DacModuleCNNOutputCallbackkernelSquaredDerivative = NULL;
+DacModuleCNNOutputCallbackvectorSplit_t DacModuleCNNOutputCallbackvectorSplit = NULL;
+DacModuleCNNInputCallbackvector_t DacModuleCNNInputCallbackvector = NULL;
+DacModuleCNNOutputCallbackvector21_t DacModuleCNNOutputCallbackvector21 = NULL;
+DacModuleCNNOutputCallbackvector42_t DacModuleCNNOutputCallbackvector42 = NULL;
+
+
+/* Exported Functions ******************************************************************************/
+void DacModuleCNNOutputCallbackcc_Register(DacModuleCNNOutputCallbackcc_t callback)
+{
+	 DacModuleCNNOutputCallbackcc = callback;
+}
+
+void DacModuleCNNOutputCallbackccMaxPool_Register(DacModuleCNNOutputCallbackccMaxPool_t callback)
+{
+	 DacModuleCNNOutputCallbackccMaxPool = callback;
+}
+
+void DacModuleCNNOutputCallbackccMaxPool4_Register(DacModuleCNNOutputCallbackccMaxPool4_t callback)
+{
+	 DacModuleCNNOutputCallbackccMaxPool4 = callback;
+}
+
+void DacModuleCNNOutputCallbackccMaxPool4Derivative_Register(DacModuleCNNOutputCallbackccMaxPool4Derivative_t callback)
+{
+	 DacModuleCNNOutputCallbackccMaxPool4Derivative = callback;
+}
+
+void DacModuleCNNOutputCallbackccSparse_Register(DacModuleCNNOutputCallbackccSparse_t callback)
+{
+	 DacModuleCNNOutputCallbackccSparse = callback;
+}
+
+void DacModuleCNNOutputCallbackccBig_Register(DacModuleCNNOutputCallbackccBig_t callback)
+{
+	 DacModuleCNNOutputCallbackccBig = callback;
+}
+
+void DacModuleCNNOutputCallbackccDoubled_Register(DacModuleCNNOutputCallbackccDoubled_t callback)
+{
+	 DacModuleCNNOutputCallbackccDoubled = callback;
+}
+
+void DacModuleCNNOutputCallbackkernelSquaredDerivative_Register(DacModuleCNNOutputCallbackkernelSquaredDerivative_t callback)
+{
+	 DacModuleCNNOutputCallbackkernelSquaredDerivative = callback;
+}
+
+void DacModuleCNNOutputCallbackvectorSplit_Register(DacModuleCNNOutputCallbackvectorSplit_t callback)
+{
+	 DacModuleCNNOutputCallbackvectorSplit = callback;
+}
+
+void DacModuleCNNInputCallbackvector_Register(DacModuleCNNInputCallbackvector_t callback)
+{
+	 DacModuleCNNInputCallbackvector = callback;
+}
+
+void DacModuleCNNOutputCallbackvector21_Register(DacModuleCNNOutputCallbackvector21_t callback)
+{
+	 DacModuleCNNOutputCallbackvector21 = callback;
+}
+
+void DacModuleCNNOutputCallbackvector42_Register(DacModuleCNNOutputCallbackvector42_t callback)
+{
+	 DacModuleCNNOutputCallbackvector42 = callback;
+}
+
+
+
+/* The main run routine ****************************************************************************/
+static void * instanceModuleCNN = NULL;
+static size_t threadsNrOfModuleCNN = 0;
+
+int DacModuleCNNCreate(size_t threadsNrOf)
+{
+	DacModuleCNNDestroy();
+
+	instanceModuleCNN = CreateThreads(threadsNrOf);
+	threadsNrOfModuleCNN = threadsNrOf;
+
+	return 0;
+}
+
+int DacModuleCNNRun(size_t threadsNrOf)
+{
+	if(NULL == DacModuleCNNOutputCallbackcc)
+	{
+		fatal("DacModuleCNNOutputCallbackcc == NULL");
+	}
+
+	if(NULL == DacModuleCNNOutputCallbackccMaxPool)
+	{
+		fatal("DacModuleCNNOutputCallbackccMaxPool == NULL");
+	}
+
+	if(NULL == DacModuleCNNOutputCallbackccMaxPool4)
+	{
+		fatal("DacModuleCNNOutputCallbackccMaxPool4 == NULL");
+	}
+
+	if(NULL == DacModuleCNNOutputCallbackccMaxPool4Derivative)
+	{
+		fatal("DacModuleCNNOutputCallbackccMaxPool4Derivative == NULL");
+	}
+
+	if(NULL == DacModuleCNNOutputCallbackccSparse)
+	{
+		fatal("DacModuleCNNOutputCallbackccSparse == NULL");
+	}
+
+	if(NULL == DacModuleCNNOutputCallbackccBig)
+	{
+		fatal("DacModuleCNNOutputCallbackccBig == NULL");
+	}
+
+	if(NULL == DacModuleCNNOutputCallbackccDoubled)
+	{
+		fatal("DacModuleCNNOutputCallbackccDoubled == NULL");
+	}
+
+	if(NULL == DacModuleCNNOutputCallbackkernelSquaredDerivative)
+	{
+		fatal("DacModuleCNNOutputCallbackkernelSquaredDerivative == NULL");
+	}
+
+	if(NULL == DacModuleCNNOutputCallbackvectorSplit)
+	{
+		fatal("DacModuleCNNOutputCallbackvectorSplit == NULL");
+	}
+
+	if(NULL == DacModuleCNNInputCallbackvector)
+	{
+		fatal("DacModuleCNNInputCallbackvector == NULL");
+	}
+
+	if(NULL == DacModuleCNNOutputCallbackvector21)
+	{
+		fatal("DacModuleCNNOutputCallbackvector21 == NULL");
+	}
+
+	if(NULL == DacModuleCNNOutputCallbackvector42)
+	{
+		fatal("DacModuleCNNOutputCallbackvector42 == NULL");
+	}
+
+	if((NULL == instanceModuleCNN) || (threadsNrOf != threadsNrOfModuleCNN))
+	{
+		DacModuleCNNCreate(threadsNrOf);
+	}
+
+	RunJobs(instanceModuleCNN, &jobPoolInitModuleCNN);
+
+	return 0;
+}
+
+void DacModuleCNNDestroy(void)
+{
+	if(NULL != instanceModuleCNN)
+	{
+		DestroyThreads(instanceModuleCNN);
+		instanceModuleCNN = NULL;
+		threadsNrOfModuleCNN = 0;
+	}
+}
+
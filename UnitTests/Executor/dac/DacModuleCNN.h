@@ -0,0 +1,68 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void (*DacModuleCNNOutputCallbackcc_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackcc_Register(DacModuleCNNOutputCallbackcc_t callback);
+typedef void (*DacModuleCNNOutputCallbackccMaxPool_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackccMaxPool_Register(DacModuleCNNOutputCallbackccMaxPool_t callback);
+typedef void (*DacModuleCNNOutputCallbackccMaxPool4_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackccMaxPool4_Register(DacModuleCNNOutputCallbackccMaxPool4_t callback);
+typedef void (*DacModuleCNNOutputCallbackccMaxPool4Derivative_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackccMaxPool4Derivative_Register(DacModuleCNNOutputCallbackccMaxPool4Derivative_t callback);
+typedef void (*DacModuleCNNOutputCallbackccSparse_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackccSparse_Register(DacModuleCNNOutputCallbackccSparse_t callback);
+typedef void (*DacModuleCNNOutputCallbackccBig_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackccBig_Register(DacModuleCNNOutputCallbackccBig_t callback);
+typedef void (*DacModuleCNNOutputCallbackccDoubled_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackccDoubled_Register(DacModuleCNNOutputCallbackccDoubled_t callback);
+typedef void (*DacModuleCNNOutputCallbackkernelSquaredDerivative_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackkernelSquaredDerivative_Register(DacModuleCNNOutputCallbackkernelSquaredDerivative_t callback);
+typedef void (*DacModuleCNNOutputCallbackvectorSplit_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackvectorSplit_Register(DacModuleCNNOutputCallbackvectorSplit_t callback);
+typedef const float * (*DacModuleCNNInputCallbackvector_t)(size_t identifier, size_t size);
+extern void DacModuleCNNInputCallbackvector_Register(DacModuleCNNInputCallbackvector_t callback);
+typedef void (*DacModuleCNNOutputCallbackvector21_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackvector21_Register(DacModuleCNNOutputCallbackvector21_t callback);
+typedef void (*DacModuleCNNOutputCallbackvector42_t)(const float* pt, size_t size);
+extern void DacModuleCNNOutputCallbackvector42_Register(DacModuleCNNOutputCallbackvector42_t callback);
+extern int DacModuleCNNCreate(size_t threadsNrOf);
+extern int DacModuleCNNRun(size_t threadsNrOf);
+extern void DacModuleCNNDestroy(void);
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
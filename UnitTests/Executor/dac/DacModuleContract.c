@@ -0,0 +1,315 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <linux/types.h>
+#include <pthread.h>
+
+
+#include "error_functions.h"
+
+#include "InstructionsModuleContract.h"
+
+#include "DacModuleContract.h"
+
+
+DacModuleContractOutputCallbackmatrixVecProd_t DacModuleContractOutputCallbackmatrixVecProd = NULL;
+DacModuleContractOutputCallbackvecMatrixProd_t DacModuleContractOutputCallbackvecMatrixProd = NULL;
+DacModuleContractOutputCallbackdenseLayer_t DacModuleContractOutputCallbackdenseLayer = NULL;
+DacModuleContractOutputCallbackmatrixProd1_t DacModuleContractOutputCallbackmatrixProd1 = NULL;
+DacModuleContractOutputCallbacktensorVecContr2_t DacModuleContractOutputCallbacktensorVecContr2 = NULL;
+DacModuleContractOutputCallbacktensorVecContr1_t DacModuleContractOutputCallbacktensorVecContr1 = NULL;
+DacModuleContractOutputCallbacktensorMatrixContr1_t DacModuleContractOutputCallbacktensorMatrixContr1 = NULL;
+DacModuleContractOutputCallbacktensorMatrixContr12_t DacModuleContractOutputCallbacktensorMatrixContr12 = NULL;
+DacModuleContractOutputCallbackmatrixIdProd_t DacModuleContractOutputCallbackmatrixIdProd = NULL;
+DacModuleContractOutputCallbacktwoMatrixTrace_t DacModuleContractOutputCallbacktwoMatrixTrace = NULL;
+DacModuleContractOutputCallbackmatrixDeltaSumProd_t DacModuleContractOutputCallbackmatrixDeltaSumProd = NULL;
+DacModuleContractOutputCallbacktensorDeltaContr_t DacModuleContractOutputCallbacktensorDeltaContr = NULL;
+DacModuleContractOutputCallbackmatrixPlusDelta_t DacModuleContractOutputCallbackmatrixPlusDelta = NULL;
+DacModuleContractOutputCallbackmatrixProdRight_t DacModuleContractOutputCallbackmatrixProdRight = NULL;
+DacModuleContractOutputCallbackmatrixProdLeft_t DacModuleContractOutputCallbackmatrixProdLeft = NULL;
+DacModuleContractOutputCallbackmatrixChainVec_t DacModuleContractOutputCallbackmatrixChainVec = NULL;
+DacModuleContractOutputCallbacktensorChainVec_t DacModuleContractOutputCallbacktensorChainVec = NULL;
+DacModuleContractOutputCallbackshiftPower5_t DacModuleContractOutputCallbackshiftPower5 = NULL;
+DacModuleContractOutputCallbackmatrixPowerTransposed3_t DacModuleContractOutputCallbackmatrixPowerTransposed3 = NULL;
+DacModuleContractOutputCallbackmatrixDoubled_t DacModuleContractOutputCallbackmatrixDoubled = NULL;
+DacModuleContractOutputCallbackmatrixDoubledId_t DacModuleContractOutputCallbackmatrixDoubledId = NULL;
+
+
+/* Exported Functions ******************************************************************************/
+void DacModuleContractOutputCallbackmatrixVecProd_Register(DacModuleContractOutputCallbackmatrixVecProd_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixVecProd = callback;
+}
+
+void DacModuleContractOutputCallbackvecMatrixProd_Register(DacModuleContractOutputCallbackvecMatrixProd_t callback)
+{
+	 DacModuleContractOutputCallbackvecMatrixProd = callback;
+}
+
+void DacModuleContractOutputCallbackdenseLayer_Register(DacModuleContractOutputCallbackdenseLayer_t callback)
+{
+	 DacModuleContractOutputCallbackdenseLayer = callback;
+}
+
+void DacModuleContractOutputCallbackmatrixProd1_Register(DacModuleContractOutputCallbackmatrixProd1_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixProd1 = callback;
+}
+
+void DacModuleContractOutputCallbacktensorVecContr2_Register(DacModuleContractOutputCallbacktensorVecContr2_t callback)
+{
+	 DacModuleContractOutputCallbacktensorVecContr2 = callback;
+}
+
+void DacModuleContractOutputCallbacktensorVecContr1_Register(DacModuleContractOutputCallbacktensorVecContr1_t callback)
+{
+	 DacModuleContractOutputCallbacktensorVecContr1 = callback;
+}
+
+void DacModuleContractOutputCallbacktensorMatrixContr1_Register(DacModuleContractOutputCallbacktensorMatrixContr1_t callback)
+{
+	 DacModuleContractOutputCallbacktensorMatrixContr1 = callback;
+}
+
+void DacModuleContractOutputCallbacktensorMatrixContr12_Register(DacModuleContractOutputCallbacktensorMatrixContr12_t callback)
+{
+	 DacModuleContractOutputCallbacktensorMatrixContr12 = callback;
+}
+
+void DacModuleContractOutputCallbackmatrixIdProd_Register(DacModuleContractOutputCallbackmatrixIdProd_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixIdProd = callback;
+}
+
+void DacModuleContractOutputCallbacktwoMatrixTrace_Register(DacModuleContractOutputCallbacktwoMatrixTrace_t callback)
+{
+	 DacModuleContractOutputCallbacktwoMatrixTrace = callback;
+}
+
+void DacModuleContractOutputCallbackmatrixDeltaSumProd_Register(DacModuleContractOutputCallbackmatrixDeltaSumProd_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixDeltaSumProd = callback;
+}
+
+void DacModuleContractOutputCallbacktensorDeltaContr_Register(DacModuleContractOutputCallbacktensorDeltaContr_t callback)
+{
+	 DacModuleContractOutputCallbacktensorDeltaContr = callback;
+}
+
+void DacModuleContractOutputCallbackmatrixPlusDelta_Register(DacModuleContractOutputCallbackmatrixPlusDelta_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixPlusDelta = callback;
+}
+
+void DacModuleContractOutputCallbackmatrixProdRight_Register(DacModuleContractOutputCallbackmatrixProdRight_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixProdRight = callback;
+}
+
+void DacModuleContractOutputCallbackmatrixProdLeft_Register(DacModuleContractOutputCallbackmatrixProdLeft_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixProdLeft = callback;
+}
+
+void DacModuleContractOutputCallbackmatrixChainVec_Register(DacModuleContractOutputCallbackmatrixChainVec_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixChainVec = callback;
+}
+
+void DacModuleContractOutputCallbacktensorChainVec_Register(DacModuleContractOutputCallbacktensorChainVec_t callback)
+{
+	 DacModuleContractOutputCallbacktensorChainVec = callback;
+}
+
+void DacModuleContractOutputCallbackshiftPower5_Register(DacModuleContractOutputCallbackshiftPower5_t callback)
+{
+	 DacModuleContractOutputCallbackshiftPower5 = callback;
+}
+
+void DacModuleContractOutputCallbackmatrixPowerTransposed3_Register(DacModuleContractOutputCallbackmatrixPowerTransposed3_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixPowerTransposed3 = callback;
+}
+
+void DacModuleContractOutputCallbackmatrixDoubled_Register(DacModuleContractOutputCallbackmatrixDoubled_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixDoubled = callback;
+}
+
+void DacModuleContractOutputCallbackmatrixDoubledId_Register(DacModuleContractOutputCallbackmatrixDoubledId_t callback)
+{
+	 DacModuleContractOutputCallbackmatrixDoubledId = callback;
+}
+
+
+
+/* The main run routine ****************************************************************************/
+static void * instanceModuleContract = NULL;
+static size_t threadsNrOfModuleContract = 0;
+
+int DacModuleContractCreate(size_t threadsNrOf)
+{
+	DacModuleContractDestroy();
+
+	instanceModuleContract = CreateThreads(threadsNrOf);
+	threadsNrOfModuleContract = threadsNrOf;
+
+	return 0;
+}
+
+int DacModuleContractRun(size_t threadsNrOf)
+{
+	if(NULL == DacModuleContractOutputCallbackmatrixVecProd)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixVecProd == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackvecMatrixProd)
+	{
+		fatal("DacModuleContractOutputCallbackvecMatrixProd == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackdenseLayer)
+	{
+		fatal("DacModuleContractOutputCallbackdenseLayer == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackmatrixProd1)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixProd1 == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbacktensorVecContr2)
+	{
+		fatal("DacModuleContractOutputCallbacktensorVecContr2 == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbacktensorVecContr1)
+	{
+		fatal("DacModuleContractOutputCallbacktensorVecContr1 == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbacktensorMatrixContr1)
+	{
+		fatal("DacModuleContractOutputCallbacktensorMatrixContr1 == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbacktensorMatrixContr12)
+	{
+		fatal("DacModuleContractOutputCallbacktensorMatrixContr12 == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackmatrixIdProd)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixIdProd == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbacktwoMatrixTrace)
+	{
+		fatal("DacModuleContractOutputCallbacktwoMatrixTrace == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackmatrixDeltaSumProd)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixDeltaSumProd == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbacktensorDeltaContr)
+	{
+		fatal("DacModuleContractOutputCallbacktensorDeltaContr == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackmatrixPlusDelta)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixPlusDelta == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackmatrixProdRight)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixProdRight == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackmatrixProdLeft)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixProdLeft == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackmatrixChainVec)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixChainVec == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbacktensorChainVec)
+	{
+		fatal("DacModuleContractOutputCallbacktensorChainVec == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackshiftPower5)
+	{
+		fatal("DacModuleContractOutputCallbackshiftPower5 == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackmatrixPowerTransposed3)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixPowerTransposed3 == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackmatrixDoubled)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixDoubled == NULL");
+	}
+
+	if(NULL == DacModuleContractOutputCallbackmatrixDoubledId)
+	{
+		fatal("DacModuleContractOutputCallbackmatrixDoubledId == NULL");
+	}
+
+	if((NULL == instanceModuleContract) || (threadsNrOf != threadsNrOfModuleContract))
+	{
+		DacModuleContractCreate(threadsNrOf);
+	}
+
+	RunJobs(instanceModuleContract, &jobPoolInitModuleContract);
+
+	return 0;
+}
+
+void DacModuleContractDestroy(void)
+{
+	if(NULL != instanceModuleContract)
+	{
+		DestroyThreads(instanceModuleContract);
+		instanceModuleContract = NULL;
+		threadsNrOfModuleContract = 0;
+	}
+}
+
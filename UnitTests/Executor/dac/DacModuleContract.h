@@ -0,0 +1,86 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void (*DacModuleContractOutputCallbackmatrixVecProd_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixVecProd_Register(DacModuleContractOutputCallbackmatrixVecProd_t callback);
+typedef void (*DacModuleContractOutputCallbackvecMatrixProd_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackvecMatrixProd_Register(DacModuleContractOutputCallbackvecMatrixProd_t callback);
+typedef void (*DacModuleContractOutputCallbackdenseLayer_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackdenseLayer_Register(DacModuleContractOutputCallbackdenseLayer_t callback);
+typedef void (*DacModuleContractOutputCallbackmatrixProd1_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixProd1_Register(DacModuleContractOutputCallbackmatrixProd1_t callback);
+typedef void (*DacModuleContractOutputCallbacktensorVecContr2_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbacktensorVecContr2_Register(DacModuleContractOutputCallbacktensorVecContr2_t callback);
+typedef void (*DacModuleContractOutputCallbacktensorVecContr1_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbacktensorVecContr1_Register(DacModuleContractOutputCallbacktensorVecContr1_t callback);
+typedef void (*DacModuleContractOutputCallbacktensorMatrixContr1_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbacktensorMatrixContr1_Register(DacModuleContractOutputCallbacktensorMatrixContr1_t callback);
+typedef void (*DacModuleContractOutputCallbacktensorMatrixContr12_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbacktensorMatrixContr12_Register(DacModuleContractOutputCallbacktensorMatrixContr12_t callback);
+typedef void (*DacModuleContractOutputCallbackmatrixIdProd_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixIdProd_Register(DacModuleContractOutputCallbackmatrixIdProd_t callback);
+typedef void (*DacModuleContractOutputCallbacktwoMatrixTrace_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbacktwoMatrixTrace_Register(DacModuleContractOutputCallbacktwoMatrixTrace_t callback);
+typedef void (*DacModuleContractOutputCallbackmatrixDeltaSumProd_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixDeltaSumProd_Register(DacModuleContractOutputCallbackmatrixDeltaSumProd_t callback);
+typedef void (*DacModuleContractOutputCallbacktensorDeltaContr_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbacktensorDeltaContr_Register(DacModuleContractOutputCallbacktensorDeltaContr_t callback);
+typedef void (*DacModuleContractOutputCallbackmatrixPlusDelta_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixPlusDelta_Register(DacModuleContractOutputCallbackmatrixPlusDelta_t callback);
+typedef void (*DacModuleContractOutputCallbackmatrixProdRight_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixProdRight_Register(DacModuleContractOutputCallbackmatrixProdRight_t callback);
+typedef void (*DacModuleContractOutputCallbackmatrixProdLeft_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixProdLeft_Register(DacModuleContractOutputCallbackmatrixProdLeft_t callback);
+typedef void (*DacModuleContractOutputCallbackmatrixChainVec_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixChainVec_Register(DacModuleContractOutputCallbackmatrixChainVec_t callback);
+typedef void (*DacModuleContractOutputCallbacktensorChainVec_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbacktensorChainVec_Register(DacModuleContractOutputCallbacktensorChainVec_t callback);
+typedef void (*DacModuleContractOutputCallbackshiftPower5_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackshiftPower5_Register(DacModuleContractOutputCallbackshiftPower5_t callback);
+typedef void (*DacModuleContractOutputCallbackmatrixPowerTransposed3_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixPowerTransposed3_Register(DacModuleContractOutputCallbackmatrixPowerTransposed3_t callback);
+typedef void (*DacModuleContractOutputCallbackmatrixDoubled_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixDoubled_Register(DacModuleContractOutputCallbackmatrixDoubled_t callback);
+typedef void (*DacModuleContractOutputCallbackmatrixDoubledId_t)(const float* pt, size_t size);
+extern void DacModuleContractOutputCallbackmatrixDoubledId_Register(DacModuleContractOutputCallbackmatrixDoubledId_t callback);
+extern int DacModuleContractCreate(size_t threadsNrOf);
+extern int DacModuleContractRun(size_t threadsNrOf);
+extern void DacModuleContractDestroy(void);
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
@@ -0,0 +1,316 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <linux/types.h>
+#include <pthread.h>
+
+
+#include "error_functions.h"
+
+#include "InstructionsModuleContractStatic.h"
+
+#include "DacModuleContractStatic.h"
+
+
+DacModuleContractStaticOutputCallbackmatrixVecProd_t DacModuleContractStaticOutputCallbackmatrixVecProd = NULL;
+DacModuleContractStaticOutputCallbackvecMatrixProd_t DacModuleContractStaticOutputCallbackvecMatrixProd = NULL;
+DacModuleContractStaticOutputCallbackdenseLayer_t DacModuleContractStaticOutputCallbackdenseLayer = NULL;
+DacModuleContractStaticOutputCallbackmatrixProd1_t DacModuleContractStaticOutputCallbackmatrixProd1 = NULL;
+DacModuleContractStaticOutputCallbacktensorVecContr2_t DacModuleContractStaticOutputCallbacktensorVecContr2 = NULL;
+DacModuleContractStaticOutputCallbacktensorVecContr1_t DacModuleContractStaticOutputCallbacktensorVecContr1 = NULL;
+DacModuleContractStaticOutputCallbacktensorMatrixContr1_t DacModuleContractStaticOutputCallbacktensorMatrixContr1 = NULL;
+DacModuleContractStaticOutputCallbacktensorMatrixContr12_t DacModuleContractStaticOutputCallbacktensorMatrixContr12 = NULL;
+DacModuleContractStaticOutputCallbackmatrixIdProd_t DacModuleContractStaticOutputCallbackmatrixIdProd = NULL;
+DacModuleContractStaticOutputCallbacktwoMatrixTrace_t DacModuleContractStaticOutputCallbacktwoMatrixTrace = NULL;
+DacModuleContractStaticOutputCallbackmatrixDeltaSumProd_t DacModuleContractStaticOutputCallbackmatrixDeltaSumProd = NULL;
+DacModuleContractStaticOutputCallbacktensorDeltaContr_t DacModuleContractStaticOutputCallbacktensorDeltaContr = NULL;
+DacModuleContractStaticOutputCallbackmatrixPlusDelta_t DacModuleContractStaticOutputCallbackmatrixPlusDelta = NULL;
+DacModuleContractStaticOutputCallbackmatrixProdRight_t DacModuleContractStaticOutputCallbackmatrixProdRight = NULL;
+DacModuleContractStaticOutputCallbackmatrixProdLeft_t DacModuleContractStaticOutputCallbackmatrixProdLeft = NULL;
+DacModuleContractStaticOutputCallbackmatrixChainVec_t DacModuleContractStaticOutputCallbackmatrixChainVec = NULL;
+DacModuleContractStaticOutputCallbacktensorChainVec_t DacModuleContractStaticOutputCallbacktensorChainVec = NULL;
+DacModuleContractStaticOutputCallbackshiftPower5_t DacModuleContractStaticOutputCallbackshiftPower5 = NULL;
+DacModuleContractStaticOutputCallbackmatrixPowerTransposed3_t DacModuleContractStaticOutputCallbackmatrixPowerTransposed3 = NULL;
+DacModuleContractStaticOutputCallbackmatrixDoubled_t DacModuleContractStaticOutputCallbackmatrixDoubled = NULL;
+DacModuleContractStaticOutputCallbackmatrixDoubledId_t DacModuleContractStaticOutputCallbackmatrixDoubledId = NULL;
+
+
+/* Exported Functions ******************************************************************************/
+void DacModuleContractStaticOutputCallbackmatrixVecProd_Register(DacModuleContractStaticOutputCallbackmatrixVecProd_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixVecProd = callback;
+}
+
+void DacModuleContractStaticOutputCallbackvecMatrixProd_Register(DacModuleContractStaticOutputCallbackvecMatrixProd_t callback)
+{
+	 DacModuleContractStaticOutputCallbackvecMatrixProd = callback;
+}
+
+void DacModuleContractStaticOutputCallbackdenseLayer_Register(DacModuleContractStaticOutputCallbackdenseLayer_t callback)
+{
+	 DacModuleContractStaticOutputCallbackdenseLayer = callback;
+}
+
+void DacModuleContractStaticOutputCallbackmatrixProd1_Register(DacModuleContractStaticOutputCallbackmatrixProd1_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixProd1 = callback;
+}
+
+void DacModuleContractStaticOutputCallbacktensorVecContr2_Register(DacModuleContractStaticOutputCallbacktensorVecContr2_t callback)
+{
+	 DacModuleContractStaticOutputCallbacktensorVecContr2 = callback;
+}
+
+void DacModuleContractStaticOutputCallbacktensorVecContr1_Register(DacModuleContractStaticOutputCallbacktensorVecContr1_t callback)
+{
+	 DacModuleContractStaticOutputCallbacktensorVecContr1 = callback;
+}
+
+void DacModuleContractStaticOutputCallbacktensorMatrixContr1_Register(DacModuleContractStaticOutputCallbacktensorMatrixContr1_t callback)
+{
+	 DacModuleContractStaticOutputCallbacktensorMatrixContr1 = callback;
+}
+
+void DacModuleContractStaticOutputCallbacktensorMatrixContr12_Register(DacModuleContractStaticOutputCallbacktensorMatrixContr12_t callback)
+{
+	 DacModuleContractStaticOutputCallbacktensorMatrixContr12 = callback;
+}
+
+void DacModuleContractStaticOutputCallbackmatrixIdProd_Register(DacModuleContractStaticOutputCallbackmatrixIdProd_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixIdProd = callback;
+}
+
+void DacModuleContractStaticOutputCallbacktwoMatrixTrace_Register(DacModuleContractStaticOutputCallbacktwoMatrixTrace_t callback)
+{
+	 DacModuleContractStaticOutputCallbacktwoMatrixTrace = callback;
+}
+
+void DacModuleContractStaticOutputCallbackmatrixDeltaSumProd_Register(DacModuleContractStaticOutputCallbackmatrixDeltaSumProd_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixDeltaSumProd = callback;
+}
+
+void DacModuleContractStaticOutputCallbacktensorDeltaContr_Register(DacModuleContractStaticOutputCallbacktensorDeltaContr_t callback)
+{
+	 DacModuleContractStaticOutputCallbacktensorDeltaContr = callback;
+}
+
+void DacModuleContractStaticOutputCallbackmatrixPlusDelta_Register(DacModuleContractStaticOutputCallbackmatrixPlusDelta_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixPlusDelta = callback;
+}
+
+void DacModuleContractStaticOutputCallbackmatrixProdRight_Register(DacModuleContractStaticOutputCallbackmatrixProdRight_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixProdRight = callback;
+}
+
+void DacModuleContractStaticOutputCallbackmatrixProdLeft_Register(DacModuleContractStaticOutputCallbackmatrixProdLeft_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixProdLeft = callback;
+}
+
+void DacModuleContractStaticOutputCallbackmatrixChainVec_Register(DacModuleContractStaticOutputCallbackmatrixChainVec_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixChainVec = callback;
+}
+
+void DacModuleContractStaticOutputCallbacktensorChainVec_Register(DacModuleContractStaticOutputCallbacktensorChainVec_t callback)
+{
+	 DacModuleContractStaticOutputCallbacktensorChainVec = callback;
+}
+
+void DacModuleContractStaticOutputCallbackshiftPower5_Register(DacModuleContractStaticOutputCallbackshiftPower5_t callback)
+{
+	 DacModuleContractStaticOutputCallbackshiftPower5 = callback;
+}
+
+void DacModuleContractStaticOutputCallbackmatrixPowerTransposed3_Register(DacModuleContractStaticOutputCallbackmatrixPowerTransposed3_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixPowerTransposed3 = callback;
+}
+
+void DacModuleContractStaticOutputCallbackmatrixDoubled_Register(DacModuleContractStaticOutputCallbackmatrixDoubled_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixDoubled = callback;
+}
+
+void DacModuleContractStaticOutputCallbackmatrixDoubledId_Register(DacModuleContractStaticOutputCallbackmatrixDoubledId_t callback)
+{
+	 DacModuleContractStaticOutputCallbackmatrixDoubledId = callback;
+}
+
+
+
+/* The main run routine ****************************************************************************/
+static void * instanceModuleContractStatic = NULL;
+static size_t threadsNrOfModuleContractStatic = 0;
+
+int DacModuleContractStaticCreate(size_t threadsNrOf __attribute__((unused)))
+{
+	DacModuleContractStaticDestroy();
+
+	instanceModuleContractStatic = CreateThreads(3);
+	threadsNrOfModuleContractStatic = 3;
+
+	return 0;
+}
+
+int DacModuleContractStaticRun(size_t threadsNrOf __attribute__((unused)))
+{
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixVecProd)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixVecProd == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackvecMatrixProd)
+	{
+		fatal("DacModuleContractStaticOutputCallbackvecMatrixProd == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackdenseLayer)
+	{
+		fatal("DacModuleContractStaticOutputCallbackdenseLayer == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixProd1)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixProd1 == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbacktensorVecContr2)
+	{
+		fatal("DacModuleContractStaticOutputCallbacktensorVecContr2 == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbacktensorVecContr1)
+	{
+		fatal("DacModuleContractStaticOutputCallbacktensorVecContr1 == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbacktensorMatrixContr1)
+	{
+		fatal("DacModuleContractStaticOutputCallbacktensorMatrixContr1 == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbacktensorMatrixContr12)
+	{
+		fatal("DacModuleContractStaticOutputCallbacktensorMatrixContr12 == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixIdProd)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixIdProd == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbacktwoMatrixTrace)
+	{
+		fatal("DacModuleContractStaticOutputCallbacktwoMatrixTrace == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixDeltaSumProd)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixDeltaSumProd == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbacktensorDeltaContr)
+	{
+		fatal("DacModuleContractStaticOutputCallbacktensorDeltaContr == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixPlusDelta)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixPlusDelta == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixProdRight)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixProdRight == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixProdLeft)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixProdLeft == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixChainVec)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixChainVec == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbacktensorChainVec)
+	{
+		fatal("DacModuleContractStaticOutputCallbacktensorChainVec == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackshiftPower5)
+	{
+		fatal("DacModuleContractStaticOutputCallbackshiftPower5 == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixPowerTransposed3)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixPowerTransposed3 == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixDoubled)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixDoubled == NULL");
+	}
+
+	if(NULL == DacModuleContractStaticOutputCallbackmatrixDoubledId)
+	{
+		fatal("DacModuleContractStaticOutputCallbackmatrixDoubledId == NULL");
+	}
+
+	if((NULL == instanceModuleContractStatic) || (3 != threadsNrOfModuleContractStatic))
+	{
+		DacModuleContractStaticCreate(3);
+	}
+
+	InstructionsModuleContractStaticResetStatic();
+	RunJobs(instanceModuleContractStatic, &jobPoolInitModuleContractStatic);
+
+	return 0;
+}
+
+void DacModuleContractStaticDestroy(void)
+{
+	if(NULL != instanceModuleContractStatic)
+	{
+		DestroyThreads(instanceModuleContractStatic);
+		instanceModuleContractStatic = NULL;
+		threadsNrOfModuleContractStatic = 0;
+	}
+}
+
@@ -0,0 +1,86 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void (*DacModuleContractStaticOutputCallbackmatrixVecProd_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixVecProd_Register(DacModuleContractStaticOutputCallbackmatrixVecProd_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackvecMatrixProd_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackvecMatrixProd_Register(DacModuleContractStaticOutputCallbackvecMatrixProd_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackdenseLayer_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackdenseLayer_Register(DacModuleContractStaticOutputCallbackdenseLayer_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackmatrixProd1_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixProd1_Register(DacModuleContractStaticOutputCallbackmatrixProd1_t callback);
+typedef void (*DacModuleContractStaticOutputCallbacktensorVecContr2_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbacktensorVecContr2_Register(DacModuleContractStaticOutputCallbacktensorVecContr2_t callback);
+typedef void (*DacModuleContractStaticOutputCallbacktensorVecContr1_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbacktensorVecContr1_Register(DacModuleContractStaticOutputCallbacktensorVecContr1_t callback);
+typedef void (*DacModuleContractStaticOutputCallbacktensorMatrixContr1_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbacktensorMatrixContr1_Register(DacModuleContractStaticOutputCallbacktensorMatrixContr1_t callback);
+typedef void (*DacModuleContractStaticOutputCallbacktensorMatrixContr12_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbacktensorMatrixContr12_Register(DacModuleContractStaticOutputCallbacktensorMatrixContr12_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackmatrixIdProd_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixIdProd_Register(DacModuleContractStaticOutputCallbackmatrixIdProd_t callback);
+typedef void (*DacModuleContractStaticOutputCallbacktwoMatrixTrace_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbacktwoMatrixTrace_Register(DacModuleContractStaticOutputCallbacktwoMatrixTrace_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackmatrixDeltaSumProd_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixDeltaSumProd_Register(DacModuleContractStaticOutputCallbackmatrixDeltaSumProd_t callback);
+typedef void (*DacModuleContractStaticOutputCallbacktensorDeltaContr_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbacktensorDeltaContr_Register(DacModuleContractStaticOutputCallbacktensorDeltaContr_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackmatrixPlusDelta_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixPlusDelta_Register(DacModuleContractStaticOutputCallbackmatrixPlusDelta_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackmatrixProdRight_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixProdRight_Register(DacModuleContractStaticOutputCallbackmatrixProdRight_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackmatrixProdLeft_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixProdLeft_Register(DacModuleContractStaticOutputCallbackmatrixProdLeft_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackmatrixChainVec_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixChainVec_Register(DacModuleContractStaticOutputCallbackmatrixChainVec_t callback);
+typedef void (*DacModuleContractStaticOutputCallbacktensorChainVec_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbacktensorChainVec_Register(DacModuleContractStaticOutputCallbacktensorChainVec_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackshiftPower5_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackshiftPower5_Register(DacModuleContractStaticOutputCallbackshiftPower5_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackmatrixPowerTransposed3_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixPowerTransposed3_Register(DacModuleContractStaticOutputCallbackmatrixPowerTransposed3_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackmatrixDoubled_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixDoubled_Register(DacModuleContractStaticOutputCallbackmatrixDoubled_t callback);
+typedef void (*DacModuleContractStaticOutputCallbackmatrixDoubledId_t)(const float* pt, size_t size);
+extern void DacModuleContractStaticOutputCallbackmatrixDoubledId_Register(DacModuleContractStaticOutputCallbackmatrixDoubledId_t callback);
+extern int DacModuleContractStaticCreate(size_t threadsNrOf);
+extern int DacModuleContractStaticRun(size_t threadsNrOf);
+extern void DacModuleContractStaticDestroy(void);
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
@@ -0,0 +1,180 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <linux/types.h>
+#include <pthread.h>
+
+
+#include "error_functions.h"
+
+#include "InstructionsModulePermute.h"
+
+#include "DacModulePermute.h"
+
+
+DacModulePermuteOutputCallbackmatrixTranspose_t DacModulePermuteOutputCallbackmatrixTranspose = NULL;
+DacModulePermuteOutputCallbacktensorPermute_t DacModulePermuteOutputCallbacktensorPermute = NULL;
+DacModulePermuteOutputCallbackdMatrixTransposeContracted_t DacModulePermuteOutputCallbackdMatrixTransposeContracted = NULL;
+DacModulePermuteOutputCallbackprojVector_t DacModulePermuteOutputCallbackprojVector = NULL;
+DacModulePermuteOutputCallbackdProjVector_t DacModulePermuteOutputCallbackdProjVector = NULL;
+DacModulePermuteOutputCallbacktensorPermuteContracted_t DacModulePermuteOutputCallbacktensorPermuteContracted = NULL;
+DacModulePermuteOutputCallbackprojMatrixVector_t DacModulePermuteOutputCallbackprojMatrixVector = NULL;
+DacModulePermuteOutputCallbackdiagonalContracted_t DacModulePermuteOutputCallbackdiagonalContracted = NULL;
+DacModulePermuteOutputCallbackmatrixTransposeTwice_t DacModulePermuteOutputCallbackmatrixTransposeTwice = NULL;
+DacModulePermuteOutputCallbacktensorPermuteTwice_t DacModulePermuteOutputCallbacktensorPermuteTwice = NULL;
+
+
+/* Exported Functions ******************************************************************************/
+void DacModulePermuteOutputCallbackmatrixTranspose_Register(DacModulePermuteOutputCallbackmatrixTranspose_t callback)
+{
+	 DacModulePermuteOutputCallbackmatrixTranspose = callback;
+}
+
+void DacModulePermuteOutputCallbacktensorPermute_Register(DacModulePermuteOutputCallbacktensorPermute_t callback)
+{
+	 DacModulePermuteOutputCallbacktensorPermute = callback;
+}
+
+void DacModulePermuteOutputCallbackdMatrixTransposeContracted_Register(DacModulePermuteOutputCallbackdMatrixTransposeContracted_t callback)
+{
+	 DacModulePermuteOutputCallbackdMatrixTransposeContracted = callback;
+}
+
+void DacModulePermuteOutputCallbackprojVector_Register(DacModulePermuteOutputCallbackprojVector_t callback)
+{
+	 DacModulePermuteOutputCallbackprojVector = callback;
+}
+
+void DacModulePermuteOutputCallbackdProjVector_Register(DacModulePermuteOutputCallbackdProjVector_t callback)
+{
+	 DacModulePermuteOutputCallbackdProjVector = callback;
+}
+
+void DacModulePermuteOutputCallbacktensorPermuteContracted_Register(DacModulePermuteOutputCallbacktensorPermuteContracted_t callback)
+{
+	 DacModulePermuteOutputCallbacktensorPermuteContracted = callback;
+}
+
+void DacModulePermuteOutputCallbackprojMatrixVector_Register(DacModulePermuteOutputCallbackprojMatrixVector_t callback)
+{
+	 DacModulePermuteOutputCallbackprojMatrixVector = callback;
+}
+
+void DacModulePermuteOutputCallbackdiagonalContracted_Register(DacModulePermuteOutputCallbackdiagonalContracted_t callback)
+{
+	 DacModulePermuteOutputCallbackdiagonalContracted = callback;
+}
+
+void DacModulePermuteOutputCallbackmatrixTransposeTwice_Register(DacModulePermuteOutputCallbackmatrixTransposeTwice_t callback)
+{
+	 DacModulePermuteOutputCallbackmatrixTransposeTwice = callback;
+}
+
+void DacModulePermuteOutputCallbacktensorPermuteTwice_Register(DacModulePermuteOutputCallbacktensorPermuteTwice_t callback)
+{
+	 DacModulePermuteOutputCallbacktensorPermuteTwice = callback;
+}
+
+
+
+/* The main run routine ****************************************************************************/
+int DacModulePermuteRunSequential(void)
+{
+	if(NULL == DacModulePermuteOutputCallbackmatrixTranspose)
+	{
+		fatal("DacModulePermuteOutputCallbackmatrixTranspose == NULL");
+	}
+
+	if(NULL == DacModulePermuteOutputCallbacktensorPermute)
+	{
+		fatal("DacModulePermuteOutputCallbacktensorPermute == NULL");
+	}
+
+	if(NULL == DacModulePermuteOutputCallbackdMatrixTransposeContracted)
+	{
+		fatal("DacModulePermuteOutputCallbackdMatrixTransposeContracted == NULL");
+	}
+
+	if(NULL == DacModulePermuteOutputCallbackprojVector)
+	{
+		fatal("DacModulePermuteOutputCallbackprojVector == NULL");
+	}
+
+	if(NULL == DacModulePermuteOutputCallbackdProjVector)
+	{
+		fatal("DacModulePermuteOutputCallbackdProjVector == NULL");
+	}
+
+	if(NULL == DacModulePermuteOutputCallbacktensorPermuteContracted)
+	{
+		fatal("DacModulePermuteOutputCallbacktensorPermuteContracted == NULL");
+	}
+
+	if(NULL == DacModulePermuteOutputCallbackprojMatrixVector)
+	{
+		fatal("DacModulePermuteOutputCallbackprojMatrixVector == NULL");
+	}
+
+	if(NULL == DacModulePermuteOutputCallbackdiagonalContracted)
+	{
+		fatal("DacModulePermuteOutputCallbackdiagonalContracted == NULL");
+	}
+
+	if(NULL == DacModulePermuteOutputCallbackmatrixTransposeTwice)
+	{
+		fatal("DacModulePermuteOutputCallbackmatrixTransposeTwice == NULL");
+	}
+
+	if(NULL == DacModulePermuteOutputCallbacktensorPermuteTwice)
+	{
+		fatal("DacModulePermuteOutputCallbacktensorPermuteTwice == NULL");
+	}
+
+	InstructionsModulePermuteRunSequential();
+
+	return 0;
+}
+
+int DacModulePermuteCreate(size_t threadsNrOf __attribute__((unused)))
+{
+	return 0;
+}
+
+int DacModulePermuteRun(size_t threadsNrOf __attribute__((unused)))
+{
+	return DacModulePermuteRunSequential();
+}
+
+void DacModulePermuteDestroy(void)
+{
+}
+
@@ -0,0 +1,65 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void (*DacModulePermuteOutputCallbackmatrixTranspose_t)(const float* pt, size_t size);
+extern void DacModulePermuteOutputCallbackmatrixTranspose_Register(DacModulePermuteOutputCallbackmatrixTranspose_t callback);
+typedef void (*DacModulePermuteOutputCallbacktensorPermute_t)(const float* pt, size_t size);
+extern void DacModulePermuteOutputCallbacktensorPermute_Register(DacModulePermuteOutputCallbacktensorPermute_t callback);
+typedef void (*DacModulePermuteOutputCallbackdMatrixTransposeContracted_t)(const float* pt, size_t size);
+extern void DacModulePermuteOutputCallbackdMatrixTransposeContracted_Register(DacModulePermuteOutputCallbackdMatrixTransposeContracted_t callback);
+typedef void (*DacModulePermuteOutputCallbackprojVector_t)(const float* pt, size_t size);
+extern void DacModulePermuteOutputCallbackprojVector_Register(DacModulePermuteOutputCallbackprojVector_t callback);
+typedef void (*DacModulePermuteOutputCallbackdProjVector_t)(const float* pt, size_t size);
+extern void DacModulePermuteOutputCallbackdProjVector_Register(DacModulePermuteOutputCallbackdProjVector_t callback);
+typedef void (*DacModulePermuteOutputCallbacktensorPermuteContracted_t)(const float* pt, size_t size);
+extern void DacModulePermuteOutputCallbacktensorPermuteContracted_Register(DacModulePermuteOutputCallbacktensorPermuteContracted_t callback);
+typedef void (*DacModulePermuteOutputCallbackprojMatrixVector_t)(const float* pt, size_t size);
+extern void DacModulePermuteOutputCallbackprojMatrixVector_Register(DacModulePermuteOutputCallbackprojMatrixVector_t callback);
+typedef void (*DacModulePermuteOutputCallbackdiagonalContracted_t)(const float* pt, size_t size);
+extern void DacModulePermuteOutputCallbackdiagonalContracted_Register(DacModulePermuteOutputCallbackdiagonalContracted_t callback);
+typedef void (*DacModulePermuteOutputCallbackmatrixTransposeTwice_t)(const float* pt, size_t size);
+extern void DacModulePermuteOutputCallbackmatrixTransposeTwice_Register(DacModulePermuteOutputCallbackmatrixTransposeTwice_t callback);
+typedef void (*DacModulePermuteOutputCallbacktensorPermuteTwice_t)(const float* pt, size_t size);
+extern void DacModulePermuteOutputCallbacktensorPermuteTwice_Register(DacModulePermuteOutputCallbacktensorPermuteTwice_t callback);
+extern int DacModulePermuteRunSequential(void);
+extern int DacModulePermuteCreate(size_t threadsNrOf);
+extern int DacModulePermuteRun(size_t threadsNrOf);
+extern void DacModulePermuteDestroy(void);
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
@@ -0,0 +1,436 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <linux/types.h>
+#include <pthread.h>
+
+
+#include "error_functions.h"
+
+#include "InstructionsModuleProduct.h"
+
+#include "DacModuleProduct.h"
+
+
+DacModuleProductOutputCallbackscalarScalarDiv_t DacModuleProductOutputCallbackscalarScalarDiv = NULL;
+DacModuleProductOutputCallbackdScalarScalarDivLeft_t DacModuleProductOutputCallbackdScalarScalarDivLeft = NULL;
+DacModuleProductOutputCallbackdScalarScalarDivRight_t DacModuleProductOutputCallbackdScalarScalarDivRight = NULL;
+DacModuleProductOutputCallbackscalarVecProd_t DacModuleProductOutputCallbackscalarVecProd = NULL;
+DacModuleProductOutputCallbackvecScalarProd_t DacModuleProductOutputCallbackvecScalarProd = NULL;
+DacModuleProductOutputCallbackvecVecProd_t DacModuleProductOutputCallbackvecVecProd = NULL;
+DacModuleProductOutputCallbackvecKronProd_t DacModuleProductOutputCallbackvecKronProd = NULL;
+DacModuleProductOutputCallbackkronVecProd_t DacModuleProductOutputCallbackkronVecProd = NULL;
+DacModuleProductOutputCallbackdVecScalarProdLeft_t DacModuleProductOutputCallbackdVecScalarProdLeft = NULL;
+DacModuleProductOutputCallbackdVecScalarProdRight_t DacModuleProductOutputCallbackdVecScalarProdRight = NULL;
+DacModuleProductOutputCallbackdVecVecProdLeft_t DacModuleProductOutputCallbackdVecVecProdLeft = NULL;
+DacModuleProductOutputCallbackdVecVecProdRight_t DacModuleProductOutputCallbackdVecVecProdRight = NULL;
+DacModuleProductOutputCallbackscalarSquared_t DacModuleProductOutputCallbackscalarSquared = NULL;
+DacModuleProductOutputCallbackdScalarSquaredBase_t DacModuleProductOutputCallbackdScalarSquaredBase = NULL;
+DacModuleProductOutputCallbackvectorSquared_t DacModuleProductOutputCallbackvectorSquared = NULL;
+DacModuleProductOutputCallbackdvectorSquaredBase_t DacModuleProductOutputCallbackdvectorSquaredBase = NULL;
+DacModuleProductOutputCallbackwideSum_t DacModuleProductOutputCallbackwideSum = NULL;
+DacModuleProductOutputCallbackmatrixProduct_t DacModuleProductOutputCallbackmatrixProduct = NULL;
+DacModuleProductOutputCallbackmatrixProductTransposed_t DacModuleProductOutputCallbackmatrixProductTransposed = NULL;
+DacModuleProductOutputCallbackmatrixProductEpilogue_t DacModuleProductOutputCallbackmatrixProductEpilogue = NULL;
+DacModuleProductOutputCallbackmatrixProductPermuted_t DacModuleProductOutputCallbackmatrixProductPermuted = NULL;
+DacModuleProductOutputCallbacksparseMatrixVector_t DacModuleProductOutputCallbacksparseMatrixVector = NULL;
+DacModuleProductOutputCallbacksymmetricMatrixVector_t DacModuleProductOutputCallbacksymmetricMatrixVector = NULL;
+DacModuleProductOutputCallbacksymmetricProduct_t DacModuleProductOutputCallbacksymmetricProduct = NULL;
+DacModuleProductOutputCallbacksymmetricProductVector_t DacModuleProductOutputCallbacksymmetricProductVector = NULL;
+DacModuleProductOutputCallbacklongVector_t DacModuleProductOutputCallbacklongVector = NULL;
+DacModuleProductOutputCallbacklongVectorCubed_t DacModuleProductOutputCallbacklongVectorCubed = NULL;
+DacModuleProductOutputCallbacklongVectorIsSmaller_t DacModuleProductOutputCallbacklongVectorIsSmaller = NULL;
+DacModuleProductOutputCallbackfusedChain_t DacModuleProductOutputCallbackfusedChain = NULL;
+DacModuleProductOutputCallbackfusedIsSmaller_t DacModuleProductOutputCallbackfusedIsSmaller = NULL;
+DacModuleProductOutputCallbackvectorSum_t DacModuleProductOutputCallbackvectorSum = NULL;
+DacModuleProductOutputCallbackvectorSumTimesOne_t DacModuleProductOutputCallbackvectorSumTimesOne = NULL;
+
+
+/* Exported Functions ******************************************************************************/
+void DacModuleProductOutputCallbackscalarScalarDiv_Register(DacModuleProductOutputCallbackscalarScalarDiv_t callback)
+{
+	 DacModuleProductOutputCallbackscalarScalarDiv = callback;
+}
+
+void DacModuleProductOutputCallbackdScalarScalarDivLeft_Register(DacModuleProductOutputCallbackdScalarScalarDivLeft_t callback)
+{
+	 DacModuleProductOutputCallbackdScalarScalarDivLeft = callback;
+}
+
+void DacModuleProductOutputCallbackdScalarScalarDivRight_Register(DacModuleProductOutputCallbackdScalarScalarDivRight_t callback)
+{
+	 DacModuleProductOutputCallbackdScalarScalarDivRight = callback;
+}
+
+void DacModuleProductOutputCallbackscalarVecProd_Register(DacModuleProductOutputCallbackscalarVecProd_t callback)
+{
+	 DacModuleProductOutputCallbackscalarVecProd = callback;
+}
+
+void DacModuleProductOutputCallbackvecScalarProd_Register(DacModuleProductOutputCallbackvecScalarProd_t callback)
+{
+	 DacModuleProductOutputCallbackvecScalarProd = callback;
+}
+
+void DacModuleProductOutputCallbackvecVecProd_Register(DacModuleProductOutputCallbackvecVecProd_t callback)
+{
+	 DacModuleProductOutputCallbackvecVecProd = callback;
+}
+
+void DacModuleProductOutputCallbackvecKronProd_Register(DacModuleProductOutputCallbackvecKronProd_t callback)
+{
+	 DacModuleProductOutputCallbackvecKronProd = callback;
+}
+
+void DacModuleProductOutputCallbackkronVecProd_Register(DacModuleProductOutputCallbackkronVecProd_t callback)
+{
+	 DacModuleProductOutputCallbackkronVecProd = callback;
+}
+
+void DacModuleProductOutputCallbackdVecScalarProdLeft_Register(DacModuleProductOutputCallbackdVecScalarProdLeft_t callback)
+{
+	 DacModuleProductOutputCallbackdVecScalarProdLeft = callback;
+}
+
+void DacModuleProductOutputCallbackdVecScalarProdRight_Register(DacModuleProductOutputCallbackdVecScalarProdRight_t callback)
+{
+	 DacModuleProductOutputCallbackdVecScalarProdRight = callback;
+}
+
+void DacModuleProductOutputCallbackdVecVecProdLeft_Register(DacModuleProductOutputCallbackdVecVecProdLeft_t callback)
+{
+	 DacModuleProductOutputCallbackdVecVecProdLeft = callback;
+}
+
+void DacModuleProductOutputCallbackdVecVecProdRight_Register(DacModuleProductOutputCallbackdVecVecProdRight_t callback)
+{
+	 DacModuleProductOutputCallbackdVecVecProdRight = callback;
+}
+
+void DacModuleProductOutputCallbackscalarSquared_Register(DacModuleProductOutputCallbackscalarSquared_t callback)
+{
+	 DacModuleProductOutputCallbackscalarSquared = callback;
+}
+
+void DacModuleProductOutputCallbackdScalarSquaredBase_Register(DacModuleProductOutputCallbackdScalarSquaredBase_t callback)
+{
+	 DacModuleProductOutputCallbackdScalarSquaredBase = callback;
+}
+
+void DacModuleProductOutputCallbackvectorSquared_Register(DacModuleProductOutputCallbackvectorSquared_t callback)
+{
+	 DacModuleProductOutputCallbackvectorSquared = callback;
+}
+
+void DacModuleProductOutputCallbackdvectorSquaredBase_Register(DacModuleProductOutputCallbackdvectorSquaredBase_t callback)
+{
+	 DacModuleProductOutputCallbackdvectorSquaredBase = callback;
+}
+
+void DacModuleProductOutputCallbackwideSum_Register(DacModuleProductOutputCallbackwideSum_t callback)
+{
+	 DacModuleProductOutputCallbackwideSum = callback;
+}
+
+void DacModuleProductOutputCallbackmatrixProduct_Register(DacModuleProductOutputCallbackmatrixProduct_t callback)
+{
+	 DacModuleProductOutputCallbackmatrixProduct = callback;
+}
+
+void DacModuleProductOutputCallbackmatrixProductTransposed_Register(DacModuleProductOutputCallbackmatrixProductTransposed_t callback)
+{
+	 DacModuleProductOutputCallbackmatrixProductTransposed = callback;
+}
+
+void DacModuleProductOutputCallbackmatrixProductEpilogue_Register(DacModuleProductOutputCallbackmatrixProductEpilogue_t callback)
+{
+	 DacModuleProductOutputCallbackmatrixProductEpilogue = callback;
+}
+
+void DacModuleProductOutputCallbackmatrixProductPermuted_Register(DacModuleProductOutputCallbackmatrixProductPermuted_t callback)
+{
+	 DacModuleProductOutputCallbackmatrixProductPermuted = callback;
+}
+
+void DacModuleProductOutputCallbacksparseMatrixVector_Register(DacModuleProductOutputCallbacksparseMatrixVector_t callback)
+{
+	 DacModuleProductOutputCallbacksparseMatrixVector = callback;
+}
+
+void DacModuleProductOutputCallbacksymmetricMatrixVector_Register(DacModuleProductOutputCallbacksymmetricMatrixVector_t callback)
+{
+	 DacModuleProductOutputCallbacksymmetricMatrixVector = callback;
+}
+
+void DacModuleProductOutputCallbacksymmetricProduct_Register(DacModuleProductOutputCallbacksymmetricProduct_t callback)
+{
+	 DacModuleProductOutputCallbacksymmetricProduct = callback;
+}
+
+void DacModuleProductOutputCallbacksymmetricProductVector_Register(DacModuleProductOutputCallbacksymmetricProductVector_t callback)
+{
+	 DacModuleProductOutputCallbacksymmetricProductVector = callback;
+}
+
+void DacModuleProductOutputCallbacklongVector_Register(DacModuleProductOutputCallbacklongVector_t callback)
+{
+	 DacModuleProductOutputCallbacklongVector = callback;
+}
+
+void DacModuleProductOutputCallbacklongVectorCubed_Register(DacModuleProductOutputCallbacklongVectorCubed_t callback)
+{
+	 DacModuleProductOutputCallbacklongVectorCubed = callback;
+}
+
+void DacModuleProductOutputCallbacklongVectorIsSmaller_Register(DacModuleProductOutputCallbacklongVectorIsSmaller_t callback)
+{
+	 DacModuleProductOutputCallbacklongVectorIsSmaller = callback;
+}
+
+void DacModuleProductOutputCallbackfusedChain_Register(DacModuleProductOutputCallbackfusedChain_t callback)
+{
+	 DacModuleProductOutputCallbackfusedChain = callback;
+}
+
+void DacModuleProductOutputCallbackfusedIsSmaller_Register(DacModuleProductOutputCallbackfusedIsSmaller_t callback)
+{
+	 DacModuleProductOutputCallbackfusedIsSmaller = callback;
+}
+
+void DacModuleProductOutputCallbackvectorSum_Register(DacModuleProductOutputCallbackvectorSum_t callback)
+{
+	 DacModuleProductOutputCallbackvectorSum = callback;
+}
+
+void DacModuleProductOutputCallbackvectorSumTimesOne_Register(DacModuleProductOutputCallbackvectorSumTimesOne_t callback)
+{
+	 DacModuleProductOutputCallbackvectorSumTimesOne = callback;
+}
+
+
+
+/* The main run routine ****************************************************************************/
+static void * instanceModuleProduct = NULL;
+static size_t threadsNrOfModuleProduct = 0;
+
+int DacModuleProductCreate(size_t threadsNrOf)
+{
+	DacModuleProductDestroy();
+
+	instanceModuleProduct = CreateThreads(threadsNrOf);
+	threadsNrOfModuleProduct = threadsNrOf;
+
+	return 0;
+}
+
+int DacModuleProductRun(size_t threadsNrOf)
+{
+	if(NULL == DacModuleProductOutputCallbackscalarScalarDiv)
+	{
+		fatal("DacModuleProductOutputCallbackscalarScalarDiv == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackdScalarScalarDivLeft)
+	{
+		fatal("DacModuleProductOutputCallbackdScalarScalarDivLeft == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackdScalarScalarDivRight)
+	{
+		fatal("DacModuleProductOutputCallbackdScalarScalarDivRight == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackscalarVecProd)
+	{
+		fatal("DacModuleProductOutputCallbackscalarVecProd == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackvecScalarProd)
+	{
+		fatal("DacModuleProductOutputCallbackvecScalarProd == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackvecVecProd)
+	{
+		fatal("DacModuleProductOutputCallbackvecVecProd == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackvecKronProd)
+	{
+		fatal("DacModuleProductOutputCallbackvecKronProd == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackkronVecProd)
+	{
+		fatal("DacModuleProductOutputCallbackkronVecProd == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackdVecScalarProdLeft)
+	{
+		fatal("DacModuleProductOutputCallbackdVecScalarProdLeft == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackdVecScalarProdRight)
+	{
+		fatal("DacModuleProductOutputCallbackdVecScalarProdRight == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackdVecVecProdLeft)
+	{
+		fatal("DacModuleProductOutputCallbackdVecVecProdLeft == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackdVecVecProdRight)
+	{
+		fatal("DacModuleProductOutputCallbackdVecVecProdRight == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackscalarSquared)
+	{
+		fatal("DacModuleProductOutputCallbackscalarSquared == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackdScalarSquaredBase)
+	{
+		fatal("DacModuleProductOutputCallbackdScalarSquaredBase == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackvectorSquared)
+	{
+		fatal("DacModuleProductOutputCallbackvectorSquared == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackdvectorSquaredBase)
+	{
+		fatal("DacModuleProductOutputCallbackdvectorSquaredBase == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackwideSum)
+	{
+		fatal("DacModuleProductOutputCallbackwideSum == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackmatrixProduct)
+	{
+		fatal("DacModuleProductOutputCallbackmatrixProduct == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackmatrixProductTransposed)
+	{
+		fatal("DacModuleProductOutputCallbackmatrixProductTransposed == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackmatrixProductEpilogue)
+	{
+		fatal("DacModuleProductOutputCallbackmatrixProductEpilogue == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackmatrixProductPermuted)
+	{
+		fatal("DacModuleProductOutputCallbackmatrixProductPermuted == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbacksparseMatrixVector)
+	{
+		fatal("DacModuleProductOutputCallbacksparseMatrixVector == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbacksymmetricMatrixVector)
+	{
+		fatal("DacModuleProductOutputCallbacksymmetricMatrixVector == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbacksymmetricProduct)
+	{
+		fatal("DacModuleProductOutputCallbacksymmetricProduct == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbacksymmetricProductVector)
+	{
+		fatal("DacModuleProductOutputCallbacksymmetricProductVector == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbacklongVector)
+	{
+		fatal("DacModuleProductOutputCallbacklongVector == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbacklongVectorCubed)
+	{
+		fatal("DacModuleProductOutputCallbacklongVectorCubed == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbacklongVectorIsSmaller)
+	{
+		fatal("DacModuleProductOutputCallbacklongVectorIsSmaller == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackfusedChain)
+	{
+		fatal("DacModuleProductOutputCallbackfusedChain == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackfusedIsSmaller)
+	{
+		fatal("DacModuleProductOutputCallbackfusedIsSmaller == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackvectorSum)
+	{
+		fatal("DacModuleProductOutputCallbackvectorSum == NULL");
+	}
+
+	if(NULL == DacModuleProductOutputCallbackvectorSumTimesOne)
+	{
+		fatal("DacModuleProductOutputCallbackvectorSumTimesOne == NULL");
+	}
+
+	if((NULL == instanceModuleProduct) || (threadsNrOf != threadsNrOfModuleProduct))
+	{
+		DacModuleProductCreate(threadsNrOf);
+	}
+
+	RunJobs(instanceModuleProduct, &jobPoolInitModuleProduct);
+
+	return 0;
+}
+
+void DacModuleProductDestroy(void)
+{
+	if(NULL != instanceModuleProduct)
+	{
+		DestroyThreads(instanceModuleProduct);
+		instanceModuleProduct = NULL;
+		threadsNrOfModuleProduct = 0;
+	}
+}
+
@@ -0,0 +1,108 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void (*DacModuleProductOutputCallbackscalarScalarDiv_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackscalarScalarDiv_Register(DacModuleProductOutputCallbackscalarScalarDiv_t callback);
+typedef void (*DacModuleProductOutputCallbackdScalarScalarDivLeft_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackdScalarScalarDivLeft_Register(DacModuleProductOutputCallbackdScalarScalarDivLeft_t callback);
+typedef void (*DacModuleProductOutputCallbackdScalarScalarDivRight_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackdScalarScalarDivRight_Register(DacModuleProductOutputCallbackdScalarScalarDivRight_t callback);
+typedef void (*DacModuleProductOutputCallbackscalarVecProd_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackscalarVecProd_Register(DacModuleProductOutputCallbackscalarVecProd_t callback);
+typedef void (*DacModuleProductOutputCallbackvecScalarProd_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackvecScalarProd_Register(DacModuleProductOutputCallbackvecScalarProd_t callback);
+typedef void (*DacModuleProductOutputCallbackvecVecProd_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackvecVecProd_Register(DacModuleProductOutputCallbackvecVecProd_t callback);
+typedef void (*DacModuleProductOutputCallbackvecKronProd_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackvecKronProd_Register(DacModuleProductOutputCallbackvecKronProd_t callback);
+typedef void (*DacModuleProductOutputCallbackkronVecProd_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackkronVecProd_Register(DacModuleProductOutputCallbackkronVecProd_t callback);
+typedef void (*DacModuleProductOutputCallbackdVecScalarProdLeft_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackdVecScalarProdLeft_Register(DacModuleProductOutputCallbackdVecScalarProdLeft_t callback);
+typedef void (*DacModuleProductOutputCallbackdVecScalarProdRight_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackdVecScalarProdRight_Register(DacModuleProductOutputCallbackdVecScalarProdRight_t callback);
+typedef void (*DacModuleProductOutputCallbackdVecVecProdLeft_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackdVecVecProdLeft_Register(DacModuleProductOutputCallbackdVecVecProdLeft_t callback);
+typedef void (*DacModuleProductOutputCallbackdVecVecProdRight_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackdVecVecProdRight_Register(DacModuleProductOutputCallbackdVecVecProdRight_t callback);
+typedef void (*DacModuleProductOutputCallbackscalarSquared_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackscalarSquared_Register(DacModuleProductOutputCallbackscalarSquared_t callback);
+typedef void (*DacModuleProductOutputCallbackdScalarSquaredBase_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackdScalarSquaredBase_Register(DacModuleProductOutputCallbackdScalarSquaredBase_t callback);
+typedef void (*DacModuleProductOutputCallbackvectorSquared_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackvectorSquared_Register(DacModuleProductOutputCallbackvectorSquared_t callback);
+typedef void (*DacModuleProductOutputCallbackdvectorSquaredBase_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackdvectorSquaredBase_Register(DacModuleProductOutputCallbackdvectorSquaredBase_t callback);
+typedef void (*DacModuleProductOutputCallbackwideSum_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackwideSum_Register(DacModuleProductOutputCallbackwideSum_t callback);
+typedef void (*DacModuleProductOutputCallbackmatrixProduct_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackmatrixProduct_Register(DacModuleProductOutputCallbackmatrixProduct_t callback);
+typedef void (*DacModuleProductOutputCallbackmatrixProductTransposed_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackmatrixProductTransposed_Register(DacModuleProductOutputCallbackmatrixProductTransposed_t callback);
+typedef void (*DacModuleProductOutputCallbackmatrixProductEpilogue_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackmatrixProductEpilogue_Register(DacModuleProductOutputCallbackmatrixProductEpilogue_t callback);
+typedef void (*DacModuleProductOutputCallbackmatrixProductPermuted_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackmatrixProductPermuted_Register(DacModuleProductOutputCallbackmatrixProductPermuted_t callback);
+typedef void (*DacModuleProductOutputCallbacksparseMatrixVector_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbacksparseMatrixVector_Register(DacModuleProductOutputCallbacksparseMatrixVector_t callback);
+typedef void (*DacModuleProductOutputCallbacksymmetricMatrixVector_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbacksymmetricMatrixVector_Register(DacModuleProductOutputCallbacksymmetricMatrixVector_t callback);
+typedef void (*DacModuleProductOutputCallbacksymmetricProduct_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbacksymmetricProduct_Register(DacModuleProductOutputCallbacksymmetricProduct_t callback);
+typedef void (*DacModuleProductOutputCallbacksymmetricProductVector_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbacksymmetricProductVector_Register(DacModuleProductOutputCallbacksymmetricProductVector_t callback);
+typedef void (*DacModuleProductOutputCallbacklongVector_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbacklongVector_Register(DacModuleProductOutputCallbacklongVector_t callback);
+typedef void (*DacModuleProductOutputCallbacklongVectorCubed_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbacklongVectorCubed_Register(DacModuleProductOutputCallbacklongVectorCubed_t callback);
+typedef void (*DacModuleProductOutputCallbacklongVectorIsSmaller_t)(const int32_t* pt, size_t size);
+extern void DacModuleProductOutputCallbacklongVectorIsSmaller_Register(DacModuleProductOutputCallbacklongVectorIsSmaller_t callback);
+typedef void (*DacModuleProductOutputCallbackfusedChain_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackfusedChain_Register(DacModuleProductOutputCallbackfusedChain_t callback);
+typedef void (*DacModuleProductOutputCallbackfusedIsSmaller_t)(const int32_t* pt, size_t size);
+extern void DacModuleProductOutputCallbackfusedIsSmaller_Register(DacModuleProductOutputCallbackfusedIsSmaller_t callback);
+typedef void (*DacModuleProductOutputCallbackvectorSum_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackvectorSum_Register(DacModuleProductOutputCallbackvectorSum_t callback);
+typedef void (*DacModuleProductOutputCallbackvectorSumTimesOne_t)(const float* pt, size_t size);
+extern void DacModuleProductOutputCallbackvectorSumTimesOne_Register(DacModuleProductOutputCallbackvectorSumTimesOne_t callback);
+extern int DacModuleProductCreate(size_t threadsNrOf);
+extern int DacModuleProductRun(size_t threadsNrOf);
+extern void DacModuleProductDestroy(void);
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
@@ -0,0 +1,95 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <linux/types.h>
+#include <pthread.h>
+
+
+#include "error_functions.h"
+
+#include "InstructionsModuleWhile.h"
+
+#include "DacModuleWhile.h"
+
+
+DacModuleWhileOutputCallbackwhileState_t DacModuleWhileOutputCallbackwhileState = NULL;
+
+
+/* Exported Functions ******************************************************************************/
+void DacModuleWhileOutputCallbackwhileState_Register(DacModuleWhileOutputCallbackwhileState_t callback)
+{
+	 DacModuleWhileOutputCallbackwhileState = callback;
+}
+
+
+
+/* The main run routine ****************************************************************************/
+static void * instanceModuleWhile = NULL;
+static size_t threadsNrOfModuleWhile = 0;
+
+int DacModuleWhileCreate(size_t threadsNrOf)
+{
+	DacModuleWhileDestroy();
+
+	instanceModuleWhile = CreateThreads(threadsNrOf);
+	threadsNrOfModuleWhile = threadsNrOf;
+
+	return 0;
+}
+
+int DacModuleWhileRun(size_t threadsNrOf)
+{
+	if(NULL == DacModuleWhileOutputCallbackwhileState)
+	{
+		fatal("DacModuleWhileOutputCallbackwhileState == NULL");
+	}
+
+	if((NULL == instanceModuleWhile) || (threadsNrOf != threadsNrOfModuleWhile))
+	{
+		DacModuleWhileCreate(threadsNrOf);
+	}
+
+	RunJobs(instanceModuleWhile, &jobPoolInitModuleWhile);
+
+	return 0;
+}
+
+void DacModuleWhileDestroy(void)
+{
+	if(NULL != instanceModuleWhile)
+	{
+		DestroyThreads(instanceModuleWhile);
+		instanceModuleWhile = NULL;
+		threadsNrOfModuleWhile = 0;
+	}
+}
+
@@ -0,0 +1,569 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+
+#include "DacModuleCNN.h"
+#include "InstructionsModuleCNN.h"
+
+extern DacModuleCNNOutputCallbackcc_t DacModuleCNNOutputCallbackcc;
+extern DacModuleCNNOutputCallbackccMaxPool_t DacModuleCNNOutputCallbackccMaxPool;
+extern DacModuleCNNOutputCallbackccMaxPool4_t DacModuleCNNOutputCallbackccMaxPool4;
+extern DacModuleCNNOutputCallbackccMaxPool4Derivative_t DacModuleCNNOutputCallbackccMaxPool4Derivative;
+extern DacModuleCNNOutputCallbackccSparse_t DacModuleCNNOutputCallbackccSparse;
+extern DacModuleCNNOutputCallbackccBig_t DacModuleCNNOutputCallbackccBig;
+extern DacModuleCNNOutputCallbackccDoubled_t DacModuleCNNOutputCallbackccDoubled;
+extern DacModuleCNNOutputCallbackkernelSquaredDerivative_t DacModuleCNNOutputCallbackkernelSquaredDerivative;
+extern DacModuleCNNOutputCallbackvectorSplit_t DacModuleCNNOutputCallbackvectorSplit;
+extern DacModuleCNNInputCallbackvector_t DacModuleCNNInputCallbackvector;
+extern DacModuleCNNOutputCallbackvector21_t DacModuleCNNOutputCallbackvector21;
+extern DacModuleCNNOutputCallbackvector42_t DacModuleCNNOutputCallbackvector42;
+
+static const float Node1[100] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 6.400000000000000000000e+01, 6.500000000000000000000e+01, 6.600000000000000000000e+01, 6.700000000000000000000e+01, 6.800000000000000000000e+01, 6.900000000000000000000e+01, 7.000000000000000000000e+01, 7.100000000000000000000e+01, 7.200000000000000000000e+01, 7.300000000000000000000e+01, 7.400000000000000000000e+01, 7.500000000000000000000e+01, 7.600000000000000000000e+01, 7.700000000000000000000e+01, 7.800000000000000000000e+01, 7.900000000000000000000e+01, 8.000000000000000000000e+01, 8.100000000000000000000e+01, 8.200000000000000000000e+01, 8.300000000000000000000e+01, 8.400000000000000000000e+01, 8.500000000000000000000e+01, 8.600000000000000000000e+01, 8.700000000000000000000e+01, 8.800000000000000000000e+01, 8.900000000000000000000e+01, 9.000000000000000000000e+01, 9.100000000000000000000e+01, 9.200000000000000000000e+01, 9.300000000000000000000e+01, 9.400000000000000000000e+01, 9.500000000000000000000e+01, 9.600000000000000000000e+01, 9.700000000000000000000e+01, 9.800000000000000000000e+01, 9.900000000000000000000e+01, 1.000000000000000000000e+02};
+static const float Node2[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00};
+static const float Node11[9] __attribute__((aligned(64))) __attribute__((unused)) = {0.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 2.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 3.000000000000000000000e+00};
+static const float Node14[256] __attribute__((aligned(64))) __attribute__((unused)) = {0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 6.400000000000000000000e+01, 6.500000000000000000000e+01, 6.600000000000000000000e+01, 6.700000000000000000000e+01, 6.800000000000000000000e+01, 6.900000000000000000000e+01, 7.000000000000000000000e+01, 7.100000000000000000000e+01, 7.200000000000000000000e+01, 7.300000000000000000000e+01, 7.400000000000000000000e+01, 7.500000000000000000000e+01, 7.600000000000000000000e+01, 7.700000000000000000000e+01, 7.800000000000000000000e+01, 7.900000000000000000000e+01, 8.000000000000000000000e+01, 8.100000000000000000000e+01, 8.200000000000000000000e+01, 8.300000000000000000000e+01, 8.400000000000000000000e+01, 8.500000000000000000000e+01, 8.600000000000000000000e+01, 8.700000000000000000000e+01, 8.800000000000000000000e+01, 8.900000000000000000000e+01, 9.000000000000000000000e+01, 9.100000000000000000000e+01, 9.200000000000000000000e+01, 9.300000000000000000000e+01, 9.400000000000000000000e+01, 9.500000000000000000000e+01, 9.600000000000000000000e+01, 9.700000000000000000000e+01, 9.800000000000000000000e+01, 9.900000000000000000000e+01, 1.000000000000000000000e+02, 1.010000000000000000000e+02, 1.020000000000000000000e+02, 1.030000000000000000000e+02, 1.040000000000000000000e+02, 1.050000000000000000000e+02, 1.060000000000000000000e+02, 1.070000000000000000000e+02, 1.080000000000000000000e+02, 1.090000000000000000000e+02, 1.100000000000000000000e+02, 1.110000000000000000000e+02, 1.120000000000000000000e+02, 1.130000000000000000000e+02, 1.140000000000000000000e+02, 1.150000000000000000000e+02, 1.160000000000000000000e+02, 1.170000000000000000000e+02, 1.180000000000000000000e+02, 1.190000000000000000000e+02, 1.200000000000000000000e+02, 1.210000000000000000000e+02, 1.220000000000000000000e+02, 1.230000000000000000000e+02, 1.240000000000000000000e+02, 1.250000000000000000000e+02, 1.260000000000000000000e+02, 1.270000000000000000000e+02, 1.280000000000000000000e+02, 1.290000000000000000000e+02, 1.300000000000000000000e+02, 1.310000000000000000000e+02, 1.320000000000000000000e+02, 1.330000000000000000000e+02, 1.340000000000000000000e+02, 1.350000000000000000000e+02, 1.360000000000000000000e+02, 1.370000000000000000000e+02, 1.380000000000000000000e+02, 1.390000000000000000000e+02, 1.400000000000000000000e+02, 1.410000000000000000000e+02, 1.420000000000000000000e+02, 1.430000000000000000000e+02, 1.440000000000000000000e+02, 1.450000000000000000000e+02, 1.460000000000000000000e+02, 1.470000000000000000000e+02, 1.480000000000000000000e+02, 1.490000000000000000000e+02, 1.500000000000000000000e+02, 1.510000000000000000000e+02, 1.520000000000000000000e+02, 1.530000000000000000000e+02, 1.540000000000000000000e+02, 1.550000000000000000000e+02, 1.560000000000000000000e+02, 1.570000000000000000000e+02, 1.580000000000000000000e+02, 1.590000000000000000000e+02, 1.600000000000000000000e+02, 1.610000000000000000000e+02, 1.620000000000000000000e+02, 1.630000000000000000000e+02, 1.640000000000000000000e+02, 1.650000000000000000000e+02, 1.660000000000000000000e+02, 1.670000000000000000000e+02, 1.680000000000000000000e+02, 1.690000000000000000000e+02, 1.700000000000000000000e+02, 1.710000000000000000000e+02, 1.720000000000000000000e+02, 1.730000000000000000000e+02, 1.740000000000000000000e+02, 1.750000000000000000000e+02, 1.760000000000000000000e+02, 1.770000000000000000000e+02, 1.780000000000000000000e+02, 1.790000000000000000000e+02, 1.800000000000000000000e+02, 1.810000000000000000000e+02, 1.820000000000000000000e+02, 1.830000000000000000000e+02, 1.840000000000000000000e+02, 1.850000000000000000000e+02, 1.860000000000000000000e+02, 1.870000000000000000000e+02, 1.880000000000000000000e+02, 1.890000000000000000000e+02, 1.900000000000000000000e+02, 1.910000000000000000000e+02, 1.920000000000000000000e+02, 1.930000000000000000000e+02, 1.940000000000000000000e+02, 1.950000000000000000000e+02, 1.960000000000000000000e+02, 1.970000000000000000000e+02, 1.980000000000000000000e+02, 1.990000000000000000000e+02, 2.000000000000000000000e+02, 2.010000000000000000000e+02, 2.020000000000000000000e+02, 2.030000000000000000000e+02, 2.040000000000000000000e+02, 2.050000000000000000000e+02, 2.060000000000000000000e+02, 2.070000000000000000000e+02, 2.080000000000000000000e+02, 2.090000000000000000000e+02, 2.100000000000000000000e+02, 2.110000000000000000000e+02, 2.120000000000000000000e+02, 2.130000000000000000000e+02, 2.140000000000000000000e+02, 2.150000000000000000000e+02, 2.160000000000000000000e+02, 2.170000000000000000000e+02, 2.180000000000000000000e+02, 2.190000000000000000000e+02, 2.200000000000000000000e+02, 2.210000000000000000000e+02, 2.220000000000000000000e+02, 2.230000000000000000000e+02, 2.240000000000000000000e+02, 2.250000000000000000000e+02, 2.260000000000000000000e+02, 2.270000000000000000000e+02, 2.280000000000000000000e+02, 2.290000000000000000000e+02, 2.300000000000000000000e+02, 2.310000000000000000000e+02, 2.320000000000000000000e+02, 2.330000000000000000000e+02, 2.340000000000000000000e+02, 2.350000000000000000000e+02, 2.360000000000000000000e+02, 2.370000000000000000000e+02, 2.380000000000000000000e+02, 2.390000000000000000000e+02, 2.400000000000000000000e+02, 2.410000000000000000000e+02, 2.420000000000000000000e+02, 2.430000000000000000000e+02, 2.440000000000000000000e+02, 2.450000000000000000000e+02, 2.460000000000000000000e+02, 2.470000000000000000000e+02, 2.480000000000000000000e+02, 2.490000000000000000000e+02, 2.500000000000000000000e+02, 2.510000000000000000000e+02, 2.520000000000000000000e+02, 2.530000000000000000000e+02, 2.540000000000000000000e+02, 2.550000000000000000000e+02};
+static const float Node15[50] __attribute__((aligned(64))) __attribute__((unused)) = {-3.000000000000000000000e+00, -2.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, -3.000000000000000000000e+00, -2.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, -3.000000000000000000000e+00, -2.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, -3.000000000000000000000e+00, -2.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, -3.000000000000000000000e+00, -2.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, -3.000000000000000000000e+00, -2.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, -3.000000000000000000000e+00, -2.000000000000000000000e+00, -1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, -3.000000000000000000000e+00};
+static const float Node18 __attribute__((unused)) = 2.000000000000000000000e+00;
+static const float Node19[9] __attribute__((aligned(64))) __attribute__((unused)) = {2.000000000000000000000e+00, 4.000000000000000000000e+00, 6.000000000000000000000e+00, 8.000000000000000000000e+00, 1.000000000000000000000e+01, 1.200000000000000000000e+01, 1.400000000000000000000e+01, 1.600000000000000000000e+01, 1.800000000000000000000e+01};
+static const float Node22 __attribute__((unused)) = 2.000000000000000000000e+00;
+static const float Node24 __attribute__((unused)) = -1.000000000000000000000e+00;
+static const float Node30[81] __attribute__((aligned(64))) __attribute__((unused)) = {2.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 4.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 6.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 8.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+01, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.200000000000000000000e+01, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.400000000000000000000e+01, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.600000000000000000000e+01, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.800000000000000000000e+01};
+static const float Node32[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00};
+static const float * Node36;
+static const float * Node38;
+
+static uint32_t Node7Argmax[4];
+static float Node3[64] __attribute__((aligned(64)));
+static float Node5[16] __attribute__((aligned(64)));
+static float Node7[4] __attribute__((aligned(64)));
+static float Node9[256] __attribute__((aligned(64)));
+static float Node12[64] __attribute__((aligned(64)));
+static float Node16[48] __attribute__((aligned(64)));
+static float Node20[64] __attribute__((aligned(64)));
+static float Node33[21] __attribute__((aligned(64)));
+
+static node_t nodesModuleCNN[]; // Initialized below
+
+static void Node3Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorCrossCorrelationCode
+
+	const uint32_t InStrides[] = {
+		 10,
+		 1,
+	};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 64; opIndexRow += 8)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 8; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			Node3[opIndex] =
+				Node1[opIndexTuple[0] * InStrides[0] + opIndexTuple[1] * InStrides[1]]
+				+ Node1[opIndexTuple[0] * InStrides[0] + (opIndexTuple[1] + 1) * InStrides[1]] * 2.000000000e+00f
+				+ Node1[opIndexTuple[0] * InStrides[0] + (opIndexTuple[1] + 2) * InStrides[1]] * 3.000000000e+00f
+				+ Node1[(opIndexTuple[0] + 1) * InStrides[0] + opIndexTuple[1] * InStrides[1]] * 4.000000000e+00f
+				+ Node1[(opIndexTuple[0] + 1) * InStrides[0] + (opIndexTuple[1] + 1) * InStrides[1]] * 5.000000000e+00f
+				+ Node1[(opIndexTuple[0] + 1) * InStrides[0] + (opIndexTuple[1] + 2) * InStrides[1]] * 6.000000000e+00f
+				+ Node1[(opIndexTuple[0] + 2) * InStrides[0] + opIndexTuple[1] * InStrides[1]] * 7.000000000e+00f
+				+ Node1[(opIndexTuple[0] + 2) * InStrides[0] + (opIndexTuple[1] + 1) * InStrides[1]] * 8.000000000e+00f
+				+ Node1[(opIndexTuple[0] + 2) * InStrides[0] + (opIndexTuple[1] + 2) * InStrides[1]] * 9.000000000e+00f;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node4Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackcc(Node3, 64 * sizeof(float));
+
+	
+}
+
+static void Node5Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorMaxPoolCode
+
+	const uint32_t InStrides[] = {
+		 8,
+		 1,
+	};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 16; opIndexRow += 4)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 4; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			const uint32_t inPoolOrigin[] = {opIndexTuple[0] * 2, opIndexTuple[1] * 2};
+
+			Node5[opIndex] =
+				fmaxf(Node3[inPoolOrigin[0] * InStrides[0] + inPoolOrigin[1] * InStrides[1]], 
+				fmaxf(Node3[inPoolOrigin[0] * InStrides[0] + (inPoolOrigin[1] + 1) * InStrides[1]], 
+				fmaxf(Node3[(inPoolOrigin[0] + 1) * InStrides[0] + inPoolOrigin[1] * InStrides[1]], 
+				Node3[(inPoolOrigin[0] + 1) * InStrides[0] + (inPoolOrigin[1] + 1) * InStrides[1]])));
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node6Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackccMaxPool(Node5, 16 * sizeof(float));
+
+	
+}
+
+static void Node7Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorMaxPoolCode
+
+	const uint32_t InStrides[] = {
+		 8,
+		 1,
+	};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 4; opIndexRow += 2)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 2; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			const uint32_t inPoolOrigin[] = {opIndexTuple[0] * 4, opIndexTuple[1] * 4};
+
+			float max = -INFINITY;
+			uint32_t argmax = 0;
+			uint32_t inIndex = (inPoolOrigin[0] + 0) * InStrides[0] + (inPoolOrigin[1] + 0) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 0) * InStrides[0] + (inPoolOrigin[1] + 1) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 0) * InStrides[0] + (inPoolOrigin[1] + 2) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 0) * InStrides[0] + (inPoolOrigin[1] + 3) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 1) * InStrides[0] + (inPoolOrigin[1] + 0) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 1) * InStrides[0] + (inPoolOrigin[1] + 1) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 1) * InStrides[0] + (inPoolOrigin[1] + 2) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 1) * InStrides[0] + (inPoolOrigin[1] + 3) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 2) * InStrides[0] + (inPoolOrigin[1] + 0) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 2) * InStrides[0] + (inPoolOrigin[1] + 1) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 2) * InStrides[0] + (inPoolOrigin[1] + 2) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 2) * InStrides[0] + (inPoolOrigin[1] + 3) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 3) * InStrides[0] + (inPoolOrigin[1] + 0) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 3) * InStrides[0] + (inPoolOrigin[1] + 1) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 3) * InStrides[0] + (inPoolOrigin[1] + 2) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			inIndex = (inPoolOrigin[0] + 3) * InStrides[0] + (inPoolOrigin[1] + 3) * InStrides[1];
+			if(max < Node3[inIndex])
+			{
+				max = Node3[inIndex];
+				argmax = inIndex;
+			}
+			
+			Node7[opIndex] = max;
+			Node7Argmax[opIndex] = argmax;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node8Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackccMaxPool4(Node7, 4 * sizeof(float));
+
+	
+}
+
+static void Node9Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorMaxPoolDerivativeCode
+
+	for(size_t index = 0; index < 256; index++)
+	{
+		Node9[index] = 0;
+	}
+
+	for(size_t poolIndex = 0; poolIndex < 4; poolIndex++)
+	{
+		Node9[Node7Argmax[poolIndex] * 4 + poolIndex] = 1;
+	}
+}
+
+static void Node10Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackccMaxPool4Derivative(Node9, 256 * sizeof(float));
+
+	
+}
+
+static void Node12Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorCrossCorrelationCode
+
+	const uint32_t InStrides[] = {
+		 10,
+		 1,
+	};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 64; opIndexRow += 8)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 8; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			Node12[opIndex] =
+				-Node1[opIndexTuple[0] * InStrides[0] + (opIndexTuple[1] + 1) * InStrides[1]]
+				+ Node1[(opIndexTuple[0] + 1) * InStrides[0] + opIndexTuple[1] * InStrides[1]] * 2.000000000e+00f
+				+ Node1[(opIndexTuple[0] + 1) * InStrides[0] + (opIndexTuple[1] + 2) * InStrides[1]]
+				+ Node1[(opIndexTuple[0] + 2) * InStrides[0] + (opIndexTuple[1] + 2) * InStrides[1]] * 3.000000000e+00f;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node13Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackccSparse(Node12, 64 * sizeof(float));
+
+	
+}
+
+static void Node16Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorCrossCorrelationCode
+
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 48; opIndexRow += 4)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 4; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			float sum = 0;
+			for(uint32_t kernel0 = 0; kernel0 < 2; kernel0++)
+			{
+				for(uint32_t kernel1 = 0; kernel1 < 5; kernel1++)
+				{
+					const float * inRow = &Node14[(opIndexTuple[0] + kernel0) * 64 + (opIndexTuple[1] + kernel1) * 8 + opIndexTuple[2]];
+					const float * kernelRow = &Node15[kernel0 * 25 + kernel1 * 5 + 0];
+					for(uint32_t kernel2 = 0; kernel2 < 5; kernel2++)
+					{
+						sum += inRow[kernel2] * kernelRow[kernel2];
+					}
+				}
+			}
+			
+			Node16[opIndex] = sum;
+		}
+		
+		if(4 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node17Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackccBig(Node16, 48 * sizeof(float));
+
+	
+}
+
+static void Node20Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorCrossCorrelationCode
+
+	const uint32_t InStrides[] = {
+		 10,
+		 1,
+	};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 64; opIndexRow += 8)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 8; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			Node20[opIndex] =
+				Node1[opIndexTuple[0] * InStrides[0] + opIndexTuple[1] * InStrides[1]] * 2.000000000e+00f
+				+ Node1[opIndexTuple[0] * InStrides[0] + (opIndexTuple[1] + 1) * InStrides[1]] * 4.000000000e+00f
+				+ Node1[opIndexTuple[0] * InStrides[0] + (opIndexTuple[1] + 2) * InStrides[1]] * 6.000000000e+00f
+				+ Node1[(opIndexTuple[0] + 1) * InStrides[0] + opIndexTuple[1] * InStrides[1]] * 8.000000000e+00f
+				+ Node1[(opIndexTuple[0] + 1) * InStrides[0] + (opIndexTuple[1] + 1) * InStrides[1]] * 1.000000000e+01f
+				+ Node1[(opIndexTuple[0] + 1) * InStrides[0] + (opIndexTuple[1] + 2) * InStrides[1]] * 1.200000000e+01f
+				+ Node1[(opIndexTuple[0] + 2) * InStrides[0] + opIndexTuple[1] * InStrides[1]] * 1.400000000e+01f
+				+ Node1[(opIndexTuple[0] + 2) * InStrides[0] + (opIndexTuple[1] + 1) * InStrides[1]] * 1.600000000e+01f
+				+ Node1[(opIndexTuple[0] + 2) * InStrides[0] + (opIndexTuple[1] + 2) * InStrides[1]] * 1.800000000e+01f;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node21Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackccDoubled(Node20, 64 * sizeof(float));
+
+	
+}
+
+static void Node31Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackkernelSquaredDerivative(Node30, 81 * sizeof(float));
+
+	
+}
+
+static void Node33Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorIndexSplitSumCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 21; opIndexRow += 7)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 7; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[0] + opIndexTuple[1]};
+
+			Node33[opIndex] = Node32[argIndexTuple[0] * 1];
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node34Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackvectorSplit(Node33, 21 * sizeof(float));
+
+	
+}
+
+static void Node35Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// InputCode
+
+	Node36 = DacModuleCNNInputCallbackvector(21, 9 * sizeof(float));
+}
+
+static void Node37Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// InputCode
+
+	Node38 = DacModuleCNNInputCallbackvector(42, 9 * sizeof(float));
+}
+
+static void Node39Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackvector21(Node36, 9 * sizeof(float));
+
+	
+}
+
+static void Node40Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleCNNOutputCallbackvector42(Node38, 9 * sizeof(float));
+
+	
+}
+
+static const node_t * const nodeParentsModuleCNN[] = {
+	&nodesModuleCNN[0],
+	&nodesModuleCNN[0],
+	&nodesModuleCNN[2],
+	&nodesModuleCNN[0],
+	&nodesModuleCNN[4],
+	&nodesModuleCNN[4],
+	&nodesModuleCNN[6],
+	&nodesModuleCNN[8],
+	&nodesModuleCNN[10],
+	&nodesModuleCNN[12],
+	&nodesModuleCNN[15],
+	&nodesModuleCNN[17],
+	&nodesModuleCNN[18],
+};
+
+static node_t * const nodeChildrenModuleCNN[] = {
+	&nodesModuleCNN[1],
+	&nodesModuleCNN[2],
+	&nodesModuleCNN[4],
+	&nodesModuleCNN[3],
+	&nodesModuleCNN[5],
+	&nodesModuleCNN[6],
+	&nodesModuleCNN[7],
+	&nodesModuleCNN[9],
+	&nodesModuleCNN[11],
+	&nodesModuleCNN[13],
+	&nodesModuleCNN[16],
+	&nodesModuleCNN[19],
+	&nodesModuleCNN[20],
+};
+
+static node_t nodesModuleCNN[] = {
+	{Node3Instruction, NULL, &nodeChildrenModuleCNN[0], 0, 0, 3, 3, 0},
+	{Node4Instruction, &nodeParentsModuleCNN[0], NULL, 0, 1, 0, 4, 0},
+	{Node5Instruction, &nodeParentsModuleCNN[1], &nodeChildrenModuleCNN[3], 0, 1, 1, 5, 0},
+	{Node6Instruction, &nodeParentsModuleCNN[2], NULL, 0, 1, 0, 6, 0},
+	{Node7Instruction, &nodeParentsModuleCNN[3], &nodeChildrenModuleCNN[4], 0, 1, 2, 7, 0},
+	{Node8Instruction, &nodeParentsModuleCNN[4], NULL, 0, 1, 0, 8, 0},
+	{Node9Instruction, &nodeParentsModuleCNN[5], &nodeChildrenModuleCNN[6], 0, 1, 1, 9, 0},
+	{Node10Instruction, &nodeParentsModuleCNN[6], NULL, 0, 1, 0, 10, 0},
+	{Node12Instruction, NULL, &nodeChildrenModuleCNN[7], 0, 0, 1, 12, 0},
+	{Node13Instruction, &nodeParentsModuleCNN[7], NULL, 0, 1, 0, 13, 0},
+	{Node16Instruction, NULL, &nodeChildrenModuleCNN[8], 0, 0, 1, 16, 0},
+	{Node17Instruction, &nodeParentsModuleCNN[8], NULL, 0, 1, 0, 17, 0},
+	{Node20Instruction, NULL, &nodeChildrenModuleCNN[9], 0, 0, 1, 20, 0},
+	{Node21Instruction, &nodeParentsModuleCNN[9], NULL, 0, 1, 0, 21, 0},
+	{Node31Instruction, NULL, NULL, 0, 0, 0, 31, 0},
+	{Node33Instruction, NULL, &nodeChildrenModuleCNN[10], 0, 0, 1, 33, 0},
+	{Node34Instruction, &nodeParentsModuleCNN[10], NULL, 0, 1, 0, 34, 0},
+	{Node35Instruction, NULL, &nodeChildrenModuleCNN[11], 0, 0, 1, 35, 0},
+	{Node37Instruction, NULL, &nodeChildrenModuleCNN[12], 0, 0, 1, 37, 0},
+	{Node39Instruction, &nodeParentsModuleCNN[11], NULL, 0, 1, 0, 39, 0},
+	{Node40Instruction, &nodeParentsModuleCNN[12], NULL, 0, 1, 0, 40, 0},
+};
+
+node_t * jobPoolInitNodesModuleCNN[] = {&nodesModuleCNN[0], &nodesModuleCNN[8], &nodesModuleCNN[10], &nodesModuleCNN[12], &nodesModuleCNN[14], &nodesModuleCNN[15], &nodesModuleCNN[17], &nodesModuleCNN[18]};
+
+jobPoolInit_t jobPoolInitModuleCNN = {
+	.Nodes = jobPoolInitNodesModuleCNN,
+	.NodesNrOf = 8,
+	.JobsNrOfMax = 21,
+};
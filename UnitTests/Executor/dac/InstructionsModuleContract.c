@@ -0,0 +1,1093 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+
+#include "DacModuleContract.h"
+#include "InstructionsModuleContract.h"
+
+extern DacModuleContractOutputCallbackmatrixVecProd_t DacModuleContractOutputCallbackmatrixVecProd;
+extern DacModuleContractOutputCallbackvecMatrixProd_t DacModuleContractOutputCallbackvecMatrixProd;
+extern DacModuleContractOutputCallbackdenseLayer_t DacModuleContractOutputCallbackdenseLayer;
+extern DacModuleContractOutputCallbackmatrixProd1_t DacModuleContractOutputCallbackmatrixProd1;
+extern DacModuleContractOutputCallbacktensorVecContr2_t DacModuleContractOutputCallbacktensorVecContr2;
+extern DacModuleContractOutputCallbacktensorVecContr1_t DacModuleContractOutputCallbacktensorVecContr1;
+extern DacModuleContractOutputCallbacktensorMatrixContr1_t DacModuleContractOutputCallbacktensorMatrixContr1;
+extern DacModuleContractOutputCallbacktensorMatrixContr12_t DacModuleContractOutputCallbacktensorMatrixContr12;
+extern DacModuleContractOutputCallbackmatrixIdProd_t DacModuleContractOutputCallbackmatrixIdProd;
+extern DacModuleContractOutputCallbacktwoMatrixTrace_t DacModuleContractOutputCallbacktwoMatrixTrace;
+extern DacModuleContractOutputCallbackmatrixDeltaSumProd_t DacModuleContractOutputCallbackmatrixDeltaSumProd;
+extern DacModuleContractOutputCallbacktensorDeltaContr_t DacModuleContractOutputCallbacktensorDeltaContr;
+extern DacModuleContractOutputCallbackmatrixPlusDelta_t DacModuleContractOutputCallbackmatrixPlusDelta;
+extern DacModuleContractOutputCallbackmatrixProdRight_t DacModuleContractOutputCallbackmatrixProdRight;
+extern DacModuleContractOutputCallbackmatrixProdLeft_t DacModuleContractOutputCallbackmatrixProdLeft;
+extern DacModuleContractOutputCallbackmatrixChainVec_t DacModuleContractOutputCallbackmatrixChainVec;
+extern DacModuleContractOutputCallbacktensorChainVec_t DacModuleContractOutputCallbacktensorChainVec;
+extern DacModuleContractOutputCallbackshiftPower5_t DacModuleContractOutputCallbackshiftPower5;
+extern DacModuleContractOutputCallbackmatrixPowerTransposed3_t DacModuleContractOutputCallbackmatrixPowerTransposed3;
+extern DacModuleContractOutputCallbackmatrixDoubled_t DacModuleContractOutputCallbackmatrixDoubled;
+extern DacModuleContractOutputCallbackmatrixDoubledId_t DacModuleContractOutputCallbackmatrixDoubledId;
+
+static const float Node1[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00};
+static const float Node2[3] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00};
+static const float Node9 __attribute__((unused)) = 2.000000000000000000000e+00;
+static const float Node12[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node15[27] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01};
+static const float Node36 __attribute__((unused)) = 2.500000000000000000000e+00;
+static const float Node60[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node61 __attribute__((unused)) = 5.000000000000000000000e+00;
+static const int32_t Node66 __attribute__((unused)) = 3;
+
+static float Node3[3] __attribute__((aligned(64)));
+static float Node5[3] __attribute__((aligned(64)));
+static float Node10[3] __attribute__((aligned(64)));
+static float Node13[9] __attribute__((aligned(64)));
+static float Node16[9] __attribute__((aligned(64)));
+static float Node18[9] __attribute__((aligned(64)));
+static float Node20[27] __attribute__((aligned(64)));
+static float Node22[3] __attribute__((aligned(64)));
+static float Node26[9] __attribute__((aligned(64)));
+static float Node28;
+static float Node37[9] __attribute__((aligned(64)));
+static float Node39[27] __attribute__((aligned(64)));
+static float Node41[9] __attribute__((aligned(64)));
+static float Node45[81] __attribute__((aligned(64)));
+static float Node46[81] __attribute__((aligned(64)));
+static float Node47[9] __attribute__((aligned(64)));
+static float Node50[81] __attribute__((aligned(64)));
+static float Node51[9] __attribute__((aligned(64)));
+static float Node55[3] __attribute__((aligned(64)));
+static float Node58[9] __attribute__((aligned(64)));
+static float Node62[9] __attribute__((aligned(64)));
+static float Node63[9] __attribute__((aligned(64)));
+static float Node64[9] __attribute__((aligned(64)));
+static float Node67[9] __attribute__((aligned(64)));
+static float Node68[9] __attribute__((aligned(64)));
+static float Node70[9] __attribute__((aligned(64)));
+static float Node74[3] __attribute__((aligned(64)));
+
+static node_t nodesModuleContract[]; // Initialized below
+
+static void Node3Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node1[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node2[rIndexTuple[0]];
+			}
+			
+			Node3[opIndex] = sum;
+		}
+	}
+}
+
+static void Node4Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixVecProd(Node3, 3 * sizeof(float));
+
+	
+}
+
+static void Node5Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {dim0};
+				const uint32_t rIndexTuple[] = {opIndexTuple[0], dim0};
+				sum += Node2[lIndexTuple[0]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node5[opIndex] = sum;
+		}
+	}
+}
+
+static void Node6Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackvecMatrixProd(Node5, 3 * sizeof(float));
+
+	
+}
+
+static void Node10Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	for(uint32_t dim = 0; dim < 3; dim++)
+	{
+		Node10[dim] = (Node3[dim] + Node2[dim]) * Node9;
+	}
+
+}
+
+static void Node11Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackdenseLayer(Node10, 3 * sizeof(float));
+
+	
+}
+
+static void Node13Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node1[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node12[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node13[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node14Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixProd1(Node13, 9 * sizeof(float));
+
+	
+}
+
+static void Node16Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], opIndexTuple[1], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node15[lIndexTuple[0] * 9 + lIndexTuple[1] * 3 + lIndexTuple[2]] * Node2[rIndexTuple[0]];
+			}
+			
+			Node16[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node17Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbacktensorVecContr2(Node16, 9 * sizeof(float));
+
+	
+}
+
+static void Node18Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0, opIndexTuple[1]};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node15[lIndexTuple[0] * 9 + lIndexTuple[1] * 3 + lIndexTuple[2]] * Node2[rIndexTuple[0]];
+			}
+			
+			Node18[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node19Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbacktensorVecContr1(Node18, 9 * sizeof(float));
+
+	
+}
+
+static void Node20Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0, opIndexTuple[1]};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[2]};
+				sum += Node15[lIndexTuple[0] * 9 + lIndexTuple[1] * 3 + lIndexTuple[2]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node20[opIndex] = sum;
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node21Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbacktensorMatrixContr1(Node20, 27 * sizeof(float));
+
+	
+}
+
+static void Node22Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				for(int dim1 = 0; dim1 < 3; dim1++)
+				{
+					const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0, dim1};
+					const uint32_t rIndexTuple[] = {dim0, dim1};
+					sum += Node15[lIndexTuple[0] * 9 + lIndexTuple[1] * 3 + lIndexTuple[2]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+				}
+			}
+			
+			Node22[opIndex] = sum;
+		}
+	}
+}
+
+static void Node23Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbacktensorMatrixContr12(Node22, 3 * sizeof(float));
+
+	
+}
+
+static void Node26Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorScalarProductCode
+
+	for(uint32_t dim = 0; dim < 9; dim++)
+	{
+		Node26[dim] = Node1[dim] * Node9;
+	}
+
+}
+
+static void Node27Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixIdProd(Node26, 9 * sizeof(float));
+
+	
+}
+
+static void Node28Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	float sum = 0;
+	for(int dim0 = 0; dim0 < 3; dim0++)
+	{
+		for(int dim1 = 0; dim1 < 3; dim1++)
+		{
+			const uint32_t argIndexTuple[] = {dim0, dim1};
+			const uint32_t kronIndexTuple[] = {dim0, dim1};
+			sum += Node1[argIndexTuple[0] * 3 + argIndexTuple[1] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 2.000000f;
+		}
+	}
+	
+	Node28 = sum;
+}
+
+static void Node29Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbacktwoMatrixTrace(&Node28, 1 * sizeof(float));
+
+	
+}
+
+static void Node37Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorScalarProductCode
+
+	for(uint32_t dim = 0; dim < 9; dim++)
+	{
+		Node37[dim] = Node1[dim] * Node36;
+	}
+
+}
+
+static void Node38Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixDeltaSumProd(Node37, 9 * sizeof(float));
+
+	
+}
+
+static void Node39Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorPermutationCode
+
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[2], opIndexTuple[0], opIndexTuple[1]};
+
+			Node39[opIndex] = Node15[argIndexTuple[0] * 9 + argIndexTuple[1] * 3 + argIndexTuple[2] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node40Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbacktensorDeltaContr(Node39, 27 * sizeof(float));
+
+	
+}
+
+static void Node41Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorAdditionCode
+
+	// VectorAdditionKroneckerDeltaCode
+
+	for(uint32_t dim = 0; dim < 9; dim++)
+	{
+		Node41[dim] = Node1[dim];
+	}
+	
+	for(uint32_t pair0 = 0; pair0 < 3; pair0++)
+	{
+		Node41[pair0 * 4] += 2.000000f;
+	}
+}
+
+static void Node42Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixPlusDelta(Node41, 9 * sizeof(float));
+
+	
+}
+
+static void Node45Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {2, 3, 0, 1};
+	uint32_t opIndexTuple[] = {0, 0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 81; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[3] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t argIndexTuple[] = {opIndexTuple[3], dim0};
+				const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1], dim0, opIndexTuple[2]};
+				sum += Node1[argIndexTuple[0] * 3 + argIndexTuple[1] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * (kronIndexTuple[1] == kronIndexTuple[deltaPairs[1]]) * 1.000000f;
+			}
+			
+			Node45[opIndex] = sum;
+		}
+		
+		if(3 == ++opIndexTuple[2])
+		{
+			opIndexTuple[2] = 0;
+			if(3 == ++opIndexTuple[1])
+			{
+				opIndexTuple[1] = 0;
+				opIndexTuple[0]++;
+			}
+		}
+	}
+}
+
+static void Node46Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorPermutationCode
+
+	uint32_t opIndexTuple[] = {0, 0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 81; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[3] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[0], opIndexTuple[1], opIndexTuple[3], opIndexTuple[2]};
+
+			Node46[opIndex] = Node45[argIndexTuple[0] * 27 + argIndexTuple[1] * 9 + argIndexTuple[2] * 3 + argIndexTuple[3] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[2])
+		{
+			opIndexTuple[2] = 0;
+			if(3 == ++opIndexTuple[1])
+			{
+				opIndexTuple[1] = 0;
+				opIndexTuple[0]++;
+			}
+		}
+	}
+}
+
+static void Node47Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				for(int dim1 = 0; dim1 < 3; dim1++)
+				{
+					const uint32_t argIndexTuple[] = {opIndexTuple[0], dim0, opIndexTuple[1], dim1};
+					const uint32_t kronIndexTuple[] = {dim0, dim1};
+					sum += Node46[argIndexTuple[0] * 27 + argIndexTuple[1] * 9 + argIndexTuple[2] * 3 + argIndexTuple[3] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f;
+				}
+			}
+			
+			Node47[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node48Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixProdRight(Node47, 9 * sizeof(float));
+
+	
+}
+
+static void Node50Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {2, 3, 0, 1};
+	uint32_t opIndexTuple[] = {0, 0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 81; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[3] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t argIndexTuple[] = {dim0, opIndexTuple[3]};
+				const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1], opIndexTuple[2], dim0};
+				sum += Node12[argIndexTuple[0] * 3 + argIndexTuple[1] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * (kronIndexTuple[1] == kronIndexTuple[deltaPairs[1]]) * 1.000000f;
+			}
+			
+			Node50[opIndex] = sum;
+		}
+		
+		if(3 == ++opIndexTuple[2])
+		{
+			opIndexTuple[2] = 0;
+			if(3 == ++opIndexTuple[1])
+			{
+				opIndexTuple[1] = 0;
+				opIndexTuple[0]++;
+			}
+		}
+	}
+}
+
+static void Node51Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				for(int dim1 = 0; dim1 < 3; dim1++)
+				{
+					const uint32_t argIndexTuple[] = {dim0, opIndexTuple[0], dim1, opIndexTuple[1]};
+					const uint32_t kronIndexTuple[] = {dim0, dim1};
+					sum += Node50[argIndexTuple[0] * 27 + argIndexTuple[1] * 9 + argIndexTuple[2] * 3 + argIndexTuple[3] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f;
+				}
+			}
+			
+			Node51[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node52Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixProdLeft(Node51, 9 * sizeof(float));
+
+	
+}
+
+static void Node55Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node1[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node74[rIndexTuple[0]];
+			}
+			
+			Node55[opIndex] = sum;
+		}
+	}
+}
+
+static void Node56Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixChainVec(Node55, 3 * sizeof(float));
+
+	
+}
+
+static void Node58Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node18[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node58[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node59Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbacktensorChainVec(Node58, 9 * sizeof(float));
+
+	
+}
+
+static void Node62Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node60[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node60[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node62[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node63Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node62[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node62[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node63[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node64Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node60[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node63[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node64[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node65Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackshiftPower5(Node64, 9 * sizeof(float));
+
+	
+}
+
+static void Node67Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {dim0, opIndexTuple[0]};
+				const uint32_t rIndexTuple[] = {opIndexTuple[1], dim0};
+				sum += Node1[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node67[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node68Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {dim0, opIndexTuple[0]};
+				const uint32_t rIndexTuple[] = {opIndexTuple[1], dim0};
+				sum += Node67[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node68[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node69Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixPowerTransposed3(Node68, 9 * sizeof(float));
+
+	
+}
+
+static void Node70Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorAdditionCode
+
+	for(uint32_t dim = 0; dim < 9; dim++)
+	{
+		Node70[dim] = Node1[dim] + Node1[dim];
+	}
+
+}
+
+static void Node71Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixDoubled(Node70, 9 * sizeof(float));
+
+	
+}
+
+static void Node72Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleContractOutputCallbackmatrixDoubledId(Node70, 9 * sizeof(float));
+
+	
+}
+
+static void Node74Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node1[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node3[rIndexTuple[0]];
+			}
+			
+			Node74[opIndex] = sum;
+		}
+	}
+}
+
+static const node_t * const nodeParentsModuleContract[] = {
+	&nodesModuleContract[0],
+	&nodesModuleContract[2],
+	&nodesModuleContract[0],
+	&nodesModuleContract[4],
+	&nodesModuleContract[6],
+	&nodesModuleContract[8],
+	&nodesModuleContract[10],
+	&nodesModuleContract[12],
+	&nodesModuleContract[14],
+	&nodesModuleContract[16],
+	&nodesModuleContract[18],
+	&nodesModuleContract[20],
+	&nodesModuleContract[22],
+	&nodesModuleContract[24],
+	&nodesModuleContract[26],
+	&nodesModuleContract[27],
+	&nodesModuleContract[28],
+	&nodesModuleContract[30],
+	&nodesModuleContract[31],
+	&nodesModuleContract[47],
+	&nodesModuleContract[33],
+	&nodesModuleContract[10],
+	&nodesModuleContract[35],
+	&nodesModuleContract[37],
+	&nodesModuleContract[38],
+	&nodesModuleContract[39],
+	&nodesModuleContract[41],
+	&nodesModuleContract[42],
+	&nodesModuleContract[44],
+	&nodesModuleContract[44],
+	&nodesModuleContract[0],
+};
+
+static node_t * const nodeChildrenModuleContract[] = {
+	&nodesModuleContract[1],
+	&nodesModuleContract[4],
+	&nodesModuleContract[47],
+	&nodesModuleContract[3],
+	&nodesModuleContract[5],
+	&nodesModuleContract[7],
+	&nodesModuleContract[9],
+	&nodesModuleContract[11],
+	&nodesModuleContract[35],
+	&nodesModuleContract[13],
+	&nodesModuleContract[15],
+	&nodesModuleContract[17],
+	&nodesModuleContract[19],
+	&nodesModuleContract[21],
+	&nodesModuleContract[23],
+	&nodesModuleContract[25],
+	&nodesModuleContract[27],
+	&nodesModuleContract[28],
+	&nodesModuleContract[29],
+	&nodesModuleContract[31],
+	&nodesModuleContract[32],
+	&nodesModuleContract[34],
+	&nodesModuleContract[36],
+	&nodesModuleContract[38],
+	&nodesModuleContract[39],
+	&nodesModuleContract[40],
+	&nodesModuleContract[42],
+	&nodesModuleContract[43],
+	&nodesModuleContract[45],
+	&nodesModuleContract[46],
+	&nodesModuleContract[33],
+};
+
+static node_t nodesModuleContract[] = {
+	{Node3Instruction, NULL, &nodeChildrenModuleContract[0], 0, 0, 3, 3, 0},
+	{Node4Instruction, &nodeParentsModuleContract[0], NULL, 0, 1, 0, 4, 0},
+	{Node5Instruction, NULL, &nodeChildrenModuleContract[3], 0, 0, 1, 5, 0},
+	{Node6Instruction, &nodeParentsModuleContract[1], NULL, 0, 1, 0, 6, 0},
+	{Node10Instruction, &nodeParentsModuleContract[2], &nodeChildrenModuleContract[4], 0, 1, 1, 10, 0},
+	{Node11Instruction, &nodeParentsModuleContract[3], NULL, 0, 1, 0, 11, 0},
+	{Node13Instruction, NULL, &nodeChildrenModuleContract[5], 0, 0, 1, 13, 0},
+	{Node14Instruction, &nodeParentsModuleContract[4], NULL, 0, 1, 0, 14, 0},
+	{Node16Instruction, NULL, &nodeChildrenModuleContract[6], 0, 0, 1, 16, 0},
+	{Node17Instruction, &nodeParentsModuleContract[5], NULL, 0, 1, 0, 17, 0},
+	{Node18Instruction, NULL, &nodeChildrenModuleContract[7], 0, 0, 2, 18, 0},
+	{Node19Instruction, &nodeParentsModuleContract[6], NULL, 0, 1, 0, 19, 0},
+	{Node20Instruction, NULL, &nodeChildrenModuleContract[9], 0, 0, 1, 20, 0},
+	{Node21Instruction, &nodeParentsModuleContract[7], NULL, 0, 1, 0, 21, 0},
+	{Node22Instruction, NULL, &nodeChildrenModuleContract[10], 0, 0, 1, 22, 0},
+	{Node23Instruction, &nodeParentsModuleContract[8], NULL, 0, 1, 0, 23, 0},
+	{Node26Instruction, NULL, &nodeChildrenModuleContract[11], 0, 0, 1, 26, 0},
+	{Node27Instruction, &nodeParentsModuleContract[9], NULL, 0, 1, 0, 27, 0},
+	{Node28Instruction, NULL, &nodeChildrenModuleContract[12], 0, 0, 1, 28, 0},
+	{Node29Instruction, &nodeParentsModuleContract[10], NULL, 0, 1, 0, 29, 0},
+	{Node37Instruction, NULL, &nodeChildrenModuleContract[13], 0, 0, 1, 37, 0},
+	{Node38Instruction, &nodeParentsModuleContract[11], NULL, 0, 1, 0, 38, 0},
+	{Node39Instruction, NULL, &nodeChildrenModuleContract[14], 0, 0, 1, 39, 0},
+	{Node40Instruction, &nodeParentsModuleContract[12], NULL, 0, 1, 0, 40, 0},
+	{Node41Instruction, NULL, &nodeChildrenModuleContract[15], 0, 0, 1, 41, 0},
+	{Node42Instruction, &nodeParentsModuleContract[13], NULL, 0, 1, 0, 42, 0},
+	{Node45Instruction, NULL, &nodeChildrenModuleContract[16], 0, 0, 1, 45, 0},
+	{Node46Instruction, &nodeParentsModuleContract[14], &nodeChildrenModuleContract[17], 0, 1, 1, 46, 0},
+	{Node47Instruction, &nodeParentsModuleContract[15], &nodeChildrenModuleContract[18], 0, 1, 1, 47, 0},
+	{Node48Instruction, &nodeParentsModuleContract[16], NULL, 0, 1, 0, 48, 0},
+	{Node50Instruction, NULL, &nodeChildrenModuleContract[19], 0, 0, 1, 50, 0},
+	{Node51Instruction, &nodeParentsModuleContract[17], &nodeChildrenModuleContract[20], 0, 1, 1, 51, 0},
+	{Node52Instruction, &nodeParentsModuleContract[18], NULL, 0, 1, 0, 52, 0},
+	{Node55Instruction, &nodeParentsModuleContract[19], &nodeChildrenModuleContract[21], 0, 1, 1, 55, 0},
+	{Node56Instruction, &nodeParentsModuleContract[20], NULL, 0, 1, 0, 56, 0},
+	{Node58Instruction, &nodeParentsModuleContract[21], &nodeChildrenModuleContract[22], 0, 1, 1, 58, 0},
+	{Node59Instruction, &nodeParentsModuleContract[22], NULL, 0, 1, 0, 59, 0},
+	{Node62Instruction, NULL, &nodeChildrenModuleContract[23], 0, 0, 1, 62, 0},
+	{Node63Instruction, &nodeParentsModuleContract[23], &nodeChildrenModuleContract[24], 0, 1, 1, 63, 0},
+	{Node64Instruction, &nodeParentsModuleContract[24], &nodeChildrenModuleContract[25], 0, 1, 1, 64, 0},
+	{Node65Instruction, &nodeParentsModuleContract[25], NULL, 0, 1, 0, 65, 0},
+	{Node67Instruction, NULL, &nodeChildrenModuleContract[26], 0, 0, 1, 67, 0},
+	{Node68Instruction, &nodeParentsModuleContract[26], &nodeChildrenModuleContract[27], 0, 1, 1, 68, 0},
+	{Node69Instruction, &nodeParentsModuleContract[27], NULL, 0, 1, 0, 69, 0},
+	{Node70Instruction, NULL, &nodeChildrenModuleContract[28], 0, 0, 2, 70, 0},
+	{Node71Instruction, &nodeParentsModuleContract[28], NULL, 0, 1, 0, 71, 0},
+	{Node72Instruction, &nodeParentsModuleContract[29], NULL, 0, 1, 0, 72, 0},
+	{Node74Instruction, &nodeParentsModuleContract[30], &nodeChildrenModuleContract[30], 0, 1, 1, 74, 0},
+};
+
+node_t * jobPoolInitNodesModuleContract[] = {&nodesModuleContract[0], &nodesModuleContract[2], &nodesModuleContract[6], &nodesModuleContract[8], &nodesModuleContract[10], &nodesModuleContract[12], &nodesModuleContract[14], &nodesModuleContract[16], &nodesModuleContract[18], &nodesModuleContract[20], &nodesModuleContract[22], &nodesModuleContract[24], &nodesModuleContract[26], &nodesModuleContract[30], &nodesModuleContract[37], &nodesModuleContract[41], &nodesModuleContract[44]};
+
+jobPoolInit_t jobPoolInitModuleContract = {
+	.Nodes = jobPoolInitNodesModuleContract,
+	.NodesNrOf = 17,
+	.JobsNrOfMax = 48,
+};
@@ -0,0 +1,1157 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+
+#include "DacModuleContractStatic.h"
+#include "InstructionsModuleContractStatic.h"
+
+extern DacModuleContractStaticOutputCallbackmatrixVecProd_t DacModuleContractStaticOutputCallbackmatrixVecProd;
+extern DacModuleContractStaticOutputCallbackvecMatrixProd_t DacModuleContractStaticOutputCallbackvecMatrixProd;
+extern DacModuleContractStaticOutputCallbackdenseLayer_t DacModuleContractStaticOutputCallbackdenseLayer;
+extern DacModuleContractStaticOutputCallbackmatrixProd1_t DacModuleContractStaticOutputCallbackmatrixProd1;
+extern DacModuleContractStaticOutputCallbacktensorVecContr2_t DacModuleContractStaticOutputCallbacktensorVecContr2;
+extern DacModuleContractStaticOutputCallbacktensorVecContr1_t DacModuleContractStaticOutputCallbacktensorVecContr1;
+extern DacModuleContractStaticOutputCallbacktensorMatrixContr1_t DacModuleContractStaticOutputCallbacktensorMatrixContr1;
+extern DacModuleContractStaticOutputCallbacktensorMatrixContr12_t DacModuleContractStaticOutputCallbacktensorMatrixContr12;
+extern DacModuleContractStaticOutputCallbackmatrixIdProd_t DacModuleContractStaticOutputCallbackmatrixIdProd;
+extern DacModuleContractStaticOutputCallbacktwoMatrixTrace_t DacModuleContractStaticOutputCallbacktwoMatrixTrace;
+extern DacModuleContractStaticOutputCallbackmatrixDeltaSumProd_t DacModuleContractStaticOutputCallbackmatrixDeltaSumProd;
+extern DacModuleContractStaticOutputCallbacktensorDeltaContr_t DacModuleContractStaticOutputCallbacktensorDeltaContr;
+extern DacModuleContractStaticOutputCallbackmatrixPlusDelta_t DacModuleContractStaticOutputCallbackmatrixPlusDelta;
+extern DacModuleContractStaticOutputCallbackmatrixProdRight_t DacModuleContractStaticOutputCallbackmatrixProdRight;
+extern DacModuleContractStaticOutputCallbackmatrixProdLeft_t DacModuleContractStaticOutputCallbackmatrixProdLeft;
+extern DacModuleContractStaticOutputCallbackmatrixChainVec_t DacModuleContractStaticOutputCallbackmatrixChainVec;
+extern DacModuleContractStaticOutputCallbacktensorChainVec_t DacModuleContractStaticOutputCallbacktensorChainVec;
+extern DacModuleContractStaticOutputCallbackshiftPower5_t DacModuleContractStaticOutputCallbackshiftPower5;
+extern DacModuleContractStaticOutputCallbackmatrixPowerTransposed3_t DacModuleContractStaticOutputCallbackmatrixPowerTransposed3;
+extern DacModuleContractStaticOutputCallbackmatrixDoubled_t DacModuleContractStaticOutputCallbackmatrixDoubled;
+extern DacModuleContractStaticOutputCallbackmatrixDoubledId_t DacModuleContractStaticOutputCallbackmatrixDoubledId;
+
+static const float Node1[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00};
+static const float Node2[3] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00};
+static const float Node9 __attribute__((unused)) = 2.000000000000000000000e+00;
+static const float Node12[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node15[27] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01};
+static const float Node36 __attribute__((unused)) = 2.500000000000000000000e+00;
+static const float Node60[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node61 __attribute__((unused)) = 5.000000000000000000000e+00;
+static const int32_t Node66 __attribute__((unused)) = 3;
+
+static float Node3[3] __attribute__((aligned(64)));
+static float Node5[3] __attribute__((aligned(64)));
+static float Node10[3] __attribute__((aligned(64)));
+static float Node13[9] __attribute__((aligned(64)));
+static float Node16[9] __attribute__((aligned(64)));
+static float Node18[9] __attribute__((aligned(64)));
+static float Node20[27] __attribute__((aligned(64)));
+static float Node22[3] __attribute__((aligned(64)));
+static float Node26[9] __attribute__((aligned(64)));
+static float Node28;
+static float Node37[9] __attribute__((aligned(64)));
+static float Node39[27] __attribute__((aligned(64)));
+static float Node41[9] __attribute__((aligned(64)));
+static float Node45[81] __attribute__((aligned(64)));
+static float Node46[81] __attribute__((aligned(64)));
+static float Node47[9] __attribute__((aligned(64)));
+static float Node50[81] __attribute__((aligned(64)));
+static float Node51[9] __attribute__((aligned(64)));
+static float Node55[3] __attribute__((aligned(64)));
+static float Node58[9] __attribute__((aligned(64)));
+static float Node62[9] __attribute__((aligned(64)));
+static float Node63[9] __attribute__((aligned(64)));
+static float Node64[9] __attribute__((aligned(64)));
+static float Node67[9] __attribute__((aligned(64)));
+static float Node68[9] __attribute__((aligned(64)));
+static float Node70[9] __attribute__((aligned(64)));
+static float Node74[3] __attribute__((aligned(64)));
+
+static void Node3Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node1[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node2[rIndexTuple[0]];
+			}
+			
+			Node3[opIndex] = sum;
+		}
+	}
+}
+
+static void Node4Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixVecProd(Node3, 3 * sizeof(float));
+
+	
+}
+
+static void Node5Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {dim0};
+				const uint32_t rIndexTuple[] = {opIndexTuple[0], dim0};
+				sum += Node2[lIndexTuple[0]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node5[opIndex] = sum;
+		}
+	}
+}
+
+static void Node6Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackvecMatrixProd(Node5, 3 * sizeof(float));
+
+	
+}
+
+static void Node10Instruction(void)
+{
+	// FusedElementWiseCode
+
+	for(uint32_t dim = 0; dim < 3; dim++)
+	{
+		Node10[dim] = (Node3[dim] + Node2[dim]) * Node9;
+	}
+
+}
+
+static void Node11Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackdenseLayer(Node10, 3 * sizeof(float));
+
+	
+}
+
+static void Node13Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node1[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node12[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node13[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node14Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixProd1(Node13, 9 * sizeof(float));
+
+	
+}
+
+static void Node16Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], opIndexTuple[1], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node15[lIndexTuple[0] * 9 + lIndexTuple[1] * 3 + lIndexTuple[2]] * Node2[rIndexTuple[0]];
+			}
+			
+			Node16[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node17Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbacktensorVecContr2(Node16, 9 * sizeof(float));
+
+	
+}
+
+static void Node18Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0, opIndexTuple[1]};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node15[lIndexTuple[0] * 9 + lIndexTuple[1] * 3 + lIndexTuple[2]] * Node2[rIndexTuple[0]];
+			}
+			
+			Node18[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node19Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbacktensorVecContr1(Node18, 9 * sizeof(float));
+
+	
+}
+
+static void Node20Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0, opIndexTuple[1]};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[2]};
+				sum += Node15[lIndexTuple[0] * 9 + lIndexTuple[1] * 3 + lIndexTuple[2]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node20[opIndex] = sum;
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node21Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbacktensorMatrixContr1(Node20, 27 * sizeof(float));
+
+	
+}
+
+static void Node22Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				for(int dim1 = 0; dim1 < 3; dim1++)
+				{
+					const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0, dim1};
+					const uint32_t rIndexTuple[] = {dim0, dim1};
+					sum += Node15[lIndexTuple[0] * 9 + lIndexTuple[1] * 3 + lIndexTuple[2]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+				}
+			}
+			
+			Node22[opIndex] = sum;
+		}
+	}
+}
+
+static void Node23Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbacktensorMatrixContr12(Node22, 3 * sizeof(float));
+
+	
+}
+
+static void Node26Instruction(void)
+{
+	// VectorScalarProductCode
+
+	for(uint32_t dim = 0; dim < 9; dim++)
+	{
+		Node26[dim] = Node1[dim] * Node9;
+	}
+
+}
+
+static void Node27Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixIdProd(Node26, 9 * sizeof(float));
+
+	
+}
+
+static void Node28Instruction(void)
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	float sum = 0;
+	for(int dim0 = 0; dim0 < 3; dim0++)
+	{
+		for(int dim1 = 0; dim1 < 3; dim1++)
+		{
+			const uint32_t argIndexTuple[] = {dim0, dim1};
+			const uint32_t kronIndexTuple[] = {dim0, dim1};
+			sum += Node1[argIndexTuple[0] * 3 + argIndexTuple[1] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 2.000000f;
+		}
+	}
+	
+	Node28 = sum;
+}
+
+static void Node29Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbacktwoMatrixTrace(&Node28, 1 * sizeof(float));
+
+	
+}
+
+static void Node37Instruction(void)
+{
+	// VectorScalarProductCode
+
+	for(uint32_t dim = 0; dim < 9; dim++)
+	{
+		Node37[dim] = Node1[dim] * Node36;
+	}
+
+}
+
+static void Node38Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixDeltaSumProd(Node37, 9 * sizeof(float));
+
+	
+}
+
+static void Node39Instruction(void)
+{
+	// VectorPermutationCode
+
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[2], opIndexTuple[0], opIndexTuple[1]};
+
+			Node39[opIndex] = Node15[argIndexTuple[0] * 9 + argIndexTuple[1] * 3 + argIndexTuple[2] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node40Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbacktensorDeltaContr(Node39, 27 * sizeof(float));
+
+	
+}
+
+static void Node41Instruction(void)
+{
+	// VectorAdditionCode
+
+	// VectorAdditionKroneckerDeltaCode
+
+	for(uint32_t dim = 0; dim < 9; dim++)
+	{
+		Node41[dim] = Node1[dim];
+	}
+	
+	for(uint32_t pair0 = 0; pair0 < 3; pair0++)
+	{
+		Node41[pair0 * 4] += 2.000000f;
+	}
+}
+
+static void Node42Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixPlusDelta(Node41, 9 * sizeof(float));
+
+	
+}
+
+static void Node45Instruction(void)
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {2, 3, 0, 1};
+	uint32_t opIndexTuple[] = {0, 0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 81; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[3] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t argIndexTuple[] = {opIndexTuple[3], dim0};
+				const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1], dim0, opIndexTuple[2]};
+				sum += Node1[argIndexTuple[0] * 3 + argIndexTuple[1] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * (kronIndexTuple[1] == kronIndexTuple[deltaPairs[1]]) * 1.000000f;
+			}
+			
+			Node45[opIndex] = sum;
+		}
+		
+		if(3 == ++opIndexTuple[2])
+		{
+			opIndexTuple[2] = 0;
+			if(3 == ++opIndexTuple[1])
+			{
+				opIndexTuple[1] = 0;
+				opIndexTuple[0]++;
+			}
+		}
+	}
+}
+
+static void Node46Instruction(void)
+{
+	// VectorPermutationCode
+
+	uint32_t opIndexTuple[] = {0, 0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 81; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[3] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[0], opIndexTuple[1], opIndexTuple[3], opIndexTuple[2]};
+
+			Node46[opIndex] = Node45[argIndexTuple[0] * 27 + argIndexTuple[1] * 9 + argIndexTuple[2] * 3 + argIndexTuple[3] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[2])
+		{
+			opIndexTuple[2] = 0;
+			if(3 == ++opIndexTuple[1])
+			{
+				opIndexTuple[1] = 0;
+				opIndexTuple[0]++;
+			}
+		}
+	}
+}
+
+static void Node47Instruction(void)
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				for(int dim1 = 0; dim1 < 3; dim1++)
+				{
+					const uint32_t argIndexTuple[] = {opIndexTuple[0], dim0, opIndexTuple[1], dim1};
+					const uint32_t kronIndexTuple[] = {dim0, dim1};
+					sum += Node46[argIndexTuple[0] * 27 + argIndexTuple[1] * 9 + argIndexTuple[2] * 3 + argIndexTuple[3] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f;
+				}
+			}
+			
+			Node47[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node48Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixProdRight(Node47, 9 * sizeof(float));
+
+	
+}
+
+static void Node50Instruction(void)
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {2, 3, 0, 1};
+	uint32_t opIndexTuple[] = {0, 0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 81; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[3] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t argIndexTuple[] = {dim0, opIndexTuple[3]};
+				const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1], opIndexTuple[2], dim0};
+				sum += Node12[argIndexTuple[0] * 3 + argIndexTuple[1] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * (kronIndexTuple[1] == kronIndexTuple[deltaPairs[1]]) * 1.000000f;
+			}
+			
+			Node50[opIndex] = sum;
+		}
+		
+		if(3 == ++opIndexTuple[2])
+		{
+			opIndexTuple[2] = 0;
+			if(3 == ++opIndexTuple[1])
+			{
+				opIndexTuple[1] = 0;
+				opIndexTuple[0]++;
+			}
+		}
+	}
+}
+
+static void Node51Instruction(void)
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				for(int dim1 = 0; dim1 < 3; dim1++)
+				{
+					const uint32_t argIndexTuple[] = {dim0, opIndexTuple[0], dim1, opIndexTuple[1]};
+					const uint32_t kronIndexTuple[] = {dim0, dim1};
+					sum += Node50[argIndexTuple[0] * 27 + argIndexTuple[1] * 9 + argIndexTuple[2] * 3 + argIndexTuple[3] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f;
+				}
+			}
+			
+			Node51[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node52Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixProdLeft(Node51, 9 * sizeof(float));
+
+	
+}
+
+static void Node55Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node1[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node74[rIndexTuple[0]];
+			}
+			
+			Node55[opIndex] = sum;
+		}
+	}
+}
+
+static void Node56Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixChainVec(Node55, 3 * sizeof(float));
+
+	
+}
+
+static void Node58Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node18[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node58[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node59Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbacktensorChainVec(Node58, 9 * sizeof(float));
+
+	
+}
+
+static void Node62Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node60[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node60[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node62[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node63Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node62[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node62[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node63[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node64Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0, opIndexTuple[1]};
+				sum += Node60[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node63[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node64[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node65Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackshiftPower5(Node64, 9 * sizeof(float));
+
+	
+}
+
+static void Node67Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {dim0, opIndexTuple[0]};
+				const uint32_t rIndexTuple[] = {opIndexTuple[1], dim0};
+				sum += Node1[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node67[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node68Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {dim0, opIndexTuple[0]};
+				const uint32_t rIndexTuple[] = {opIndexTuple[1], dim0};
+				sum += Node67[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node1[rIndexTuple[0] * 3 + rIndexTuple[1]];
+			}
+			
+			Node68[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node69Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixPowerTransposed3(Node68, 9 * sizeof(float));
+
+	
+}
+
+static void Node70Instruction(void)
+{
+	// VectorAdditionCode
+
+	for(uint32_t dim = 0; dim < 9; dim++)
+	{
+		Node70[dim] = Node1[dim] + Node1[dim];
+	}
+
+}
+
+static void Node71Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixDoubled(Node70, 9 * sizeof(float));
+
+	
+}
+
+static void Node72Instruction(void)
+{
+	// OutputCode
+
+	DacModuleContractStaticOutputCallbackmatrixDoubledId(Node70, 9 * sizeof(float));
+
+	
+}
+
+static void Node74Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node1[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node3[rIndexTuple[0]];
+			}
+			
+			Node74[opIndex] = sum;
+		}
+	}
+}
+
+static atomic_uint exeCntModuleContractStatic[48];
+static atomic_uint finalIterationModuleContractStatic;
+
+void InstructionsModuleContractStaticResetStatic(void)
+{
+	for(size_t node = 0; node < sizeof(exeCntModuleContractStatic) / sizeof(exeCntModuleContractStatic[0]); node++)
+	{
+		atomic_store_explicit(&exeCntModuleContractStatic[node], 0, memory_order_relaxed);
+	}
+
+	atomic_store_explicit(&finalIterationModuleContractStatic, UINT32_MAX, memory_order_relaxed);
+}
+
+static void Thread0Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	Node45Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[26], 1, memory_order_release);
+
+	Node46Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[27], 1, memory_order_release);
+
+	Node47Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[28], 1, memory_order_release);
+
+	Node26Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[16], 1, memory_order_release);
+
+	Node41Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[24], 1, memory_order_release);
+
+	WaitForCount(&exeCntModuleContractStatic[22], 1);
+	Node40Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[23], 1, memory_order_release);
+
+	WaitForCount(&exeCntModuleContractStatic[0], 1);
+	Node10Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[4], 1, memory_order_release);
+
+	Node27Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[17], 1, memory_order_release);
+
+	Node42Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[25], 1, memory_order_release);
+
+	Node48Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[29], 1, memory_order_release);
+
+	WaitForCount(&exeCntModuleContractStatic[0], 1);
+	Node4Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[1], 1, memory_order_release);
+
+	Node11Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[5], 1, memory_order_release);
+
+	WaitForCount(&exeCntModuleContractStatic[14], 1);
+	Node23Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[15], 1, memory_order_release);
+
+}
+
+static void Thread1Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	Node50Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[30], 1, memory_order_release);
+
+	Node51Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[31], 1, memory_order_release);
+
+	WaitForCount(&exeCntModuleContractStatic[10], 1);
+	Node58Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[33], 1, memory_order_release);
+
+	Node22Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[14], 1, memory_order_release);
+
+	Node37Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[20], 1, memory_order_release);
+
+	Node70Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[42], 1, memory_order_release);
+
+	Node5Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[2], 1, memory_order_release);
+
+	Node28Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[18], 1, memory_order_release);
+
+	WaitForCount(&exeCntModuleContractStatic[10], 1);
+	Node19Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[11], 1, memory_order_release);
+
+	Node38Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[21], 1, memory_order_release);
+
+	Node52Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[32], 1, memory_order_release);
+
+	Node59Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[34], 1, memory_order_release);
+
+	Node71Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[43], 1, memory_order_release);
+
+	Node72Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[44], 1, memory_order_release);
+
+	Node6Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[3], 1, memory_order_release);
+
+	Node29Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[19], 1, memory_order_release);
+
+}
+
+static void Thread2Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	Node62Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[35], 1, memory_order_release);
+
+	Node20Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[12], 1, memory_order_release);
+
+	Node18Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[10], 1, memory_order_release);
+
+	Node63Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[36], 1, memory_order_release);
+
+	Node67Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[39], 1, memory_order_release);
+
+	Node39Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[22], 1, memory_order_release);
+
+	Node3Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[0], 1, memory_order_release);
+
+	Node13Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[6], 1, memory_order_release);
+
+	Node16Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[8], 1, memory_order_release);
+
+	Node64Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[37], 1, memory_order_release);
+
+	Node68Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[40], 1, memory_order_release);
+
+	Node74Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[45], 1, memory_order_release);
+
+	Node21Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[13], 1, memory_order_release);
+
+	Node55Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[46], 1, memory_order_release);
+
+	Node14Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[7], 1, memory_order_release);
+
+	Node17Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[9], 1, memory_order_release);
+
+	Node65Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[38], 1, memory_order_release);
+
+	Node69Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[41], 1, memory_order_release);
+
+	Node56Instruction();
+	atomic_store_explicit(&exeCntModuleContractStatic[47], 1, memory_order_release);
+
+}
+
+static node_t nodesModuleContractStatic[] = {
+	{Thread0Instruction, NULL, NULL, 0, 0, 0, 0, 0},
+	{Thread1Instruction, NULL, NULL, 0, 0, 0, 1, 0},
+	{Thread2Instruction, NULL, NULL, 0, 0, 0, 2, 0},
+};
+
+node_t * jobPoolInitNodesModuleContractStatic[] = {
+	&nodesModuleContractStatic[0],
+	&nodesModuleContractStatic[1],
+	&nodesModuleContractStatic[2],
+};
+
+jobPoolInit_t jobPoolInitModuleContractStatic = {
+	.Nodes = jobPoolInitNodesModuleContractStatic,
+	.NodesNrOf = 3,
+	.JobsNrOfMax = 3,
+};
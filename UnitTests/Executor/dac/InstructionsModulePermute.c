@@ -0,0 +1,373 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+
+#include "DacModulePermute.h"
+#include "InstructionsModulePermute.h"
+
+extern DacModulePermuteOutputCallbackmatrixTranspose_t DacModulePermuteOutputCallbackmatrixTranspose;
+extern DacModulePermuteOutputCallbacktensorPermute_t DacModulePermuteOutputCallbacktensorPermute;
+extern DacModulePermuteOutputCallbackdMatrixTransposeContracted_t DacModulePermuteOutputCallbackdMatrixTransposeContracted;
+extern DacModulePermuteOutputCallbackprojVector_t DacModulePermuteOutputCallbackprojVector;
+extern DacModulePermuteOutputCallbackdProjVector_t DacModulePermuteOutputCallbackdProjVector;
+extern DacModulePermuteOutputCallbacktensorPermuteContracted_t DacModulePermuteOutputCallbacktensorPermuteContracted;
+extern DacModulePermuteOutputCallbackprojMatrixVector_t DacModulePermuteOutputCallbackprojMatrixVector;
+extern DacModulePermuteOutputCallbackdiagonalContracted_t DacModulePermuteOutputCallbackdiagonalContracted;
+extern DacModulePermuteOutputCallbackmatrixTransposeTwice_t DacModulePermuteOutputCallbackmatrixTransposeTwice;
+extern DacModulePermuteOutputCallbacktensorPermuteTwice_t DacModulePermuteOutputCallbacktensorPermuteTwice;
+
+static const float Node1[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00};
+static const float Node4[27] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01};
+static const float Node10[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00};
+static const float Node13[27] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00};
+static const float Node15[3] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00};
+
+static float arenaModulePermute_float[32] __attribute__((aligned(64))); // Memory plan: Intermediate arrays of 344 bytes share 128 bytes
+static float Node23;
+
+static void Node2Instruction(void)
+{
+	float * const restrict Node2 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// VectorPermutationCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[1], opIndexTuple[0]};
+
+			Node2[opIndex] = Node1[argIndexTuple[0] * 3 + argIndexTuple[1] * 1];
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node3Instruction(void)
+{
+	float * const restrict Node2 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// OutputCode
+
+	DacModulePermuteOutputCallbackmatrixTranspose(Node2, 9 * sizeof(float));
+
+	
+}
+
+static void Node5Instruction(void)
+{
+	float * const restrict Node5 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// VectorPermutationCode
+
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[2], opIndexTuple[1], opIndexTuple[0]};
+
+			Node5[opIndex] = Node4[argIndexTuple[0] * 9 + argIndexTuple[1] * 3 + argIndexTuple[2] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node6Instruction(void)
+{
+	float * const restrict Node5 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// OutputCode
+
+	DacModulePermuteOutputCallbacktensorPermute(Node5, 27 * sizeof(float));
+
+	
+}
+
+static void Node8Instruction(void)
+{
+	float * const restrict Node8 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// VectorPermutationCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[1], opIndexTuple[0]};
+
+			Node8[opIndex] = Node1[argIndexTuple[0] * 3 + argIndexTuple[1] * 1];
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node9Instruction(void)
+{
+	float * const restrict Node8 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// OutputCode
+
+	DacModulePermuteOutputCallbackdMatrixTransposeContracted(Node8, 9 * sizeof(float));
+
+	
+}
+
+static void Node11Instruction(void)
+{
+	float * const restrict Node11 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// VectorProjectionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[0]};
+
+			Node11[opIndex] = Node10[argIndexTuple[0] * 1];
+		}
+	}
+}
+
+static void Node12Instruction(void)
+{
+	float * const restrict Node11 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// OutputCode
+
+	DacModulePermuteOutputCallbackprojVector(Node11, 3 * sizeof(float));
+
+	
+}
+
+static void Node14Instruction(void)
+{
+	// OutputCode
+
+	DacModulePermuteOutputCallbackdProjVector(Node13, 27 * sizeof(float));
+
+	
+}
+
+static void Node17Instruction(void)
+{
+	float * const restrict Node17 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], opIndexTuple[1], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node4[lIndexTuple[0] + lIndexTuple[1] * 9 + lIndexTuple[2] * 3] * Node15[rIndexTuple[0]];
+			}
+			
+			Node17[opIndex] = sum;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node18Instruction(void)
+{
+	float * const restrict Node17 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// OutputCode
+
+	DacModulePermuteOutputCallbacktensorPermuteContracted(Node17, 9 * sizeof(float));
+
+	
+}
+
+static void Node20Instruction(void)
+{
+	float * const restrict Node20 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 2; opIndexRow += 2)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 2; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node1[3 + lIndexTuple[0] * 3 + lIndexTuple[1]] * Node15[rIndexTuple[0]];
+			}
+			
+			Node20[opIndex] = sum;
+		}
+	}
+}
+
+static void Node21Instruction(void)
+{
+	float * const restrict Node20 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// OutputCode
+
+	DacModulePermuteOutputCallbackprojMatrixVector(Node20, 2 * sizeof(float));
+
+	
+}
+
+static void Node23Instruction(void)
+{
+	// VectorContractionCode
+
+	float sum = 0;
+	for(int dim0 = 0; dim0 < 3; dim0++)
+	{
+		const uint32_t lIndexTuple[] = {dim0};
+		const uint32_t rIndexTuple[] = {dim0};
+		sum += Node1[lIndexTuple[0] * 4] * Node15[rIndexTuple[0]];
+	}
+	
+	Node23 = sum;
+}
+
+static void Node24Instruction(void)
+{
+	// OutputCode
+
+	DacModulePermuteOutputCallbackdiagonalContracted(&Node23, 1 * sizeof(float));
+
+	
+}
+
+static void Node27Instruction(void)
+{
+	// OutputCode
+
+	DacModulePermuteOutputCallbackmatrixTransposeTwice(Node1, 9 * sizeof(float));
+
+	
+}
+
+static void Node29Instruction(void)
+{
+	float * const restrict Node29 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// VectorPermutationCode
+
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[2], opIndexTuple[0], opIndexTuple[1]};
+
+			Node29[opIndex] = Node4[argIndexTuple[0] * 9 + argIndexTuple[1] * 3 + argIndexTuple[2] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node30Instruction(void)
+{
+	float * const restrict Node29 __attribute__((unused)) = __builtin_assume_aligned(&arenaModulePermute_float[0], 64);
+	
+	// OutputCode
+
+	DacModulePermuteOutputCallbacktensorPermuteTwice(Node29, 27 * sizeof(float));
+
+	
+}
+
+void InstructionsModulePermuteRunSequential(void)
+{
+	Node2Instruction();
+	Node3Instruction();
+	Node5Instruction();
+	Node6Instruction();
+	Node8Instruction();
+	Node9Instruction();
+	Node11Instruction();
+	Node12Instruction();
+	Node14Instruction();
+	Node17Instruction();
+	Node18Instruction();
+	Node20Instruction();
+	Node21Instruction();
+	Node23Instruction();
+	Node24Instruction();
+	Node27Instruction();
+	Node29Instruction();
+	Node30Instruction();
+}
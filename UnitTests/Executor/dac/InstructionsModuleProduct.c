@@ -0,0 +1,2776 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+
+#include "DacModuleProduct.h"
+#include "InstructionsModuleProduct.h"
+
+#ifndef __SSE2__
+#error "Instructions generated for __SSE2__, enable the target ISA!"
+#endif
+
+typedef uint8_t vecUint8_t __attribute__((vector_size(16)));
+typedef uint8_t vecUint8U_t __attribute__((vector_size(16), aligned(__alignof__(uint8_t))));
+typedef int8_t vecInt8_t __attribute__((vector_size(16)));
+typedef int8_t vecInt8U_t __attribute__((vector_size(16), aligned(__alignof__(int8_t))));
+typedef int32_t vecInt32_t __attribute__((vector_size(16)));
+typedef int32_t vecInt32U_t __attribute__((vector_size(16), aligned(__alignof__(int32_t))));
+typedef float vecFloat_t __attribute__((vector_size(16)));
+typedef float vecFloatU_t __attribute__((vector_size(16), aligned(__alignof__(float))));
+
+extern DacModuleProductOutputCallbackscalarScalarDiv_t DacModuleProductOutputCallbackscalarScalarDiv;
+extern DacModuleProductOutputCallbackdScalarScalarDivLeft_t DacModuleProductOutputCallbackdScalarScalarDivLeft;
+extern DacModuleProductOutputCallbackdScalarScalarDivRight_t DacModuleProductOutputCallbackdScalarScalarDivRight;
+extern DacModuleProductOutputCallbackscalarVecProd_t DacModuleProductOutputCallbackscalarVecProd;
+extern DacModuleProductOutputCallbackvecScalarProd_t DacModuleProductOutputCallbackvecScalarProd;
+extern DacModuleProductOutputCallbackvecVecProd_t DacModuleProductOutputCallbackvecVecProd;
+extern DacModuleProductOutputCallbackvecKronProd_t DacModuleProductOutputCallbackvecKronProd;
+extern DacModuleProductOutputCallbackkronVecProd_t DacModuleProductOutputCallbackkronVecProd;
+extern DacModuleProductOutputCallbackdVecScalarProdLeft_t DacModuleProductOutputCallbackdVecScalarProdLeft;
+extern DacModuleProductOutputCallbackdVecScalarProdRight_t DacModuleProductOutputCallbackdVecScalarProdRight;
+extern DacModuleProductOutputCallbackdVecVecProdLeft_t DacModuleProductOutputCallbackdVecVecProdLeft;
+extern DacModuleProductOutputCallbackdVecVecProdRight_t DacModuleProductOutputCallbackdVecVecProdRight;
+extern DacModuleProductOutputCallbackscalarSquared_t DacModuleProductOutputCallbackscalarSquared;
+extern DacModuleProductOutputCallbackdScalarSquaredBase_t DacModuleProductOutputCallbackdScalarSquaredBase;
+extern DacModuleProductOutputCallbackvectorSquared_t DacModuleProductOutputCallbackvectorSquared;
+extern DacModuleProductOutputCallbackdvectorSquaredBase_t DacModuleProductOutputCallbackdvectorSquaredBase;
+extern DacModuleProductOutputCallbackwideSum_t DacModuleProductOutputCallbackwideSum;
+extern DacModuleProductOutputCallbackmatrixProduct_t DacModuleProductOutputCallbackmatrixProduct;
+extern DacModuleProductOutputCallbackmatrixProductTransposed_t DacModuleProductOutputCallbackmatrixProductTransposed;
+extern DacModuleProductOutputCallbackmatrixProductEpilogue_t DacModuleProductOutputCallbackmatrixProductEpilogue;
+extern DacModuleProductOutputCallbackmatrixProductPermuted_t DacModuleProductOutputCallbackmatrixProductPermuted;
+extern DacModuleProductOutputCallbacksparseMatrixVector_t DacModuleProductOutputCallbacksparseMatrixVector;
+extern DacModuleProductOutputCallbacksymmetricMatrixVector_t DacModuleProductOutputCallbacksymmetricMatrixVector;
+extern DacModuleProductOutputCallbacksymmetricProduct_t DacModuleProductOutputCallbacksymmetricProduct;
+extern DacModuleProductOutputCallbacksymmetricProductVector_t DacModuleProductOutputCallbacksymmetricProductVector;
+extern DacModuleProductOutputCallbacklongVector_t DacModuleProductOutputCallbacklongVector;
+extern DacModuleProductOutputCallbacklongVectorCubed_t DacModuleProductOutputCallbacklongVectorCubed;
+extern DacModuleProductOutputCallbacklongVectorIsSmaller_t DacModuleProductOutputCallbacklongVectorIsSmaller;
+extern DacModuleProductOutputCallbackfusedChain_t DacModuleProductOutputCallbackfusedChain;
+extern DacModuleProductOutputCallbackfusedIsSmaller_t DacModuleProductOutputCallbackfusedIsSmaller;
+extern DacModuleProductOutputCallbackvectorSum_t DacModuleProductOutputCallbackvectorSum;
+extern DacModuleProductOutputCallbackvectorSumTimesOne_t DacModuleProductOutputCallbackvectorSumTimesOne;
+
+static const float Node1 __attribute__((unused)) = 4.200000000000000000000e+01;
+static const float Node2[16] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00};
+static const float Node3[16] __attribute__((aligned(64))) __attribute__((unused)) = {4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00};
+static const float Node4 __attribute__((unused)) = 2.000000000000000000000e+00;
+static const float Node5 __attribute__((unused)) = -1.000000000000000000000e+00;
+static const float Node60 __attribute__((unused)) = 1.000000000000000000000e+00;
+static const float Node65 __attribute__((unused)) = 3.000000000000000000000e+00;
+static const float Node68 __attribute__((unused)) = 4.000000000000000000000e+00;
+static const float Node71 __attribute__((unused)) = 5.000000000000000000000e+00;
+static const float Node74 __attribute__((unused)) = 6.000000000000000000000e+00;
+static const float Node77 __attribute__((unused)) = 7.000000000000000000000e+00;
+static const float Node80 __attribute__((unused)) = 8.000000000000000000000e+00;
+static const float Node83 __attribute__((unused)) = 9.000000000000000000000e+00;
+static const float Node86 __attribute__((unused)) = 1.000000000000000000000e+01;
+static const float Node89 __attribute__((unused)) = 1.100000000000000000000e+01;
+static const float Node92 __attribute__((unused)) = 1.200000000000000000000e+01;
+static const float Node95 __attribute__((unused)) = 1.300000000000000000000e+01;
+static const float Node98 __attribute__((unused)) = 1.400000000000000000000e+01;
+static const float Node101 __attribute__((unused)) = 1.500000000000000000000e+01;
+static const float Node104 __attribute__((unused)) = 1.600000000000000000000e+01;
+static const float Node107 __attribute__((unused)) = 1.700000000000000000000e+01;
+static const float Node110 __attribute__((unused)) = 1.800000000000000000000e+01;
+static const float Node113 __attribute__((unused)) = 1.900000000000000000000e+01;
+static const float Node116 __attribute__((unused)) = 2.000000000000000000000e+01;
+static const float Node119 __attribute__((unused)) = 2.100000000000000000000e+01;
+static const float Node122 __attribute__((unused)) = 2.200000000000000000000e+01;
+static const float Node125 __attribute__((unused)) = 2.300000000000000000000e+01;
+static const float Node128 __attribute__((unused)) = 2.400000000000000000000e+01;
+static const float Node131 __attribute__((unused)) = 2.500000000000000000000e+01;
+static const float Node134 __attribute__((unused)) = 2.600000000000000000000e+01;
+static const float Node137 __attribute__((unused)) = 2.700000000000000000000e+01;
+static const float Node140 __attribute__((unused)) = 2.800000000000000000000e+01;
+static const float Node143 __attribute__((unused)) = 2.900000000000000000000e+01;
+static const float Node146 __attribute__((unused)) = 3.000000000000000000000e+01;
+static const float Node149 __attribute__((unused)) = 3.100000000000000000000e+01;
+static const float Node152 __attribute__((unused)) = 3.200000000000000000000e+01;
+static const float Node155 __attribute__((unused)) = 3.300000000000000000000e+01;
+static const float Node158 __attribute__((unused)) = 3.400000000000000000000e+01;
+static const float Node161 __attribute__((unused)) = 3.500000000000000000000e+01;
+static const float Node164 __attribute__((unused)) = 3.600000000000000000000e+01;
+static const float Node167 __attribute__((unused)) = 3.700000000000000000000e+01;
+static const float Node170 __attribute__((unused)) = 3.800000000000000000000e+01;
+static const float Node173 __attribute__((unused)) = 3.900000000000000000000e+01;
+static const float Node176 __attribute__((unused)) = 4.000000000000000000000e+01;
+static const float Node179 __attribute__((unused)) = 4.100000000000000000000e+01;
+static const float Node185 __attribute__((unused)) = 4.300000000000000000000e+01;
+static const float Node188 __attribute__((unused)) = 4.400000000000000000000e+01;
+static const float Node191 __attribute__((unused)) = 4.500000000000000000000e+01;
+static const float Node194 __attribute__((unused)) = 4.600000000000000000000e+01;
+static const float Node197 __attribute__((unused)) = 4.700000000000000000000e+01;
+static const float Node200 __attribute__((unused)) = 4.800000000000000000000e+01;
+static const float Node203 __attribute__((unused)) = 4.900000000000000000000e+01;
+static const float Node206 __attribute__((unused)) = 5.000000000000000000000e+01;
+static const float Node209 __attribute__((unused)) = 5.100000000000000000000e+01;
+static const float Node212 __attribute__((unused)) = 5.200000000000000000000e+01;
+static const float Node215 __attribute__((unused)) = 5.300000000000000000000e+01;
+static const float Node218 __attribute__((unused)) = 5.400000000000000000000e+01;
+static const float Node221 __attribute__((unused)) = 5.500000000000000000000e+01;
+static const float Node224 __attribute__((unused)) = 5.600000000000000000000e+01;
+static const float Node227 __attribute__((unused)) = 5.700000000000000000000e+01;
+static const float Node230 __attribute__((unused)) = 5.800000000000000000000e+01;
+static const float Node233 __attribute__((unused)) = 5.900000000000000000000e+01;
+static const float Node236 __attribute__((unused)) = 6.000000000000000000000e+01;
+static const float Node239 __attribute__((unused)) = 6.100000000000000000000e+01;
+static const float Node242 __attribute__((unused)) = 6.200000000000000000000e+01;
+static const float Node245 __attribute__((unused)) = 6.300000000000000000000e+01;
+static const float Node248 __attribute__((unused)) = 6.400000000000000000000e+01;
+static const float Node251 __attribute__((unused)) = 6.500000000000000000000e+01;
+static const float Node254 __attribute__((unused)) = 6.600000000000000000000e+01;
+static const float Node257 __attribute__((unused)) = 6.700000000000000000000e+01;
+static const float Node260 __attribute__((unused)) = 6.800000000000000000000e+01;
+static const float Node263 __attribute__((unused)) = 6.900000000000000000000e+01;
+static const float Node266 __attribute__((unused)) = 7.000000000000000000000e+01;
+static const float Node269 __attribute__((unused)) = 7.100000000000000000000e+01;
+static const float Node272 __attribute__((unused)) = 7.200000000000000000000e+01;
+static const float Node275 __attribute__((unused)) = 7.300000000000000000000e+01;
+static const float Node278 __attribute__((unused)) = 7.400000000000000000000e+01;
+static const float Node281 __attribute__((unused)) = 7.500000000000000000000e+01;
+static const float Node284 __attribute__((unused)) = 7.600000000000000000000e+01;
+static const float Node287 __attribute__((unused)) = 7.700000000000000000000e+01;
+static const float Node290 __attribute__((unused)) = 7.800000000000000000000e+01;
+static const float Node293 __attribute__((unused)) = 7.900000000000000000000e+01;
+static const float Node296 __attribute__((unused)) = 8.000000000000000000000e+01;
+static const float Node299 __attribute__((unused)) = 8.100000000000000000000e+01;
+static const float Node302 __attribute__((unused)) = 8.200000000000000000000e+01;
+static const float Node305 __attribute__((unused)) = 8.300000000000000000000e+01;
+static const float Node308 __attribute__((unused)) = 8.400000000000000000000e+01;
+static const float Node311 __attribute__((unused)) = 8.500000000000000000000e+01;
+static const float Node314 __attribute__((unused)) = 8.600000000000000000000e+01;
+static const float Node317 __attribute__((unused)) = 8.700000000000000000000e+01;
+static const float Node320 __attribute__((unused)) = 8.800000000000000000000e+01;
+static const float Node323 __attribute__((unused)) = 8.900000000000000000000e+01;
+static const float Node326 __attribute__((unused)) = 9.000000000000000000000e+01;
+static const float Node329 __attribute__((unused)) = 9.100000000000000000000e+01;
+static const float Node332 __attribute__((unused)) = 9.200000000000000000000e+01;
+static const float Node335 __attribute__((unused)) = 9.300000000000000000000e+01;
+static const float Node338 __attribute__((unused)) = 9.400000000000000000000e+01;
+static const float Node341 __attribute__((unused)) = 9.500000000000000000000e+01;
+static const float Node344 __attribute__((unused)) = 9.600000000000000000000e+01;
+static const float Node347 __attribute__((unused)) = 9.700000000000000000000e+01;
+static const float Node350 __attribute__((unused)) = 9.800000000000000000000e+01;
+static const float Node353 __attribute__((unused)) = 9.900000000000000000000e+01;
+static const float Node356 __attribute__((unused)) = 1.000000000000000000000e+02;
+static const float Node360[4096] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node361[4096] __attribute__((aligned(64))) __attribute__((unused)) = {0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01, 3.700000000000000000000e+01, 3.800000000000000000000e+01, 3.900000000000000000000e+01, 4.000000000000000000000e+01, 4.100000000000000000000e+01, 4.200000000000000000000e+01, 4.300000000000000000000e+01, 4.400000000000000000000e+01, 4.500000000000000000000e+01, 4.600000000000000000000e+01, 4.700000000000000000000e+01, 4.800000000000000000000e+01, 4.900000000000000000000e+01, 5.000000000000000000000e+01, 5.100000000000000000000e+01, 5.200000000000000000000e+01, 5.300000000000000000000e+01, 5.400000000000000000000e+01, 5.500000000000000000000e+01, 5.600000000000000000000e+01, 5.700000000000000000000e+01, 5.800000000000000000000e+01, 5.900000000000000000000e+01, 6.000000000000000000000e+01, 6.100000000000000000000e+01, 6.200000000000000000000e+01, 6.300000000000000000000e+01};
+static const float Node373[16] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00};
+static const float Node374[16] __attribute__((aligned(64))) __attribute__((unused)) = {0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00};
+static const float Node378[16] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00};
+static const float Node382[16] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00};
+static const float Node389[48] __attribute__((aligned(64))) __attribute__((unused)) = {0.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00, 4.000000000000000000000e+00, 5.000000000000000000000e+00, 6.000000000000000000000e+00, 7.000000000000000000000e+00, 8.000000000000000000000e+00, 9.000000000000000000000e+00, 1.000000000000000000000e+01, 1.100000000000000000000e+01, 1.200000000000000000000e+01, 1.300000000000000000000e+01, 1.400000000000000000000e+01, 1.500000000000000000000e+01, 1.600000000000000000000e+01, 1.700000000000000000000e+01, 1.800000000000000000000e+01, 1.900000000000000000000e+01, 2.000000000000000000000e+01, 2.100000000000000000000e+01, 2.200000000000000000000e+01, 2.300000000000000000000e+01, 2.400000000000000000000e+01, 2.500000000000000000000e+01, 2.600000000000000000000e+01, 2.700000000000000000000e+01, 2.800000000000000000000e+01, 2.900000000000000000000e+01, 3.000000000000000000000e+01, 3.100000000000000000000e+01, 3.200000000000000000000e+01, 3.300000000000000000000e+01, 3.400000000000000000000e+01, 3.500000000000000000000e+01, 3.600000000000000000000e+01};
+static const float Node404 __attribute__((unused)) = 9.999999776482582092285e-03;
+static const int32_t Node376PackedArg[8] __attribute__((aligned(64))) __attribute__((unused)) = {7, 6, 5, 4, 3, 2, 1, 0};
+static const int32_t Node376PackedOp[8] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 2, 3, 4, 5, 6, 7};
+static const int32_t Node380PackedArg[9] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 0, 2, 0, 1, 2, 1, 2};
+static const int32_t Node380PackedElement[9] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 1, 2, 2, 3, 4, 4, 5};
+static const int32_t Node380PackedOp[9] __attribute__((aligned(64))) __attribute__((unused)) = {0, 0, 1, 0, 2, 1, 1, 2, 2};
+static const int32_t Node387PackedArg[9] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 0, 2, 0, 1, 2, 1, 2};
+static const int32_t Node387PackedElement[9] __attribute__((aligned(64))) __attribute__((unused)) = {0, 1, 1, 2, 2, 3, 4, 4, 5};
+static const int32_t Node387PackedOp[9] __attribute__((aligned(64))) __attribute__((unused)) = {0, 0, 1, 0, 2, 1, 1, 2, 2};
+
+static float Node6;
+static float Node7;
+static float Node14;
+static float Node16[16] __attribute__((aligned(64)));
+static float Node18[16] __attribute__((aligned(64)));
+static float Node20[16] __attribute__((aligned(64)));
+static float Node23[32] __attribute__((aligned(64)));
+static float Node24[16] __attribute__((aligned(64)));
+static float Node26[32] __attribute__((aligned(64)));
+static float Node27[16] __attribute__((aligned(64)));
+static float Node30[16] __attribute__((aligned(64)));
+static float Node34[32] __attribute__((aligned(64)));
+static float Node35[16] __attribute__((aligned(64)));
+static float Node38[32] __attribute__((aligned(64)));
+static float Node39[32] __attribute__((aligned(64)));
+static float Node40[16] __attribute__((aligned(64)));
+static float Node42;
+static float Node45;
+static float Node47;
+static float Node49[16] __attribute__((aligned(64)));
+static float Node54[16] __attribute__((aligned(64)));
+static float Node56[32] __attribute__((aligned(64)));
+static float Node57[16] __attribute__((aligned(64)));
+static float Node73[16] __attribute__((aligned(64)));
+static float Node85[16] __attribute__((aligned(64)));
+static float Node97[16] __attribute__((aligned(64)));
+static float Node109[16] __attribute__((aligned(64)));
+static float Node121[16] __attribute__((aligned(64)));
+static float Node133[16] __attribute__((aligned(64)));
+static float Node145[16] __attribute__((aligned(64)));
+static float Node157[16] __attribute__((aligned(64)));
+static float Node169[16] __attribute__((aligned(64)));
+static float Node181[16] __attribute__((aligned(64)));
+static float Node193[16] __attribute__((aligned(64)));
+static float Node205[16] __attribute__((aligned(64)));
+static float Node217[16] __attribute__((aligned(64)));
+static float Node229[16] __attribute__((aligned(64)));
+static float Node241[16] __attribute__((aligned(64)));
+static float Node253[16] __attribute__((aligned(64)));
+static float Node265[16] __attribute__((aligned(64)));
+static float Node277[16] __attribute__((aligned(64)));
+static float Node289[16] __attribute__((aligned(64)));
+static float Node301[16] __attribute__((aligned(64)));
+static float Node313[16] __attribute__((aligned(64)));
+static float Node325[16] __attribute__((aligned(64)));
+static float Node337[16] __attribute__((aligned(64)));
+static float Node349[16] __attribute__((aligned(64)));
+static float Node358[16] __attribute__((aligned(64)));
+static float Node362[4096] __attribute__((aligned(64)));
+static float Node364[4096] __attribute__((aligned(64)));
+static float Node368[4096] __attribute__((aligned(64)));
+static float Node371[4096] __attribute__((aligned(64)));
+static float Node375[16] __attribute__((aligned(64)));
+static float Node376[16] __attribute__((aligned(64)));
+static float Node380[16] __attribute__((aligned(64)));
+static float Node383[16] __attribute__((aligned(64)));
+static float Node385[16] __attribute__((aligned(64)));
+static float Node386[16] __attribute__((aligned(64)));
+static float Node387[16] __attribute__((aligned(64)));
+static float Node392[48] __attribute__((aligned(64)));
+static float Node395[48] __attribute__((aligned(64)));
+static int32_t Node397;
+static float Node399[48] __attribute__((aligned(64)));
+static float Node401[48] __attribute__((aligned(64)));
+static int32_t Node407;
+static float Node409[16] __attribute__((aligned(64)));
+
+static node_t nodesModuleProduct[]; // Initialized below
+
+static void Node6Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorPowerCode
+
+	Node6 = __builtin_powif(Node4, -1);
+}
+
+static void Node7Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorScalarProductCode
+
+	Node7 = Node1 * Node6;
+}
+
+static void Node8Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackscalarScalarDiv(&Node7, 1 * sizeof(float));
+
+	
+}
+
+static void Node9Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackdScalarScalarDivLeft(&Node6, 1 * sizeof(float));
+
+	
+}
+
+static void Node14Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	Node14 = (Node5 * (powf(Node4, (Node5 + Node5)))) * Node1;
+}
+
+static void Node15Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackdScalarScalarDivRight(&Node14, 1 * sizeof(float));
+
+	
+}
+
+static void Node16Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorScalarProductCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node16[dim]) = Node1 * (*(const vecFloat_t *) &Node2[dim]);
+		}
+	}
+
+}
+
+static void Node17Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackscalarVecProd(Node16, 3 * sizeof(float));
+
+	
+}
+
+static void Node18Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorScalarProductCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node18[dim]) = (*(const vecFloat_t *) &Node2[dim]) * Node1;
+		}
+	}
+
+}
+
+static void Node19Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackvecScalarProd(Node18, 3 * sizeof(float));
+
+	
+}
+
+static void Node20Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorVectorProductCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			const uint32_t lIndexTuple[] = {opIndexTuple[0]};
+			const uint32_t rIndexTuple[] = {opIndexTuple[1]};
+			Node20[opIndex] = Node2[lIndexTuple[0] * 1] * Node3[rIndexTuple[0] * 1];
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node21Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackvecVecProd(Node20, 9 * sizeof(float));
+
+	
+}
+
+static void Node23Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorVectorProductCode
+
+	// VectorVectorProductKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t vecIndexTuple[] = {opIndexTuple[0]};
+			const uint32_t kronIndexTuple[] = {opIndexTuple[1], opIndexTuple[2]};
+			Node23[opIndex] = (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 2.000000f * Node2[vecIndexTuple[0] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node24Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				for(int dim1 = 0; dim1 < 3; dim1++)
+				{
+					const uint32_t argIndexTuple[] = {opIndexTuple[0], dim0, dim1};
+					const uint32_t kronIndexTuple[] = {dim0, dim1};
+					sum += Node23[argIndexTuple[0] * 9 + argIndexTuple[1] * 3 + argIndexTuple[2] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 2.000000f;
+				}
+			}
+			
+			Node24[opIndex] = sum;
+		}
+	}
+}
+
+static void Node25Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackvecKronProd(Node24, 3 * sizeof(float));
+
+	
+}
+
+static void Node26Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorVectorProductCode
+
+	// VectorVectorProductKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t vecIndexTuple[] = {opIndexTuple[2]};
+			const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1]};
+			Node26[opIndex] = (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 2.000000f * Node2[vecIndexTuple[0] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node27Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				for(int dim1 = 0; dim1 < 3; dim1++)
+				{
+					const uint32_t argIndexTuple[] = {dim0, dim1, opIndexTuple[0]};
+					const uint32_t kronIndexTuple[] = {dim0, dim1};
+					sum += Node26[argIndexTuple[0] * 9 + argIndexTuple[1] * 3 + argIndexTuple[2] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 2.000000f;
+				}
+			}
+			
+			Node27[opIndex] = sum;
+		}
+	}
+}
+
+static void Node28Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackkronVecProd(Node27, 3 * sizeof(float));
+
+	
+}
+
+static void Node30Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorScalarProductCode
+
+	// VectorScalarProductKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			Node30[opIndex] = (opIndexTuple[0] == opIndexTuple[deltaPairs[0]]) * 1.000000f * Node1;
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node31Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackdVecScalarProdLeft(Node30, 9 * sizeof(float));
+
+	
+}
+
+static void Node32Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackdVecScalarProdRight(Node2, 3 * sizeof(float));
+
+	
+}
+
+static void Node34Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorVectorProductCode
+
+	// VectorVectorProductKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t vecIndexTuple[] = {opIndexTuple[2]};
+			const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1]};
+			Node34[opIndex] = (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f * Node3[vecIndexTuple[0] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node35Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				for(int dim1 = 0; dim1 < 3; dim1++)
+				{
+					const uint32_t argIndexTuple[] = {dim0, dim1, opIndexTuple[0]};
+					const uint32_t kronIndexTuple[] = {dim0, dim1};
+					sum += Node34[argIndexTuple[0] * 9 + argIndexTuple[1] * 3 + argIndexTuple[2] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 2.000000f;
+				}
+			}
+			
+			Node35[opIndex] = sum;
+		}
+	}
+}
+
+static void Node36Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackdVecVecProdLeft(Node35, 3 * sizeof(float));
+
+	
+}
+
+static void Node38Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorVectorProductCode
+
+	// VectorVectorProductKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t vecIndexTuple[] = {opIndexTuple[2]};
+			const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1]};
+			Node38[opIndex] = (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f * Node2[vecIndexTuple[0] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node39Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorPermutationCode
+
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[0], opIndexTuple[2], opIndexTuple[1]};
+
+			Node39[opIndex] = Node38[argIndexTuple[0] * 9 + argIndexTuple[1] * 3 + argIndexTuple[2] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node40Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorContractionKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				for(int dim1 = 0; dim1 < 3; dim1++)
+				{
+					const uint32_t argIndexTuple[] = {dim0, opIndexTuple[0], dim1};
+					const uint32_t kronIndexTuple[] = {dim0, dim1};
+					sum += Node39[argIndexTuple[0] * 9 + argIndexTuple[1] * 3 + argIndexTuple[2] * 1] * (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 2.000000f;
+				}
+			}
+			
+			Node40[opIndex] = sum;
+		}
+	}
+}
+
+static void Node41Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackdVecVecProdRight(Node40, 3 * sizeof(float));
+
+	
+}
+
+static void Node42Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorPowerCode
+
+	Node42 = __builtin_powif(Node1, 2);
+}
+
+static void Node43Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackscalarSquared(&Node42, 1 * sizeof(float));
+
+	
+}
+
+static void Node45Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorAdditionCode
+
+	Node45 = Node4 + Node5;
+}
+
+static void Node47Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	Node47 = Node4 * (powf(Node1, Node45));
+}
+
+static void Node48Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackdScalarSquaredBase(&Node47, 1 * sizeof(float));
+
+	
+}
+
+static void Node49Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorPowerCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			for(uint32_t lane = 0; lane < 4; lane++) { Node49[dim + lane] = __builtin_powif(Node2[dim + lane], 2); }
+		}
+	}
+
+}
+
+static void Node50Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackvectorSquared(Node49, 3 * sizeof(float));
+
+	
+}
+
+static void Node54Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	for(uint32_t dim = 0; dim < 3; dim++)
+	{
+		Node54[dim] = Node4 * (powf(Node2[dim], Node45));
+	}
+
+}
+
+static void Node56Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorVectorProductCode
+
+	// VectorVectorProductKroneckerDeltaCode
+
+	const uint32_t deltaPairs[] = {1, 0};
+	uint32_t opIndexTuple[] = {0, 0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 27; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[2] = opIndexInRow;
+
+			const uint32_t vecIndexTuple[] = {opIndexTuple[2]};
+			const uint32_t kronIndexTuple[] = {opIndexTuple[0], opIndexTuple[1]};
+			Node56[opIndex] = (kronIndexTuple[0] == kronIndexTuple[deltaPairs[0]]) * 1.000000f * Node54[vecIndexTuple[0] * 1];
+		}
+		
+		if(3 == ++opIndexTuple[1])
+		{
+			opIndexTuple[1] = 0;
+			opIndexTuple[0]++;
+		}
+	}
+}
+
+static void Node57Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorJoinIndicesCode
+
+	uint32_t opIndexTuple[] = {0, 0};
+	for(size_t opIndexRow = 0; opIndexRow < 9; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[1] = opIndexInRow;
+
+			const uint32_t argIndexTuple[] = {opIndexTuple[0], opIndexTuple[1], opIndexTuple[1]};
+
+			Node57[opIndex] = Node56[argIndexTuple[0] * 9 + argIndexTuple[1] * 3 + argIndexTuple[2] * 1];
+		}
+		
+		opIndexTuple[0]++;
+	}
+}
+
+static void Node58Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackdvectorSquaredBase(Node57, 9 * sizeof(float));
+
+	
+}
+
+static void Node73Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node73[dim]) = ((((*(const vecFloat_t *) &Node18[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node4)) + ((*(const vecFloat_t *) &Node18[dim]) * Node65)) + ((*(const vecFloat_t *) &Node18[dim]) * Node68)) + ((*(const vecFloat_t *) &Node18[dim]) * Node71);
+		}
+	}
+
+}
+
+static void Node85Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node85[dim]) = ((((*(const vecFloat_t *) &Node73[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node74)) + ((*(const vecFloat_t *) &Node18[dim]) * Node77)) + ((*(const vecFloat_t *) &Node18[dim]) * Node80)) + ((*(const vecFloat_t *) &Node18[dim]) * Node83);
+		}
+	}
+
+}
+
+static void Node97Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node97[dim]) = ((((*(const vecFloat_t *) &Node85[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node86)) + ((*(const vecFloat_t *) &Node18[dim]) * Node89)) + ((*(const vecFloat_t *) &Node18[dim]) * Node92)) + ((*(const vecFloat_t *) &Node18[dim]) * Node95);
+		}
+	}
+
+}
+
+static void Node109Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node109[dim]) = ((((*(const vecFloat_t *) &Node97[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node98)) + ((*(const vecFloat_t *) &Node18[dim]) * Node101)) + ((*(const vecFloat_t *) &Node18[dim]) * Node104)) + ((*(const vecFloat_t *) &Node18[dim]) * Node107);
+		}
+	}
+
+}
+
+static void Node121Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node121[dim]) = ((((*(const vecFloat_t *) &Node109[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node110)) + ((*(const vecFloat_t *) &Node18[dim]) * Node113)) + ((*(const vecFloat_t *) &Node18[dim]) * Node116)) + ((*(const vecFloat_t *) &Node18[dim]) * Node119);
+		}
+	}
+
+}
+
+static void Node133Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node133[dim]) = ((((*(const vecFloat_t *) &Node121[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node122)) + ((*(const vecFloat_t *) &Node18[dim]) * Node125)) + ((*(const vecFloat_t *) &Node18[dim]) * Node128)) + ((*(const vecFloat_t *) &Node18[dim]) * Node131);
+		}
+	}
+
+}
+
+static void Node145Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node145[dim]) = ((((*(const vecFloat_t *) &Node133[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node134)) + ((*(const vecFloat_t *) &Node18[dim]) * Node137)) + ((*(const vecFloat_t *) &Node18[dim]) * Node140)) + ((*(const vecFloat_t *) &Node18[dim]) * Node143);
+		}
+	}
+
+}
+
+static void Node157Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node157[dim]) = ((((*(const vecFloat_t *) &Node145[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node146)) + ((*(const vecFloat_t *) &Node18[dim]) * Node149)) + ((*(const vecFloat_t *) &Node18[dim]) * Node152)) + ((*(const vecFloat_t *) &Node18[dim]) * Node155);
+		}
+	}
+
+}
+
+static void Node169Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node169[dim]) = ((((*(const vecFloat_t *) &Node157[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node158)) + ((*(const vecFloat_t *) &Node18[dim]) * Node161)) + ((*(const vecFloat_t *) &Node18[dim]) * Node164)) + ((*(const vecFloat_t *) &Node18[dim]) * Node167);
+		}
+	}
+
+}
+
+static void Node181Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node181[dim]) = ((((*(const vecFloat_t *) &Node169[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node170)) + ((*(const vecFloat_t *) &Node18[dim]) * Node173)) + ((*(const vecFloat_t *) &Node18[dim]) * Node176)) + ((*(const vecFloat_t *) &Node18[dim]) * Node179);
+		}
+	}
+
+}
+
+static void Node193Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node193[dim]) = ((((*(const vecFloat_t *) &Node181[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node1)) + ((*(const vecFloat_t *) &Node18[dim]) * Node185)) + ((*(const vecFloat_t *) &Node18[dim]) * Node188)) + ((*(const vecFloat_t *) &Node18[dim]) * Node191);
+		}
+	}
+
+}
+
+static void Node205Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node205[dim]) = ((((*(const vecFloat_t *) &Node193[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node194)) + ((*(const vecFloat_t *) &Node18[dim]) * Node197)) + ((*(const vecFloat_t *) &Node18[dim]) * Node200)) + ((*(const vecFloat_t *) &Node18[dim]) * Node203);
+		}
+	}
+
+}
+
+static void Node217Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node217[dim]) = ((((*(const vecFloat_t *) &Node205[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node206)) + ((*(const vecFloat_t *) &Node18[dim]) * Node209)) + ((*(const vecFloat_t *) &Node18[dim]) * Node212)) + ((*(const vecFloat_t *) &Node18[dim]) * Node215);
+		}
+	}
+
+}
+
+static void Node229Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node229[dim]) = ((((*(const vecFloat_t *) &Node217[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node218)) + ((*(const vecFloat_t *) &Node18[dim]) * Node221)) + ((*(const vecFloat_t *) &Node18[dim]) * Node224)) + ((*(const vecFloat_t *) &Node18[dim]) * Node227);
+		}
+	}
+
+}
+
+static void Node241Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node241[dim]) = ((((*(const vecFloat_t *) &Node229[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node230)) + ((*(const vecFloat_t *) &Node18[dim]) * Node233)) + ((*(const vecFloat_t *) &Node18[dim]) * Node236)) + ((*(const vecFloat_t *) &Node18[dim]) * Node239);
+		}
+	}
+
+}
+
+static void Node253Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node253[dim]) = ((((*(const vecFloat_t *) &Node241[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node242)) + ((*(const vecFloat_t *) &Node18[dim]) * Node245)) + ((*(const vecFloat_t *) &Node18[dim]) * Node248)) + ((*(const vecFloat_t *) &Node18[dim]) * Node251);
+		}
+	}
+
+}
+
+static void Node265Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node265[dim]) = ((((*(const vecFloat_t *) &Node253[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node254)) + ((*(const vecFloat_t *) &Node18[dim]) * Node257)) + ((*(const vecFloat_t *) &Node18[dim]) * Node260)) + ((*(const vecFloat_t *) &Node18[dim]) * Node263);
+		}
+	}
+
+}
+
+static void Node277Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node277[dim]) = ((((*(const vecFloat_t *) &Node265[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node266)) + ((*(const vecFloat_t *) &Node18[dim]) * Node269)) + ((*(const vecFloat_t *) &Node18[dim]) * Node272)) + ((*(const vecFloat_t *) &Node18[dim]) * Node275);
+		}
+	}
+
+}
+
+static void Node289Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node289[dim]) = ((((*(const vecFloat_t *) &Node277[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node278)) + ((*(const vecFloat_t *) &Node18[dim]) * Node281)) + ((*(const vecFloat_t *) &Node18[dim]) * Node284)) + ((*(const vecFloat_t *) &Node18[dim]) * Node287);
+		}
+	}
+
+}
+
+static void Node301Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node301[dim]) = ((((*(const vecFloat_t *) &Node289[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node290)) + ((*(const vecFloat_t *) &Node18[dim]) * Node293)) + ((*(const vecFloat_t *) &Node18[dim]) * Node296)) + ((*(const vecFloat_t *) &Node18[dim]) * Node299);
+		}
+	}
+
+}
+
+static void Node313Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node313[dim]) = ((((*(const vecFloat_t *) &Node301[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node302)) + ((*(const vecFloat_t *) &Node18[dim]) * Node305)) + ((*(const vecFloat_t *) &Node18[dim]) * Node308)) + ((*(const vecFloat_t *) &Node18[dim]) * Node311);
+		}
+	}
+
+}
+
+static void Node325Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node325[dim]) = ((((*(const vecFloat_t *) &Node313[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node314)) + ((*(const vecFloat_t *) &Node18[dim]) * Node317)) + ((*(const vecFloat_t *) &Node18[dim]) * Node320)) + ((*(const vecFloat_t *) &Node18[dim]) * Node323);
+		}
+	}
+
+}
+
+static void Node337Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node337[dim]) = ((((*(const vecFloat_t *) &Node325[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node326)) + ((*(const vecFloat_t *) &Node18[dim]) * Node329)) + ((*(const vecFloat_t *) &Node18[dim]) * Node332)) + ((*(const vecFloat_t *) &Node18[dim]) * Node335);
+		}
+	}
+
+}
+
+static void Node349Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node349[dim]) = ((((*(const vecFloat_t *) &Node337[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node338)) + ((*(const vecFloat_t *) &Node18[dim]) * Node341)) + ((*(const vecFloat_t *) &Node18[dim]) * Node344)) + ((*(const vecFloat_t *) &Node18[dim]) * Node347);
+		}
+	}
+
+}
+
+static void Node358Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node358[dim]) = (((*(const vecFloat_t *) &Node349[dim]) + ((*(const vecFloat_t *) &Node18[dim]) * Node350)) + ((*(const vecFloat_t *) &Node18[dim]) * Node353)) + ((*(const vecFloat_t *) &Node18[dim]) * Node356);
+		}
+	}
+
+}
+
+static void Node359Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackwideSum(Node358, 3 * sizeof(float));
+
+	
+}
+
+static void Node362Tile0Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node362[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 0; opIndex < 1024; opIndex++)
+	{
+		Node362[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node361[(kBlock + k) * 64 + (nBlock + n) * 1];
+				}
+			}
+
+			size_t m = 0;
+			for(; m + 4 <= 16; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node362[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node362[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node362[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node362[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node360[(m + 0) * 64 + (kBlock + k) * 1];
+					const float l1 = Node360[(m + 1) * 64 + (kBlock + k) * 1];
+					const float l2 = Node360[(m + 2) * 64 + (kBlock + k) * 1];
+					const float l3 = Node360[(m + 3) * 64 + (kBlock + k) * 1];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 16; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node362[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node360[(m + 0) * 64 + (kBlock + k) * 1];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node362Tile1Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node362[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 1024; opIndex < 2048; opIndex++)
+	{
+		Node362[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node361[(kBlock + k) * 64 + (nBlock + n) * 1];
+				}
+			}
+
+			size_t m = 16;
+			for(; m + 4 <= 32; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node362[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node362[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node362[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node362[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node360[(m + 0) * 64 + (kBlock + k) * 1];
+					const float l1 = Node360[(m + 1) * 64 + (kBlock + k) * 1];
+					const float l2 = Node360[(m + 2) * 64 + (kBlock + k) * 1];
+					const float l3 = Node360[(m + 3) * 64 + (kBlock + k) * 1];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 32; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node362[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node360[(m + 0) * 64 + (kBlock + k) * 1];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node362Tile2Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node362[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 2048; opIndex < 3072; opIndex++)
+	{
+		Node362[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node361[(kBlock + k) * 64 + (nBlock + n) * 1];
+				}
+			}
+
+			size_t m = 32;
+			for(; m + 4 <= 48; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node362[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node362[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node362[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node362[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node360[(m + 0) * 64 + (kBlock + k) * 1];
+					const float l1 = Node360[(m + 1) * 64 + (kBlock + k) * 1];
+					const float l2 = Node360[(m + 2) * 64 + (kBlock + k) * 1];
+					const float l3 = Node360[(m + 3) * 64 + (kBlock + k) * 1];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 48; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node362[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node360[(m + 0) * 64 + (kBlock + k) * 1];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node362Tile3Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node362[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 3072; opIndex < 4096; opIndex++)
+	{
+		Node362[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node361[(kBlock + k) * 64 + (nBlock + n) * 1];
+				}
+			}
+
+			size_t m = 48;
+			for(; m + 4 <= 64; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node362[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node362[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node362[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node362[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node360[(m + 0) * 64 + (kBlock + k) * 1];
+					const float l1 = Node360[(m + 1) * 64 + (kBlock + k) * 1];
+					const float l2 = Node360[(m + 2) * 64 + (kBlock + k) * 1];
+					const float l3 = Node360[(m + 3) * 64 + (kBlock + k) * 1];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 64; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node362[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node360[(m + 0) * 64 + (kBlock + k) * 1];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node363Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackmatrixProduct(Node362, 4096 * sizeof(float));
+
+	
+}
+
+static void Node364Tile0Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node364[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 0; opIndex < 1024; opIndex++)
+	{
+		Node364[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node360[(kBlock + k) * 1 + (nBlock + n) * 64];
+				}
+			}
+
+			size_t m = 0;
+			for(; m + 4 <= 16; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node364[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node364[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node364[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node364[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					const float l1 = Node361[(m + 1) * 1 + (kBlock + k) * 64];
+					const float l2 = Node361[(m + 2) * 1 + (kBlock + k) * 64];
+					const float l3 = Node361[(m + 3) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 16; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node364[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node364Tile1Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node364[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 1024; opIndex < 2048; opIndex++)
+	{
+		Node364[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node360[(kBlock + k) * 1 + (nBlock + n) * 64];
+				}
+			}
+
+			size_t m = 16;
+			for(; m + 4 <= 32; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node364[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node364[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node364[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node364[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					const float l1 = Node361[(m + 1) * 1 + (kBlock + k) * 64];
+					const float l2 = Node361[(m + 2) * 1 + (kBlock + k) * 64];
+					const float l3 = Node361[(m + 3) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 32; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node364[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node364Tile2Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node364[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 2048; opIndex < 3072; opIndex++)
+	{
+		Node364[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node360[(kBlock + k) * 1 + (nBlock + n) * 64];
+				}
+			}
+
+			size_t m = 32;
+			for(; m + 4 <= 48; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node364[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node364[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node364[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node364[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					const float l1 = Node361[(m + 1) * 1 + (kBlock + k) * 64];
+					const float l2 = Node361[(m + 2) * 1 + (kBlock + k) * 64];
+					const float l3 = Node361[(m + 3) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 48; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node364[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node364Tile3Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node364[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 3072; opIndex < 4096; opIndex++)
+	{
+		Node364[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node360[(kBlock + k) * 1 + (nBlock + n) * 64];
+				}
+			}
+
+			size_t m = 48;
+			for(; m + 4 <= 64; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node364[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node364[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node364[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node364[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					const float l1 = Node361[(m + 1) * 1 + (kBlock + k) * 64];
+					const float l2 = Node361[(m + 2) * 1 + (kBlock + k) * 64];
+					const float l3 = Node361[(m + 3) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 64; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node364[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node365Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackmatrixProductTransposed(Node364, 4096 * sizeof(float));
+
+	
+}
+
+static void Node368Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 4096; dim += 4)
+		{
+			(*(vecFloat_t *) &Node368[dim]) = ((*(const vecFloat_t *) &Node362[dim]) + (*(const vecFloat_t *) &Node361[dim])) * Node4;
+		}
+	}
+
+}
+
+static void Node369Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackmatrixProductEpilogue(Node368, 4096 * sizeof(float));
+
+	
+}
+
+static void Node371Tile0Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node371[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 0; opIndex < 1024; opIndex++)
+	{
+		Node371[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node361[(kBlock + k) * 64 + (nBlock + n) * 1];
+				}
+			}
+
+			size_t m = 0;
+			for(; m + 4 <= 16; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node371[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node371[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node371[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node371[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					const float l1 = Node361[(m + 1) * 1 + (kBlock + k) * 64];
+					const float l2 = Node361[(m + 2) * 1 + (kBlock + k) * 64];
+					const float l3 = Node361[(m + 3) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 16; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node371[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node371Tile1Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node371[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 1024; opIndex < 2048; opIndex++)
+	{
+		Node371[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node361[(kBlock + k) * 64 + (nBlock + n) * 1];
+				}
+			}
+
+			size_t m = 16;
+			for(; m + 4 <= 32; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node371[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node371[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node371[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node371[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					const float l1 = Node361[(m + 1) * 1 + (kBlock + k) * 64];
+					const float l2 = Node361[(m + 2) * 1 + (kBlock + k) * 64];
+					const float l3 = Node361[(m + 3) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 32; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node371[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node371Tile2Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node371[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 2048; opIndex < 3072; opIndex++)
+	{
+		Node371[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node361[(kBlock + k) * 64 + (nBlock + n) * 1];
+				}
+			}
+
+			size_t m = 32;
+			for(; m + 4 <= 48; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node371[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node371[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node371[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node371[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					const float l1 = Node361[(m + 1) * 1 + (kBlock + k) * 64];
+					const float l2 = Node361[(m + 2) * 1 + (kBlock + k) * 64];
+					const float l3 = Node361[(m + 3) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 48; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node371[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node371Tile3Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// VectorMatrixProductCode
+
+	// Node371[64][64] = l[64][64] * r[64][64]
+	for(size_t opIndex = 3072; opIndex < 4096; opIndex++)
+	{
+		Node371[opIndex] = 0;
+	}
+
+	float rPacked[64][64] __attribute__((aligned(64)));
+	for(size_t kBlock = 0; kBlock < 64; kBlock += 64)
+	{
+		const size_t kSize = (64 < kBlock + 64) ? 64 - kBlock : 64;
+		for(size_t nBlock = 0; nBlock < 64; nBlock += 64)
+		{
+			const size_t nSize = (64 < nBlock + 64) ? 64 - nBlock : 64;
+
+			for(size_t k = 0; k < kSize; k++)
+			{
+				for(size_t n = 0; n < nSize; n++)
+				{
+					rPacked[k][n] = Node361[(kBlock + k) * 64 + (nBlock + n) * 1];
+				}
+			}
+
+			size_t m = 48;
+			for(; m + 4 <= 64; m += 4)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node371[(m + 0) * 64 + nBlock], 64);
+				float * restrict op1 = __builtin_assume_aligned(&Node371[(m + 1) * 64 + nBlock], 64);
+				float * restrict op2 = __builtin_assume_aligned(&Node371[(m + 2) * 64 + nBlock], 64);
+				float * restrict op3 = __builtin_assume_aligned(&Node371[(m + 3) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					const float l1 = Node361[(m + 1) * 1 + (kBlock + k) * 64];
+					const float l2 = Node361[(m + 2) * 1 + (kBlock + k) * 64];
+					const float l3 = Node361[(m + 3) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+						op1[n] += l1 * rPacked[k][n];
+						op2[n] += l2 * rPacked[k][n];
+						op3[n] += l3 * rPacked[k][n];
+					}
+				}
+			}
+			for(; m + 1 <= 64; m += 1)
+			{
+				float * restrict op0 = __builtin_assume_aligned(&Node371[(m + 0) * 64 + nBlock], 64);
+				for(size_t k = 0; k < kSize; k++)
+				{
+					const float l0 = Node361[(m + 0) * 1 + (kBlock + k) * 64];
+					for(size_t n = 0; n < nSize; n++)
+					{
+						op0[n] += l0 * rPacked[k][n];
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Node372Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackmatrixProductPermuted(Node371, 4096 * sizeof(float));
+
+	
+}
+
+static void Node375Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorScalarProductCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node375[dim]) = (*(const vecFloat_t *) &Node373[dim]) * Node4;
+		}
+	}
+
+}
+
+static void Node376Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// PackedContractionCode
+
+	for(size_t opIndex = 0; opIndex < 8; opIndex++)
+	{
+		Node376[opIndex] = 0;
+	}
+
+	for(size_t term = 0; term < 8; term++)
+	{
+		Node376[Node376PackedOp[term]] += Node375[term] * Node374[Node376PackedArg[term]];
+	}
+}
+
+static void Node377Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbacksparseMatrixVector(Node376, 8 * sizeof(float));
+
+	
+}
+
+static void Node380Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// PackedContractionCode
+
+	for(size_t opIndex = 0; opIndex < 3; opIndex++)
+	{
+		Node380[opIndex] = 0;
+	}
+
+	for(size_t term = 0; term < 9; term++)
+	{
+		Node380[Node380PackedOp[term]] += Node378[Node380PackedElement[term]] * Node2[Node380PackedArg[term]];
+	}
+}
+
+static void Node381Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbacksymmetricMatrixVector(Node380, 3 * sizeof(float));
+
+	
+}
+
+static void Node383Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// SymmetricProductCode
+
+	for(size_t row = 0; row < 3; row++)
+	{
+		for(size_t col = row; col < 3; col++)
+		{
+			float sum = 0;
+			for(size_t inner = 0; inner < 2; inner++)
+			{
+				sum += Node382[row * 2 + inner] * Node382[col * 2 + inner];
+			}
+
+			const size_t dim __attribute__((unused)) = row * 3 + col;
+			Node383[dim] = sum;
+			Node383[col * 3 + row] = sum;
+		}
+	}
+}
+
+static void Node384Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbacksymmetricProduct(Node383, 9 * sizeof(float));
+
+	
+}
+
+static void Node385Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorScalarProductCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node385[dim]) = (*(const vecFloat_t *) &Node382[dim]) * Node4;
+		}
+	}
+
+}
+
+static void Node386Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// SymmetricProductCode
+
+	size_t element = 0;
+	for(size_t row = 0; row < 3; row++)
+	{
+		for(size_t col = row; col < 3; col++)
+		{
+			float sum = 0;
+			for(size_t inner = 0; inner < 2; inner++)
+			{
+				sum += Node385[row * 2 + inner] * Node385[col * 2 + inner];
+			}
+
+			const size_t dim __attribute__((unused)) = element++;
+			Node386[dim] = sum;
+		}
+	}
+}
+
+static void Node387Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	// PackedContractionCode
+
+	for(size_t opIndex = 0; opIndex < 3; opIndex++)
+	{
+		Node387[opIndex] = 0;
+	}
+
+	for(size_t term = 0; term < 9; term++)
+	{
+		Node387[Node387PackedOp[term]] += Node386[Node387PackedElement[term]] * Node2[Node387PackedArg[term]];
+	}
+}
+
+static void Node388Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbacksymmetricProductVector(Node387, 3 * sizeof(float));
+
+	
+}
+
+static void Node392Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	for(uint32_t dim = 0; dim < 37; dim++)
+	{
+		Node392[dim] = (__builtin_powif(Node389[dim], 2)) + (Node389[dim] * Node4);
+	}
+
+}
+
+static void Node393Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbacklongVector(Node392, 37 * sizeof(float));
+
+	
+}
+
+static void Node395Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorPowerCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 48; dim += 4)
+		{
+			for(uint32_t lane = 0; lane < 4; lane++) { Node395[dim + lane] = __builtin_powif(Node389[dim + lane], 3); }
+		}
+	}
+
+}
+
+static void Node396Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbacklongVectorCubed(Node395, 37 * sizeof(float));
+
+	
+}
+
+static void Node397Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorComparisonIsSmallerCode
+
+	float Node389Norm1 = 0;
+	float Node392Norm1 = 0;
+	vecFloat_t Node389Norm1Vec = {0};
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 37; dim += 4)
+		{
+			Node389Norm1Vec += (*(const vecFloat_t *) &Node389[dim]) * (*(const vecFloat_t *) &Node389[dim]);
+		}
+		for(; dim < 37; dim++)
+		{
+			Node389Norm1 += Node389[dim] * Node389[dim];
+		}
+	}
+
+	for(uint32_t lane = 0; lane < 4; lane++)
+	{
+		Node389Norm1 += Node389Norm1Vec[lane];
+	}
+
+	vecFloat_t Node392Norm1Vec = {0};
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 37; dim += 4)
+		{
+			Node392Norm1Vec += (*(const vecFloat_t *) &Node392[dim]) * (*(const vecFloat_t *) &Node392[dim]);
+		}
+		for(; dim < 37; dim++)
+		{
+			Node392Norm1 += Node392[dim] * Node392[dim];
+		}
+	}
+
+	for(uint32_t lane = 0; lane < 4; lane++)
+	{
+		Node392Norm1 += Node392Norm1Vec[lane];
+	}
+
+	if(Node389Norm1 < Node392Norm1)
+	{
+		 Node397 = 1;
+	}
+	else
+	{
+		 Node397 = 0;
+	}
+
+}
+
+static void Node398Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbacklongVectorIsSmaller(&Node397, 1 * sizeof(int32_t));
+
+	
+}
+
+static void Node399Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorAdditionCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 48; dim += 4)
+		{
+			(*(vecFloat_t *) &Node399[dim]) = (*(const vecFloat_t *) &Node389[dim]) + (*(const vecFloat_t *) &Node389[dim]);
+		}
+	}
+
+}
+
+static void Node401Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// FusedElementWiseCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 48; dim += 4)
+		{
+			(*(vecFloat_t *) &Node401[dim]) = ((*(const vecFloat_t *) &Node399[dim]) * Node4) + (*(const vecFloat_t *) &Node389[dim]);
+		}
+	}
+
+}
+
+static void Node402Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackfusedChain(Node401, 37 * sizeof(float));
+
+	
+}
+
+static void Node407Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorComparisonIsSmallerCode
+
+	float Node406Norm1 = 0;
+	float Node389Norm2 = 0;
+	for(uint32_t dim = 0; dim < 37; dim++)
+	{
+		 Node406Norm1 += (__builtin_powif((Node399[dim] * Node404), 2)) * (__builtin_powif((Node399[dim] * Node404), 2));
+	}
+
+	for(uint32_t dim = 0; dim < 37; dim++)
+	{
+		 Node389Norm2 += Node389[dim] * Node389[dim];
+	}
+
+	if(Node406Norm1 < Node389Norm2)
+	{
+		 Node407 = 1;
+	}
+	else
+	{
+		 Node407 = 0;
+	}
+
+}
+
+static void Node408Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackfusedIsSmaller(&Node407, 1 * sizeof(int32_t));
+
+	
+}
+
+static void Node409Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorAdditionCode
+
+	{
+		uint32_t dim = 0;
+		for(; dim + 4 <= 16; dim += 4)
+		{
+			(*(vecFloat_t *) &Node409[dim]) = (*(const vecFloat_t *) &Node2[dim]) + (*(const vecFloat_t *) &Node3[dim]);
+		}
+	}
+
+}
+
+static void Node410Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackvectorSum(Node409, 3 * sizeof(float));
+
+	
+}
+
+static void Node413Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleProductOutputCallbackvectorSumTimesOne(Node409, 3 * sizeof(float));
+
+	
+}
+
+static const node_t * const nodeParentsModuleProduct[] = {
+	&nodesModuleProduct[0],
+	&nodesModuleProduct[1],
+	&nodesModuleProduct[0],
+	&nodesModuleProduct[4],
+	&nodesModuleProduct[6],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[10],
+	&nodesModuleProduct[12],
+	&nodesModuleProduct[13],
+	&nodesModuleProduct[15],
+	&nodesModuleProduct[16],
+	&nodesModuleProduct[18],
+	&nodesModuleProduct[21],
+	&nodesModuleProduct[22],
+	&nodesModuleProduct[24],
+	&nodesModuleProduct[25],
+	&nodesModuleProduct[26],
+	&nodesModuleProduct[28],
+	&nodesModuleProduct[30],
+	&nodesModuleProduct[31],
+	&nodesModuleProduct[33],
+	&nodesModuleProduct[30],
+	&nodesModuleProduct[35],
+	&nodesModuleProduct[36],
+	&nodesModuleProduct[37],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[39],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[40],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[41],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[42],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[43],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[44],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[45],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[46],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[47],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[48],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[49],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[50],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[51],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[52],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[53],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[54],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[55],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[56],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[57],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[58],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[59],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[60],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[61],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[62],
+	&nodesModuleProduct[8],
+	&nodesModuleProduct[63],
+	&nodesModuleProduct[65],
+	&nodesModuleProduct[66],
+	&nodesModuleProduct[67],
+	&nodesModuleProduct[68],
+	&nodesModuleProduct[70],
+	&nodesModuleProduct[71],
+	&nodesModuleProduct[72],
+	&nodesModuleProduct[73],
+	&nodesModuleProduct[65],
+	&nodesModuleProduct[66],
+	&nodesModuleProduct[67],
+	&nodesModuleProduct[68],
+	&nodesModuleProduct[75],
+	&nodesModuleProduct[77],
+	&nodesModuleProduct[78],
+	&nodesModuleProduct[79],
+	&nodesModuleProduct[80],
+	&nodesModuleProduct[82],
+	&nodesModuleProduct[83],
+	&nodesModuleProduct[85],
+	&nodesModuleProduct[87],
+	&nodesModuleProduct[89],
+	&nodesModuleProduct[90],
+	&nodesModuleProduct[91],
+	&nodesModuleProduct[93],
+	&nodesModuleProduct[95],
+	&nodesModuleProduct[93],
+	&nodesModuleProduct[97],
+	&nodesModuleProduct[99],
+	&nodesModuleProduct[100],
+	&nodesModuleProduct[99],
+	&nodesModuleProduct[102],
+	&nodesModuleProduct[104],
+	&nodesModuleProduct[104],
+};
+
+static node_t * const nodeChildrenModuleProduct[] = {
+	&nodesModuleProduct[1],
+	&nodesModuleProduct[3],
+	&nodesModuleProduct[2],
+	&nodesModuleProduct[5],
+	&nodesModuleProduct[7],
+	&nodesModuleProduct[9],
+	&nodesModuleProduct[39],
+	&nodesModuleProduct[40],
+	&nodesModuleProduct[41],
+	&nodesModuleProduct[42],
+	&nodesModuleProduct[43],
+	&nodesModuleProduct[44],
+	&nodesModuleProduct[45],
+	&nodesModuleProduct[46],
+	&nodesModuleProduct[47],
+	&nodesModuleProduct[48],
+	&nodesModuleProduct[49],
+	&nodesModuleProduct[50],
+	&nodesModuleProduct[51],
+	&nodesModuleProduct[52],
+	&nodesModuleProduct[53],
+	&nodesModuleProduct[54],
+	&nodesModuleProduct[55],
+	&nodesModuleProduct[56],
+	&nodesModuleProduct[57],
+	&nodesModuleProduct[58],
+	&nodesModuleProduct[59],
+	&nodesModuleProduct[60],
+	&nodesModuleProduct[61],
+	&nodesModuleProduct[62],
+	&nodesModuleProduct[63],
+	&nodesModuleProduct[11],
+	&nodesModuleProduct[13],
+	&nodesModuleProduct[14],
+	&nodesModuleProduct[16],
+	&nodesModuleProduct[17],
+	&nodesModuleProduct[19],
+	&nodesModuleProduct[22],
+	&nodesModuleProduct[23],
+	&nodesModuleProduct[25],
+	&nodesModuleProduct[26],
+	&nodesModuleProduct[27],
+	&nodesModuleProduct[29],
+	&nodesModuleProduct[31],
+	&nodesModuleProduct[35],
+	&nodesModuleProduct[32],
+	&nodesModuleProduct[34],
+	&nodesModuleProduct[36],
+	&nodesModuleProduct[37],
+	&nodesModuleProduct[38],
+	&nodesModuleProduct[40],
+	&nodesModuleProduct[41],
+	&nodesModuleProduct[42],
+	&nodesModuleProduct[43],
+	&nodesModuleProduct[44],
+	&nodesModuleProduct[45],
+	&nodesModuleProduct[46],
+	&nodesModuleProduct[47],
+	&nodesModuleProduct[48],
+	&nodesModuleProduct[49],
+	&nodesModuleProduct[50],
+	&nodesModuleProduct[51],
+	&nodesModuleProduct[52],
+	&nodesModuleProduct[53],
+	&nodesModuleProduct[54],
+	&nodesModuleProduct[55],
+	&nodesModuleProduct[56],
+	&nodesModuleProduct[57],
+	&nodesModuleProduct[58],
+	&nodesModuleProduct[59],
+	&nodesModuleProduct[60],
+	&nodesModuleProduct[61],
+	&nodesModuleProduct[62],
+	&nodesModuleProduct[63],
+	&nodesModuleProduct[64],
+	&nodesModuleProduct[69],
+	&nodesModuleProduct[75],
+	&nodesModuleProduct[69],
+	&nodesModuleProduct[75],
+	&nodesModuleProduct[69],
+	&nodesModuleProduct[75],
+	&nodesModuleProduct[69],
+	&nodesModuleProduct[75],
+	&nodesModuleProduct[74],
+	&nodesModuleProduct[74],
+	&nodesModuleProduct[74],
+	&nodesModuleProduct[74],
+	&nodesModuleProduct[76],
+	&nodesModuleProduct[81],
+	&nodesModuleProduct[81],
+	&nodesModuleProduct[81],
+	&nodesModuleProduct[81],
+	&nodesModuleProduct[83],
+	&nodesModuleProduct[84],
+	&nodesModuleProduct[86],
+	&nodesModuleProduct[88],
+	&nodesModuleProduct[90],
+	&nodesModuleProduct[91],
+	&nodesModuleProduct[92],
+	&nodesModuleProduct[94],
+	&nodesModuleProduct[97],
+	&nodesModuleProduct[96],
+	&nodesModuleProduct[98],
+	&nodesModuleProduct[100],
+	&nodesModuleProduct[102],
+	&nodesModuleProduct[101],
+	&nodesModuleProduct[103],
+	&nodesModuleProduct[105],
+	&nodesModuleProduct[106],
+};
+
+static node_t nodesModuleProduct[] = {
+	{Node6Instruction, NULL, &nodeChildrenModuleProduct[0], 0, 0, 2, 6, 0},
+	{Node7Instruction, &nodeParentsModuleProduct[0], &nodeChildrenModuleProduct[2], 0, 1, 1, 7, 0},
+	{Node8Instruction, &nodeParentsModuleProduct[1], NULL, 0, 1, 0, 8, 0},
+	{Node9Instruction, &nodeParentsModuleProduct[2], NULL, 0, 1, 0, 9, 0},
+	{Node14Instruction, NULL, &nodeChildrenModuleProduct[3], 0, 0, 1, 14, 0},
+	{Node15Instruction, &nodeParentsModuleProduct[3], NULL, 0, 1, 0, 15, 0},
+	{Node16Instruction, NULL, &nodeChildrenModuleProduct[4], 0, 0, 1, 16, 0},
+	{Node17Instruction, &nodeParentsModuleProduct[4], NULL, 0, 1, 0, 17, 0},
+	{Node18Instruction, NULL, &nodeChildrenModuleProduct[5], 0, 0, 26, 18, 0},
+	{Node19Instruction, &nodeParentsModuleProduct[5], NULL, 0, 1, 0, 19, 0},
+	{Node20Instruction, NULL, &nodeChildrenModuleProduct[31], 0, 0, 1, 20, 0},
+	{Node21Instruction, &nodeParentsModuleProduct[6], NULL, 0, 1, 0, 21, 0},
+	{Node23Instruction, NULL, &nodeChildrenModuleProduct[32], 0, 0, 1, 23, 0},
+	{Node24Instruction, &nodeParentsModuleProduct[7], &nodeChildrenModuleProduct[33], 0, 1, 1, 24, 0},
+	{Node25Instruction, &nodeParentsModuleProduct[8], NULL, 0, 1, 0, 25, 0},
+	{Node26Instruction, NULL, &nodeChildrenModuleProduct[34], 0, 0, 1, 26, 0},
+	{Node27Instruction, &nodeParentsModuleProduct[9], &nodeChildrenModuleProduct[35], 0, 1, 1, 27, 0},
+	{Node28Instruction, &nodeParentsModuleProduct[10], NULL, 0, 1, 0, 28, 0},
+	{Node30Instruction, NULL, &nodeChildrenModuleProduct[36], 0, 0, 1, 30, 0},
+	{Node31Instruction, &nodeParentsModuleProduct[11], NULL, 0, 1, 0, 31, 0},
+	{Node32Instruction, NULL, NULL, 0, 0, 0, 32, 0},
+	{Node34Instruction, NULL, &nodeChildrenModuleProduct[37], 0, 0, 1, 34, 0},
+	{Node35Instruction, &nodeParentsModuleProduct[12], &nodeChildrenModuleProduct[38], 0, 1, 1, 35, 0},
+	{Node36Instruction, &nodeParentsModuleProduct[13], NULL, 0, 1, 0, 36, 0},
+	{Node38Instruction, NULL, &nodeChildrenModuleProduct[39], 0, 0, 1, 38, 0},
+	{Node39Instruction, &nodeParentsModuleProduct[14], &nodeChildrenModuleProduct[40], 0, 1, 1, 39, 0},
+	{Node40Instruction, &nodeParentsModuleProduct[15], &nodeChildrenModuleProduct[41], 0, 1, 1, 40, 0},
+	{Node41Instruction, &nodeParentsModuleProduct[16], NULL, 0, 1, 0, 41, 0},
+	{Node42Instruction, NULL, &nodeChildrenModuleProduct[42], 0, 0, 1, 42, 0},
+	{Node43Instruction, &nodeParentsModuleProduct[17], NULL, 0, 1, 0, 43, 0},
+	{Node45Instruction, NULL, &nodeChildrenModuleProduct[43], 0, 0, 2, 45, 0},
+	{Node47Instruction, &nodeParentsModuleProduct[18], &nodeChildrenModuleProduct[45], 0, 1, 1, 47, 0},
+	{Node48Instruction, &nodeParentsModuleProduct[19], NULL, 0, 1, 0, 48, 0},
+	{Node49Instruction, NULL, &nodeChildrenModuleProduct[46], 0, 0, 1, 49, 0},
+	{Node50Instruction, &nodeParentsModuleProduct[20], NULL, 0, 1, 0, 50, 0},
+	{Node54Instruction, &nodeParentsModuleProduct[21], &nodeChildrenModuleProduct[47], 0, 1, 1, 54, 0},
+	{Node56Instruction, &nodeParentsModuleProduct[22], &nodeChildrenModuleProduct[48], 0, 1, 1, 56, 0},
+	{Node57Instruction, &nodeParentsModuleProduct[23], &nodeChildrenModuleProduct[49], 0, 1, 1, 57, 0},
+	{Node58Instruction, &nodeParentsModuleProduct[24], NULL, 0, 1, 0, 58, 0},
+	{Node73Instruction, &nodeParentsModuleProduct[25], &nodeChildrenModuleProduct[50], 0, 1, 1, 73, 0},
+	{Node85Instruction, &nodeParentsModuleProduct[26], &nodeChildrenModuleProduct[51], 0, 2, 1, 85, 0},
+	{Node97Instruction, &nodeParentsModuleProduct[28], &nodeChildrenModuleProduct[52], 0, 2, 1, 97, 0},
+	{Node109Instruction, &nodeParentsModuleProduct[30], &nodeChildrenModuleProduct[53], 0, 2, 1, 109, 0},
+	{Node121Instruction, &nodeParentsModuleProduct[32], &nodeChildrenModuleProduct[54], 0, 2, 1, 121, 0},
+	{Node133Instruction, &nodeParentsModuleProduct[34], &nodeChildrenModuleProduct[55], 0, 2, 1, 133, 0},
+	{Node145Instruction, &nodeParentsModuleProduct[36], &nodeChildrenModuleProduct[56], 0, 2, 1, 145, 0},
+	{Node157Instruction, &nodeParentsModuleProduct[38], &nodeChildrenModuleProduct[57], 0, 2, 1, 157, 0},
+	{Node169Instruction, &nodeParentsModuleProduct[40], &nodeChildrenModuleProduct[58], 0, 2, 1, 169, 0},
+	{Node181Instruction, &nodeParentsModuleProduct[42], &nodeChildrenModuleProduct[59], 0, 2, 1, 181, 0},
+	{Node193Instruction, &nodeParentsModuleProduct[44], &nodeChildrenModuleProduct[60], 0, 2, 1, 193, 0},
+	{Node205Instruction, &nodeParentsModuleProduct[46], &nodeChildrenModuleProduct[61], 0, 2, 1, 205, 0},
+	{Node217Instruction, &nodeParentsModuleProduct[48], &nodeChildrenModuleProduct[62], 0, 2, 1, 217, 0},
+	{Node229Instruction, &nodeParentsModuleProduct[50], &nodeChildrenModuleProduct[63], 0, 2, 1, 229, 0},
+	{Node241Instruction, &nodeParentsModuleProduct[52], &nodeChildrenModuleProduct[64], 0, 2, 1, 241, 0},
+	{Node253Instruction, &nodeParentsModuleProduct[54], &nodeChildrenModuleProduct[65], 0, 2, 1, 253, 0},
+	{Node265Instruction, &nodeParentsModuleProduct[56], &nodeChildrenModuleProduct[66], 0, 2, 1, 265, 0},
+	{Node277Instruction, &nodeParentsModuleProduct[58], &nodeChildrenModuleProduct[67], 0, 2, 1, 277, 0},
+	{Node289Instruction, &nodeParentsModuleProduct[60], &nodeChildrenModuleProduct[68], 0, 2, 1, 289, 0},
+	{Node301Instruction, &nodeParentsModuleProduct[62], &nodeChildrenModuleProduct[69], 0, 2, 1, 301, 0},
+	{Node313Instruction, &nodeParentsModuleProduct[64], &nodeChildrenModuleProduct[70], 0, 2, 1, 313, 0},
+	{Node325Instruction, &nodeParentsModuleProduct[66], &nodeChildrenModuleProduct[71], 0, 2, 1, 325, 0},
+	{Node337Instruction, &nodeParentsModuleProduct[68], &nodeChildrenModuleProduct[72], 0, 2, 1, 337, 0},
+	{Node349Instruction, &nodeParentsModuleProduct[70], &nodeChildrenModuleProduct[73], 0, 2, 1, 349, 0},
+	{Node358Instruction, &nodeParentsModuleProduct[72], &nodeChildrenModuleProduct[74], 0, 2, 1, 358, 0},
+	{Node359Instruction, &nodeParentsModuleProduct[74], NULL, 0, 1, 0, 359, 0},
+	{Node362Tile0Instruction, NULL, &nodeChildrenModuleProduct[75], 0, 0, 2, 362, 0},
+	{Node362Tile1Instruction, NULL, &nodeChildrenModuleProduct[77], 0, 0, 2, 362, 0},
+	{Node362Tile2Instruction, NULL, &nodeChildrenModuleProduct[79], 0, 0, 2, 362, 0},
+	{Node362Tile3Instruction, NULL, &nodeChildrenModuleProduct[81], 0, 0, 2, 362, 0},
+	{Node363Instruction, &nodeParentsModuleProduct[75], NULL, 0, 4, 0, 363, 0},
+	{Node364Tile0Instruction, NULL, &nodeChildrenModuleProduct[83], 0, 0, 1, 364, 0},
+	{Node364Tile1Instruction, NULL, &nodeChildrenModuleProduct[84], 0, 0, 1, 364, 0},
+	{Node364Tile2Instruction, NULL, &nodeChildrenModuleProduct[85], 0, 0, 1, 364, 0},
+	{Node364Tile3Instruction, NULL, &nodeChildrenModuleProduct[86], 0, 0, 1, 364, 0},
+	{Node365Instruction, &nodeParentsModuleProduct[79], NULL, 0, 4, 0, 365, 0},
+	{Node368Instruction, &nodeParentsModuleProduct[83], &nodeChildrenModuleProduct[87], 0, 4, 1, 368, 0},
+	{Node369Instruction, &nodeParentsModuleProduct[87], NULL, 0, 1, 0, 369, 0},
+	{Node371Tile0Instruction, NULL, &nodeChildrenModuleProduct[88], 0, 0, 1, 371, 0},
+	{Node371Tile1Instruction, NULL, &nodeChildrenModuleProduct[89], 0, 0, 1, 371, 0},
+	{Node371Tile2Instruction, NULL, &nodeChildrenModuleProduct[90], 0, 0, 1, 371, 0},
+	{Node371Tile3Instruction, NULL, &nodeChildrenModuleProduct[91], 0, 0, 1, 371, 0},
+	{Node372Instruction, &nodeParentsModuleProduct[88], NULL, 0, 4, 0, 372, 0},
+	{Node375Instruction, NULL, &nodeChildrenModuleProduct[92], 0, 0, 1, 375, 0},
+	{Node376Instruction, &nodeParentsModuleProduct[92], &nodeChildrenModuleProduct[93], 0, 1, 1, 376, 0},
+	{Node377Instruction, &nodeParentsModuleProduct[93], NULL, 0, 1, 0, 377, 0},
+	{Node380Instruction, NULL, &nodeChildrenModuleProduct[94], 0, 0, 1, 380, 0},
+	{Node381Instruction, &nodeParentsModuleProduct[94], NULL, 0, 1, 0, 381, 0},
+	{Node383Instruction, NULL, &nodeChildrenModuleProduct[95], 0, 0, 1, 383, 0},
+	{Node384Instruction, &nodeParentsModuleProduct[95], NULL, 0, 1, 0, 384, 0},
+	{Node385Instruction, NULL, &nodeChildrenModuleProduct[96], 0, 0, 1, 385, 0},
+	{Node386Instruction, &nodeParentsModuleProduct[96], &nodeChildrenModuleProduct[97], 0, 1, 1, 386, 0},
+	{Node387Instruction, &nodeParentsModuleProduct[97], &nodeChildrenModuleProduct[98], 0, 1, 1, 387, 0},
+	{Node388Instruction, &nodeParentsModuleProduct[98], NULL, 0, 1, 0, 388, 0},
+	{Node392Instruction, NULL, &nodeChildrenModuleProduct[99], 0, 0, 2, 392, 0},
+	{Node393Instruction, &nodeParentsModuleProduct[99], NULL, 0, 1, 0, 393, 0},
+	{Node395Instruction, NULL, &nodeChildrenModuleProduct[101], 0, 0, 1, 395, 0},
+	{Node396Instruction, &nodeParentsModuleProduct[100], NULL, 0, 1, 0, 396, 0},
+	{Node397Instruction, &nodeParentsModuleProduct[101], &nodeChildrenModuleProduct[102], 0, 1, 1, 397, 0},
+	{Node398Instruction, &nodeParentsModuleProduct[102], NULL, 0, 1, 0, 398, 0},
+	{Node399Instruction, NULL, &nodeChildrenModuleProduct[103], 0, 0, 2, 399, 0},
+	{Node401Instruction, &nodeParentsModuleProduct[103], &nodeChildrenModuleProduct[105], 0, 1, 1, 401, 0},
+	{Node402Instruction, &nodeParentsModuleProduct[104], NULL, 0, 1, 0, 402, 0},
+	{Node407Instruction, &nodeParentsModuleProduct[105], &nodeChildrenModuleProduct[106], 0, 1, 1, 407, 0},
+	{Node408Instruction, &nodeParentsModuleProduct[106], NULL, 0, 1, 0, 408, 0},
+	{Node409Instruction, NULL, &nodeChildrenModuleProduct[107], 0, 0, 2, 409, 0},
+	{Node410Instruction, &nodeParentsModuleProduct[107], NULL, 0, 1, 0, 410, 0},
+	{Node413Instruction, &nodeParentsModuleProduct[108], NULL, 0, 1, 0, 413, 0},
+};
+
+node_t * jobPoolInitNodesModuleProduct[] = {&nodesModuleProduct[0], &nodesModuleProduct[4], &nodesModuleProduct[6], &nodesModuleProduct[8], &nodesModuleProduct[10], &nodesModuleProduct[12], &nodesModuleProduct[15], &nodesModuleProduct[18], &nodesModuleProduct[20], &nodesModuleProduct[21], &nodesModuleProduct[24], &nodesModuleProduct[28], &nodesModuleProduct[30], &nodesModuleProduct[33], &nodesModuleProduct[65], &nodesModuleProduct[66], &nodesModuleProduct[67], &nodesModuleProduct[68], &nodesModuleProduct[70], &nodesModuleProduct[71], &nodesModuleProduct[72], &nodesModuleProduct[73], &nodesModuleProduct[77], &nodesModuleProduct[78], &nodesModuleProduct[79], &nodesModuleProduct[80], &nodesModuleProduct[82], &nodesModuleProduct[85], &nodesModuleProduct[87], &nodesModuleProduct[89], &nodesModuleProduct[93], &nodesModuleProduct[95], &nodesModuleProduct[99], &nodesModuleProduct[104]};
+
+jobPoolInit_t jobPoolInitModuleProduct = {
+	.Nodes = jobPoolInitNodesModuleProduct,
+	.NodesNrOf = 34,
+	.JobsNrOfMax = 107,
+};
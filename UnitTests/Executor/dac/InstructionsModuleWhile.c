@@ -0,0 +1,174 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+
+#include "DacModuleWhile.h"
+#include "InstructionsModuleWhile.h"
+
+extern DacModuleWhileOutputCallbackwhileState_t DacModuleWhileOutputCallbackwhileState;
+
+static const float Node2[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node3[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node4[3] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const int32_t Node10 __attribute__((unused)) = -1;
+
+static float Node1[3] __attribute__((aligned(64))) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00};
+static float Node6[3] __attribute__((aligned(64)));
+static int32_t Node9 = 4;
+static float Node13[3] __attribute__((aligned(64)));
+
+static node_t nodesModuleWhile[]; // Initialized below
+
+static void Node6Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node2[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node13[rIndexTuple[0]];
+			}
+			
+			Node6[opIndex] = sum;
+		}
+	}
+}
+
+static void Node7Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorAdditionCode
+
+	for(uint32_t dim = 0; dim < 3; dim++)
+	{
+		Node1[dim] = Node1[dim] + Node6[dim];
+	}
+
+}
+
+static void Node8Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleWhileOutputCallbackwhileState(Node1, 3 * sizeof(float));
+
+	
+}
+
+static void Node11Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorAdditionCode
+
+	Node9 = Node9 + Node10;
+}
+
+static void Node12Instruction(void * instance, void (*PushNode)(void * instance, struct node_s * node))
+{
+	// ControlTransferWhileCode
+
+	if(Node9)
+	{
+		PushNode(instance, &nodesModuleWhile[3]);
+		PushNode(instance, &nodesModuleWhile[5]);
+	}
+	else
+	{
+		; // Do nothing
+	}
+}
+
+static void Node13Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node3[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node4[rIndexTuple[0]];
+			}
+			
+			Node13[opIndex] = sum;
+		}
+	}
+}
+
+static const node_t * const nodeParentsModuleWhile[] = {
+	&nodesModuleWhile[5],
+	&nodesModuleWhile[0],
+	&nodesModuleWhile[1],
+	&nodesModuleWhile[3],
+	&nodesModuleWhile[2],
+};
+
+static node_t * const nodeChildrenModuleWhile[] = {
+	&nodesModuleWhile[1],
+	&nodesModuleWhile[2],
+	&nodesModuleWhile[4],
+	&nodesModuleWhile[4],
+	&nodesModuleWhile[0],
+};
+
+static node_t nodesModuleWhile[] = {
+	{Node6Instruction, &nodeParentsModuleWhile[0], &nodeChildrenModuleWhile[0], 0, 1, 1, 6, 0},
+	{Node7Instruction, &nodeParentsModuleWhile[1], &nodeChildrenModuleWhile[1], 0, 1, 1, 7, 0},
+	{Node8Instruction, &nodeParentsModuleWhile[2], &nodeChildrenModuleWhile[2], 0, 1, 1, 8, 0},
+	{Node11Instruction, NULL, &nodeChildrenModuleWhile[3], 0, 0, 1, 11, 0},
+	{Node12Instruction, &nodeParentsModuleWhile[3], NULL, 0, 2, 0, 12, 0},
+	{Node13Instruction, NULL, &nodeChildrenModuleWhile[4], 0, 0, 1, 13, 0},
+};
+
+node_t * jobPoolInitNodesModuleWhile[] = {&nodesModuleWhile[3], &nodesModuleWhile[5]};
+
+jobPoolInit_t jobPoolInitModuleWhile = {
+	.Nodes = jobPoolInitNodesModuleWhile,
+	.NodesNrOf = 2,
+	.JobsNrOfMax = 6,
+};
@@ -0,0 +1,117 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+
+#include "DacModuleWhileFolded.h"
+#include "InstructionsModuleWhileFolded.h"
+
+extern DacModuleWhileFoldedOutputCallbackwhileState_t DacModuleWhileFoldedOutputCallbackwhileState;
+
+static const float Node2[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node3[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node4[3] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node6[3] __attribute__((aligned(64))) __attribute__((unused)) = {3.000000000000000000000e+00, 1.000000000000000000000e+00, 2.000000000000000000000e+00};
+static const int32_t Node10 __attribute__((unused)) = -1;
+
+static float Node1[3] __attribute__((aligned(64))) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00};
+static int32_t Node9 = 4;
+
+static node_t nodesModuleWhileFolded[]; // Initialized below
+
+static void Node7Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorAdditionCode
+
+	for(uint32_t dim = 0; dim < 3; dim++)
+	{
+		Node1[dim] = Node1[dim] + Node6[dim];
+	}
+
+}
+
+static void Node8Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// OutputCode
+
+	DacModuleWhileFoldedOutputCallbackwhileState(Node1, 3 * sizeof(float));
+
+	
+}
+
+static void Node11Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	// VectorAdditionCode
+
+	Node9 = Node9 + Node10;
+}
+
+static void Node12Instruction(void * instance, void (*PushNode)(void * instance, struct node_s * node))
+{
+	// ControlTransferWhileCode
+
+	if(Node9)
+	{
+		PushNode(instance, &nodesModuleWhileFolded[0]);
+		PushNode(instance, &nodesModuleWhileFolded[2]);
+	}
+	else
+	{
+		; // Do nothing
+	}
+}
+
+static const node_t * const nodeParentsModuleWhileFolded[] = {
+	&nodesModuleWhileFolded[0],
+	&nodesModuleWhileFolded[2],
+	&nodesModuleWhileFolded[1],
+};
+
+static node_t * const nodeChildrenModuleWhileFolded[] = {
+	&nodesModuleWhileFolded[1],
+	&nodesModuleWhileFolded[3],
+	&nodesModuleWhileFolded[3],
+};
+
+static node_t nodesModuleWhileFolded[] = {
+	{Node7Instruction, NULL, &nodeChildrenModuleWhileFolded[0], 0, 0, 1, 7, 0},
+	{Node8Instruction, &nodeParentsModuleWhileFolded[0], &nodeChildrenModuleWhileFolded[1], 0, 1, 1, 8, 0},
+	{Node11Instruction, NULL, &nodeChildrenModuleWhileFolded[2], 0, 0, 1, 11, 0},
+	{Node12Instruction, &nodeParentsModuleWhileFolded[1], NULL, 0, 2, 0, 12, 0},
+};
+
+node_t * jobPoolInitNodesModuleWhileFolded[] = {&nodesModuleWhileFolded[0], &nodesModuleWhileFolded[2]};
+
+jobPoolInit_t jobPoolInitModuleWhileFolded = {
+	.Nodes = jobPoolInitNodesModuleWhileFolded,
+	.NodesNrOf = 2,
+	.JobsNrOfMax = 4,
+};
@@ -0,0 +1,241 @@
+/*
+ * Distributed Algebraic Computations
+ *
+ * MIT License
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * This program was generated by DAC "Distributed Algebraic Computations"
+ * The source code for the generator is available on GitHub
+ * https://github.com/siquus/dac
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+
+#include "DacModuleWhileStatic.h"
+#include "InstructionsModuleWhileStatic.h"
+
+extern DacModuleWhileStaticOutputCallbackwhileState_t DacModuleWhileStaticOutputCallbackwhileState;
+
+static const float Node2[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node3[9] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00, 0.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const float Node4[3] __attribute__((aligned(64))) __attribute__((unused)) = {1.000000000000000000000e+00, 1.000000000000000000000e+00, 1.000000000000000000000e+00};
+static const int32_t Node10 __attribute__((unused)) = -1;
+
+static float Node1[3] __attribute__((aligned(64))) = {1.000000000000000000000e+00, 2.000000000000000000000e+00, 3.000000000000000000000e+00};
+static float Node6[3] __attribute__((aligned(64)));
+static int32_t Node9 = 4;
+static float Node13[3] __attribute__((aligned(64)));
+
+static void Node6Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node2[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node13[rIndexTuple[0]];
+			}
+			
+			Node6[opIndex] = sum;
+		}
+	}
+}
+
+static void Node7Instruction(void)
+{
+	// VectorAdditionCode
+
+	for(uint32_t dim = 0; dim < 3; dim++)
+	{
+		Node1[dim] = Node1[dim] + Node6[dim];
+	}
+
+}
+
+static void Node8Instruction(void)
+{
+	// OutputCode
+
+	DacModuleWhileStaticOutputCallbackwhileState(Node1, 3 * sizeof(float));
+
+	
+}
+
+static void Node11Instruction(void)
+{
+	// VectorAdditionCode
+
+	Node9 = Node9 + Node10;
+}
+
+static uint8_t Node12InstructionRepeat = 0;
+
+static void Node12Instruction(void)
+{
+	// ControlTransferWhileCode
+
+	Node12InstructionRepeat = (Node9) ? 1 : 0;
+}
+
+static void Node13Instruction(void)
+{
+	// VectorContractionCode
+
+	uint32_t opIndexTuple[] = {0};
+	for(size_t opIndexRow = 0; opIndexRow < 3; opIndexRow += 3)
+	{
+		for(uint32_t opIndexInRow = 0; opIndexInRow < 3; opIndexInRow++)
+		{
+			const size_t opIndex = opIndexRow + opIndexInRow;
+			opIndexTuple[0] = opIndexInRow;
+
+			float sum = 0;
+			for(int dim0 = 0; dim0 < 3; dim0++)
+			{
+				const uint32_t lIndexTuple[] = {opIndexTuple[0], dim0};
+				const uint32_t rIndexTuple[] = {dim0};
+				sum += Node3[lIndexTuple[0] * 3 + lIndexTuple[1]] * Node4[rIndexTuple[0]];
+			}
+			
+			Node13[opIndex] = sum;
+		}
+	}
+}
+
+static atomic_uint exeCntModuleWhileStatic[6];
+static atomic_uint finalIterationModuleWhileStatic;
+
+void InstructionsModuleWhileStaticResetStatic(void)
+{
+	for(size_t node = 0; node < sizeof(exeCntModuleWhileStatic) / sizeof(exeCntModuleWhileStatic[0]); node++)
+	{
+		atomic_store_explicit(&exeCntModuleWhileStatic[node], 0, memory_order_relaxed);
+	}
+
+	atomic_store_explicit(&finalIterationModuleWhileStatic, UINT32_MAX, memory_order_relaxed);
+}
+
+static void Thread0Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	Node13Instruction();
+	atomic_store_explicit(&exeCntModuleWhileStatic[1], 1, memory_order_release);
+
+	Node6Instruction();
+	atomic_store_explicit(&exeCntModuleWhileStatic[2], 1, memory_order_release);
+
+	Node7Instruction();
+	atomic_store_explicit(&exeCntModuleWhileStatic[3], 1, memory_order_release);
+
+	Node8Instruction();
+	atomic_store_explicit(&exeCntModuleWhileStatic[4], 1, memory_order_release);
+
+	WaitForCount(&exeCntModuleWhileStatic[0], 1);
+	Node12Instruction();
+	if(!Node12InstructionRepeat)
+	{
+		atomic_store_explicit(&finalIterationModuleWhileStatic, 1, memory_order_relaxed);
+	}
+	atomic_store_explicit(&exeCntModuleWhileStatic[5], 1, memory_order_release);
+
+	for(uint32_t iteration = 2; ; iteration++)
+	{
+		WaitForCount(&exeCntModuleWhileStatic[5], iteration - 1);
+		if(iteration - 1 == atomic_load_explicit(&finalIterationModuleWhileStatic, memory_order_relaxed))
+		{
+			break;
+		}
+
+		Node13Instruction();
+		atomic_store_explicit(&exeCntModuleWhileStatic[1], iteration, memory_order_release);
+
+		Node6Instruction();
+		atomic_store_explicit(&exeCntModuleWhileStatic[2], iteration, memory_order_release);
+
+		Node7Instruction();
+		atomic_store_explicit(&exeCntModuleWhileStatic[3], iteration, memory_order_release);
+
+		Node8Instruction();
+		atomic_store_explicit(&exeCntModuleWhileStatic[4], iteration, memory_order_release);
+
+		WaitForCount(&exeCntModuleWhileStatic[0], iteration);
+		Node12Instruction();
+		if(!Node12InstructionRepeat)
+		{
+			atomic_store_explicit(&finalIterationModuleWhileStatic, iteration, memory_order_relaxed);
+		}
+		atomic_store_explicit(&exeCntModuleWhileStatic[5], iteration, memory_order_release);
+
+	}
+}
+
+static void Thread1Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+	Node11Instruction();
+	atomic_store_explicit(&exeCntModuleWhileStatic[0], 1, memory_order_release);
+
+	for(uint32_t iteration = 2; ; iteration++)
+	{
+		WaitForCount(&exeCntModuleWhileStatic[5], iteration - 1);
+		if(iteration - 1 == atomic_load_explicit(&finalIterationModuleWhileStatic, memory_order_relaxed))
+		{
+			break;
+		}
+
+		WaitForCount(&exeCntModuleWhileStatic[5], iteration - 1);
+		Node11Instruction();
+		atomic_store_explicit(&exeCntModuleWhileStatic[0], iteration, memory_order_release);
+
+	}
+}
+
+static void Thread2Instruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))
+{
+}
+
+static node_t nodesModuleWhileStatic[] = {
+	{Thread0Instruction, NULL, NULL, 0, 0, 0, 0, 0},
+	{Thread1Instruction, NULL, NULL, 0, 0, 0, 1, 0},
+	{Thread2Instruction, NULL, NULL, 0, 0, 0, 2, 0},
+};
+
+node_t * jobPoolInitNodesModuleWhileStatic[] = {
+	&nodesModuleWhileStatic[0],
+	&nodesModuleWhileStatic[1],
+	&nodesModuleWhileStatic[2],
+};
+
+jobPoolInit_t jobPoolInitModuleWhileStatic = {
+	.Nodes = jobPoolInitNodesModuleWhileStatic,
+	.NodesNrOf = 3,
+	.JobsNrOfMax = 3,
+};
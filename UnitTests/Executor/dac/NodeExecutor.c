@@ -0,0 +1,713 @@
+/*
+ * This file is part of
+ * Distributed Algebraic Computations (https://github.com/siquus/dac)
+ *
+ * GPL-3 (or later)
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NodeExecutor.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <errno.h>
+
+#include "error_functions.h"
+
+
+#define ENABLE_DEBUG_OUTPUT 0
+
+#if ENABLE_DEBUG_OUTPUT
+#define DPRINTF(...) \
+	printf(__VA_ARGS__); \
+	fflush(stdout);
+#else // !ENABLE_DEBUG_OUTPUT
+#define DPRINTF(...)
+#endif // !ENABLE_DEBUG_OUTPUT
+
+#define INFO(...) \
+	printf(__VA_ARGS__); \
+	fflush(stdout);
+
+// Scheduling
+// Every thread owns a Chase-Lev work-stealing deque. Ready nodes are pushed to and taken from
+// the bottom of the own deque (LIFO, cache-friendly), idle threads steal from the top of other
+// threads' deques (FIFO). See Chase & Lev, "Dynamic Circular Work-Stealing Deque" (SPAA '05) and
+// Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP '13).
+//
+// Instead of scanning parents and children whenever a node finishes, each node counts the
+// readiness signals it received for its next execution in node_t::readyCnt:
+// - one per parent which finished the execution the node is waiting for,
+// - one per child which consumed the node's previous execution (i.e. not for the first execution),
+// - one external trigger for nodes without parents (initial job or PushNode by a control transfer).
+// The thread delivering the last signal pushes the node.
+
+#define CACHE_LINE_SIZE 64u
+#define STEAL_ROUNDS_BEFORE_SLEEP 64u
+#define SPINS_BEFORE_YIELD 64u
+
+typedef struct {
+	atomic_long top;
+	char paddingTop[CACHE_LINE_SIZE - sizeof(atomic_long)];
+	atomic_long bottom;
+	char paddingBottom[CACHE_LINE_SIZE - sizeof(atomic_long)];
+	node_t * _Atomic * buffer;
+	size_t size; // Power of two, sized by the generated jobPoolInit_t::JobsNrOfMax
+} jobDeque_t;
+
+struct threads_s;
+
+typedef struct {
+	jobDeque_t deque;
+	struct threads_s * threads;
+	uint32_t randomState;
+	uint16_t arrayPos;
+} worker_t;
+
+typedef struct threads_s {
+	pthread_t * pthreads;
+	worker_t * workers;
+	size_t threadsNrOf;
+	atomic_size_t jobsInFlight; // pushed but not yet finished
+	atomic_uchar done;
+	atomic_size_t sleepersNrOf;
+	atomic_size_t wakeupEpoch;
+	pthread_mutex_t mutex;
+	pthread_cond_t sleepCondition;
+	// Between runs the workers are parked. Protected by mutex:
+	pthread_cond_t runStartCondition;
+	pthread_cond_t runDoneCondition;
+	size_t runGeneration;
+	size_t activeWorkersNrOf;
+	uint8_t shutdown;
+} threads_t;
+
+static void lockMutex(pthread_mutex_t * mutex)
+{
+	int mutexLockRet = pthread_mutex_lock(mutex);
+	if(0 != mutexLockRet)
+	{
+		errExitEN(mutexLockRet, "pthread_mutex_lock");
+	}
+}
+
+static void unlockMutex(pthread_mutex_t * mutex)
+{
+	int mutexUnlockRet = pthread_mutex_unlock(mutex);
+	if(0 != mutexUnlockRet)
+	{
+		errExitEN(mutexUnlockRet, "pthread_mutex_unlock");
+	}
+}
+
+static void waitCondition(pthread_cond_t * condition, pthread_mutex_t * mutex)
+{
+	int waitRet = pthread_cond_wait(condition, mutex);
+	if(0 != waitRet)
+	{
+		errExitEN(waitRet, "pthread_cond_wait");
+	}
+}
+
+static void broadcastCondition(pthread_cond_t * condition)
+{
+	int condBroadcastRet = pthread_cond_broadcast(condition);
+	if(0 != condBroadcastRet)
+	{
+		errExitEN(condBroadcastRet, "pthread_cond_broadcast");
+	}
+}
+
+static void dequePush(jobDeque_t * deque, node_t * node)
+{
+	long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+	long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+	if(deque->size <= (unsigned long) (bottom - top))
+	{
+		fatal("Job Deque does not have enough slots!");
+	}
+
+	atomic_store_explicit(&deque->buffer[bottom & (deque->size - 1)], node, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+}
+
+// Owner side: returns NULL if the deque is empty
+static node_t * dequeTake(jobDeque_t * deque)
+{
+	long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+	atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	long top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+	if(top > bottom)
+	{
+		// Empty
+		atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+		return NULL;
+	}
+
+	node_t * node = atomic_load_explicit(&deque->buffer[bottom & (deque->size - 1)], memory_order_relaxed);
+	if(top == bottom)
+	{
+		// Last element: Race against thieves
+		if(!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+				memory_order_seq_cst, memory_order_relaxed))
+		{
+			node = NULL;
+		}
+
+		atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+	}
+
+	return node;
+}
+
+// Thief side: returns NULL if the deque is empty or we lost the race for the top element
+static node_t * dequeSteal(jobDeque_t * deque)
+{
+	long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+	atomic_thread_fence(memory_order_seq_cst);
+	long bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+	if(top >= bottom)
+	{
+		return NULL;
+	}
+
+	node_t * node = atomic_load_explicit(&deque->buffer[top & (deque->size - 1)], memory_order_relaxed);
+	if(!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+			memory_order_seq_cst, memory_order_relaxed))
+	{
+		return NULL;
+	}
+
+	return node;
+}
+
+static uint32_t readinessSignalsRequired(const node_t * node)
+{
+	uint32_t required = node->parentsNrOf;
+
+	if(0 == node->parentsNrOf)
+	{
+		required++; // External trigger
+	}
+
+	if(0 != node->exeCnt)
+	{
+		required += node->childrenNrOf; // Previous execution has to be consumed
+	}
+
+	return required;
+}
+
+static void wakeSleepingThreads(threads_t * threads)
+{
+	atomic_fetch_add(&threads->wakeupEpoch, 1);
+
+	if(0 == atomic_load(&threads->sleepersNrOf))
+	{
+		return;
+	}
+
+	lockMutex(&threads->mutex);
+	broadcastCondition(&threads->sleepCondition);
+	unlockMutex(&threads->mutex);
+}
+
+static void pushJob(worker_t * worker, node_t * node)
+{
+	DPRINTF("Thread %2u: pushing Node %u\n", worker->arrayPos, node->id);
+
+	atomic_fetch_add_explicit(&worker->threads->jobsInFlight, 1, memory_order_relaxed);
+	dequePush(&worker->deque, node);
+	wakeSleepingThreads(worker->threads);
+}
+
+static void signalNode(worker_t * worker, node_t * node)
+{
+	// acq_rel: The thread pushing the node has to see the results of all signaling threads
+	uint32_t signalsReceived = atomic_fetch_add_explicit(&node->readyCnt, 1, memory_order_acq_rel) + 1;
+
+	if(signalsReceived == readinessSignalsRequired(node))
+	{
+		pushJob(worker, node);
+	}
+}
+
+static void pushJobExported(void * instance, struct node_s * node)
+{
+	if(0 != node->parentsNrOf)
+	{
+		// Nodes with parents are pushed once their parents finished.
+		return;
+	}
+
+	signalNode((worker_t *) instance, node);
+}
+
+static void finishJob(worker_t * worker, node_t * node)
+{
+	// Consume the signals of this execution. Subtracting (instead of resetting) keeps early triggers.
+	atomic_fetch_sub_explicit(&node->readyCnt, readinessSignalsRequired(node), memory_order_relaxed);
+	node->exeCnt++;
+
+	DPRINTF("Thread %2u: updated node %u exe cnt to %u.\n", worker->arrayPos, node->id, node->exeCnt);
+
+	for(uint32_t child = 0; child < node->childrenNrOf; child++)
+	{
+		signalNode(worker, node->children[child]);
+	}
+
+	for(uint32_t parent = 0; parent < node->parentsNrOf; parent++)
+	{
+		// The parent's output has been consumed, it may execute again.
+		signalNode(worker, (node_t *) node->parents[parent]);
+	}
+
+	threads_t * threads = worker->threads;
+	if(1 == atomic_fetch_sub_explicit(&threads->jobsInFlight, 1, memory_order_acq_rel))
+	{
+		// Program is done: Let other threads know
+		DPRINTF("Thread %2u: executed last instruction!\n", worker->arrayPos);
+		atomic_store(&threads->done, 1);
+		wakeSleepingThreads(threads);
+	}
+}
+
+static node_t * stealJob(worker_t * worker)
+{
+	threads_t * threads = worker->threads;
+
+	// xorshift32 to pick the first victim
+	uint32_t random = worker->randomState;
+	random ^= random << 13;
+	random ^= random >> 17;
+	random ^= random << 5;
+	worker->randomState = random;
+
+	for(size_t victim = 0; victim < threads->threadsNrOf; victim++)
+	{
+		size_t victimPos = (random + victim) % threads->threadsNrOf;
+		if(victimPos == worker->arrayPos)
+		{
+			continue;
+		}
+
+		node_t * node = dequeSteal(&threads->workers[victimPos].deque);
+		if(NULL != node)
+		{
+			DPRINTF("Thread %2u: stole Node %u from thread %lu\n", worker->arrayPos, node->id, victimPos);
+			return node;
+		}
+	}
+
+	return NULL;
+}
+
+static void sleepUntilWork(threads_t * threads, size_t wakeupEpoch)
+{
+	lockMutex(&threads->mutex);
+
+	atomic_fetch_add(&threads->sleepersNrOf, 1);
+
+	// Anything pushed since we last looked for work? Pushers increment the epoch before checking
+	// for sleepers, so either they see us sleeping or we see their epoch.
+	while((wakeupEpoch == atomic_load(&threads->wakeupEpoch)) && !atomic_load(&threads->done))
+	{
+		waitCondition(&threads->sleepCondition, &threads->mutex);
+	}
+
+	atomic_fetch_sub(&threads->sleepersNrOf, 1);
+
+	unlockMutex(&threads->mutex);
+}
+
+static void executeJobs(worker_t * worker)
+{
+	threads_t * threads = worker->threads;
+
+	uint32_t failedStealRounds = 0;
+	while(!atomic_load(&threads->done))
+	{
+		size_t wakeupEpoch = atomic_load(&threads->wakeupEpoch);
+
+		node_t * nodeJob = dequeTake(&worker->deque);
+		if(NULL == nodeJob)
+		{
+			nodeJob = stealJob(worker);
+		}
+
+		if(NULL == nodeJob)
+		{
+			failedStealRounds++;
+			if(STEAL_ROUNDS_BEFORE_SLEEP > failedStealRounds)
+			{
+				sched_yield();
+			}
+			else
+			{
+				sleepUntilWork(threads, wakeupEpoch);
+				failedStealRounds = 0;
+			}
+
+			continue;
+		}
+
+		failedStealRounds = 0;
+
+		DPRINTF("Thread %2u: picking up Node %2u.\n", worker->arrayPos, nodeJob->id);
+
+		// Run instruction
+		nodeJob->instruction(worker, &pushJobExported);
+
+		finishJob(worker, nodeJob);
+	}
+}
+
+void * threadFunction(void * arg)
+{
+	worker_t * worker = (worker_t *) arg;
+	threads_t * threads = worker->threads;
+
+	size_t runGeneration = 0;
+	while(1)
+	{
+		// Park until the next run
+		lockMutex(&threads->mutex);
+		while((runGeneration == threads->runGeneration) && !threads->shutdown)
+		{
+			waitCondition(&threads->runStartCondition, &threads->mutex);
+		}
+
+		if(threads->shutdown)
+		{
+			unlockMutex(&threads->mutex);
+			break;
+		}
+
+		runGeneration = threads->runGeneration;
+		unlockMutex(&threads->mutex);
+
+		executeJobs(worker);
+
+		lockMutex(&threads->mutex);
+		threads->activeWorkersNrOf--;
+		if(0 == threads->activeWorkersNrOf)
+		{
+			broadcastCondition(&threads->runDoneCondition);
+		}
+		unlockMutex(&threads->mutex);
+	}
+
+	return NULL;
+}
+
+void * CreateThreads(size_t threadsNrOf)
+{
+	if(0 == threadsNrOf)
+	{
+		fatal("At least one thread is required!\n");
+	}
+
+	threads_t * threads = malloc(sizeof(threads_t));
+	if(NULL == threads)
+	{
+		fatal("Could not malloc threads_t!\n");
+	}
+
+	threads->threadsNrOf = threadsNrOf;
+
+	pthread_t * pthreads = malloc(sizeof(pthread_t) * threadsNrOf);
+	if(NULL == pthreads)
+	{
+		fatal("Could not malloc pthread_t!\n");
+	}
+
+	threads->pthreads = pthreads;
+
+	worker_t * workers = malloc(sizeof(worker_t) * threadsNrOf);
+	if(NULL == workers)
+	{
+		fatal("Could not malloc worker_t!\n");
+	}
+
+	threads->workers = workers;
+
+	for(uint16_t arrayPos = 0; arrayPos < threads->threadsNrOf; arrayPos++)
+	{
+		atomic_init(&workers[arrayPos].deque.top, 0);
+		atomic_init(&workers[arrayPos].deque.bottom, 0);
+		workers[arrayPos].deque.buffer = NULL;
+		workers[arrayPos].deque.size = 0;
+		workers[arrayPos].threads = threads;
+		workers[arrayPos].randomState = 2463534242u + arrayPos; // xorshift32 must not start at zero
+		workers[arrayPos].arrayPos = arrayPos;
+	}
+
+	atomic_init(&threads->jobsInFlight, 0);
+	atomic_init(&threads->done, 1);
+	atomic_init(&threads->sleepersNrOf, 0);
+	atomic_init(&threads->wakeupEpoch, 0);
+
+	pthread_mutex_init(&threads->mutex, NULL);
+	pthread_cond_init(&threads->sleepCondition, NULL);
+	pthread_cond_init(&threads->runStartCondition, NULL);
+	pthread_cond_init(&threads->runDoneCondition, NULL);
+
+	threads->runGeneration = 0;
+	threads->activeWorkersNrOf = 0;
+	threads->shutdown = 0;
+
+	DPRINTF("Starting %lu threads\n", threads->threadsNrOf);
+
+	// Set thread attributes: Priority & scheduler
+	// Checking whether this process is allowed to change schedulers requires an external library,
+	// check the man-pages for libcap.
+	// To avoid installing it for this, we just try and see if we fail with "EPERM Operation not permitted"
+	// and use the normal SCHED_OTHER in that case
+	pthread_attr_t threadAttribute;
+	int attrInitRet = pthread_attr_init(&threadAttribute);
+	if(attrInitRet)
+	{
+		errExitEN(attrInitRet, "pthread_attr_init");
+	}
+
+	int setinheritschedRet = pthread_attr_setinheritsched(&threadAttribute, PTHREAD_EXPLICIT_SCHED);
+	if(setinheritschedRet)
+	{
+		errExitEN(setinheritschedRet, "thread_attr_setinheritsched");
+	}
+
+	int setschedpolicyRet = pthread_attr_setschedpolicy(&threadAttribute, SCHED_FIFO);
+	if(setschedpolicyRet)
+	{
+		errExitEN(setschedpolicyRet, "pthread_attr_setschedpolicy");
+	}
+
+	struct sched_param schedParams;
+	int getPriorityRet = schedParams.sched_priority = sched_get_priority_max(SCHED_FIFO);
+	if(0 > getPriorityRet)
+	{
+		err_exit("sched_get_priority_max() failed!");
+	}
+
+	int setschedparamRet = pthread_attr_setschedparam(&threadAttribute, &schedParams);
+	if(setschedparamRet)
+	{
+		errExitEN(setschedparamRet, "pthread_attr_setschedparam");
+	}
+
+	uint8_t have_cap_sys_nice = 1;
+	for(uint16_t arrayPos = 0; arrayPos < threads->threadsNrOf; arrayPos++)
+	{
+		int threadCreateRet;
+		if(have_cap_sys_nice)
+		{
+			threadCreateRet = pthread_create(&threads->pthreads[arrayPos], &threadAttribute, threadFunction, &workers[arrayPos]);
+		}
+		else
+		{
+			threadCreateRet = pthread_create(&threads->pthreads[arrayPos], NULL, threadFunction, &workers[arrayPos]);
+		}
+
+		if(threadCreateRet)
+		{
+			if((EPERM == threadCreateRet) && have_cap_sys_nice && (0 == arrayPos)) // We are not allowed to set the thread attribues: Create threads with standard values.
+			{
+				INFO("No CAP_SYS_NICE capability. Defaulting to standard thread attributes.\n")
+				threadCreateRet = pthread_create(&threads->pthreads[arrayPos], NULL, threadFunction, &workers[arrayPos]);
+				have_cap_sys_nice = 0;
+			}
+
+			if(threadCreateRet)
+			{
+				errExitEN(threadCreateRet, "pthread_create");
+			}
+		}
+	}
+
+	int attrDestroyRet = pthread_attr_destroy(&threadAttribute);
+	if(attrDestroyRet)
+	{
+		errExitEN(attrDestroyRet, "pthread_attr_destroy");
+	}
+
+	return threads;
+}
+
+static void waitForRun(threads_t * threads)
+{
+	lockMutex(&threads->mutex);
+	while(0 != threads->activeWorkersNrOf)
+	{
+		waitCondition(&threads->runDoneCondition, &threads->mutex);
+	}
+	unlockMutex(&threads->mutex);
+}
+
+static void reserveDeques(threads_t * threads, size_t jobsNrOfMax)
+{
+	size_t size = 1;
+	while(size < jobsNrOfMax)
+	{
+		size <<= 1;
+	}
+
+	for(size_t thread = 0; thread < threads->threadsNrOf; thread++)
+	{
+		jobDeque_t * deque = &threads->workers[thread].deque;
+		if(deque->size >= size)
+		{
+			continue;
+		}
+
+		// Deques are empty between runs, so the buffer can simply be replaced
+		free(deque->buffer);
+
+		deque->buffer = malloc(sizeof(deque->buffer[0]) * size);
+		if(NULL == deque->buffer)
+		{
+			fatal("Could not malloc job deque!\n");
+		}
+
+		deque->size = size;
+	}
+}
+
+static void startRun(threads_t * threads, jobPoolInit_t * jobPoolInit)
+{
+	// All workers are parked and do not touch their deques, so we may push to them.
+	// The mutex hands the pushed jobs over to the workers. Note that there are no sleepers
+	// between runs, so pushing won't try to lock the mutex again.
+	lockMutex(&threads->mutex);
+
+	if(0 != threads->activeWorkersNrOf)
+	{
+		fatal("Run started while previous run is still active!\n");
+	}
+
+	atomic_store(&threads->done, 0);
+
+	reserveDeques(threads, jobPoolInit->JobsNrOfMax);
+
+	// Distribute the initial jobs round robin
+	DPRINTF("Job pool is initialized with nodes {");
+	for(size_t node = 0; node < jobPoolInit->NodesNrOf; node++)
+	{
+		node_t * initNode = jobPoolInit->Nodes[node];
+		if(0 != initNode->parentsNrOf)
+		{
+			fatal("Initial Node%u has parents!\n", initNode->id);
+		}
+
+		signalNode(&threads->workers[node % threads->threadsNrOf], initNode);
+		DPRINTF("%u ", initNode->id);
+	}
+	DPRINTF("}\n");
+
+	if(0 == atomic_load(&threads->jobsInFlight))
+	{
+		// Nothing to do
+		atomic_store(&threads->done, 1);
+		unlockMutex(&threads->mutex);
+		return;
+	}
+
+	threads->activeWorkersNrOf = threads->threadsNrOf;
+	threads->runGeneration++;
+	broadcastCondition(&threads->runStartCondition);
+
+	unlockMutex(&threads->mutex);
+}
+
+void RunJobs(void * instance, jobPoolInit_t * jobPoolInit)
+{
+	threads_t * threads = (threads_t *) instance;
+
+	startRun(threads, jobPoolInit);
+	waitForRun(threads);
+}
+
+void DestroyThreads(void * instance)
+{
+	threads_t * threads = (threads_t *) instance;
+
+	waitForRun(threads);
+
+	lockMutex(&threads->mutex);
+	threads->shutdown = 1;
+	broadcastCondition(&threads->runStartCondition);
+	unlockMutex(&threads->mutex);
+
+	for(uint16_t thread = 0; thread < threads->threadsNrOf; thread++)
+	{
+		int joinRet;
+		joinRet = pthread_join(threads->pthreads[thread], NULL);
+		if(0 != joinRet)
+		{
+			errExitEN(joinRet, "pthread_join");
+		}
+	}
+
+	pthread_cond_destroy(&threads->runDoneCondition);
+	pthread_cond_destroy(&threads->runStartCondition);
+	pthread_cond_destroy(&threads->sleepCondition);
+	pthread_mutex_destroy(&threads->mutex);
+
+	for(size_t thread = 0; thread < threads->threadsNrOf; thread++)
+	{
+		free(threads->workers[thread].deque.buffer);
+	}
+
+	free(threads->workers);
+	free(threads->pthreads);
+	free(threads);
+}
+
+void StartThreads(void ** instance, size_t threadsNrOf, jobPoolInit_t * jobPoolInit)
+{
+	// Why this weird way of assigning the pointer? Because otherwise we can't hand it over to
+	// to JoinThreads. See https://www.viva64.com/en/b/0576/
+	*instance = CreateThreads(threadsNrOf);
+
+	startRun((threads_t *) *instance, jobPoolInit);
+}
+
+void JoinThreads(void * instance)
+{
+	DestroyThreads(instance);
+}
+
+void WaitForCount(atomic_uint * counter, uint32_t count)
+{
+	uint32_t spins = 0;
+	while(atomic_load_explicit(counter, memory_order_acquire) < count)
+	{
+		spins++;
+		if(SPINS_BEFORE_YIELD < spins)
+		{
+			sched_yield();
+		}
+	}
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of
+ * Distributed Algebraic Computations (https://github.com/siquus/dac)
+ *
+ * GPL-3 (or later)
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_NODEEXECUTOR_H_
+#define SRC_NODEEXECUTOR_H_
+
+#include <stdatomic.h>
+#include <pthread.h>
+#include <stdint.h>
+
+typedef struct node_s {
+	void (*instruction)(void * instance, void (*PushNode)(void * instance, struct node_s * node));
+	const struct node_s * const * parents; // Slice of the generated parents array, parentsNrOf long
+	struct node_s * const * children; // Slice of the generated children array, childrenNrOf long
+	uint32_t exeCnt;
+	const uint16_t parentsNrOf;
+	const uint16_t childrenNrOf;
+	const uint16_t id;
+	atomic_uint readyCnt; // Readiness signals received for the next execution. Zero-initialized, owned by the executor.
+} node_t;
+
+typedef struct jobPoolInit_s {
+	node_t ** Nodes;
+	size_t NodesNrOf;
+	size_t JobsNrOfMax; // Maximum number of jobs queued at the same time
+} jobPoolInit_t;
+
+extern void * threadFunction(void * arg);
+
+// Persistent thread pool: Workers are parked between runs and reused.
+extern void * CreateThreads(size_t threadsNrOf);
+extern void RunJobs(void * instance, jobPoolInit_t * jobPoolInit); // Blocks until all jobs are done
+extern void DestroyThreads(void * instance);
+
+// One-shot: Create threads and start running, JoinThreads waits for the run and destroys the threads.
+extern void StartThreads(void ** instance, size_t threadsNrOf, jobPoolInit_t * jobPoolInit);
+extern void JoinThreads(void * instance);
+
+// Spins (and eventually yields) until counter >= count. Used by statically scheduled graphs.
+extern void WaitForCount(atomic_uint * counter, uint32_t count);
+
+#endif /* SRC_NODEEXECUTOR_H_ */
@@ -31,6 +31,7 @@
 #include "ModulePermute.h"
 #include "ModuleProduct.h"
 #include "ModuleCNN.h"
+#include "ModuleWhile.h"
 
 int main() {
 
@@ -62,6 +63,13 @@ int main() {
 		fatal("Not all tests passed!\n");
 	}
 
+	ModuleWhile moduleWhile;
+	moduleWhile.Execute(4);
+	if(!moduleWhile.Success())
+	{
+		fatal("Not all tests passed!\n");
+	}
+
 	fprintf(stdout, "SUCCESS!!\n");
 	fflush(stdout);
 
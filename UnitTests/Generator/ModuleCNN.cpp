@@ -39,6 +39,54 @@ bool ModuleCNN::Generate(const std::string &path)
 	auto ccMaxPoolOutput = Interface::Output(&graph, "ccMaxPool");
 	ccMaxPoolOutput.Set(ccMaxPool);
 
+	// The derivative uses the positions of the maxima recorded by the max pool
+	auto ccMaxPool4 = cc->MaxPool(std::vector<uint32_t>{4, 4});
+	auto ccMaxPool4Output = Interface::Output(&graph, "ccMaxPool4");
+	ccMaxPool4Output.Set(ccMaxPool4);
+
+	auto ccMaxPool4Derivative = ccMaxPool4->Derivative(cc);
+	auto ccMaxPool4DerivativeOutput = Interface::Output(&graph, "ccMaxPool4Derivative");
+	ccMaxPool4DerivativeOutput.Set(ccMaxPool4Derivative);
+
+	// Zero and unit kernel elements are folded
+	auto sparseKernelInit = std::vector<float>{0, -1, 0, 2, 0, 1, 0, 0, 3};
+	auto sparseKernel = kernelSpace.Element(&graph, sparseKernelInit);
+
+	auto ccSparse = input->CrossCorrelate(sparseKernel);
+	auto ccSparseOutput = Interface::Output(&graph, "ccSparse");
+	ccSparseOutput.Set(ccSparse);
+
+	// Kernel too large to be unrolled
+	auto bigInputSpace = Algebra::Module::VectorSpace(Algebra::Ring::Float32, std::vector<dimension_t>{4, 8, 8});
+	auto bigKernelSpace = Algebra::Module::VectorSpace(Algebra::Ring::Float32, std::vector<dimension_t>{2, 5, 5});
+
+	auto bigInputInit = std::vector<float>(4 * 8 * 8);
+	std::iota(bigInputInit.begin(), bigInputInit.end(), 0);
+
+	auto bigKernelInit = std::vector<float>(2 * 5 * 5);
+	for(size_t elem = 0; elem < bigKernelInit.size(); elem++)
+	{
+		bigKernelInit[elem] = (float) (elem % 7) - 3.f;
+	}
+
+	auto bigInput = bigInputSpace.Element(&graph, bigInputInit);
+	auto bigKernel = bigKernelSpace.Element(&graph, bigKernelInit);
+
+	auto ccBig = bigInput->CrossCorrelate(bigKernel);
+	auto ccBigOutput = Interface::Output(&graph, "ccBig");
+	ccBigOutput.Set(ccBig);
+
+	// Only depending on constants, so computed at generation time: A kernel and a derivative
+	auto doubledKernel = kernel->Multiply(2.f);
+	auto ccDoubled = input->CrossCorrelate(doubledKernel);
+	auto ccDoubledOutput = Interface::Output(&graph, "ccDoubled");
+	ccDoubledOutput.Set(ccDoubled);
+
+	auto kernelSquared = kernel->Power(2.f);
+	auto kernelSquaredDerivative = kernelSquared->Derivative(kernel);
+	auto kernelSquaredDerivativeOutput = Interface::Output(&graph, "kernelSquaredDerivative");
+	kernelSquaredDerivativeOutput.Set(kernelSquaredDerivative);
+
 	auto vectorSpace = Algebra::Module::VectorSpace(Algebra::Ring::Float32, 9);
 	auto vectorInit = std::vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9};
 	auto vector = vectorSpace.Element(&graph, vectorInit);
@@ -59,6 +107,7 @@ bool ModuleCNN::Generate(const std::string &path)
 	vector42Output.Set(inVector42);
 
 	CodeGenerator codeGenerator(&path);
+	codeGenerator.SetConstantFolding(true);
 	bool GenSuccess = codeGenerator.Generate(&graph);
 	if(!GenSuccess)
 	{
@@ -28,9 +28,9 @@
 
 #include "ModuleContract.h"
 
-bool ModuleContract::Generate(const std::string &path)
+static bool generateContract(const std::string &path, const char * name, CodeGenerator::Scheduling scheduling, size_t threadsNrOf)
 {
-	Graph graph("ModuleContract");
+	Graph graph(name);
 
 	auto myVs = Algebra::Module::VectorSpace(Algebra::Ring::Float32, 3);
 	auto myMatrixSpace = Algebra::Module::VectorSpace(myVs ,2);
@@ -53,6 +53,12 @@ bool ModuleContract::Generate(const std::string &path)
 	auto vecMatrixProdOutput = Interface::Output(&graph, "vecMatrixProd");
 	vecMatrixProdOutput.Set(vecMatrixProd);
 
+	// Dense layer: Bias and scaling computed where the product is stored
+	auto denseLayer = matrix1->Contract(vector, 1, 0)->Add(vector)->Multiply(myVs.Scalar(&graph, 2.f));
+
+	auto denseLayerOutput = Interface::Output(&graph, "denseLayer");
+	denseLayerOutput.Set(denseLayer);
+
 	// Matrix times identity Matrix
 	auto matrix2_init = std::vector<float>{1, 0, 0, 0, 1, 0, 0, 0, 1};
 
@@ -113,6 +119,26 @@ bool ModuleContract::Generate(const std::string &path)
 	auto twoMatrixTraceOutput = Interface::Output(&graph, "twoMatrixTrace");
 	twoMatrixTraceOutput.Set(twoMatrixTrace);
 
+	// Sums, multiples and permutations of deltas stay deltas: (2 d_ji + d_ij - 0.5 d_ij) = 2.5 d_ij, which only scales matrix1
+	auto One_ij = myMatrixSpace.Element(&graph, std::vector<uint32_t>{1, 0}, 1.);
+	auto deltaSum = TwoDelta_ij->Permute(std::vector<uint32_t>{1, 0})->Add(One_ij)->Subtract(One_ij->Multiply(0.5f));
+	auto matrixDeltaSumProd = matrix1->Contract(deltaSum, 1, 0);
+
+	auto matrixDeltaSumProdOutput = Interface::Output(&graph, "matrixDeltaSumProd");
+	matrixDeltaSumProdOutput.Set(matrixDeltaSumProd);
+
+	// Contracting a delta renames indices: T_ajk d_ia = T_ijk, permuted to the result's order
+	auto tensorDeltaContr = tensor->Contract(One_ij, 0, 1);
+
+	auto tensorDeltaContrOutput = Interface::Output(&graph, "tensorDeltaContr");
+	tensorDeltaContrOutput.Set(tensorDeltaContr);
+
+	// A dense matrix plus a delta
+	auto matrixPlusDelta = matrix1->Add(TwoDelta_ij);
+
+	auto matrixPlusDeltaOutput = Interface::Output(&graph, "matrixPlusDelta");
+	matrixPlusDeltaOutput.Set(matrixPlusDelta);
+
 	// Derivation
 
 	// Matrix Product
@@ -134,9 +160,51 @@ bool ModuleContract::Generate(const std::string &path)
 	auto matrixProdLeftOutput = Interface::Output(&graph, "matrixProdLeft");
 	matrixProdLeftOutput.Set(matrixProdLeft);
 
+	// Chains of contractions: ((A A) A) v is reordered to A (A (A v)), T_ijk A_kl v_j to (T_ijk v_j) A_kl
+	auto matrixChainVec = matrix1->Contract(matrix1, 1, 0)->Contract(matrix1, 1, 0)->Contract(vector, 1, 0);
+
+	auto matrixChainVecOutput = Interface::Output(&graph, "matrixChainVec");
+	matrixChainVecOutput.Set(matrixChainVec);
+
+	auto tensorChainVec = tensor->Contract(matrix1, 2, 0)->Contract(vector, 1, 0);
+
+	auto tensorChainVecOutput = Interface::Output(&graph, "tensorChainVec");
+	tensorChainVecOutput.Set(tensorChainVec);
+
+	// Contraction powers: Repeated squaring, or contracted in sequence if regrouping changes the product
+	auto shift_init = std::vector<float>{1, 1, 0, 0, 1, 1, 0, 0, 1};
+	auto shift = myMatrixSpace.Element(&graph, shift_init);
+	auto five = myVs.Scalar(&graph, 5.f);
+
+	auto shiftPower5 = shift->Power(five, std::vector<uint32_t>{1}, std::vector<uint32_t>{0});
+
+	auto shiftPower5Output = Interface::Output(&graph, "shiftPower5");
+	shiftPower5Output.Set(shiftPower5);
+
+	auto myIntVs = Algebra::Module::VectorSpace(Algebra::Ring::Int32, 1);
+	auto three = myIntVs.Scalar(&graph, 3);
+	auto matrixPowerTransposed3 = matrix1->Power(three, std::vector<uint32_t>{0}, std::vector<uint32_t>{1});
+
+	auto matrixPowerTransposed3Output = Interface::Output(&graph, "matrixPowerTransposed3");
+	matrixPowerTransposed3Output.Set(matrixPowerTransposed3);
+
+	// Contracting the identity gives back the matrix itself: Both outputs read the same node
+	auto matrixDoubled = matrix1->Add(matrix1);
+	auto matrixDoubledId = matrixDoubled->Contract(delta_ij, 1, 0);
+
+	auto matrixDoubledOutput = Interface::Output(&graph, "matrixDoubled");
+	matrixDoubledOutput.Set(matrixDoubled);
+
+	auto matrixDoubledIdOutput = Interface::Output(&graph, "matrixDoubledId");
+	matrixDoubledIdOutput.Set(matrixDoubledId);
+
+	graph.OrderContractions();
+	graph.RemoveDuplicates();
+
 	// Generate Code
 
 	CodeGenerator codeGenerator(&path);
+	codeGenerator.SetScheduling(scheduling, threadsNrOf);
 	bool GenSuccess = codeGenerator.Generate(&graph);
 	if(!GenSuccess)
 	{
@@ -147,5 +215,13 @@ bool ModuleContract::Generate(const std::string &path)
 	return true;
 }
 
+bool ModuleContract::Generate(const std::string &path)
+{
+	if(!generateContract(path, "ModuleContract", CodeGenerator::Scheduling::DYNAMIC, 1))
+	{
+		return false;
+	}
 
-
+	// The same graph partitioned across threads at generation time
+	return generateContract(path, "ModuleContractStatic", CodeGenerator::Scheduling::STATIC, 3);
+}
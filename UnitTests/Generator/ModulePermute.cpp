@@ -89,9 +89,39 @@ bool ModulePermute::Generate(const std::string &path)
 
 	// Project derivative
 
+	// Views: Permutations, projections and joins only read by a contraction are not copied
+	auto vector3_init = std::vector<float>{1, 2, 3};
+	auto vector3 = myVs.Element(&graph, vector3_init);
+
+	auto tensorPermuteContracted = tensor->Permute(std::vector<uint32_t>{1, 2, 0})->Contract(vector3, 2, 0);
+	auto tensorPermuteContractedOutput = Interface::Output(&graph, "tensorPermuteContracted");
+	tensorPermuteContractedOutput.Set(tensorPermuteContracted);
+
+	auto projMatrixVector = matrix->Project(std::vector<std::pair<uint32_t, uint32_t>>{{1, 3}, {0, 3}})->Contract(vector3, 1, 0);
+	auto projMatrixVectorOutput = Interface::Output(&graph, "projMatrixVector");
+	projMatrixVectorOutput.Set(projMatrixVector);
+
+	std::vector<std::vector<uint32_t>> diagonalIndices = {{0, 1}};
+	auto diagonalContracted = matrix->JoinIndices(diagonalIndices)->Contract(vector3, 0, 0);
+	auto diagonalContractedOutput = Interface::Output(&graph, "diagonalContracted");
+	diagonalContractedOutput.Set(diagonalContracted);
+
+	// Simplification: Permuting back and forth reads the operand, two permutations compose to one
+	auto matrixTransposeTwice = matrix->Permute(std::vector<uint32_t>{1, 0})->Permute(std::vector<uint32_t>{1, 0});
+	auto matrixTransposeTwiceOutput = Interface::Output(&graph, "matrixTransposeTwice");
+	matrixTransposeTwiceOutput.Set(matrixTransposeTwice);
+
+	auto tensorPermuteTwice = tensor->Permute(std::vector<uint32_t>{1, 2, 0})->Permute(std::vector<uint32_t>{1, 2, 0});
+	auto tensorPermuteTwiceOutput = Interface::Output(&graph, "tensorPermuteTwice");
+	tensorPermuteTwiceOutput.Set(tensorPermuteTwice);
+
+	graph.Simplify();
+
 	// Generate Code
 
 	CodeGenerator codeGenerator(&path);
+	codeGenerator.SetScheduling(CodeGenerator::Scheduling::SEQUENTIAL);
+	codeGenerator.SetMemoryPlanning(true);
 	bool GenSuccess = codeGenerator.Generate(&graph);
 	if(!GenSuccess)
 	{
@@ -130,9 +130,162 @@ bool ModuleProduct::Generate(const std::string &path)
 	auto dvectorSquaredBaseOutput = Interface::Output(&graph, "dvectorSquaredBase");
 	dvectorSquaredBaseOutput.Set(dvectorSquaredBase);
 
+	// Wide graph: One node with 100 children, all of which may run in parallel
+	auto wideVector = vector1->Multiply(scalar);
+	auto wideSum = wideVector->Multiply(myVs.Scalar(&graph, 1.f));
+	for(size_t child = 2; child <= 100; child++)
+	{
+		auto wideChild = wideVector->Multiply(myVs.Scalar(&graph, (float) child));
+		wideSum = wideSum->Add(wideChild);
+	}
+
+	auto wideSumOutput = Interface::Output(&graph, "wideSum");
+	wideSumOutput.Set(wideSum);
+
+	// Large matrix product: Split into several jobs
+	auto bigVs = Algebra::Module::VectorSpace(Algebra::Ring::Float32, 64);
+	auto bigMatrixSpace = Algebra::Module::VectorSpace(bigVs, 2);
+
+	auto ones_init = std::vector<float>(64 * 64, 1.f);
+	auto columns_init = std::vector<float>(64 * 64);
+	for(size_t index = 0; index < columns_init.size(); index++)
+	{
+		columns_init[index] = (float) (index % 64);
+	}
+
+	auto ones = bigMatrixSpace.Element(&graph, ones_init);
+	auto columns = bigMatrixSpace.Element(&graph, columns_init);
+	auto matrixProduct = ones->Contract(columns, std::vector<uint32_t>{1}, std::vector<uint32_t>{0});
+
+	auto matrixProductOutput = Interface::Output(&graph, "matrixProduct");
+	matrixProductOutput.Set(matrixProduct);
+
+	// ... with transposed operands
+	auto matrixProductTransposed = columns->Contract(ones, std::vector<uint32_t>{0}, std::vector<uint32_t>{1});
+
+	auto matrixProductTransposedOutput = Interface::Output(&graph, "matrixProductTransposed");
+	matrixProductTransposedOutput.Set(matrixProductTransposed);
+
+	// ... followed by element-wise operations, computed where the product is stored
+	auto matrixProductEpilogue = ones->Contract(columns, std::vector<uint32_t>{1}, std::vector<uint32_t>{0})->Add(columns)->Multiply(scalar2);
+
+	auto matrixProductEpilogueOutput = Interface::Output(&graph, "matrixProductEpilogue");
+	matrixProductEpilogueOutput.Set(matrixProductEpilogue);
+
+	// ... with a permuted operand, read in place
+	auto matrixProductPermuted = columns->Permute(std::vector<uint32_t>{1, 0})->Contract(columns, std::vector<uint32_t>{1}, std::vector<uint32_t>{0});
+
+	auto matrixProductPermutedOutput = Interface::Output(&graph, "matrixProductPermuted");
+	matrixProductPermutedOutput.Set(matrixProductPermuted);
+
+	// Sparse matrix: Only the non-zeros are stored and multiplied
+	auto sparseVs = Algebra::Module::VectorSpace(Algebra::Ring::Float32, 8);
+	auto sparseMatrixSpace = Algebra::Module::VectorSpace(sparseVs, 2);
+
+	auto antiDiagonal_init = std::vector<float>(8 * 8, 0.f);
+	auto vector8_init = std::vector<float>(8);
+	for(size_t index = 0; index < 8; index++)
+	{
+		antiDiagonal_init[index * 8 + 7 - index] = (float) (index + 1);
+		vector8_init[index] = (float) index;
+	}
+
+	Algebra::Module::VectorSpace::Vector::propertyParameterSparse_t paramSparse;
+	paramSparse.Initializer = paramSparse.DENSE;
+
+	auto antiDiagonal = sparseMatrixSpace.Element(&graph, antiDiagonal_init, Algebra::Module::VectorSpace::Vector::Property::Sparse, &paramSparse);
+	auto vector8 = sparseVs.Element(&graph, vector8_init);
+	auto sparseMatrixVector = antiDiagonal->Multiply(scalar2)->Contract(vector8, 1, 0);
+
+	auto sparseMatrixVectorOutput = Interface::Output(&graph, "sparseMatrixVector");
+	sparseMatrixVectorOutput.Set(sparseMatrixVector);
+
+	// Symmetric matrix given by its upper triangle: Only the triangle is stored, mirror images are added by the contraction
+	auto symmetricVs = Algebra::Module::VectorSpace(Algebra::Ring::Float32, 3);
+	auto symmetricMatrixSpace = Algebra::Module::VectorSpace(symmetricVs, 2);
+
+	auto upperTriangle_init = std::vector<float>{1, 2, 3, 4, 5, 6};
+	auto vector3_init = std::vector<float>{1, 2, 3};
+
+	Algebra::Module::VectorSpace::Vector::propertyParameterSymmetric_t paramSymmetric;
+	paramSymmetric.Initializer = paramSymmetric.LEFTMOST_INDICES;
+	paramSymmetric.Pairs = {0, 1};
+
+	auto symmetricMatrix = symmetricMatrixSpace.Element(&graph, upperTriangle_init, Algebra::Module::VectorSpace::Vector::Property::Symmetric, &paramSymmetric);
+	auto vector3 = symmetricVs.Element(&graph, vector3_init);
+	auto symmetricMatrixVector = symmetricMatrix->Contract(vector3, 1, 0);
+
+	auto symmetricMatrixVectorOutput = Interface::Output(&graph, "symmetricMatrixVector");
+	symmetricMatrixVectorOutput.Set(symmetricMatrixVector);
+
+	// a a^T: Only the upper triangle is computed, then mirrored ...
+	auto rows_init = std::vector<float>{1, 2, 3, 4, 5, 6};
+	auto rowsSpace = Algebra::Module::VectorSpace(Algebra::Ring::Float32, std::vector<dimension_t>{3, 2});
+	auto rows = rowsSpace.Element(&graph, rows_init);
+	auto symmetricProduct = rows->Contract(rows, 1, 1);
+
+	auto symmetricProductOutput = Interface::Output(&graph, "symmetricProduct");
+	symmetricProductOutput.Set(symmetricProduct);
+
+	// ... or stored packed if all its readers handle that
+	auto doubledRows = rows->Multiply(scalar2);
+	auto symmetricProductVector = doubledRows->Contract(doubledRows, 1, 1)->Contract(vector3, 1, 0);
+
+	auto symmetricProductVectorOutput = Interface::Output(&graph, "symmetricProductVector");
+	symmetricProductVectorOutput.Set(symmetricProductVector);
+
+	// Long vector: Vectorized loops and remainder
+	auto longVs = Algebra::Module::VectorSpace(Algebra::Ring::Float32, 37);
+
+	auto longVector_init = std::vector<float>(37);
+	for(size_t index = 0; index < longVector_init.size(); index++)
+	{
+		longVector_init[index] = (float) index;
+	}
+
+	auto longVector = longVs.Element(&graph, longVector_init);
+	auto longVectorSquared = longVector->Power(scalar2);
+	auto longVectorResult = longVectorSquared->Add(longVector->Multiply(scalar2));
+
+	auto longVectorOutput = Interface::Output(&graph, "longVector");
+	longVectorOutput.Set(longVectorResult);
+
+	// Integer exponents are multiplied out
+	auto longVectorCubed = longVector->Power(myVs.Scalar(&graph, 3.f));
+	auto longVectorCubedOutput = Interface::Output(&graph, "longVectorCubed");
+	longVectorCubedOutput.Set(longVectorCubed);
+
+	auto longVectorIsSmaller = longVector->IsSmaller(longVectorResult);
+	auto longVectorIsSmallerOutput = Interface::Output(&graph, "longVectorIsSmaller");
+	longVectorIsSmallerOutput.Set(longVectorIsSmaller);
+
+	// Element-wise chains: Computed in one loop
+	auto fusedChain = longVector->Add(longVector)->Multiply(scalar2)->Add(longVector);
+	auto fusedChainOutput = Interface::Output(&graph, "fusedChain");
+	fusedChainOutput.Set(fusedChain);
+
+	auto fusedPower = longVector->Add(longVector)->Multiply(myVs.Scalar(&graph, 0.01f))->Power(scalar2);
+	auto fusedIsSmaller = fusedPower->IsSmaller(longVector);
+	auto fusedIsSmallerOutput = Interface::Output(&graph, "fusedIsSmaller");
+	fusedIsSmallerOutput.Set(fusedIsSmaller);
+
+	// Simplify() points the second output at the sum the first one reads: Both are kept
+	auto vectorSum = vector1->Add(vector2);
+	auto vectorSumOutput = Interface::Output(&graph, "vectorSum");
+	vectorSumOutput.Set(vectorSum);
+
+	auto vectorSumTimesOne = vectorSum->Multiply(myVs.Scalar(&graph, 1.f));
+	auto vectorSumTimesOneOutput = Interface::Output(&graph, "vectorSumTimesOne");
+	vectorSumTimesOneOutput.Set(vectorSumTimesOne);
+
+	graph.Simplify();
+	graph.RemoveDuplicates();
+
 	// Generate Code
 
 	CodeGenerator codeGenerator(&path);
+	codeGenerator.SetSimd(CodeGenerator::Simd::SSE2);
+	codeGenerator.SetPadding(true);
 	bool GenSuccess = codeGenerator.Generate(&graph);
 	if(!GenSuccess)
 	{
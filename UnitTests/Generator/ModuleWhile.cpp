@@ -0,0 +1,110 @@
+/*
+ * This file is part of
+ * Distributed Algebraic Computations (https://github.com/siquus/dac)
+ *
+ * GPL-3 (or later)
+ *
+ * Copyright (C) 2020  Patrik Omland
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ControlTransfer.h"
+#include "Graph.h"
+#include "Module.h"
+#include "Ring.h"
+#include "Interface.h"
+#include "CodeGenerator.h"
+
+#include "ModuleWhile.h"
+
+static bool generateWhile(const std::string &path, const char * name, bool constantFolding, CodeGenerator::Scheduling scheduling, size_t threadsNrOf)
+{
+	Graph graph(name);
+
+	auto myVs = Algebra::Module::VectorSpace(Algebra::Ring::Float32, 3);
+	auto myMatrixSpace = Algebra::Module::VectorSpace(myVs, 2);
+
+	auto state_init = std::vector<float>{1, 2, 3};
+	auto state = myVs.Element(&graph, state_init);
+
+	// Constant chain, cheaper when contracted from the right: Its new inner contraction reads constants only
+	auto matrix1_init = std::vector<float>{1, 2, 0, 0, 1, 0, 0, 0, 1};
+	auto matrix1 = myMatrixSpace.Element(&graph, matrix1_init);
+
+	auto matrix2_init = std::vector<float>{1, 0, 0, 0, 1, 0, 1, 0, 1};
+	auto matrix2 = myMatrixSpace.Element(&graph, matrix2_init);
+
+	auto vector_init = std::vector<float>{1, 1, 1};
+	auto vector = myVs.Element(&graph, vector_init);
+
+	auto chain = matrix1->Contract(matrix2, 1, 0)->Contract(vector, 1, 0);
+
+	auto newState = state->Add(chain);
+	newState->StoreIn(state);
+
+	auto whileStateOutput = Interface::Output(&graph, "whileState");
+	whileStateOutput.Set(newState);
+
+	auto myIntVs = Algebra::Module::VectorSpace(Algebra::Ring::Int32, 1);
+
+	auto iterations = myIntVs.Scalar(&graph, 4);
+	auto minusOne = myIntVs.Scalar(&graph, -1);
+
+	auto iterationCntDown = iterations->Add(minusOne);
+	iterationCntDown->StoreIn(iterations);
+
+	std::vector<const NodeRef *> whileParents{&whileStateOutput};
+
+	ControlTransfer::While loop;
+	loop.Set(
+			iterationCntDown,
+			whileParents,
+			&whileStateOutput,
+			nullptr);
+
+	graph.Simplify();
+	graph.OrderContractions();
+
+	// Generate Code
+
+	CodeGenerator codeGenerator(&path);
+	codeGenerator.SetConstantFolding(constantFolding);
+	codeGenerator.SetScheduling(scheduling, threadsNrOf);
+	bool GenSuccess = codeGenerator.Generate(&graph);
+	if(!GenSuccess)
+	{
+		printf("Could not generate Code\n");
+		return false;
+	}
+
+	return true;
+}
+
+bool ModuleWhile::Generate(const std::string &path)
+{
+	if(!generateWhile(path, "ModuleWhile", false, CodeGenerator::Scheduling::DYNAMIC, 1))
+	{
+		return false;
+	}
+
+	// The chain is folded, too: Its result still has to be read in every iteration
+	if(!generateWhile(path, "ModuleWhileFolded", true, CodeGenerator::Scheduling::DYNAMIC, 1))
+	{
+		return false;
+	}
+
+	// The loop partitioned across threads at generation time
+	return generateWhile(path, "ModuleWhileStatic", false, CodeGenerator::Scheduling::STATIC, 3);
+}
@@ -36,6 +36,7 @@
 #include "ModulePermute.h"
 #include "ModuleProduct.h"
 #include "ModuleCNN.h"
+#include "ModuleWhile.h"
 
 #include "main.h"
 
@@ -73,6 +74,9 @@ int main()
 	ModuleCNN moduleCNN;
 	FATAL_ON_FALSE(moduleCNN.Generate(outpath));
 
+	ModuleWhile moduleWhile;
+	FATAL_ON_FALSE(moduleWhile.Generate(outpath));
+
 	printf("Success!\n");
 	return 0;
 }
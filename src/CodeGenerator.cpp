@@ -28,6 +28,7 @@
 #include <cstdarg>
 #include <algorithm>
 #include <float.h>
+#include <math.h>
 
 #include "GlobalDefines.h"
 #include "Ring.h"
@@ -109,23 +110,14 @@ static const char fileHeader[] = \
  */\n\
 \n";
 
-// TODO: This is very wasteful
 static void getAllTuples(std::vector<std::vector<uint32_t>> &tuples, const std::vector<std::pair<uint32_t, uint32_t>> &ranges)
 {
-	const size_t nrOfTuplesLimit = 1000;
-
 	size_t nrOfTuples = 1;
 	for(const auto &range: ranges)
 	{
 		nrOfTuples *= range.second - range.first;
 	}
 
-	if(nrOfTuples > nrOfTuplesLimit)
-	{
-		Fatal("Tried to generated %lu tuples. Limit is %lu!\n",
-				nrOfTuples, nrOfTuplesLimit);
-	}
-
 	tuples.resize(nrOfTuples);
 
 	// Initialize first tuple to all lowest indices
@@ -148,7 +140,7 @@ static void getAllTuples(std::vector<std::vector<uint32_t>> &tuples, const std::
 		 }
 		 else // Increase other index
 		 {
-			 tuples[tuple].at(ranges.size() - 1) = 0;
+			 tuples[tuple].at(ranges.size() - 1) = ranges[ranges.size() - 1].first;
 
 			 for(int index = ranges.size() - 2; index >= 0; index--)
 			 {
@@ -159,14 +151,21 @@ static void getAllTuples(std::vector<std::vector<uint32_t>> &tuples, const std::
 				 }
 				 else
 				 {
-					 tuples[tuple].at(index) = 0;
+					 tuples[tuple].at(index) = ranges[index].first;
 				 }
 			 }
 		 }
 	}
 }
 
-static const uint32_t NODE_T_MAX_EDGE_NUMBER = 42;
+static void pushBackUnique(std::vector<uint32_t> * vec, uint32_t value)
+{
+	// The executor counts one readiness signal per edge, so edges must not be listed twice
+	if(vec->end() == std::find(vec->begin(), vec->end(), value))
+	{
+		vec->push_back(value);
+	}
+}
 
 static void appendArrayPosition(std::string * out, const Algebra::Module::VectorSpace * vspace, const std::string &indexTuple)
 {
@@ -191,35 +190,69 @@ static void appendArrayPosition(std::string * out, const Algebra::Module::Vector
 	*out += "]";
 }
 
-static void appendIndexTuple(std::string * out, const Algebra::Module::VectorSpace * vspace, const std::string &arrayPos)
+static void appendViewPosition(std::string * out, const std::vector<size_t> &strides, size_t offset, const std::string &indexTuple)
 {
-	std::vector<uint32_t> strides;
-	vspace->GetStrides(&strides);
+	*out += "[";
+	if(offset)
+	{
+		*out += std::to_string(offset) + " + ";
+	}
 
-	*out += "{";
 	for(size_t stride = 0; stride < strides.size(); stride++)
 	{
-		if(0 == stride)
-		{
-			*out += arrayPos;
-		}
-		else
-		{
-			*out += "(" + arrayPos + " % " + std::to_string(strides[stride - 1]) + ")";
-		}
+		*out += indexTuple + "[" + std::to_string(stride) + "]";
 
 		if(1 != strides[stride])
 		{
-			*out += " / " + std::to_string(strides[stride]);
+			*out += " * " + std::to_string(strides[stride]);
 		}
 
 		if(strides.size() - 1 != stride)
 		{
-			*out += ", ";
+			*out += " + ";
+		}
+	}
+	*out += "]";
+}
+
+static void getIndexTuple(std::vector<uint32_t> * tuple, size_t position, const Algebra::Module::VectorSpace * vspace)
+{
+	std::vector<uint32_t> strides;
+	vspace->GetStrides(&strides);
+
+	tuple->resize(strides.size());
+	for(size_t factor = 0; factor < strides.size(); factor++)
+	{
+		tuple->at(factor) = (position / strides[factor]) % vspace->Factors()->at(factor).Dim;
+	}
+}
+
+static size_t getArrayPosition(const Algebra::Module::VectorSpace * vspace, const std::vector<uint32_t> &tuple)
+{
+	std::vector<uint32_t> strides;
+	vspace->GetStrides(&strides);
+
+	size_t position = 0;
+	for(size_t factor = 0; factor < strides.size(); factor++)
+	{
+		position += tuple[factor] * strides[factor];
+	}
+
+	return position;
+}
+
+// Whether term t uses stored element t, i.e. the packed operand is read in order
+static bool isEachElementOnce(const std::vector<uint32_t> &elements)
+{
+	for(size_t term = 0; term < elements.size(); term++)
+	{
+		if(term != elements[term])
+		{
+			return false;
 		}
 	}
 
-	*out += "}";
+	return true;
 }
 
 FileWriter::~FileWriter()
@@ -305,6 +338,32 @@ CodeGenerator::~CodeGenerator() {
 
 }
 
+void CodeGenerator::SetScheduling(Scheduling scheduling, size_t threadsNrOf)
+{
+	scheduling_ = scheduling;
+	ThreadsNrOf_ = threadsNrOf;
+}
+
+void CodeGenerator::SetSimd(Simd simd)
+{
+	simd_ = simd;
+}
+
+void CodeGenerator::SetPadding(bool padding)
+{
+	padding_ = padding;
+}
+
+void CodeGenerator::SetMemoryPlanning(bool memoryPlanning)
+{
+	memoryPlanning_ = memoryPlanning;
+}
+
+void CodeGenerator::SetConstantFolding(bool constantFolding)
+{
+	constantFolding_ = constantFolding;
+}
+
 bool CodeGenerator::Generate(const Graph* graph)
 {
 	graph_ = graph;
@@ -330,6 +389,10 @@ bool CodeGenerator::Generate(const Graph* graph)
 		DEBUG("\n");
 	}
 
+	retFalseOnFalse(FoldConstants(), "Could not fold constants\n");
+	retFalseOnFalse(FoldViews(), "Could not fold views\n");
+	retFalseOnFalse(PropagatePacking(), "Could not propagate packing\n");
+	retFalseOnFalse(FuseElementWiseNodes(), "Could not fuse element-wise nodes\n");
 	retFalseOnFalse(FetchVariables(), "Could not fetch variables\n");
 
 	std::string pathAndFileName = path_ + "Dac" + graph->Name();
@@ -379,15 +442,24 @@ bool CodeGenerator::Generate(const Graph* graph)
 	fileInstructions_.PrintfLine("#include \"Dac%s.h\"", graph_->Name().c_str());
 	fileInstructions_.PrintfLine("#include \"Instructions%s.h\"\n", graph_->Name().c_str());
 
+	retFalseOnFalse(GenerateSimdTypes(), "Could not generate SIMD types\n");
+
 	// Generate Functions
 	fileDacH_.PrintfLine("#ifdef __cplusplus");
 	fileDacH_.PrintfLine("extern \"C\" {");
 	fileDacH_.PrintfLine("#endif // __cplusplus\n");
-	fileDacH_.PrintfLine("#include <stddef.h>\n");
+	fileDacH_.PrintfLine("#include <stddef.h>");
+	fileDacH_.PrintfLine("#include <stdint.h>\n");
 	retFalseOnFalse(GenerateInterfaceFunctions(), "Could not generate interface Functions\n!");
 	fileInstructions_.PrintfLine("");
 
 	// Generate Variables
+	// Lifetimes follow from the order of execution, which is only fixed if sequential
+	if(memoryPlanning_ && (Scheduling::SEQUENTIAL == scheduling_))
+	{
+		retFalseOnFalse(PlanMemory(), "Could not plan memory!\n");
+	}
+
 	retFalseOnFalse(GenerateConstantDeclarations(), "Could not generate Constants\n");
 	fileInstructions_.PrintfLine("");
 	retFalseOnFalse(GenerateStaticVariableDeclarations(), "Could not generate Statics\n!");
@@ -398,11 +470,24 @@ bool CodeGenerator::Generate(const Graph* graph)
 
 	retFalseOnFalse(GenerateRunFunction(), "Could not generate Run Function!\n");
 
-	fileInstructions_.PrintfLine("static node_t nodes%s[]; // Initialized below\n", graph_->Name().c_str()); // TODO: This seems dirty.
+	if(Scheduling::SEQUENTIAL == scheduling_)
+	{
+		retFalseOnFalse(GenerateInstructions(), "Could not generate Instructions!\n");
+		retFalseOnFalse(GenerateSequentialRunFunction(), "Could not generate sequential Run Function!\n");
+	}
+	else if(Scheduling::STATIC == scheduling_)
+	{
+		retFalseOnFalse(GenerateInstructions(), "Could not generate Instructions!\n");
+		retFalseOnFalse(GenerateStaticRunFunction(), "Could not generate static Run Function!\n");
+	}
+	else
+	{
+		fileInstructions_.PrintfLine("static node_t nodes%s[]; // Initialized below\n", graph_->Name().c_str()); // TODO: This seems dirty.
 
-	retFalseOnFalse(GenerateInstructions(), "Could not generate Instructions!\n");
+		retFalseOnFalse(GenerateInstructions(), "Could not generate Instructions!\n");
 
-	retFalseOnFalse(GenerateNodesArray(), "Could not generate Nodes Array");
+		retFalseOnFalse(GenerateNodesArray(), "Could not generate Nodes Array");
+	}
 
 	fileDacH_.PrintfLine("#ifdef __cplusplus");
 	fileDacH_.PrintfLine("}");
@@ -413,44 +498,32 @@ bool CodeGenerator::Generate(const Graph* graph)
 
 bool CodeGenerator::GenerateNodesArray()
 {
-	fileInstructions_.PrintfLine("static node_t nodes%s[] = {", graph_->Name().c_str());
-	fileInstructions_.Indent();
+	// Edges are stored in CSR-style: All parents (children) of all nodes in one array,
+	// each node points to its slice.
+	std::vector<uint32_t> parentsArray;
+	std::vector<uint32_t> childrenArray;
+	std::vector<std::pair<size_t, size_t>> parentsSlices; // offset, number of
+	std::vector<std::pair<size_t, size_t>> childrenSlices;
 
-	// Write array
 	for(const auto &nodePair: nodesInstructionMap_)
 	{
 		// Only include parents/children which require an instruction
+		std::vector<Node::Id_t> instructionParents;
+		GetInstructionParents(&instructionParents, nodePair.second);
+
 		std::vector<uint32_t> parentsArrayPosition;
-		for(const Node::Id_t &parent: *nodePair.second->Parents())
+		for(const Node::Id_t &parent: instructionParents)
 		{
-			if(nodesInstructionMap_.end() != nodesInstructionMap_.find(parent))
+			const auto &arrayPos = nodeArrayPos_.find(parent);
+			if(nodeArrayPos_.end() == arrayPos)
 			{
-				const auto &arrayPos = nodeArrayPos_.find(parent);
-				if(nodeArrayPos_.end() == arrayPos)
-				{
-					Error("Couldn't find array position for node %u\n", parent);
-					return false;
-				}
-
-				parentsArrayPosition.push_back(arrayPos->second);
+				Error("Couldn't find array position for node %u\n", parent);
+				return false;
 			}
-			else // Maybe the parent is just a intermediate variable for e.g. an input
+
+			for(const uint32_t &pos: arrayPos->second)
 			{
-				const Node * parentNode = graph_->GetNode(parent);
-				for(const Node::Id_t &grandParent: *parentNode->Parents())
-				{
-					if(nodesInstructionMap_.end() != nodesInstructionMap_.find(grandParent))
-					{
-						const auto &arrayPos = nodeArrayPos_.find(grandParent);
-						if(nodeArrayPos_.end() == arrayPos)
-						{
-							Error("Couldn't find array position for node %u\n", grandParent);
-							return false;
-						}
-
-						parentsArrayPosition.push_back(arrayPos->second);
-					}
-				}
+				pushBackUnique(&parentsArrayPosition, pos);
 			}
 		}
 
@@ -474,16 +547,21 @@ bool CodeGenerator::GenerateNodesArray()
 
 			for(const Node::Id_t &child: *childNode->Children())
 			{
-				if(nodesInstructionMap_.end() != nodesInstructionMap_.find(child))
+				// Fused children are computed by their sink
+				const Node::Id_t sink = GetFusionSink(child);
+				if(nodesInstructionMap_.end() != nodesInstructionMap_.find(sink))
 				{
-					const auto &arrayPos = nodeArrayPos_.find(child);
+					const auto &arrayPos = nodeArrayPos_.find(sink);
 					if(nodeArrayPos_.end() == arrayPos)
 					{
-						Error("Couldn't find array position for node %u\n", child);
+						Error("Couldn't find array position for node %u\n", sink);
 						return false;
 					}
 
-					childrenArrayPosition.push_back(arrayPos->second);
+					for(const uint32_t &pos: arrayPos->second)
+					{
+						pushBackUnique(&childrenArrayPosition, pos);
+					}
 				}
 			}
 		}
@@ -492,27 +570,63 @@ bool CodeGenerator::GenerateNodesArray()
 		default:
 			for(const Node::Id_t &child: *nodePair.second->Children())
 			{
-				if(nodesInstructionMap_.end() != nodesInstructionMap_.find(child))
+				// Fused children are computed by their sink
+				const Node::Id_t sink = GetFusionSink(child);
+				if(nodesInstructionMap_.end() != nodesInstructionMap_.find(sink))
 				{
-					const auto &arrayPos = nodeArrayPos_.find(child);
+					const auto &arrayPos = nodeArrayPos_.find(sink);
 					if(nodeArrayPos_.end() == arrayPos)
 					{
-						Error("Couldn't find array position for node %u\n", child);
+						Error("Couldn't find array position for node %u\n", sink);
 						return false;
 					}
 
-					childrenArrayPosition.push_back(arrayPos->second);
+					for(const uint32_t &pos: arrayPos->second)
+					{
+						pushBackUnique(&childrenArrayPosition, pos);
+					}
 				}
 			}
 			break;
 		}
 
-		retFalseOnFalse(
-				GenerateNodesElem(
-						nodePair.first,
-						&parentsArrayPosition,
-						&childrenArrayPosition),
-				"Could not generate Nodes Element!");
+		// Tiles share the edges of their node
+		const size_t tilesNrOf = nodeArrayPos_.at(nodePair.first).size();
+		for(size_t tile = 0; tile < tilesNrOf; tile++)
+		{
+			parentsSlices.push_back(std::make_pair(parentsArray.size(), parentsArrayPosition.size()));
+			parentsArray.insert(parentsArray.end(), parentsArrayPosition.begin(), parentsArrayPosition.end());
+
+			childrenSlices.push_back(std::make_pair(childrenArray.size(), childrenArrayPosition.size()));
+			childrenArray.insert(childrenArray.end(), childrenArrayPosition.begin(), childrenArrayPosition.end());
+		}
+	}
+
+	retFalseOnFalse(GenerateEdgeArray("nodeParents", "const node_t * const", &parentsArray), "Could not generate parents array!\n");
+	retFalseOnFalse(GenerateEdgeArray("nodeChildren", "node_t * const", &childrenArray), "Could not generate children array!\n");
+
+	fileInstructions_.PrintfLine("static node_t nodes%s[] = {", graph_->Name().c_str());
+	fileInstructions_.Indent();
+
+	size_t arrayPos = 0;
+	for(const auto &nodePair: nodesInstructionMap_)
+	{
+		const size_t tilesNrOf = nodeArrayPos_.at(nodePair.first).size();
+		for(size_t tile = 0; tile < tilesNrOf; tile++)
+		{
+			std::string instrId;
+			GenerateInstructionId(&instrId, nodePair.first, (1 < tilesNrOf) ? tile : SIZE_MAX);
+
+			retFalseOnFalse(
+					GenerateNodesElem(
+							&instrId,
+							nodePair.first,
+							&parentsSlices[arrayPos],
+							&childrenSlices[arrayPos]),
+					"Could not generate Nodes Element!");
+
+			arrayPos++;
+		}
 	}
 
 	fileInstructions_.Outdent();
@@ -524,6 +638,7 @@ bool CodeGenerator::GenerateNodesArray()
 
 	std::string jobPoolInitNodesId = "jobPoolInitNodes" + graph_->Name();
 	std::string jobPoolInitNodes = "node_t * " + jobPoolInitNodesId + "[] = {";
+	size_t firstNodesNrOf = 0;
 	for(const auto &node: firstNodes)
 	{
 		const auto &arrayPos = nodeArrayPos_.find(node);
@@ -533,10 +648,14 @@ bool CodeGenerator::GenerateNodesArray()
 			return false;
 		}
 
-		jobPoolInitNodes += "&nodes" + graph_->Name() + "[";
-		jobPoolInitNodes += std::to_string(arrayPos->second);
-		jobPoolInitNodes += "]";
-		jobPoolInitNodes += ", ";
+		for(const uint32_t &pos: arrayPos->second)
+		{
+			jobPoolInitNodes += "&nodes" + graph_->Name() + "[";
+			jobPoolInitNodes += std::to_string(pos);
+			jobPoolInitNodes += "]";
+			jobPoolInitNodes += ", ";
+			firstNodesNrOf++;
+		}
 	}
 
 	jobPoolInitNodes.erase(jobPoolInitNodes.size() - 2); // Remove last ", "
@@ -548,7 +667,10 @@ bool CodeGenerator::GenerateNodesArray()
 	fileInstructions_.PrintfLine("%s = {", jobPoolInitId.c_str());
 	fileInstructions_.Indent();
 	fileInstructions_.PrintfLine(".Nodes = %s,", jobPoolInitNodesId.c_str());
-	fileInstructions_.PrintfLine(".NodesNrOf = %lu,", firstNodes.size());
+	fileInstructions_.PrintfLine(".NodesNrOf = %lu,", firstNodesNrOf);
+	// Every node is queued at most once at any time. The graph's width (largest antichain) is not
+	// a bound here, as loops may queue a node's next execution before its descendants ran.
+	fileInstructions_.PrintfLine(".JobsNrOfMax = %lu,", arrayPos);
 	fileInstructions_.Outdent();
 	fileInstructions_.PrintfLine("};");
 
@@ -559,670 +681,1894 @@ bool CodeGenerator::GenerateNodesArray()
 	return true;
 }
 
-bool CodeGenerator::GetFirstNodesToExecute(std::set<Node::Id_t> * nodeSet)
+bool CodeGenerator::GetStaticOrder(std::vector<Node::Id_t> * order, const Node ** controlTransfer, std::set<Node::Id_t> * loopBody) const
 {
-	// Find all nodes which do not have parents and create a set of their children
-	std::set<Node::Id_t> roots;
+	retFalseOnFalse(GetInstructionsTopologicalOrder(order), "Could not sort instructions!\n");
 
-	auto nodes = graph_->GetNodes();
-	for(const auto &nodePair: *nodes)
+	// Every instruction is executed once. A control transfer then repeats all descendants
+	// of the nodes it would push, i.e. the loop body. The loop body depends on nothing but
+	// itself and the nodes before, so it can be moved to the end of the topological order.
+	*controlTransfer = nullptr;
+	for(const Node::Id_t &nodeId: *order)
 	{
-		if(0 == nodePair.second.Parents()->size())
+		const Node * node = graph_->GetNode(nodeId);
+		if(Node::Type::CONTROL_TRANSFER_WHILE != node->GetType())
 		{
-			roots.insert(nodePair.second.id);
-
-			bool nodeIsInstruction = (nodesInstructionMap_.find(nodePair.second.id) != nodesInstructionMap_.end());
-
-			if(nodeIsInstruction)
-			{
-				nodeSet->insert(nodePair.second.id);
-			}
-			else
-			{
-				std::copy(
-						nodePair.second.Children()->begin(), nodePair.second.Children()->end(),
-						std::inserter(*nodeSet, nodeSet->end()));
-			}
+			continue;
 		}
-	}
 
-	// delete all children which have non-root parents.
-	// i.e. these children may be executed right away.
-	std::vector<Node::Id_t> nonFirstGenerationChildren;
-	for(Node::Id_t childId: *nodeSet)
-	{
-		const auto childNodeIt =  nodes->find(childId);
-		if(nodes->end() == childNodeIt)
+		if(nullptr != *controlTransfer)
 		{
-			Error("Unknown Child, NodeId = %u!\n", childId);
+			Error("Sequential and static scheduling support only one control transfer!\n");
 			return false;
 		}
 
-		const Node* childNode = &childNodeIt->second;
+		*controlTransfer = node;
+
+		std::set<Node::Id_t> rootChildren;
+		retFalseOnFalse(GetControlTransferBranchTrue(&rootChildren, node), "Could not get branch!\n");
 
-		for(const Node::Id_t &parentId: *childNode->Parents())
+		std::vector<Node::Id_t> toVisit(rootChildren.begin(), rootChildren.end());
+		while(toVisit.size())
 		{
-			if(roots.end() == roots.find(parentId))
+			Node::Id_t visitId = toVisit.back();
+			toVisit.pop_back();
+
+			if(!loopBody->insert(visitId).second)
 			{
-				// Child has one non-first-generation parent.
-				nonFirstGenerationChildren.push_back(childId); // erase later
-				break;
+				continue;
 			}
+
+			const Node * visitNode = graph_->GetNode(visitId);
+			toVisit.insert(toVisit.end(), visitNode->Children()->begin(), visitNode->Children()->end());
 		}
 	}
 
-	for(Node::Id_t childId: nonFirstGenerationChildren)
-	{
-		nodeSet->erase(childId);
-	}
+	std::stable_partition(order->begin(), order->end(),
+			[loopBody](Node::Id_t nodeId) {return loopBody->end() == loopBody->find(nodeId);});
 
 	return true;
 }
 
-bool CodeGenerator::GenerateInstructions()
+bool CodeGenerator::GenerateSequentialRunFunction()
 {
-	Node::Id_t arrayPos = 0;
-	const auto nodes = graph_->GetNodes();
-	for(const auto &nodePair: *nodes)
-	{
-		// Does this node require a function?
-		switch(nodePair.second.GetType())
-		{
-		default:
-			Error("Unknown Node-Type %u\n", (uint8_t) nodePair.second.GetType());
-			return false;
-
-		case Node::Type::NONE:
-			Error("Node::Type::None not allowed!!\n");
-			return false;
+	std::vector<Node::Id_t> order;
+	const Node * controlTransfer;
+	std::set<Node::Id_t> loopBody;
+	retFalseOnFalse(GetStaticOrder(&order, &controlTransfer, &loopBody), "Could not get order!\n");
 
-		case Node::Type::VECTOR: // no break intended
-		case Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT:
-			continue; // does not have instruction
+	fileInstructionsH_.PrintfLine("extern void Instructions%sRunSequential(void);", graph_->Name().c_str());
 
-		case Node::Type::CONTROL_TRANSFER_WHILE: // no break intended
-		case Node::Type::VECTOR_ADDITION: // no break intended
-		case Node::Type::VECTOR_SCALAR_PRODUCT: // no break intended
-		case Node::Type::VECTOR_VECTOR_PRODUCT: // no break intended
-		case Node::Type::VECTOR_POWER: // no break intended
-		case Node::Type::VECTOR_CONTRACTION: // no break intended
-		case Node::Type::VECTOR_COMPARISON_IS_SMALLER: // no break intended
-		case Node::Type::VECTOR_PERMUTATION: // no break intended
-		case Node::Type::VECTOR_PROJECTION: // no break intended
-		case Node::Type::VECTOR_JOIN_INDICES: // no break intended
-		case Node::Type::VECTOR_INDEX_SPLIT_SUM: // no break intended
-		case Node::Type::VECTOR_CROSS_CORRELATION: // no break intended
-		case Node::Type::VECTOR_MAX_POOL: // no break intended
-		case Node::Type::OUTPUT: // no break intended
-		case Node::Type::INPUT:
-			break; // create instruction
-		}
+	fileInstructions_.PrintfLine("void Instructions%sRunSequential(void)", graph_->Name().c_str());
+	fileInstructions_.PrintfLine("{");
+	fileInstructions_.Indent();
 
-		// Create function identifier
-		std::string fctId;
-		GenerateInstructionId(&fctId, nodePair.second.id);
+	for(const Node::Id_t &nodeId: order)
+	{
+		std::string instrId;
+		GenerateInstructionId(&instrId, nodeId);
+		fileInstructions_.PrintfLine("%s();", instrId.c_str());
+	}
 
-		// Set param to unused if not used
-		if(Node::Type::CONTROL_TRANSFER_WHILE != nodePair.second.GetType())
-		{
-			fileInstructions_.PrintfLine("static void %s(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))", fctId.c_str());
-		}
-		else
-		{
-			fileInstructions_.PrintfLine("static void %s(void * instance, void (*PushNode)(void * instance, struct node_s * node))", fctId.c_str());
-		}
+	if(nullptr != controlTransfer)
+	{
+		std::string controlTransferId;
+		GenerateInstructionId(&controlTransferId, controlTransfer->id);
 
+		fileInstructions_.PrintfLine("");
+		fileInstructions_.PrintfLine("while(%sRepeat)", controlTransferId.c_str());
 		fileInstructions_.PrintfLine("{");
 		fileInstructions_.Indent();
 
-		retFalseOnFalse(GenerateOperationCode(
-				&nodePair.second,
-				&fileInstructions_),
-				"Could not generate Operation Code for Node%u!\n", nodePair.first);
-
-		// End function
-		fileInstructions_.Outdent();
-		fileInstructions_.PrintfLine("}\n");
+		for(const Node::Id_t &nodeId: order)
+		{
+			if(loopBody.end() == loopBody.find(nodeId))
+			{
+				continue;
+			}
 
-		// Add node to "nodes with instruction"
-		nodesInstructionMap_.insert(std::pair<Node::Id_t, const Node*>(nodePair.second.id, &nodePair.second));
+			std::string instrId;
+			GenerateInstructionId(&instrId, nodeId);
+			fileInstructions_.PrintfLine("%s();", instrId.c_str());
+		}
 
-		// Determine Nodes array positions
-		nodeArrayPos_.insert(std::pair<Node::Id_t, uint32_t>(nodePair.second.id, arrayPos));
-		arrayPos++;
+		fileInstructions_.Outdent();
+		fileInstructions_.PrintfLine("}");
 	}
 
+	fileInstructions_.Outdent();
+	fileInstructions_.PrintfLine("}");
+
 	return true;
 }
 
-bool CodeGenerator::GenerateCallbackPtCheck(FileWriter* file) const
+bool CodeGenerator::PlanMemory()
 {
-	std::set<const void *> inputCheckCreated;
+	// Intermediate arrays only live from their instruction to their last reader. Arrays whose
+	// lifetimes don't overlap in the sequential order share memory in one arena per element type.
+	std::vector<Node::Id_t> order;
+	const Node * controlTransfer;
+	std::set<Node::Id_t> loopBody;
+	retFalseOnFalse(GetStaticOrder(&order, &controlTransfer, &loopBody), "Could not get order!\n");
 
-	auto nodes = graph_->GetNodes();
-	for(const auto &nodePair: *nodes)
+	std::map<Node::Id_t, size_t> orderPos;
+	for(size_t pos = 0; pos < order.size(); pos++)
 	{
-		switch(nodePair.second.GetType())
-		{
-		case Node::Type::OUTPUT:
+		orderPos[order[pos]] = pos;
+	}
+
+	typedef struct {
+		Variable * var;
+		size_t first; // Order positions
+		size_t last;
+		size_t offset; // Elements
+		size_t length; // Elements, whole multiples of the alignment
+	} buffer_t;
+
+	std::map<std::string, std::vector<buffer_t>> arenaBuffers;
+	size_t unplannedBytes = 0;
+
+	for(const Node::Id_t &nodeId: order)
+	{
+		const Node * node = graph_->GetNode(nodeId);
+
+		auto varIt = variables_.find(nodeId);
+		if(variables_.end() == varIt)
 		{
-			auto output = (const Interface::Output*) nodePair.second.GetObjectPt();
+			continue; // Stored elsewhere or no variable
+		}
 
-			file->PrintfLine("if(NULL == %s)", output->GetCallbackName()->c_str());
-			file->PrintfLine("{");
-			file->PrintfLine("\tfatal(\"%s == NULL\");", output->GetCallbackName()->c_str());
-			file->PrintfLine("}\n");
+		// Constants, external buffers, state carried across iterations and scalars stay as they are.
+		Variable * var = &varIt->second;
+		if(var->HasProperty(Variable::PROPERTY_CONST) ||
+				var->HasProperty(Variable::PROPERTY_POINTER) ||
+				node->UsedAsStorageByOthers() ||
+				(1 >= var->Length()))
+		{
+			continue;
 		}
-		break;
 
-		case Node::Type::INPUT:
+		buffer_t buffer;
+		buffer.var = var;
+		buffer.first = orderPos[nodeId];
+		buffer.last = buffer.first;
+		buffer.offset = 0;
+
+		const size_t elementsPerAlignment = Variable::ALIGNMENT / var->ElementSize();
+		buffer.length = ((var->LengthAllocated() + elementsPerAlignment - 1) / elementsPerAlignment) * elementsPerAlignment;
+
+		for(const Node::Id_t &child: *node->Children())
 		{
-			auto insert = inputCheckCreated.insert(nodePair.second.GetObjectPt());
-			if(!insert.second)
+			// Fused children are read by their sink
+			const Node::Id_t reader = GetFusionSink(child);
+			const auto childPos = orderPos.find(reader);
+			if(orderPos.end() == childPos)
 			{
-				// Pointer check for this input already created
-				continue;
+				continue; // Not an instruction
 			}
 
-			auto input = (const Interface::Input*) nodePair.second.GetObjectPt();
+			// Read by every iteration of the loop, but written once before it
+			if((loopBody.end() != loopBody.find(reader)) && (loopBody.end() == loopBody.find(nodeId)))
+			{
+				buffer.last = order.size();
+			}
 
-			file->PrintfLine("if(NULL == %s)", input->GetCallbackName()->c_str());
-			file->PrintfLine("{");
-			file->PrintfLine("\tfatal(\"%s == NULL\");", input->GetCallbackName()->c_str());
-			file->PrintfLine("}\n");
+			buffer.last = std::max(buffer.last, childPos->second);
 		}
-		break;
 
-		default:
-			// do nothing
-			break;
-		}
+		arenaBuffers[var->GetTypeString()].push_back(buffer);
+		unplannedBytes += var->LengthAllocated() * var->ElementSize();
 	}
 
-	return true;
-}
-
-bool CodeGenerator::GenerateInstructionId(std::string * InstrId, const Node::Id_t NodeId)
-{
-	if(nullptr == InstrId)
+	size_t arenasBytes = 0;
+	for(auto &arenaPair: arenaBuffers)
 	{
-		Error("nullptr");
-		return false;
+		// Largest buffers first, each at the lowest offset not used by a buffer living at the same time
+		std::vector<buffer_t> &buffers = arenaPair.second;
+		std::stable_sort(buffers.begin(), buffers.end(),
+				[](const buffer_t &a, const buffer_t &b) {return a.length > b.length;});
+
+		size_t arenaLength = 0;
+		for(size_t buf = 0; buf < buffers.size(); buf++)
+		{
+			std::vector<std::pair<size_t, size_t>> occupied;
+			for(size_t placed = 0; placed < buf; placed++)
+			{
+				if((buffers[placed].first <= buffers[buf].last) && (buffers[buf].first <= buffers[placed].last))
+				{
+					occupied.push_back(std::make_pair(buffers[placed].offset, buffers[placed].offset + buffers[placed].length));
+				}
+			}
+			std::sort(occupied.begin(), occupied.end());
+
+			size_t offset = 0;
+			for(const auto &range: occupied)
+			{
+				if(offset + buffers[buf].length <= range.first)
+				{
+					break; // Fits into the gap
+				}
+
+				offset = std::max(offset, range.second);
+			}
+
+			buffers[buf].offset = offset;
+			arenaLength = std::max(arenaLength, offset + buffers[buf].length);
+		}
+
+		std::string arenaId = "arena" + graph_->Name() + "_" + arenaPair.first;
+		for(const buffer_t &buffer: buffers)
+		{
+			retFalseOnFalse(buffer.var->PlaceInArena(&arenaId, buffer.offset), "Could not place %s!\n", buffer.var->GetIdentifier()->c_str());
+		}
+
+		arenas_[arenaPair.first] = arenaLength;
+		arenasBytes += arenaLength * buffers.front().var->ElementSize();
 	}
 
-	*InstrId = "Node";
-	*InstrId += std::to_string(NodeId);
-	*InstrId += "Instruction";
+	memoryPlanReport_ = "Memory plan: Intermediate arrays of " + std::to_string(unplannedBytes) +
+			" bytes share " + std::to_string(arenasBytes) + " bytes";
+	DEBUG("%s of %s\n", memoryPlanReport_.c_str(), graph_->Name().c_str());
 
 	return true;
 }
 
-bool CodeGenerator::GenerateNodesElem(
-		const Node::Id_t nodeId,
-		const std::vector<uint32_t> * parentsArrayPosition,
-		const std::vector<uint32_t> * childrenArrayPosition)
+size_t CodeGenerator::GetNodeLength(Node::Id_t id) const
 {
-	std::string instrId;
-	GenerateInstructionId(&instrId, nodeId);
+	const Node * node = graph_->GetNode(id);
+	if(nullptr == node)
+	{
+		return 1;
+	}
 
-	std::string buffer;
-	buffer += instrId;
-	buffer += ", {";
+	Node::Id_t storageNodeId = (Node::ID_NONE != node->IsStoredIn()) ? node->IsStoredIn() : id;
 
-	if(NODE_T_MAX_EDGE_NUMBER < parentsArrayPosition->size())
+	const auto varIt = variables_.find(storageNodeId);
+	if(variables_.end() == varIt)
 	{
-		Error("Too many parent nodes!");
-		return false;
+		return 1; // e.g. Kronecker deltas
+	}
+
+	return varIt->second.Length();
+}
+
+double CodeGenerator::EstimateCost(const Node * node) const
+{
+	// Rough number of floating point operations
+	const double length = (double) GetNodeLength(node->id);
+
+	const Node * contraction = GetFusedContraction(node);
+	if(nullptr != contraction)
+	{
+		return EstimateCost(contraction) + length; // Plus the epilogue
 	}
 
-	for(uint32_t parent = 0; parent < parentsArrayPosition->size(); parent++)
+	switch(node->GetType())
+	{
+	case Node::Type::VECTOR_CONTRACTION:
 	{
-		buffer += "&";
-		buffer += "nodes" + graph_->Name();
-		buffer += "[";
-		buffer += std::to_string((*parentsArrayPosition)[parent]);
-		buffer += "]";
+		// Every stored element of a packed operand is multiplied with a part of the other one, once more per mirror image
+		packedContraction_t packed;
+		if(GetPackedContraction(node, &packed))
+		{
+			return (double) (packed.opOffsets.size() * packed.freeLength);
+		}
 
-		if(parentsArrayPosition->size() - 1 > parent)
+		// Only the upper triangle of a a^T is computed
+		symmetricProduct_t product;
+		if(GetSymmetricProduct(node, &product))
 		{
-			buffer += ", ";
+			return (double) (product.rowsNrOf * (product.rowsNrOf + 1) / 2 * product.innerLength);
 		}
-	}
 
-	buffer += "}, {";
+		// Every output element sums over all contracted indices
+		auto contractParams = (const Node::contractParameters_t *) node->TypeParameters();
+		auto lVec = (const Algebra::Module::VectorSpace::Vector *) graph_->GetNode(node->Parents()->at(0))->GetObjectPt();
 
-	if(NODE_T_MAX_EDGE_NUMBER < childrenArrayPosition->size())
-	{
-		Error("Too many child nodes!");
-		return false;
+		double contractedLength = 1.;
+		for(const uint32_t &factor: contractParams->lfactors)
+		{
+			contractedLength *= (double) lVec->Space()->Factors()->at(factor).Dim;
+		}
+
+		return length * contractedLength;
 	}
 
-	for(uint32_t child = 0; child < childrenArrayPosition->size(); child++)
-	{
-		buffer += "&";
-		buffer += "nodes" + graph_->Name();
-		buffer += "[";
-		buffer += std::to_string((*childrenArrayPosition)[child]);
-		buffer += "]";
+	case Node::Type::VECTOR_CROSS_CORRELATION:
+		return length * (double) GetCrossCorrelationTapsNrOf(node); // times non-zero kernel elements
 
-		if(childrenArrayPosition->size() - 1 > child)
+	case Node::Type::VECTOR_INDEX_SPLIT_SUM: // no break intended
+	case Node::Type::VECTOR_MAX_POOL: // no break intended
+	case Node::Type::OUTPUT:
+	{
+		// Determined by the input length
+		double parentsLength = 0.;
+		for(const Node::Id_t &parent: *node->Parents())
 		{
-			buffer += ", ";
+			parentsLength += (double) GetNodeLength(parent);
 		}
+		return parentsLength;
 	}
 
-	buffer += "}, 0, ";
-	buffer += std::to_string(parentsArrayPosition->size());
-	buffer += ", ";
-	buffer += std::to_string(childrenArrayPosition->size());
-	buffer += ", ";
-	buffer += std::to_string(nodeId);
+	case Node::Type::VECTOR_POWER:
+	{
+		int32_t exponent;
+		if(GetIntegerExponent(&exponent, node))
+		{
+			return log2(1. + abs(exponent)) * length; // Repeated squaring
+		}
 
-	fileInstructions_.PrintfLine("{%s},", buffer.c_str());
+		return 10. * length; // powf
+	}
 
-	return true;
+	default:
+		return length;
+	}
 }
 
-bool CodeGenerator::GenerateRunFunction()
+size_t CodeGenerator::GetTilesNrOf(const Node * node) const
 {
-	// Add prototype to header
-	fileDacH_.PrintfLine("extern int Dac%sRun(size_t threadsNrOf);", graph_->Name().c_str());
+	// Work per tile which outweighs the overhead of an additional job
+	static const double TILE_COST_MIN = 65536.;
+	static const size_t TILES_NR_OF_MAX = 8;
 
-	// Define function
-	fileDacC_.PrintfLine("int Dac%sRun(size_t threadsNrOf)\n{", graph_->Name().c_str());
-	fileDacC_.Indent();
+	// Only the thread pool executes tiles concurrently
+	if(Scheduling::DYNAMIC != scheduling_)
+	{
+		return 1;
+	}
 
-	// Check that callbacks have been set
-	GenerateCallbackPtCheck(&fileDacC_);
+	// Tiles of the contraction computing node
+	const Node * contraction = GetFusedContraction(node);
+	if(nullptr != contraction)
+	{
+		return GetTilesNrOf(contraction);
+	}
+
+	switch(node->GetType())
+	{
+	case Node::Type::VECTOR_CONTRACTION:
+	{
+		for(const Node::Id_t &parent: *node->Parents())
+		{
+			// Stored elements of packed operands are scattered across the result
+			if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == graph_->GetNode(parent)->GetType()) || IsPacked(parent))
+			{
+				return 1;
+			}
+		}
 
-	// Fire up threads
-	fileDacC_.PrintfLine("void * instance = NULL;");
-	fileDacC_.PrintfLine("StartThreads(&instance, threadsNrOf, &jobPoolInit%s);", graph_->Name().c_str());
+		// The triangle computed by a symmetric product is not split
+		symmetricProduct_t product;
+		if(GetSymmetricProduct(node, &product))
+		{
+			return 1;
+		}
+		break;
+	}
 
-	// Join threads, create return values and closing brackets
-	fileDacC_.PrintfLine("JoinThreads(instance);\n");
+	case Node::Type::VECTOR_CROSS_CORRELATION:
+		break;
 
-	// Return 0 to show success.
-	fileDacC_.PrintfLine("return 0;\n}\n");
+	default:
+		return 1;
+	}
 
-	return true;
+	const size_t length = GetNodeLength(node->id);
+	if(1 >= length)
+	{
+		return 1;
+	}
+
+	size_t tilesNrOf = (size_t) (EstimateCost(node) / TILE_COST_MIN);
+	tilesNrOf = std::min(tilesNrOf, TILES_NR_OF_MAX);
+	tilesNrOf = std::min(tilesNrOf, length / GetTileGranularity(node));
+
+	return std::max(tilesNrOf, (size_t) 1);
 }
 
-bool CodeGenerator::InputCode(const Node* node, FileWriter * file)
+size_t CodeGenerator::GetTileGranularity(const Node * node) const
 {
-	file->PrintfLine("// %s\n", __func__);
+	const Node * contraction = GetFusedContraction(node);
+	if(nullptr != contraction)
+	{
+		return GetTileGranularity(contraction);
+	}
 
-	auto input = (const Interface::Input* ) node->GetObjectPt();
+	// Matrix products are split by rows
+	matrixProductShape_t matrixProductShape;
+	if(GetMatrixProductShape(node, &matrixProductShape))
+	{
+		return matrixProductShape.N;
+	}
 
-	// What is the identifier?
-	size_t identifier = input->GetIdentifier(node->id);
-	if(SIZE_MAX == identifier)
+	// Others by rows of the result's last dimension, see GenerateOpIndexLoop
+	const Algebra::Module::VectorSpace::Vector * vec = (const Algebra::Module::VectorSpace::Vector *) node->GetObjectPt();
+	return vec->Space()->Factors()->back().Dim;
+}
+
+void CodeGenerator::GenerateOpIndexLoop(FileWriter * file, const Algebra::Module::VectorSpace * vspace) const
+{
+	// Rows of the last dimension, so that the inner loop neither divides nor carries.
+	// Tiles are split on row boundaries, see GetTileGranularity.
+	std::vector<uint32_t> strides;
+	vspace->GetStrides(&strides);
+
+	const size_t dimsNrOf = strides.size();
+	const uint32_t rowLength = vspace->Factors()->at(dimsNrOf - 1).Dim;
+
+	size_t opIndexFirst = 0;
+	size_t opIndexLast = strides[0] * vspace->Factors()->at(0).Dim;
+	if(opIndexRange_.first < opIndexRange_.second) // Generating a tile
 	{
-		Error("Could not get identifier!\n");
-		return false;
+		opIndexFirst = opIndexRange_.first;
+		opIndexLast = opIndexRange_.second;
 	}
 
-	// For which node do we set the input?
-	Node::Id_t targetNodeId = *(node->Children()->begin());
-	getVarRetFalseOnError(targetVar, targetNodeId);
+	std::string opIndexTuple = "uint32_t opIndexTuple[] = {";
+	for(size_t dim = 0; dim < dimsNrOf - 1; dim++)
+	{
+		opIndexTuple += std::to_string((opIndexFirst / strides[dim]) % vspace->Factors()->at(dim).Dim) + ", ";
+	}
+	opIndexTuple += "0};";
 
-	file->PrintfLine("%s = %s(%lu, %lu * sizeof(%s));",
-			targetVar->GetIdentifier()->c_str(),
-			input->GetCallbackName()->c_str(),
-			identifier,
-			targetVar->Length(),
-			targetVar->GetTypeString());
+	file->PrintfLine("%s", opIndexTuple.c_str());
+	file->PrintfLine("for(size_t opIndexRow = %lu; opIndexRow < %lu; opIndexRow += %u)",
+			opIndexFirst, opIndexLast, rowLength);
+	file->PrintfLine("{");
+	file->Indent();
 
-	return true;
+	file->PrintfLine("for(uint32_t opIndexInRow = 0; opIndexInRow < %u; opIndexInRow++)", rowLength);
+	file->PrintfLine("{");
+	file->Indent();
+
+	file->PrintfLine("const size_t opIndex = opIndexRow + opIndexInRow;");
+	file->PrintfLine("opIndexTuple[%lu] = opIndexInRow;\n", dimsNrOf - 1);
 }
 
-bool CodeGenerator::OutputCode(const Node* node, FileWriter * file)
+void CodeGenerator::GenerateOpIndexLoopEnd(FileWriter * file, const Algebra::Module::VectorSpace * vspace) const
 {
-	file->PrintfLine("// %s\n", __func__);
+	file->Outdent();
+	file->PrintfLine("}");
 
-	// Call corresponding function callbacks
-	for(const Node::Id_t &outId: *node->Parents())
+	// Odometer: Advance the row's index tuple, carry into the preceding indices on overflow.
+	const size_t dimsNrOf = vspace->Factors()->size();
+	if(1 < dimsNrOf)
 	{
-		getVarRetFalseOnError(var, outId);
-
-		auto output = (const Interface::Output*) node->GetObjectPt();
+		file->PrintfLine("");
 
-		const std::string * varIdentifier = var->GetIdentifier();
-		if(nullptr == varIdentifier)
+		for(size_t dim = dimsNrOf - 2; dim > 0; dim--)
 		{
-			Error("Could not find Var. Identifier!\n");
-			return false;
+			file->PrintfLine("if(%u == ++opIndexTuple[%lu])", vspace->Factors()->at(dim).Dim, dim);
+			file->PrintfLine("{");
+			file->Indent();
+			file->PrintfLine("opIndexTuple[%lu] = 0;", dim);
 		}
 
-		// If node is not an array, we need to take address
-		std::string NodeStr;
-		if(2 > var->Length())
+		file->PrintfLine("opIndexTuple[0]++;");
+
+		for(size_t dim = dimsNrOf - 2; dim > 0; dim--)
 		{
-			NodeStr += "&";
+			file->Outdent();
+			file->PrintfLine("}");
 		}
-		NodeStr += *varIdentifier;
-
-		file->PrintfLine("%s(%s, %lu * sizeof(%s));\n",
-				output->GetCallbackName()->c_str(),
-				NodeStr.c_str(),
-				var->Length(),
-				var->GetTypeString());
 	}
 
-	file->PrintfLine("");
-
-	return true;
+	file->Outdent();
+	file->PrintfLine("}");
 }
 
-bool CodeGenerator::GenerateOperationCode(const Node* node, FileWriter * file)
+bool CodeGenerator::GenerateStaticRunFunction()
 {
-	switch(node->GetType())
-	{
-	case Node::Type::VECTOR_ADDITION:
-		retFalseOnFalse(VectorAdditionCode(node, file), "Could not generate Vector Addition Code!\n");
-		break;
+	// Relative cost of a node without any work and of synchronizing with another thread
+	static const double COST_NODE_OVERHEAD = 10.;
+	static const double COST_SYNCHRONIZATION = 200.;
 
-	case Node::Type::CONTROL_TRANSFER_WHILE:
-		retFalseOnFalse(ControlTransferWhileCode(node, file),
-				"Could not generatede Control Transfer While Code!\n");
-		break;
+	std::vector<Node::Id_t> order;
+	const Node * controlTransfer;
+	std::set<Node::Id_t> loopBody;
+	retFalseOnFalse(GetStaticOrder(&order, &controlTransfer, &loopBody), "Could not get order!\n");
 
-	case Node::Type::VECTOR_SCALAR_PRODUCT:
-		retFalseOnFalse(VectorScalarProductCode(node, file),
-				"Could not generate Vector Scalar Product Code!\n");
-		break;
+	const char * name = graph_->Name().c_str();
 
-	case Node::Type::VECTOR_POWER:
-		retFalseOnFalse(VectorPowerCode(node, file),
-				"Could not generate Vector Power Code!\n");
-		break;
+	if(0 == ThreadsNrOf_)
+	{
+		Error("Static scheduling requires at least one thread!\n");
+		return false;
+	}
 
-	case Node::Type::VECTOR_PROJECTION:
-		retFalseOnFalse(VectorProjectionCode(node, file),
-				"Could not generate Vector Projection Code!\n");
-		break;
+	fileInstructionsH_.PrintfLine("#include \"NodeExecutor.h\"\n");
 
-	case Node::Type::VECTOR_CROSS_CORRELATION:
-		retFalseOnFalse(VectorCrossCorrelationCode(node, file),
-				"Could not generate Vector Cross-Correlation Code!\n");
-		break;
+	// Instruction dependencies, skipping intermediate variables (as the nodes array does)
+	std::map<Node::Id_t, std::set<Node::Id_t>> parents;
+	std::map<Node::Id_t, std::set<Node::Id_t>> children;
+	for(const Node::Id_t &nodeId: order)
+	{
+		std::vector<Node::Id_t> instructionParents;
+		GetInstructionParents(&instructionParents, graph_->GetNode(nodeId));
 
-	case Node::Type::VECTOR_MAX_POOL:
-		retFalseOnFalse(VectorMaxPoolCode(node, file),
-				"Could not generate Vector max pool Code!\n");
-		break;
+		for(const Node::Id_t &parent: instructionParents)
+		{
+			parents[nodeId].insert(parent);
+			children[parent].insert(nodeId);
+		}
+	}
 
-	case Node::Type::VECTOR_VECTOR_PRODUCT:
-		retFalseOnFalse(VectorVectorProductCode(node, file),
-				"Could not generate Vector Vector Product Code!\n");
-		break;
+	// Priority: Length of the critical path to the end of the graph
+	std::map<Node::Id_t, double> cost;
+	std::map<Node::Id_t, double> criticalPath;
+	for(auto nodeIt = order.rbegin(); nodeIt != order.rend(); nodeIt++)
+	{
+		cost[*nodeIt] = COST_NODE_OVERHEAD + EstimateCost(graph_->GetNode(*nodeIt));
 
-	case Node::Type::VECTOR_JOIN_INDICES:
-		retFalseOnFalse(VectorJoinIndicesCode(node, file),
-						"Could not generate Vector Join Indices Code!\n");
-		break;
+		double childrenPath = 0.;
+		for(const Node::Id_t &child: children[*nodeIt])
+		{
+			childrenPath = std::max(childrenPath, criticalPath[child]);
+		}
 
-	case Node::Type::VECTOR_INDEX_SPLIT_SUM:
-			retFalseOnFalse(VectorIndexSplitSumCode(node, file),
-							"Could not generate Vector Split Sum Indices Code!\n");
-			break;
+		criticalPath[*nodeIt] = cost[*nodeIt] + childrenPath;
+	}
 
-	case Node::Type::VECTOR_COMPARISON_IS_SMALLER:
-		retFalseOnFalse(VectorComparisonIsSmallerCode(node, file),
-				"Could not generate Vector Comparison <= Code!\n");
-		break;
+	// List scheduling: Take the ready node with the longest critical path and put it on the thread
+	// where it finishes first. Loop body nodes only become ready after all other nodes, so the
+	// scheduling order remains one common topological order of all threads' sequences.
+	std::map<Node::Id_t, size_t> parentsRemaining;
+	std::set<std::pair<double, Node::Id_t>> ready[2]; // outside / inside loop body
+	for(const Node::Id_t &nodeId: order)
+	{
+		parentsRemaining[nodeId] = parents[nodeId].size();
+		if(0 == parentsRemaining[nodeId])
+		{
+			ready[loopBody.count(nodeId)].insert(std::make_pair(-criticalPath[nodeId], nodeId));
+		}
+	}
 
-	case Node::Type::OUTPUT:
-		retFalseOnFalse(OutputCode(node, file),
-				"Could not generate Output Code!\n");
-		break;
+	std::vector<double> threadAvailable(ThreadsNrOf_, 0.);
+	std::vector<std::vector<Node::Id_t>> threadSequence(ThreadsNrOf_);
+	std::map<Node::Id_t, size_t> nodeThread;
+	std::map<Node::Id_t, double> nodeFinish;
+	while(ready[0].size() || ready[1].size())
+	{
+		auto * readySet = ready[0].size() ? &ready[0] : &ready[1];
+		const Node::Id_t nodeId = readySet->begin()->second;
+		readySet->erase(readySet->begin());
 
-	case Node::Type::INPUT:
-		retFalseOnFalse(InputCode(node, file),
-				"Could not generate Input Code!\n");
-		break;
+		size_t bestThread = 0;
+		double bestFinish = DBL_MAX;
+		for(size_t thread = 0; thread < ThreadsNrOf_; thread++)
+		{
+			double start = threadAvailable[thread];
+			for(const Node::Id_t &parent: parents[nodeId])
+			{
+				double parentReady = nodeFinish[parent];
+				if(nodeThread[parent] != thread)
+				{
+					parentReady += COST_SYNCHRONIZATION;
+				}
 
-	case Node::Type::VECTOR:
-		Error("Type %i is no operation!\n", (int) node->GetType());
-		return false;
+				start = std::max(start, parentReady);
+			}
 
-	case Node::Type::VECTOR_CONTRACTION:
-		retFalseOnFalse(VectorContractionCode(node, file),
-		"Could not generate vector contraction Code!\n");
-		break;
+			if(start + cost[nodeId] < bestFinish)
+			{
+				bestFinish = start + cost[nodeId];
+				bestThread = thread;
+			}
+		}
 
-	case Node::Type::VECTOR_PERMUTATION:
-		retFalseOnFalse(VectorPermutationCode(node, file),
-				"Could not generate vector contraction Code!\n");
-		break;
+		nodeThread[nodeId] = bestThread;
+		nodeFinish[nodeId] = bestFinish;
+		threadAvailable[bestThread] = bestFinish;
+		threadSequence[bestThread].push_back(nodeId);
 
-	default:
-		Error("Unknown Type %i!\n", (int) node->GetType());
-		return false;
+		for(const Node::Id_t &child: children[nodeId])
+		{
+			parentsRemaining[child]--;
+			if(0 == parentsRemaining[child])
+			{
+				ready[loopBody.count(child)].insert(std::make_pair(-criticalPath[child], child));
+			}
+		}
 	}
 
-	return true;
-}
-
-bool CodeGenerator::GenerateLocalVariableDeclaration(const Variable * var)
-{
-	if(!var->HasProperty(Variable::PROPERTY_GLOBAL))
+	double sequentialCost = 0.;
+	for(const auto &costPair: cost)
 	{
-		std::string varDecl;
-		var->GetDeclaration(&varDecl);
-		varDecl += "\n";
-		fileDacC_.PrintfLine("\t%s", varDecl.c_str());
+		sequentialCost += costPair.second;
 	}
 
-	return true;
-}
+	DEBUG("Static schedule of %s: estimated makespan %f, sequential %f\n", name,
+			*std::max_element(threadAvailable.begin(), threadAvailable.end()),
+			sequentialCost);
 
-bool CodeGenerator::VectorAdditionCode(const Node* node, FileWriter * file)
-{
-	file->PrintfLine("// %s\n", __func__);
+	// Synchronization: One execution counter per instruction
+	fileInstructions_.PrintfLine("static atomic_uint exeCnt%s[%lu];", name, order.size());
+	fileInstructions_.PrintfLine("static atomic_uint finalIteration%s;\n", name);
 
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varSum1, node->Parents()->at(0));
-	getVarRetFalseOnError(varSum2, node->Parents()->at(1));
+	fileInstructionsH_.PrintfLine("extern void Instructions%sResetStatic(void);", name);
+	fileInstructions_.PrintfLine("void Instructions%sResetStatic(void)", name);
+	fileInstructions_.PrintfLine("{");
+	fileInstructions_.PrintfLine("\tfor(size_t node = 0; node < sizeof(exeCnt%s) / sizeof(exeCnt%s[0]); node++)", name, name);
+	fileInstructions_.PrintfLine("\t{");
+	fileInstructions_.PrintfLine("\t\tatomic_store_explicit(&exeCnt%s[node], 0, memory_order_relaxed);", name);
+	fileInstructions_.PrintfLine("\t}\n");
+	fileInstructions_.PrintfLine("\tatomic_store_explicit(&finalIteration%s, UINT32_MAX, memory_order_relaxed);", name);
+	fileInstructions_.PrintfLine("}\n");
 
-	GenerateLocalVariableDeclaration(varOp);
+	std::map<Node::Id_t, size_t> counterPos;
+	for(size_t pos = 0; pos < order.size(); pos++)
+	{
+		counterPos[order[pos]] = pos;
+	}
 
-	auto vecOp = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+	auto generateNode = [&](FileWriter * file, Node::Id_t nodeId, size_t thread, const char * iteration, bool inLoop)
+	{
+		for(const Node::Id_t &parent: parents[nodeId])
+		{
+			// Parents outside the loop body were awaited by the first iteration
+			if((nodeThread[parent] != thread) && (!inLoop || loopBody.count(parent)))
+			{
+				file->PrintfLine("WaitForCount(&exeCnt%s[%lu], %s);", name, counterPos[parent], iteration);
+			}
+		}
 
-	bool resultIsArray = (1 < vecOp->Space()->GetDim());
+		if(inLoop)
+		{
+			// Children have to consume the last iteration before we overwrite it
+			for(const Node::Id_t &child: children[nodeId])
+			{
+				if(nodeThread[child] != thread)
+				{
+					file->PrintfLine("WaitForCount(&exeCnt%s[%lu], %s - 1);", name, counterPos[child], iteration);
+				}
+			}
+		}
 
-	if(resultIsArray)
-	{
-		file->PrintfLine("for(uint32_t dim = 0; dim < %u; dim++)",
-				vecOp->Space()->GetDim());
+		std::string instrId;
+		GenerateInstructionId(&instrId, nodeId);
+		file->PrintfLine("%s();", instrId.c_str());
 
-		file->PrintfLine("{");
+		if((nullptr != controlTransfer) && (controlTransfer->id == nodeId))
+		{
+			file->PrintfLine("if(!%sRepeat)", instrId.c_str());
+			file->PrintfLine("{");
+			file->PrintfLine("\tatomic_store_explicit(&finalIteration%s, %s, memory_order_relaxed);", name, iteration);
+			file->PrintfLine("}");
+		}
 
-		file->PrintfLine("\t%s[dim] = %s[dim] + %s[dim];",
-				varOp->GetIdentifier()->c_str(),
-				varSum1->GetIdentifier()->c_str(),
-				varSum2->GetIdentifier()->c_str());
+		file->PrintfLine("atomic_store_explicit(&exeCnt%s[%lu], %s, memory_order_release);\n", name, counterPos[nodeId], iteration);
+	};
 
-		file->PrintfLine("}\n");
-	}
-	else
+	for(size_t thread = 0; thread < ThreadsNrOf_; thread++)
 	{
-		file->PrintfLine("%s = %s + %s;",
-				varOp->GetIdentifier()->c_str(),
-				varSum1->GetIdentifier()->c_str(),
-				varSum2->GetIdentifier()->c_str());
-	}
+		fileInstructions_.PrintfLine("static void Thread%luInstruction(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))", thread);
+		fileInstructions_.PrintfLine("{");
+		fileInstructions_.Indent();
 
-	return true;
-}
+		for(const Node::Id_t &nodeId: threadSequence[thread])
+		{
+			generateNode(&fileInstructions_, nodeId, thread, "1", false);
+		}
 
-bool CodeGenerator::VectorContractionKroneckerDeltaCode(const Node* node, FileWriter * file)
-{
-	file->PrintfLine("// %s\n", __func__);
+		bool hasLoopBody = std::any_of(threadSequence[thread].begin(), threadSequence[thread].end(),
+				[&loopBody](Node::Id_t nodeId) {return loopBody.count(nodeId);});
 
-	auto nodes = graph_->GetNodes();
-	const auto lnode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == lnode)
-	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(0));
-		return false;
-	}
+		if(hasLoopBody)
+		{
+			fileInstructions_.PrintfLine("for(uint32_t iteration = 2; ; iteration++)");
+			fileInstructions_.PrintfLine("{");
+			fileInstructions_.Indent();
 
-	const auto rnode = nodes->find(node->Parents()->at(1));
-	if(nodes->end() == rnode)
-	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(1));
-		return false;
-	}
+			fileInstructions_.PrintfLine("WaitForCount(&exeCnt%s[%lu], iteration - 1);", name, counterPos[controlTransfer->id]);
+			fileInstructions_.PrintfLine("if(iteration - 1 == atomic_load_explicit(&finalIteration%s, memory_order_relaxed))", name);
+			fileInstructions_.PrintfLine("{");
+			fileInstructions_.PrintfLine("\tbreak;");
+			fileInstructions_.PrintfLine("}\n");
 
-	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lnode->second.GetType()) &&
-			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rnode->second.GetType()))
-	{
-		Error("Contraction of two KroneckerDeltas not supported: Should be handled in graph creation!\n");
-		return false;
+			for(const Node::Id_t &nodeId: threadSequence[thread])
+			{
+				if(loopBody.count(nodeId))
+				{
+					generateNode(&fileInstructions_, nodeId, thread, "iteration", true);
+				}
+			}
+
+			fileInstructions_.Outdent();
+			fileInstructions_.PrintfLine("}");
+		}
+
+		fileInstructions_.Outdent();
+		fileInstructions_.PrintfLine("}\n");
 	}
 
-	const Node * argVecNode;
-	const Node * kronNode;
-	bool argVecIsLeftArg;
-	if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lnode->second.GetType())
+	// One job per thread for the thread pool
+	fileInstructions_.PrintfLine("static node_t nodes%s[] = {", name);
+	for(size_t thread = 0; thread < ThreadsNrOf_; thread++)
 	{
-		argVecNode = &rnode->second;
-		kronNode = &lnode->second;
-		argVecIsLeftArg = false;
+		fileInstructions_.PrintfLine("\t{Thread%luInstruction, NULL, NULL, 0, 0, 0, %lu, 0},", thread, thread);
 	}
-	else
+	fileInstructions_.PrintfLine("};\n");
+
+	fileInstructions_.PrintfLine("node_t * jobPoolInitNodes%s[] = {", name);
+	for(size_t thread = 0; thread < ThreadsNrOf_; thread++)
 	{
-		argVecNode = &lnode->second;
-		kronNode = &rnode->second;
-		argVecIsLeftArg = true;
+		fileInstructions_.PrintfLine("\t&nodes%s[%lu],", name, thread);
 	}
+	fileInstructions_.PrintfLine("};\n");
 
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varArgVec, argVecNode->id);
-
-	const Algebra::Module::VectorSpace::Vector* argVec = (const Algebra::Module::VectorSpace::Vector*) argVecNode->GetObjectPt();
-	const Algebra::Module::VectorSpace::Vector* kronVec = (const Algebra::Module::VectorSpace::Vector*) kronNode->GetObjectPt();
-	const Algebra::Module::VectorSpace::Vector* opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+	fileInstructions_.PrintfLine("jobPoolInit_t jobPoolInit%s = {", name);
+	fileInstructions_.Indent();
+	fileInstructions_.PrintfLine(".Nodes = jobPoolInitNodes%s,", name);
+	fileInstructions_.PrintfLine(".NodesNrOf = %lu,", ThreadsNrOf_);
+	fileInstructions_.PrintfLine(".JobsNrOfMax = %lu,", ThreadsNrOf_);
+	fileInstructions_.Outdent();
+	fileInstructions_.PrintfLine("};");
 
-	const Node::contractParameters_t * contractValue = (const Node::contractParameters_t *) node->TypeParameters();
+	fileInstructionsH_.PrintfLine("extern jobPoolInit_t jobPoolInit%s;", name);
 
-	const std::vector<uint32_t> * argContractFactors;
-	const std::vector<uint32_t> * kronContractFactors;
-	if(argVecIsLeftArg)
-	{
-		argContractFactors = &contractValue->lfactors;
-		kronContractFactors = &contractValue->rfactors;
-	}
-	else
-	{
-		argContractFactors = &contractValue->rfactors;
-		kronContractFactors = &contractValue->lfactors;
-	}
+	return true;
+}
 
-	const Node::KroneckerDeltaParameters_t * kroneckerParam = (Node::KroneckerDeltaParameters_t *) kronNode->TypeParameters();
+bool CodeGenerator::GetFirstNodesToExecute(std::set<Node::Id_t> * nodeSet)
+{
+	// Find all nodes which do not have parents and create a set of their children. Folded nodes count as such.
+	std::set<Node::Id_t> roots;
 
-	// Copy delta pairs array into file
-	std::string deltaPairs = "const uint32_t deltaPairs[] = {";
-	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	auto nodes = graph_->GetNodes();
+	for(const auto &nodePair: *nodes)
 	{
-		deltaPairs += std::to_string(kroneckerParam->DeltaPair[paramPos]) + ", ";
-	}
-	deltaPairs.erase(deltaPairs.end() - 2, deltaPairs.end()); // remove last ", "
-	deltaPairs += "};";
-	file->PrintfLine("%s", deltaPairs.c_str());
+		if((0 == nodePair.second.Parents()->size()) || IsFolded(nodePair.first))
+		{
+			roots.insert(nodePair.second.id);
 
-	const char * varOpId = varOp->GetIdentifier()->c_str();
+			bool nodeIsInstruction = (nodesInstructionMap_.find(nodePair.second.id) != nodesInstructionMap_.end());
 
-	bool resultIsArray = (1 < varOp->Length());
+			if(nodeIsInstruction)
+			{
+				nodeSet->insert(nodePair.second.id);
+			}
+			else
+			{
+				for(const Node::Id_t &childId: *nodePair.second.Children())
+				{
+					if(!IsFolded(childId))
+					{
+						nodeSet->insert(GetFusionSink(childId));
+					}
+				}
+			}
+		}
+	}
 
-	if(resultIsArray)
+	// delete all children which have non-root parents.
+	// i.e. these children may be executed right away.
+	std::vector<Node::Id_t> nonFirstGenerationChildren;
+	for(Node::Id_t childId: *nodeSet)
 	{
-		file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-				varOpId, varOpId);
-		file->PrintfLine("{");
-		file->Indent();
+		const auto childNodeIt =  nodes->find(childId);
+		if(nodes->end() == childNodeIt)
+		{
+			Error("Unknown Child, NodeId = %u!\n", childId);
+			return false;
+		}
 
-		std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-		appendIndexTuple(&opIndexTuple, opVec->Space(), std::string{"opIndex"});
-		opIndexTuple += ";";
+		std::vector<Node::Id_t> operands;
+		GetFusedOperands(&operands, &childNodeIt->second);
 
-		file->PrintfLine("%s", opIndexTuple.c_str());
+		for(const Node::Id_t &parentId: operands)
+		{
+			if(roots.end() == roots.find(parentId))
+			{
+				// Child has one non-first-generation parent.
+				nonFirstGenerationChildren.push_back(childId); // erase later
+				break;
+			}
+		}
 	}
 
-	file->PrintfLine("%s sum = 0;", varOp->GetTypeString());
-	for(uint32_t factorIndex = 0; factorIndex < contractValue->lfactors.size(); factorIndex++)
+	for(Node::Id_t childId: nonFirstGenerationChildren)
 	{
-		file->PrintfLine("for(int dim%u = 0; dim%u < %u; dim%u++)",
-				factorIndex, factorIndex,
-				argVec->Space()->Factors()->at(argContractFactors->at(factorIndex)).Dim,
-				factorIndex);
-		file->PrintfLine("{");
-		file->Indent();
+		nodeSet->erase(childId);
 	}
 
-	uint32_t opIndex = 0;
-	if(!argVecIsLeftArg)
-	{
-		opIndex = opVec->Space()->Factors()->size() - (argVec->Space()->Factors()->size() - argContractFactors->size());
-	}
+	return true;
+}
 
-	std::string argIndexTuple = "const uint32_t argIndexTuple[] = {";
-	for(uint32_t lDim = 0; lDim < argVec->Space()->Factors()->size(); lDim++)
-	{
-		auto it = std::find(
-				argContractFactors->begin(),
-				argContractFactors->end(),
-				lDim);
+bool CodeGenerator::GenerateInstructions()
+{
+	const auto nodes = graph_->GetNodes();
 
-		if(it == argContractFactors->end())
+	// Determine Nodes array positions first: Control transfers refer to instructions of higher ids, too.
+	Node::Id_t arrayPos = 0;
+	for(const auto &nodePair: *nodes)
+	{
+		if(!HasInstruction(&nodePair.second))
 		{
-			argIndexTuple += "opIndexTuple[";
-			argIndexTuple += std::to_string(opIndex);
-			argIndexTuple += "], ";
-			opIndex++;
+			continue;
 		}
-		else
+
+		const size_t tilesNrOf = GetTilesNrOf(&nodePair.second);
+
+		std::vector<uint32_t> tilesArrayPos;
+		for(size_t tile = 0; tile < tilesNrOf; tile++)
 		{
-			argIndexTuple += "dim" + std::to_string(std::distance(argContractFactors->begin(), it));
-			argIndexTuple += ", ";
+			tilesArrayPos.push_back(arrayPos);
+			arrayPos++;
 		}
-	}
-
-	argIndexTuple.erase(argIndexTuple.end() - 2, argIndexTuple.end()); // remove last ", "
-	argIndexTuple += "};";
-	file->PrintfLine(argIndexTuple.c_str());
 
-	if(!argVecIsLeftArg)
-	{
-		opIndex = 0;
+		nodesInstructionMap_.insert(std::pair<Node::Id_t, const Node*>(nodePair.second.id, &nodePair.second));
+		nodeArrayPos_.insert(std::make_pair(nodePair.second.id, tilesArrayPos));
 	}
 
-	std::string kronIndexTuple = "const uint32_t kronIndexTuple[] = {";
-	for(uint32_t rDim = 0; rDim < kronVec->Space()->Factors()->size(); rDim++)
+	for(const auto &nodePair: *nodes)
 	{
-		auto it = std::find(
-				kronContractFactors->begin(),
-				kronContractFactors->end(),
-				rDim);
-
-		if(it == kronContractFactors->end())
+		if(IsFused(nodePair.first))
 		{
-			kronIndexTuple += "opIndexTuple[";
-			kronIndexTuple += std::to_string(opIndex);
-			kronIndexTuple += "], ";
-			opIndex++;
+			continue; // Computed by the instruction of its sink
 		}
-		else
+
+		if(IsFolded(nodePair.first))
 		{
-			kronIndexTuple += "dim" + std::to_string(std::distance(kronContractFactors->begin(), it));
-			kronIndexTuple += ", ";
+			continue; // Computed at generation time
 		}
-	}
-
-	kronIndexTuple.erase(kronIndexTuple.end() - 2, kronIndexTuple.end()); // remove last ", "
-	kronIndexTuple += "};";
-	file->PrintfLine(kronIndexTuple.c_str());
+
+		// Does this node require a function?
+		switch(nodePair.second.GetType())
+		{
+		default:
+			Error("Unknown Node-Type %u\n", (uint8_t) nodePair.second.GetType());
+			return false;
+
+		case Node::Type::NONE:
+			Error("Node::Type::None not allowed!!\n");
+			return false;
+
+		case Node::Type::VECTOR: // no break intended
+		case Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT:
+			continue; // does not have instruction
+
+		case Node::Type::CONTROL_TRANSFER_WHILE: // no break intended
+		case Node::Type::VECTOR_ADDITION: // no break intended
+		case Node::Type::VECTOR_SCALAR_PRODUCT: // no break intended
+		case Node::Type::VECTOR_VECTOR_PRODUCT: // no break intended
+		case Node::Type::VECTOR_POWER: // no break intended
+		case Node::Type::VECTOR_CONTRACTION: // no break intended
+		case Node::Type::VECTOR_COMPARISON_IS_SMALLER: // no break intended
+		case Node::Type::VECTOR_PERMUTATION: // no break intended
+		case Node::Type::VECTOR_PROJECTION: // no break intended
+		case Node::Type::VECTOR_JOIN_INDICES: // no break intended
+		case Node::Type::VECTOR_INDEX_SPLIT_SUM: // no break intended
+		case Node::Type::VECTOR_CROSS_CORRELATION: // no break intended
+		case Node::Type::VECTOR_MAX_POOL: // no break intended
+		case Node::Type::VECTOR_MAX_POOL_DERIVATIVE: // no break intended
+		case Node::Type::OUTPUT: // no break intended
+		case Node::Type::INPUT:
+			break; // create instruction
+		}
+
+		// Create function identifier
+		std::string fctId;
+		GenerateInstructionId(&fctId, nodePair.second.id);
+
+		// Large operations are split into tiles of result elements, executed as separate jobs.
+		// All tiles take the node's place in the graph: Its children wait for every tile.
+		const size_t tilesNrOf = GetTilesNrOf(&nodePair.second);
+		if(1 < tilesNrOf)
+		{
+			const size_t granularity = GetTileGranularity(&nodePair.second);
+			const size_t granulesNrOf = GetNodeLength(nodePair.second.id) / granularity;
+
+			for(size_t tile = 0; tile < tilesNrOf; tile++)
+			{
+				opIndexRange_.first = granularity * (tile * granulesNrOf / tilesNrOf);
+				opIndexRange_.second = granularity * ((tile + 1) * granulesNrOf / tilesNrOf);
+
+				std::string tileId;
+				GenerateInstructionId(&tileId, nodePair.second.id, tile);
+
+				fileInstructions_.PrintfLine("static void %s(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))", tileId.c_str());
+				fileInstructions_.PrintfLine("{");
+				fileInstructions_.Indent();
+
+				bool success = GenerateOperationCode(
+						&nodePair.second,
+						&fileInstructions_);
+
+				opIndexRange_ = {0, 0};
+				retFalseOnFalse(success, "Could not generate Operation Code for Node%u Tile%lu!\n", nodePair.first, tile);
+
+				fileInstructions_.Outdent();
+				fileInstructions_.PrintfLine("}\n");
+			}
+
+			continue;
+		}
+
+		// Set param to unused if not used
+		if(Scheduling::DYNAMIC != scheduling_)
+		{
+			if(Node::Type::CONTROL_TRANSFER_WHILE == nodePair.second.GetType())
+			{
+				fileInstructions_.PrintfLine("static uint8_t %sRepeat = 0;\n", fctId.c_str());
+			}
+
+			fileInstructions_.PrintfLine("static void %s(void)", fctId.c_str());
+		}
+		else if(Node::Type::CONTROL_TRANSFER_WHILE != nodePair.second.GetType())
+		{
+			fileInstructions_.PrintfLine("static void %s(void * instance __attribute__((unused)), void (*PushNode)(void * instance, struct node_s * node) __attribute__((unused)))", fctId.c_str());
+		}
+		else
+		{
+			fileInstructions_.PrintfLine("static void %s(void * instance, void (*PushNode)(void * instance, struct node_s * node))", fctId.c_str());
+		}
+
+		fileInstructions_.PrintfLine("{");
+		fileInstructions_.Indent();
+
+		retFalseOnFalse(GenerateArenaViews(&nodePair.second, &fileInstructions_), "Could not declare arena views of Node%u!\n", nodePair.first);
+
+		retFalseOnFalse(GenerateOperationCode(
+				&nodePair.second,
+				&fileInstructions_),
+				"Could not generate Operation Code for Node%u!\n", nodePair.first);
+
+		// End function
+		fileInstructions_.Outdent();
+		fileInstructions_.PrintfLine("}\n");
+	}
+
+	return true;
+}
+
+bool CodeGenerator::GenerateArenaViews(const Node * node, FileWriter * file)
+{
+	// The instruction's result and its operands
+	std::vector<Node::Id_t> nodeIds{node->id};
+	GetFusedOperands(&nodeIds, node);
+
+	std::set<const Variable *> declared;
+	for(const Node::Id_t &nodeId: nodeIds)
+	{
+		const Node * varNode = graph_->GetNode(nodeId);
+		if(nullptr == varNode)
+		{
+			continue;
+		}
+
+		const Node::Id_t storageId = (Node::ID_NONE != varNode->IsStoredIn()) ? varNode->IsStoredIn() : nodeId;
+		const auto varIt = variables_.find(storageId);
+		if((variables_.end() == varIt) || !varIt->second.IsInArena() || !declared.insert(&varIt->second).second)
+		{
+			continue;
+		}
+
+		const Variable * var = &varIt->second;
+
+		std::string decl;
+		retFalseOnFalse(var->GetDeclaration(&decl), "Could not get declaration!\n");
+		file->PrintfLine("%s", decl.c_str());
+	}
+
+	if(declared.size())
+	{
+		file->PrintfLine("");
+	}
+
+	return true;
+}
+
+bool CodeGenerator::GenerateCallbackPtCheck(FileWriter* file) const
+{
+	std::set<const void *> inputCheckCreated;
+
+	auto nodes = graph_->GetNodes();
+	for(const auto &nodePair: *nodes)
+	{
+		switch(nodePair.second.GetType())
+		{
+		case Node::Type::OUTPUT:
+		{
+			auto output = (const Interface::Output*) nodePair.second.GetObjectPt();
+
+			file->PrintfLine("if(NULL == %s)", output->GetCallbackName()->c_str());
+			file->PrintfLine("{");
+			file->PrintfLine("\tfatal(\"%s == NULL\");", output->GetCallbackName()->c_str());
+			file->PrintfLine("}\n");
+		}
+		break;
+
+		case Node::Type::INPUT:
+		{
+			auto insert = inputCheckCreated.insert(nodePair.second.GetObjectPt());
+			if(!insert.second)
+			{
+				// Pointer check for this input already created
+				continue;
+			}
+
+			auto input = (const Interface::Input*) nodePair.second.GetObjectPt();
+
+			file->PrintfLine("if(NULL == %s)", input->GetCallbackName()->c_str());
+			file->PrintfLine("{");
+			file->PrintfLine("\tfatal(\"%s == NULL\");", input->GetCallbackName()->c_str());
+			file->PrintfLine("}\n");
+		}
+		break;
+
+		default:
+			// do nothing
+			break;
+		}
+	}
+
+	return true;
+}
+
+bool CodeGenerator::GenerateInstructionId(std::string * InstrId, const Node::Id_t NodeId, const size_t Tile)
+{
+	if(nullptr == InstrId)
+	{
+		Error("nullptr");
+		return false;
+	}
+
+	*InstrId = "Node";
+	*InstrId += std::to_string(NodeId);
+	if(SIZE_MAX != Tile)
+	{
+		*InstrId += "Tile";
+		*InstrId += std::to_string(Tile);
+	}
+	*InstrId += "Instruction";
+
+	return true;
+}
+
+bool CodeGenerator::GenerateEdgeArray(const char * arrayName, const char * type, const std::vector<uint32_t> * arrayPositions)
+{
+	if(0 == arrayPositions->size())
+	{
+		return true; // Nodes will use NULL
+	}
+
+	fileInstructions_.PrintfLine("static %s %s%s[] = {", type, arrayName, graph_->Name().c_str());
+	fileInstructions_.Indent();
+
+	for(const uint32_t &arrayPos: *arrayPositions)
+	{
+		fileInstructions_.PrintfLine("&nodes%s[%u],", graph_->Name().c_str(), arrayPos);
+	}
+
+	fileInstructions_.Outdent();
+	fileInstructions_.PrintfLine("};\n");
+
+	return true;
+}
+
+bool CodeGenerator::GenerateNodesElem(
+		const std::string * instrId,
+		const Node::Id_t nodeId,
+		const std::pair<size_t, size_t> * parentsSlice,
+		const std::pair<size_t, size_t> * childrenSlice)
+{
+	std::string buffer;
+	buffer += *instrId;
+	buffer += ", ";
+
+	if(parentsSlice->second)
+	{
+		buffer += "&nodeParents" + graph_->Name() + "[" + std::to_string(parentsSlice->first) + "], ";
+	}
+	else
+	{
+		buffer += "NULL, ";
+	}
+
+	if(childrenSlice->second)
+	{
+		buffer += "&nodeChildren" + graph_->Name() + "[" + std::to_string(childrenSlice->first) + "], ";
+	}
+	else
+	{
+		buffer += "NULL, ";
+	}
+
+	buffer += "0, ";
+	buffer += std::to_string(parentsSlice->second);
+	buffer += ", ";
+	buffer += std::to_string(childrenSlice->second);
+	buffer += ", ";
+	buffer += std::to_string(nodeId);
+	buffer += ", 0"; // readyCnt
+
+	fileInstructions_.PrintfLine("{%s},", buffer.c_str());
+
+	return true;
+}
+
+bool CodeGenerator::GenerateRunFunction()
+{
+	const char * name = graph_->Name().c_str();
+
+	if(Scheduling::SEQUENTIAL == scheduling_)
+	{
+		fileDacH_.PrintfLine("extern int Dac%sRunSequential(void);", name);
+
+		fileDacC_.PrintfLine("int Dac%sRunSequential(void)\n{", name);
+		fileDacC_.Indent();
+		GenerateCallbackPtCheck(&fileDacC_);
+		fileDacC_.PrintfLine("Instructions%sRunSequential();\n", name);
+		fileDacC_.PrintfLine("return 0;");
+		fileDacC_.Outdent();
+		fileDacC_.PrintfLine("}\n");
+
+		// Keep the interface of the dynamic scheduling, so callers don't have to change
+		fileDacH_.PrintfLine("extern int Dac%sCreate(size_t threadsNrOf);", name);
+		fileDacH_.PrintfLine("extern int Dac%sRun(size_t threadsNrOf);", name);
+		fileDacH_.PrintfLine("extern void Dac%sDestroy(void);", name);
+
+		fileDacC_.PrintfLine("int Dac%sCreate(size_t threadsNrOf __attribute__((unused)))\n{", name);
+		fileDacC_.PrintfLine("\treturn 0;\n}\n");
+		fileDacC_.PrintfLine("int Dac%sRun(size_t threadsNrOf __attribute__((unused)))\n{", name);
+		fileDacC_.PrintfLine("\treturn Dac%sRunSequential();\n}\n", name);
+		fileDacC_.PrintfLine("void Dac%sDestroy(void)\n{\n}\n", name);
+
+		return true;
+	}
+
+	// Add prototypes to header
+	fileDacH_.PrintfLine("extern int Dac%sCreate(size_t threadsNrOf);", name);
+	fileDacH_.PrintfLine("extern int Dac%sRun(size_t threadsNrOf);", name);
+	fileDacH_.PrintfLine("extern void Dac%sDestroy(void);", name);
+
+	// The statically partitioned graph requires exactly the number of threads it was partitioned for.
+	const bool isStatic = (Scheduling::STATIC == scheduling_);
+	const std::string staticThreadsNrOf = std::to_string(ThreadsNrOf_);
+	const char * threadsNrOfArg = isStatic ? " __attribute__((unused))" : "";
+	const char * threadsNrOfUsed = isStatic ? staticThreadsNrOf.c_str() : "threadsNrOf";
+
+	// The thread pool persists between runs, workers are parked in between.
+	fileDacC_.PrintfLine("static void * instance%s = NULL;", name);
+	fileDacC_.PrintfLine("static size_t threadsNrOf%s = 0;\n", name);
+
+	// Create
+	fileDacC_.PrintfLine("int Dac%sCreate(size_t threadsNrOf%s)\n{", name, threadsNrOfArg);
+	fileDacC_.Indent();
+	fileDacC_.PrintfLine("Dac%sDestroy();\n", name);
+	fileDacC_.PrintfLine("instance%s = CreateThreads(%s);", name, threadsNrOfUsed);
+	fileDacC_.PrintfLine("threadsNrOf%s = %s;\n", name, threadsNrOfUsed);
+	fileDacC_.PrintfLine("return 0;");
+	fileDacC_.Outdent();
+	fileDacC_.PrintfLine("}\n");
+
+	// Run
+	fileDacC_.PrintfLine("int Dac%sRun(size_t threadsNrOf%s)\n{", name, threadsNrOfArg);
+	fileDacC_.Indent();
+
+	// Check that callbacks have been set
+	GenerateCallbackPtCheck(&fileDacC_);
+
+	// (Re-)create the thread pool if necessary
+	fileDacC_.PrintfLine("if((NULL == instance%s) || (%s != threadsNrOf%s))", name, threadsNrOfUsed, name);
+	fileDacC_.PrintfLine("{");
+	fileDacC_.PrintfLine("\tDac%sCreate(%s);", name, threadsNrOfUsed);
+	fileDacC_.PrintfLine("}\n");
+
+	if(isStatic)
+	{
+		fileDacC_.PrintfLine("Instructions%sResetStatic();", name);
+	}
+
+	fileDacC_.PrintfLine("RunJobs(instance%s, &jobPoolInit%s);\n", name, name);
+
+	// Return 0 to show success.
+	fileDacC_.PrintfLine("return 0;");
+	fileDacC_.Outdent();
+	fileDacC_.PrintfLine("}\n");
+
+	// Destroy
+	fileDacC_.PrintfLine("void Dac%sDestroy(void)\n{", name);
+	fileDacC_.Indent();
+	fileDacC_.PrintfLine("if(NULL != instance%s)", name);
+	fileDacC_.PrintfLine("{");
+	fileDacC_.PrintfLine("\tDestroyThreads(instance%s);", name);
+	fileDacC_.PrintfLine("\tinstance%s = NULL;", name);
+	fileDacC_.PrintfLine("\tthreadsNrOf%s = 0;", name);
+	fileDacC_.PrintfLine("}");
+	fileDacC_.Outdent();
+	fileDacC_.PrintfLine("}\n");
+
+	return true;
+}
+
+bool CodeGenerator::InputCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	auto input = (const Interface::Input* ) node->GetObjectPt();
+
+	// What is the identifier?
+	size_t identifier = input->GetIdentifier(node->id);
+	if(SIZE_MAX == identifier)
+	{
+		Error("Could not get identifier!\n");
+		return false;
+	}
+
+	// For which node do we set the input?
+	Node::Id_t targetNodeId = *(node->Children()->begin());
+	getVarRetFalseOnError(targetVar, targetNodeId);
+
+	file->PrintfLine("%s = %s(%lu, %lu * sizeof(%s));",
+			targetVar->GetIdentifier()->c_str(),
+			input->GetCallbackName()->c_str(),
+			identifier,
+			targetVar->Length(),
+			targetVar->GetTypeString());
+
+	return true;
+}
+
+bool CodeGenerator::OutputCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	// Call corresponding function callbacks
+	for(const Node::Id_t &outId: *node->Parents())
+	{
+		getVarRetFalseOnError(var, outId);
+
+		auto output = (const Interface::Output*) node->GetObjectPt();
+
+		const std::string * varIdentifier = var->GetIdentifier();
+		if(nullptr == varIdentifier)
+		{
+			Error("Could not find Var. Identifier!\n");
+			return false;
+		}
+
+		// If node is not an array, we need to take address
+		std::string NodeStr;
+		if(2 > var->Length())
+		{
+			NodeStr += "&";
+		}
+		NodeStr += *varIdentifier;
+
+		file->PrintfLine("%s(%s, %lu * sizeof(%s));\n",
+				output->GetCallbackName()->c_str(),
+				NodeStr.c_str(),
+				var->Length(),
+				var->GetTypeString());
+	}
+
+	file->PrintfLine("");
+
+	return true;
+}
+
+bool CodeGenerator::GenerateOperationCode(const Node* node, FileWriter * file)
+{
+	const bool hasFusedParents = std::any_of(node->Parents()->begin(), node->Parents()->end(),
+			[this](Node::Id_t parent) {return IsFused(parent) && !IsView(parent);});
+
+	if(hasFusedParents && (Node::Type::VECTOR_COMPARISON_IS_SMALLER != node->GetType()))
+	{
+		retFalseOnFalse(FusedElementWiseCode(node, file), "Could not generate fused element-wise Code!\n");
+		return true;
+	}
+
+	switch(node->GetType())
+	{
+	case Node::Type::VECTOR_ADDITION:
+		retFalseOnFalse(VectorAdditionCode(node, file), "Could not generate Vector Addition Code!\n");
+		break;
+
+	case Node::Type::CONTROL_TRANSFER_WHILE:
+		retFalseOnFalse(ControlTransferWhileCode(node, file),
+				"Could not generatede Control Transfer While Code!\n");
+		break;
+
+	case Node::Type::VECTOR_SCALAR_PRODUCT:
+		retFalseOnFalse(VectorScalarProductCode(node, file),
+				"Could not generate Vector Scalar Product Code!\n");
+		break;
+
+	case Node::Type::VECTOR_POWER:
+		retFalseOnFalse(VectorPowerCode(node, file),
+				"Could not generate Vector Power Code!\n");
+		break;
+
+	case Node::Type::VECTOR_PROJECTION:
+		retFalseOnFalse(VectorProjectionCode(node, file),
+				"Could not generate Vector Projection Code!\n");
+		break;
+
+	case Node::Type::VECTOR_CROSS_CORRELATION:
+		retFalseOnFalse(VectorCrossCorrelationCode(node, file),
+				"Could not generate Vector Cross-Correlation Code!\n");
+		break;
+
+	case Node::Type::VECTOR_MAX_POOL:
+		retFalseOnFalse(VectorMaxPoolCode(node, file),
+				"Could not generate Vector max pool Code!\n");
+		break;
+
+	case Node::Type::VECTOR_MAX_POOL_DERIVATIVE:
+		retFalseOnFalse(VectorMaxPoolDerivativeCode(node, file),
+				"Could not generate Vector max pool derivative Code!\n");
+		break;
+
+	case Node::Type::VECTOR_VECTOR_PRODUCT:
+		retFalseOnFalse(VectorVectorProductCode(node, file),
+				"Could not generate Vector Vector Product Code!\n");
+		break;
+
+	case Node::Type::VECTOR_JOIN_INDICES:
+		retFalseOnFalse(VectorJoinIndicesCode(node, file),
+						"Could not generate Vector Join Indices Code!\n");
+		break;
+
+	case Node::Type::VECTOR_INDEX_SPLIT_SUM:
+			retFalseOnFalse(VectorIndexSplitSumCode(node, file),
+							"Could not generate Vector Split Sum Indices Code!\n");
+			break;
+
+	case Node::Type::VECTOR_COMPARISON_IS_SMALLER:
+		retFalseOnFalse(VectorComparisonIsSmallerCode(node, file),
+				"Could not generate Vector Comparison <= Code!\n");
+		break;
+
+	case Node::Type::OUTPUT:
+		retFalseOnFalse(OutputCode(node, file),
+				"Could not generate Output Code!\n");
+		break;
+
+	case Node::Type::INPUT:
+		retFalseOnFalse(InputCode(node, file),
+				"Could not generate Input Code!\n");
+		break;
+
+	case Node::Type::VECTOR:
+		Error("Type %i is no operation!\n", (int) node->GetType());
+		return false;
+
+	case Node::Type::VECTOR_CONTRACTION:
+		retFalseOnFalse(VectorContractionCode(node, file),
+		"Could not generate vector contraction Code!\n");
+		break;
+
+	case Node::Type::VECTOR_PERMUTATION:
+		retFalseOnFalse(VectorPermutationCode(node, file),
+				"Could not generate vector contraction Code!\n");
+		break;
+
+	default:
+		Error("Unknown Type %i!\n", (int) node->GetType());
+		return false;
+	}
+
+	return true;
+}
+
+bool CodeGenerator::GenerateLocalVariableDeclaration(const Variable * var)
+{
+	if(!var->HasProperty(Variable::PROPERTY_GLOBAL))
+	{
+		std::string varDecl;
+		var->GetDeclaration(&varDecl);
+		varDecl += "\n";
+		fileDacC_.PrintfLine("\t%s", varDecl.c_str());
+	}
+
+	return true;
+}
+
+size_t CodeGenerator::GetSimdWidth() const
+{
+	// Bytes per vector register
+	switch(simd_)
+	{
+	case Simd::SSE2:
+		return 16;
+
+	case Simd::AVX2:
+		return 32;
+
+	case Simd::AVX512:
+		return 64;
+
+	default: // no break intended
+	case Simd::GENERIC:
+		return 0;
+	}
+}
+
+size_t CodeGenerator::GetSimdLanesNrOf(const Variable * var) const
+{
+	if(Simd::GENERIC == simd_)
+	{
+		return 1;
+	}
+
+	switch(var->GetType())
+	{
+	case Variable::Type::uint8_: // no break intended
+	case Variable::Type::int8_:
+		return GetSimdWidth();
+
+	case Variable::Type::int32_: // no break intended
+	case Variable::Type::float_:
+		return GetSimdWidth() / 4;
+
+	default: // no break intended
+	case Variable::Type::none: // no break intended
+	case Variable::Type::nrOf:
+		return 1;
+	}
+}
+
+std::string CodeGenerator::GetSimdTypeString(const Variable * var, bool unaligned) const
+{
+	std::string typeString;
+	switch(var->GetType())
+	{
+	case Variable::Type::uint8_:
+		typeString = "vecUint8";
+		break;
+
+	case Variable::Type::int8_:
+		typeString = "vecInt8";
+		break;
+
+	case Variable::Type::int32_:
+		typeString = "vecInt32";
+		break;
+
+	case Variable::Type::float_:
+		typeString = "vecFloat";
+		break;
+
+	default: // no break intended
+	case Variable::Type::none: // no break intended
+	case Variable::Type::nrOf:
+		Error("Unknown Type %u!\n", (unsigned int) var->GetType());
+		return "";
+	}
+
+	typeString += unaligned ? "U_t" : "_t";
+
+	return typeString;
+}
+
+bool CodeGenerator::GenerateSimdTypes()
+{
+	static const char isaMacros[][12] = {
+			"", // GENERIC
+			"__SSE2__",
+			"__AVX2__",
+			"__AVX512F__",
+	};
+
+	if(Simd::GENERIC == simd_)
+	{
+		return true;
+	}
+
+	const char * isaMacro = isaMacros[(int) simd_];
+	fileInstructions_.PrintfLine("#ifndef %s", isaMacro);
+	fileInstructions_.PrintfLine("#error \"Instructions generated for %s, enable the target ISA!\"", isaMacro);
+	fileInstructions_.PrintfLine("#endif\n");
+
+	static const Variable::Type types[] = {
+			Variable::Type::uint8_,
+			Variable::Type::int8_,
+			Variable::Type::int32_,
+			Variable::Type::float_,
+	};
+
+	for(const Variable::Type &type: types)
+	{
+		std::string id = "simdType";
+		Variable var(&id, Variable::PROPERTY_NONE, type);
+
+		fileInstructions_.PrintfLine("typedef %s %s __attribute__((vector_size(%lu)));",
+				var.GetTypeString(),
+				GetSimdTypeString(&var).c_str(),
+				GetSimdWidth());
+
+		// Element-aligned for buffers not allocated here, i.e. loads and stores may be unaligned
+		fileInstructions_.PrintfLine("typedef %s %s __attribute__((vector_size(%lu), aligned(__alignof__(%s))));",
+				var.GetTypeString(),
+				GetSimdTypeString(&var, true).c_str(),
+				GetSimdWidth(),
+				var.GetTypeString());
+	}
+
+	fileInstructions_.PrintfLine("");
+
+	return true;
+}
+
+std::string CodeGenerator::GetSimdElement(const Variable * var, bool vector, bool isConst) const
+{
+	if(1 == var->Length()) // Scalars are broadcast
+	{
+		return *var->GetIdentifier();
+	}
+
+	if(!vector)
+	{
+		return *var->GetIdentifier() + "[dim]";
+	}
+
+	std::string elem = "(*(";
+	elem += isConst ? "const " : "";
+	elem += GetSimdTypeString(var, var->HasProperty(Variable::PROPERTY_POINTER)); // Arrays allocated here are aligned
+	elem += " *) &" + *var->GetIdentifier() + "[dim])";
+
+	return elem;
+}
+
+bool CodeGenerator::GenerateSimdLoop(
+		FileWriter * file,
+		const Variable * varOp,
+		size_t length,
+		const std::string * vectorStatement,
+		const std::string * scalarStatement)
+{
+	const size_t lanesNrOf = GetSimdLanesNrOf(varOp);
+
+	file->PrintfLine("{");
+	file->Indent();
+	file->PrintfLine("uint32_t dim = 0;");
+	if(lanesNrOf <= length)
+	{
+		file->PrintfLine("for(; dim + %lu <= %lu; dim += %lu)", lanesNrOf, length, lanesNrOf);
+		file->PrintfLine("{");
+		file->PrintfLine("\t%s", vectorStatement->c_str());
+		file->PrintfLine("}");
+	}
+
+	// Remainder
+	if(length % lanesNrOf)
+	{
+		file->PrintfLine("for(; dim < %lu; dim++)", length);
+		file->PrintfLine("{");
+		file->PrintfLine("\t%s", scalarStatement->c_str());
+		file->PrintfLine("}");
+	}
+	file->Outdent();
+	file->PrintfLine("}\n");
+
+	return true;
+}
+
+size_t CodeGenerator::GetSimdLoopLength(const Variable * varOp, const Variable * lVar, const Variable * rVar) const
+{
+	// The padding of the result may be computed if all operands are padded alike.
+	for(const Variable * var: {lVar, rVar})
+	{
+		if((1 < var->Length()) &&
+				(var->HasProperty(Variable::PROPERTY_POINTER) || (var->LengthAllocated() != varOp->LengthAllocated())))
+		{
+			return varOp->Length();
+		}
+	}
+
+	return varOp->LengthAllocated();
+}
+
+bool CodeGenerator::IsSimdApplicable(const Variable * varOp, const Variable * lVar, const Variable * rVar) const
+{
+	// Arrays are reinterpreted as vectors of the result's element type
+	if(1 == GetSimdLanesNrOf(varOp))
+	{
+		return false;
+	}
+
+	for(const Variable * var: {lVar, rVar})
+	{
+		if((1 < var->Length()) && (var->GetType() != varOp->GetType()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool CodeGenerator::VectorAdditionKroneckerDeltaCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	getVarRetFalseOnError(varOp, node->id);
+
+	GenerateLocalVariableDeclaration(varOp);
+
+	const char * opId = varOp->GetIdentifier()->c_str();
+
+	// The other operand is copied, or the result cleared if both are deltas ...
+	std::string init = "0";
+	for(const Node::Id_t &parent: *node->Parents())
+	{
+		if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != graph_->GetNode(parent)->GetType())
+		{
+			getVarRetFalseOnError(varDense, parent);
+			init = *varDense->GetIdentifier() + "[dim]";
+		}
+	}
+
+	file->PrintfLine("for(uint32_t dim = 0; dim < %lu; dim++)", varOp->Length());
+	file->PrintfLine("{");
+	file->PrintfLine("\t%s[dim] = %s;", opId, init.c_str());
+	file->PrintfLine("}");
+
+	// ... then the deltas are added along their diagonals, one loop per pair
+	auto opVec = (const Algebra::Module::VectorSpace::Vector *) node->GetObjectPt();
+	const auto factors = opVec->Space()->Factors();
+
+	std::vector<uint32_t> strides;
+	opVec->Space()->GetStrides(&strides);
+
+	for(const Node::Id_t &parent: *node->Parents())
+	{
+		const Node * kronNode = graph_->GetNode(parent);
+		if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != kronNode->GetType())
+		{
+			continue;
+		}
+
+		const Node::KroneckerDeltaParameters_t * kroneckerParam = (const Node::KroneckerDeltaParameters_t *) kronNode->TypeParameters();
+
+		file->PrintfLine("");
+
+		std::string position;
+		size_t loopsNrOf = 0;
+		for(size_t factor = 0; factor < kroneckerParam->DeltaPair.size(); factor++)
+		{
+			const uint32_t partner = kroneckerParam->DeltaPair[factor];
+			if(partner < factor)
+			{
+				continue; // Every pair is listed twice
+			}
+
+			file->PrintfLine("for(uint32_t pair%lu = 0; pair%lu < %u; pair%lu++)", factor, factor, factors->at(factor).Dim, factor);
+			file->PrintfLine("{");
+			file->Indent();
+			loopsNrOf++;
+
+			position += position.empty() ? "" : " + ";
+			position += "pair" + std::to_string(factor) + " * " + std::to_string(strides[factor] + strides[partner]);
+		}
+
+		file->PrintfLine("%s[%s] += %sf;", opId, position.c_str(), std::to_string(kroneckerParam->Scaling).c_str());
+
+		for(size_t loop = 0; loop < loopsNrOf; loop++)
+		{
+			file->Outdent();
+			file->PrintfLine("}");
+		}
+	}
+
+	return true;
+}
+
+bool CodeGenerator::VectorAdditionCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	for(const Node::Id_t &parent: *node->Parents())
+	{
+		if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == graph_->GetNode(parent)->GetType())
+		{
+			return VectorAdditionKroneckerDeltaCode(node, file);
+		}
+	}
+
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varSum1, node->Parents()->at(0));
+	getVarRetFalseOnError(varSum2, node->Parents()->at(1));
+
+	GenerateLocalVariableDeclaration(varOp);
+
+	bool resultIsArray = (1 < varOp->Length());
+
+	if(resultIsArray && IsSimdApplicable(varOp, varSum1, varSum2))
+	{
+		std::string vectorStatement = GetSimdElement(varOp, true, false) + " = " +
+				GetSimdElement(varSum1, true, true) + " + " + GetSimdElement(varSum2, true, true) + ";";
+		std::string scalarStatement = GetSimdElement(varOp, false, false) + " = " +
+				GetSimdElement(varSum1, false, true) + " + " + GetSimdElement(varSum2, false, true) + ";";
+
+		retFalseOnFalse(GenerateSimdLoop(file, varOp, GetSimdLoopLength(varOp, varSum1, varSum2), &vectorStatement, &scalarStatement),
+				"Could not generate SIMD loop!\n");
+	}
+	else if(resultIsArray)
+	{
+		file->PrintfLine("for(uint32_t dim = 0; dim < %lu; dim++)",
+				varOp->Length());
+
+		file->PrintfLine("{");
+
+		file->PrintfLine("\t%s[dim] = %s[dim] + %s[dim];",
+				varOp->GetIdentifier()->c_str(),
+				varSum1->GetIdentifier()->c_str(),
+				varSum2->GetIdentifier()->c_str());
+
+		file->PrintfLine("}\n");
+	}
+	else
+	{
+		file->PrintfLine("%s = %s + %s;",
+				varOp->GetIdentifier()->c_str(),
+				varSum1->GetIdentifier()->c_str(),
+				varSum2->GetIdentifier()->c_str());
+	}
+
+	return true;
+}
+
+bool CodeGenerator::VectorContractionKroneckerDeltaCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	auto nodes = graph_->GetNodes();
+	const auto lnode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == lnode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(0));
+		return false;
+	}
+
+	const auto rnode = nodes->find(node->Parents()->at(1));
+	if(nodes->end() == rnode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(1));
+		return false;
+	}
+
+	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lnode->second.GetType()) &&
+			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rnode->second.GetType()))
+	{
+		Error("Contraction of two KroneckerDeltas not supported: Should be handled in graph creation!\n");
+		return false;
+	}
+
+	const Node * argVecNode;
+	const Node * kronNode;
+	bool argVecIsLeftArg;
+	if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lnode->second.GetType())
+	{
+		argVecNode = &rnode->second;
+		kronNode = &lnode->second;
+		argVecIsLeftArg = false;
+	}
+	else
+	{
+		argVecNode = &lnode->second;
+		kronNode = &rnode->second;
+		argVecIsLeftArg = true;
+	}
+
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varArgVec, argVecNode->id);
+
+	const Algebra::Module::VectorSpace::Vector* argVec = (const Algebra::Module::VectorSpace::Vector*) argVecNode->GetObjectPt();
+	const Algebra::Module::VectorSpace::Vector* kronVec = (const Algebra::Module::VectorSpace::Vector*) kronNode->GetObjectPt();
+	const Algebra::Module::VectorSpace::Vector* opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+
+	const Node::contractParameters_t * contractValue = (const Node::contractParameters_t *) node->TypeParameters();
+
+	const std::vector<uint32_t> * argContractFactors;
+	const std::vector<uint32_t> * kronContractFactors;
+	if(argVecIsLeftArg)
+	{
+		argContractFactors = &contractValue->lfactors;
+		kronContractFactors = &contractValue->rfactors;
+	}
+	else
+	{
+		argContractFactors = &contractValue->rfactors;
+		kronContractFactors = &contractValue->lfactors;
+	}
+
+	const Node::KroneckerDeltaParameters_t * kroneckerParam = (Node::KroneckerDeltaParameters_t *) kronNode->TypeParameters();
+
+	// Copy delta pairs array into file
+	std::string deltaPairs = "const uint32_t deltaPairs[] = {";
+	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	{
+		deltaPairs += std::to_string(kroneckerParam->DeltaPair[paramPos]) + ", ";
+	}
+	deltaPairs.erase(deltaPairs.end() - 2, deltaPairs.end()); // remove last ", "
+	deltaPairs += "};";
+	file->PrintfLine("%s", deltaPairs.c_str());
+
+	const char * varOpId = varOp->GetIdentifier()->c_str();
+
+	bool resultIsArray = (1 < varOp->Length());
+
+	if(resultIsArray)
+	{
+		GenerateOpIndexLoop(file, opVec->Space());
+	}
+
+	file->PrintfLine("%s sum = 0;", varOp->GetTypeString());
+	for(uint32_t factorIndex = 0; factorIndex < contractValue->lfactors.size(); factorIndex++)
+	{
+		file->PrintfLine("for(int dim%u = 0; dim%u < %u; dim%u++)",
+				factorIndex, factorIndex,
+				argVec->Space()->Factors()->at(argContractFactors->at(factorIndex)).Dim,
+				factorIndex);
+		file->PrintfLine("{");
+		file->Indent();
+	}
+
+	uint32_t opIndex = 0;
+	if(!argVecIsLeftArg)
+	{
+		opIndex = opVec->Space()->Factors()->size() - (argVec->Space()->Factors()->size() - argContractFactors->size());
+	}
+
+	std::string argIndexTuple = "const uint32_t argIndexTuple[] = {";
+	for(uint32_t lDim = 0; lDim < argVec->Space()->Factors()->size(); lDim++)
+	{
+		auto it = std::find(
+				argContractFactors->begin(),
+				argContractFactors->end(),
+				lDim);
+
+		if(it == argContractFactors->end())
+		{
+			argIndexTuple += "opIndexTuple[";
+			argIndexTuple += std::to_string(opIndex);
+			argIndexTuple += "], ";
+			opIndex++;
+		}
+		else
+		{
+			argIndexTuple += "dim" + std::to_string(std::distance(argContractFactors->begin(), it));
+			argIndexTuple += ", ";
+		}
+	}
+
+	argIndexTuple.erase(argIndexTuple.end() - 2, argIndexTuple.end()); // remove last ", "
+	argIndexTuple += "};";
+	file->PrintfLine(argIndexTuple.c_str());
+
+	if(!argVecIsLeftArg)
+	{
+		opIndex = 0;
+	}
+
+	std::string kronIndexTuple = "const uint32_t kronIndexTuple[] = {";
+	for(uint32_t rDim = 0; rDim < kronVec->Space()->Factors()->size(); rDim++)
+	{
+		auto it = std::find(
+				kronContractFactors->begin(),
+				kronContractFactors->end(),
+				rDim);
+
+		if(it == kronContractFactors->end())
+		{
+			kronIndexTuple += "opIndexTuple[";
+			kronIndexTuple += std::to_string(opIndex);
+			kronIndexTuple += "], ";
+			opIndex++;
+		}
+		else
+		{
+			kronIndexTuple += "dim" + std::to_string(std::distance(kronContractFactors->begin(), it));
+			kronIndexTuple += ", ";
+		}
+	}
+
+	kronIndexTuple.erase(kronIndexTuple.end() - 2, kronIndexTuple.end()); // remove last ", "
+	kronIndexTuple += "};";
+	file->PrintfLine(kronIndexTuple.c_str());
 
 	// A_ijk	= B_ijm d_mk
 	//			= B_ijk
@@ -1234,1592 +2580,3846 @@ bool CodeGenerator::VectorContractionKroneckerDeltaCode(const Node* node, FileWr
 	// A_ijkl	= B_ijmn d_mn d_kl
 	//			= B_ijnn d_kl
 
-	std::string sum = "sum += ";
-	sum += *(varArgVec->GetIdentifier());
-	appendArrayPosition(&sum, argVec->Space(), std::string{"argIndexTuple"});
+	std::string sum = "sum += ";
+	sum += *(varArgVec->GetIdentifier());
+	appendArrayPosition(&sum, argVec->Space(), std::string{"argIndexTuple"});
+
+	sum += " *";
+
+	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	{
+		if(kroneckerParam->DeltaPair[paramPos] > paramPos) // Remember, we save the partner for every factor, but only half the information is needed
+		{
+			sum += " (kronIndexTuple[" + std::to_string(paramPos) + "] ==";
+			sum += " kronIndexTuple[deltaPairs[" + std::to_string(paramPos) + "]]) *";
+		}
+	}
+	sum += " " + std::to_string(kroneckerParam->Scaling) + "f;";
+
+	file->PrintfLine(sum.c_str());
+
+	for(uint32_t factorIndex = 0; factorIndex < contractValue->lfactors.size(); factorIndex++)
+	{
+		file->Outdent();
+		file->PrintfLine("}");
+	}
+
+	file->PrintfLine("");
+
+	if(resultIsArray)
+	{
+		file->PrintfLine("%s[opIndex] = sum;",
+				varOpId);
+
+		GenerateOpIndexLoopEnd(file, opVec->Space());
+	}
+	else
+	{
+		file->PrintfLine("%s = sum;", varOpId);
+	}
+
+	return true;
+}
+
+bool CodeGenerator::VectorPermutationCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	const Node::permuteParameters_t * permuteParam = (const Node::permuteParameters_t *) node->TypeParameters();
+
+	auto nodes = graph_->GetNodes();
+	const auto argNode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == argNode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(0));
+		return false;
+	}
+
+	const Algebra::Module::VectorSpace::Vector* vec = (const Algebra::Module::VectorSpace::Vector*) argNode->second.GetObjectPt();
+
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varArg, node->Parents()->at(0));
+
+	const char * varOpId = varOp->GetIdentifier()->c_str();
+	const char * varArgId = varArg->GetIdentifier()->c_str();
+
+	GenerateOpIndexLoop(file, vec->Space());
+
+	std::string argIndexTuple = "const uint32_t argIndexTuple[] = {";
+
+	for(size_t argIndex = 0; argIndex < permuteParam->indices.size(); argIndex++)
+	{
+		argIndexTuple += "opIndexTuple[" + std::to_string(permuteParam->indices[argIndex]) + "], ";
+	}
+
+	argIndexTuple.erase(argIndexTuple.end() - 2, argIndexTuple.end()); // remove last ", "
+	argIndexTuple += "};\n";
+
+	file->PrintfLine("%s", argIndexTuple.c_str());
+
+	std::string opValue = varOpId;
+	opValue += "[opIndex]";
+	opValue += " = ";
+	opValue += varArgId;
+	appendArrayPosition(&opValue, vec->Space(), std::string{"argIndexTuple"});
+	opValue += ";";
+
+	file->PrintfLine("%s", opValue.c_str());
+
+	GenerateOpIndexLoopEnd(file, vec->Space());
+
+	return true;
+}
+
+bool CodeGenerator::GetMatrixProductShape(const Node * node, matrixProductShape_t * shape) const
+{
+	// Smallest number of multiplications for which the blocked kernel pays off
+	static const size_t MATRIX_PRODUCT_COST_MIN = 32768;
+
+	if(Node::Type::VECTOR_CONTRACTION != node->GetType())
+	{
+		return false;
+	}
+
+	const Node * lNode = graph_->GetNode(node->Parents()->at(0));
+	const Node * rNode = graph_->GetNode(node->Parents()->at(1));
+	if((nullptr == lNode) || (nullptr == rNode))
+	{
+		return false;
+	}
+
+	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lNode->GetType()) ||
+			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rNode->GetType()) ||
+			IsPacked(lNode->id) || IsPacked(rNode->id))
+	{
+		return false;
+	}
+
+	auto lVec = (const Algebra::Module::VectorSpace::Vector *) lNode->GetObjectPt();
+	auto rVec = (const Algebra::Module::VectorSpace::Vector *) rNode->GetObjectPt();
+	auto contractParams = (const Node::contractParameters_t *) node->TypeParameters();
+
+	// The contracted factors have to be contiguous and in the same order in both operands,
+	// the order of the pairs doesn't matter.
+	std::vector<std::pair<uint32_t, uint32_t>> contracted;
+	for(size_t pair = 0; pair < contractParams->lfactors.size(); pair++)
+	{
+		contracted.push_back(std::make_pair(contractParams->lfactors[pair], contractParams->rfactors[pair]));
+	}
+	std::sort(contracted.begin(), contracted.end());
+
+	size_t K = 1;
+	for(size_t pair = 0; pair < contracted.size(); pair++)
+	{
+		if((contracted[pair].first != contracted[0].first + pair) ||
+				(contracted[pair].second != contracted[0].second + pair))
+		{
+			return false;
+		}
+
+		K *= lVec->Space()->Factors()->at(contracted[pair].first).Dim;
+	}
+
+	// ... and at either end of the operands
+	const size_t lFactorsNrOf = lVec->Space()->Factors()->size();
+	const size_t rFactorsNrOf = rVec->Space()->Factors()->size();
+
+	const bool lTrailing = (contracted.front().first + contracted.size() == lFactorsNrOf);
+	const bool lLeading = (0 == contracted.front().first);
+	const bool rLeading = (0 == contracted.front().second);
+	const bool rTrailing = (contracted.front().second + contracted.size() == rFactorsNrOf);
+
+	if((!lTrailing && !lLeading) || (!rLeading && !rTrailing))
+	{
+		return false;
+	}
+
+	size_t lLength = 1;
+	for(const auto &factor: *lVec->Space()->Factors())
+	{
+		lLength *= factor.Dim;
+	}
+
+	size_t rLength = 1;
+	for(const auto &factor: *rVec->Space()->Factors())
+	{
+		rLength *= factor.Dim;
+	}
+
+	shape->M = lLength / K;
+	shape->N = rLength / K;
+	shape->K = K;
+
+	// Scalar operands and results are no arrays
+	if((1 == lLength) || (1 == rLength) || (1 == shape->M * shape->N))
+	{
+		return false;
+	}
+
+	if(MATRIX_PRODUCT_COST_MIN > shape->M * shape->N * shape->K)
+	{
+		return false;
+	}
+
+	// The operands may be views: Each group of factors has to be read as a single strided index
+	view_t lView;
+	view_t rView;
+	if(!GetView(&lView, lNode->id) || !GetView(&rView, rNode->id))
+	{
+		return false;
+	}
+
+	auto groupStride = [](size_t * stride, const view_t &view, const Algebra::Module::VectorSpace * vspace, size_t first, size_t nrOf)
+	{
+		*stride = 0;
+		for(size_t factor = first; factor < first + nrOf; factor++)
+		{
+			if((factor + 1 < first + nrOf) && (view.strides[factor] != view.strides[factor + 1] * vspace->Factors()->at(factor + 1).Dim))
+			{
+				return false;
+			}
+
+			*stride = view.strides[factor];
+		}
+
+		return true;
+	};
+
+	const size_t lKFirst = contracted.front().first;
+	const size_t lMFirst = lTrailing ? 0 : contracted.size(); // l[m][k] or l[k][m]
+	const size_t rKFirst = rLeading ? 0 : contracted.front().second; // r[k][n] or r[n][k]
+	const size_t rNFirst = rLeading ? contracted.size() : 0;
+
+	if(!groupStride(&shape->lStrideRow, lView, lVec->Space(), lMFirst, lFactorsNrOf - contracted.size()) ||
+			!groupStride(&shape->lStrideInner, lView, lVec->Space(), lKFirst, contracted.size()) ||
+			!groupStride(&shape->rStrideInner, rView, rVec->Space(), rKFirst, contracted.size()) ||
+			!groupStride(&shape->rStrideCol, rView, rVec->Space(), rNFirst, rFactorsNrOf - contracted.size()))
+	{
+		return false;
+	}
+
+	shape->lOffset = lView.offset;
+	shape->rOffset = rView.offset;
+
+	return true;
+}
+
+bool CodeGenerator::VectorMatrixProductCode(const Node* node, const matrixProductShape_t * shape, FileWriter * file, const Node * epilogue)
+{
+	// Block sizes: The packed block of r fits into L2, four rows of the result into L1.
+	static const size_t BLOCK_K = 64;
+	static const size_t BLOCK_N = 256;
+	static const size_t BLOCK_M = 4; // Rows sharing the loads of r
+
+	file->PrintfLine("// %s\n", __func__);
+
+	view_t lView;
+	retFalseOnFalse(GetView(&lView, node->Parents()->at(0)), "Could not get view of Node%u!\n", node->Parents()->at(0));
+
+	view_t rView;
+	retFalseOnFalse(GetView(&rView, node->Parents()->at(1)), "Could not get view of Node%u!\n", node->Parents()->at(1));
+
+	// With an epilogue, the result is accumulated in the epilogue's array
+	getVarRetFalseOnError(varOp, (nullptr != epilogue) ? epilogue->id : node->id);
+	getVarRetFalseOnError(varLVec, lView.base);
+	getVarRetFalseOnError(varRVec, rView.base);
+
+	const char * opId = varOp->GetIdentifier()->c_str();
+	const char * lId = varLVec->GetIdentifier()->c_str();
+	const char * rId = varRVec->GetIdentifier()->c_str();
+	const char * type = varOp->GetTypeString();
+
+	// Views start at an offset into their array
+	const std::string lOffset = shape->lOffset ? std::to_string(shape->lOffset) + " + " : "";
+	const std::string rOffset = shape->rOffset ? std::to_string(shape->rOffset) + " + " : "";
+
+	// Rows of this tile
+	size_t rowBegin = 0;
+	size_t rowEnd = shape->M;
+	if(opIndexRange_.first < opIndexRange_.second)
+	{
+		rowBegin = opIndexRange_.first / shape->N;
+		rowEnd = opIndexRange_.second / shape->N;
+	}
+
+	const size_t blockK = std::min(BLOCK_K, shape->K);
+	const size_t blockN = std::min(BLOCK_N, shape->N);
+
+	// Rows of the result start at a cache line if the array does
+	const size_t rowBytes = shape->N * varOp->ElementSize();
+	const bool rowsAligned = (0 == rowBytes % Variable::ALIGNMENT) && (0 == (blockN * varOp->ElementSize()) % Variable::ALIGNMENT);
+
+	file->PrintfLine("// %s[%lu][%lu] = l[%lu][%lu] * r[%lu][%lu]", opId, shape->M, shape->N, shape->M, shape->K, shape->K, shape->N);
+	file->PrintfLine("for(size_t opIndex = %lu; opIndex < %lu; opIndex++)", rowBegin * shape->N, rowEnd * shape->N);
+	file->PrintfLine("{");
+	file->PrintfLine("\t%s[opIndex] = 0;", opId);
+	file->PrintfLine("}\n");
+
+	file->PrintfLine("%s rPacked[%lu][%lu] __attribute__((aligned(%lu)));", type, blockK, blockN, Variable::ALIGNMENT);
+	file->PrintfLine("for(size_t kBlock = 0; kBlock < %lu; kBlock += %lu)", shape->K, blockK);
+	file->PrintfLine("{");
+	file->Indent();
+	file->PrintfLine("const size_t kSize = (%lu < kBlock + %lu) ? %lu - kBlock : %lu;", shape->K, blockK, shape->K, blockK);
+
+	file->PrintfLine("for(size_t nBlock = 0; nBlock < %lu; nBlock += %lu)", shape->N, blockN);
+	file->PrintfLine("{");
+	file->Indent();
+	file->PrintfLine("const size_t nSize = (%lu < nBlock + %lu) ? %lu - nBlock : %lu;\n", shape->N, blockN, shape->N, blockN);
+
+	// Pack the block of r contiguously
+	file->PrintfLine("for(size_t k = 0; k < kSize; k++)");
+	file->PrintfLine("{");
+	file->PrintfLine("\tfor(size_t n = 0; n < nSize; n++)");
+	file->PrintfLine("\t{");
+	file->PrintfLine("\t\trPacked[k][n] = %s[%s(kBlock + k) * %lu + (nBlock + n) * %lu];", rId, rOffset.c_str(), shape->rStrideInner, shape->rStrideCol);
+	file->PrintfLine("\t}");
+	file->PrintfLine("}\n");
+
+	// Register blocked rows, then the remaining ones
+	file->PrintfLine("size_t m = %lu;", rowBegin);
+	for(size_t rows = BLOCK_M; 0 < rows; rows = (BLOCK_M == rows) ? 1 : 0)
+	{
+		file->PrintfLine("for(; m + %lu <= %lu; m += %lu)", rows, rowEnd, rows);
+		file->PrintfLine("{");
+		file->Indent();
+
+		for(size_t row = 0; row < rows; row++)
+		{
+			if(rowsAligned)
+			{
+				file->PrintfLine("%s * restrict op%lu = __builtin_assume_aligned(&%s[(m + %lu) * %lu + nBlock], %lu);",
+						type, row, opId, row, shape->N, Variable::ALIGNMENT);
+			}
+			else
+			{
+				file->PrintfLine("%s * restrict op%lu = &%s[(m + %lu) * %lu + nBlock];", type, row, opId, row, shape->N);
+			}
+		}
+
+		file->PrintfLine("for(size_t k = 0; k < kSize; k++)");
+		file->PrintfLine("{");
+		file->Indent();
+
+		for(size_t row = 0; row < rows; row++)
+		{
+			file->PrintfLine("const %s l%lu = %s[%s(m + %lu) * %lu + (kBlock + k) * %lu];", type, row, lId, lOffset.c_str(), row, shape->lStrideRow, shape->lStrideInner);
+		}
+
+		file->PrintfLine("for(size_t n = 0; n < nSize; n++)");
+		file->PrintfLine("{");
+		file->Indent();
+
+		for(size_t row = 0; row < rows; row++)
+		{
+			file->PrintfLine("op%lu[n] += l%lu * rPacked[k][n];", row, row);
+		}
+
+		file->Outdent();
+		file->PrintfLine("}");
+		file->Outdent();
+		file->PrintfLine("}");
+
+		// The rows are final after the last block of k, and still in the cache
+		if(nullptr != epilogue)
+		{
+			file->PrintfLine("");
+			file->PrintfLine("// Epilogue: Node%u", epilogue->id);
+			file->PrintfLine("if(%lu == kBlock + kSize)", shape->K);
+			file->PrintfLine("{");
+			file->Indent();
+			file->PrintfLine("for(size_t n = 0; n < nSize; n++)");
+			file->PrintfLine("{");
+			file->Indent();
+
+			for(size_t row = 0; row < rows; row++)
+			{
+				std::string element = "op" + std::to_string(row) + "[n]";
+
+				std::string expr;
+				retFalseOnFalse(GetEpilogueExpression(&expr, epilogue, element), "Could not get epilogue of Node%u!\n", node->id);
+
+				file->PrintfLine("{");
+				file->PrintfLine("\tconst size_t dim __attribute__((unused)) = (m + %lu) * %lu + nBlock + n;", row, shape->N);
+				file->PrintfLine("\t%s = %s;", element.c_str(), expr.c_str());
+				file->PrintfLine("}");
+			}
+
+			file->Outdent();
+			file->PrintfLine("}");
+			file->Outdent();
+			file->PrintfLine("}");
+		}
+
+		file->Outdent();
+		file->PrintfLine("}");
+	}
+
+	file->Outdent();
+	file->PrintfLine("}");
+	file->Outdent();
+	file->PrintfLine("}");
+
+	return true;
+}
+
+bool CodeGenerator::GetPackedContraction(const Node * node, packedContraction_t * packed) const
+{
+	if((Node::Type::VECTOR_CONTRACTION != node->GetType()) || IsFolded(node->id))
+	{
+		return false;
+	}
+
+	if(IsPacked(node->Parents()->at(0)) == IsPacked(node->Parents()->at(1)))
+	{
+		return false; // Neither or both
+	}
+
+	packed->operand = IsPacked(node->Parents()->at(0)) ? 0 : 1;
+
+	const Node * sNode = graph_->GetNode(node->Parents()->at(packed->operand));
+	const Node * dNode = graph_->GetNode(node->Parents()->at(1 - packed->operand));
+	if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == dNode->GetType())
+	{
+		return false;
+	}
+
+	auto sVec = (const Algebra::Module::VectorSpace::Vector *) sNode->GetObjectPt();
+	auto dVec = (const Algebra::Module::VectorSpace::Vector *) dNode->GetObjectPt();
+	if(1 >= dVec->Space()->GetDim())
+	{
+		return false; // No array
+	}
+
+	auto contractParams = (const Node::contractParameters_t *) node->TypeParameters();
+	const std::vector<uint32_t> &sContracted = (0 == packed->operand) ? contractParams->lfactors : contractParams->rfactors;
+	const std::vector<uint32_t> &dContracted = (0 == packed->operand) ? contractParams->rfactors : contractParams->lfactors;
+
+	view_t dView;
+	if(!GetView(&dView, dNode->id))
+	{
+		return false;
+	}
+
+	// The factors of the dense operand which are not contracted have to be read as a single strided index
+	const auto dFactors = dVec->Space()->Factors();
+	packed->freeLength = 1;
+	packed->argStride = 0;
+	for(size_t factor = dFactors->size(); 0 < factor--;)
+	{
+		if(dContracted.end() != std::find(dContracted.begin(), dContracted.end(), factor))
+		{
+			continue;
+		}
+
+		if(1 == packed->freeLength)
+		{
+			packed->argStride = dView.strides[factor];
+		}
+		else if(dView.strides[factor] != packed->argStride * packed->freeLength)
+		{
+			return false;
+		}
+
+		packed->freeLength *= dFactors->at(factor).Dim;
+	}
+
+	// The result is indexed by the free factors of l, then those of r
+	const auto sFactors = sVec->Space()->Factors();
+	size_t sFreeLength = 1;
+	for(size_t factor = 0; factor < sFactors->size(); factor++)
+	{
+		if(sContracted.end() == std::find(sContracted.begin(), sContracted.end(), factor))
+		{
+			sFreeLength *= sFactors->at(factor).Dim;
+		}
+	}
+
+	packed->opStride = (0 == packed->operand) ? 1 : sFreeLength;
+
+	std::vector<uint32_t> sStrides;
+	sVec->Space()->GetStrides(&sStrides);
+
+	// A stored element contributes at its position and at the one of its mirror image
+	auto getOffsets = [&](uint32_t position, uint32_t * opOffset, uint32_t * argOffset)
+	{
+		size_t freeIndex = 0;
+		*argOffset = dView.offset;
+		for(size_t factor = 0; factor < sFactors->size(); factor++)
+		{
+			const size_t index = (position / sStrides[factor]) % sFactors->at(factor).Dim;
+
+			auto it = std::find(sContracted.begin(), sContracted.end(), factor);
+			if(sContracted.end() == it)
+			{
+				freeIndex = freeIndex * sFactors->at(factor).Dim + index;
+			}
+			else
+			{
+				*argOffset += index * dView.strides[dContracted[std::distance(sContracted.begin(), it)]];
+			}
+		}
+
+		*opOffset = (0 == packed->operand) ? freeIndex * packed->freeLength : freeIndex;
+	};
+
+	const packing_t &packing = packing_.at(sNode->id);
+
+	packed->elements.clear();
+	packed->opOffsets.clear();
+	packed->argOffsets.clear();
+	std::vector<uint32_t> subtractedElements;
+	std::vector<uint32_t> subtractedOpOffsets;
+	std::vector<uint32_t> subtractedArgOffsets;
+	for(uint32_t element = 0; element < packing.positions.size(); element++)
+	{
+		uint32_t opOffset;
+		uint32_t argOffset;
+		getOffsets(packing.positions[element], &opOffset, &argOffset);
+
+		packed->elements.push_back(element);
+		packed->opOffsets.push_back(opOffset);
+		packed->argOffsets.push_back(argOffset);
+
+		if(packing.mirrors[element] == packing.positions[element])
+		{
+			continue;
+		}
+
+		getOffsets(packing.mirrors[element], &opOffset, &argOffset);
+		if(0.f < packing.mirrorSign)
+		{
+			packed->elements.push_back(element);
+			packed->opOffsets.push_back(opOffset);
+			packed->argOffsets.push_back(argOffset);
+		}
+		else
+		{
+			subtractedElements.push_back(element);
+			subtractedOpOffsets.push_back(opOffset);
+			subtractedArgOffsets.push_back(argOffset);
+		}
+	}
+
+	packed->addedNrOf = packed->elements.size();
+	packed->elements.insert(packed->elements.end(), subtractedElements.begin(), subtractedElements.end());
+	packed->opOffsets.insert(packed->opOffsets.end(), subtractedOpOffsets.begin(), subtractedOpOffsets.end());
+	packed->argOffsets.insert(packed->argOffsets.end(), subtractedArgOffsets.begin(), subtractedArgOffsets.end());
+
+	return true;
+}
+
+bool CodeGenerator::PackedContractionCode(const Node* node, const packedContraction_t * packed, FileWriter * file, const Node * epilogue)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	view_t argView;
+	retFalseOnFalse(GetView(&argView, node->Parents()->at(1 - packed->operand)), "Could not get view of Node%u!\n", node->Parents()->at(1 - packed->operand));
+
+	getVarRetFalseOnError(varOp, (nullptr != epilogue) ? epilogue->id : node->id);
+	getVarRetFalseOnError(varPacked, node->Parents()->at(packed->operand));
+	getVarRetFalseOnError(varArg, argView.base);
+
+	const char * opId = varOp->GetIdentifier()->c_str();
+	const bool resultIsArray = (1 < varOp->Length());
+	const std::string arrayPrefix = "Node" + std::to_string(node->id) + "Packed";
+
+	// Each term adds its products to a part of the result, see GenerateConstantDeclarations for the offsets
+	std::string opElement = opId;
+	if(resultIsArray)
+	{
+		file->PrintfLine("for(size_t opIndex = 0; opIndex < %lu; opIndex++)", varOp->Length());
+		file->PrintfLine("{");
+		file->PrintfLine("\t%s[opIndex] = 0;", opId);
+		file->PrintfLine("}\n");
+
+		opElement += "[" + arrayPrefix + "Op[term]]";
+	}
+	else
+	{
+		file->PrintfLine("%s = 0;", opId);
+	}
+
+	std::string packedElement = *varPacked->GetIdentifier();
+	packedElement += isEachElementOnce(packed->elements) ? "[term]" : "[" + arrayPrefix + "Element[term]]";
+
+	std::string argElement = *varArg->GetIdentifier() + "[" + arrayPrefix + "Arg[term]";
+	if(1 < packed->freeLength)
+	{
+		opElement.insert(opElement.size() - 1, " + free * " + std::to_string(packed->opStride));
+		argElement += " + free * " + std::to_string(packed->argStride);
+	}
+	argElement += "]";
+
+	// Mirror images of antisymmetric elements come last and are subtracted
+	const std::pair<size_t, size_t> termRanges[] = {{0, packed->addedNrOf}, {packed->addedNrOf, packed->opOffsets.size()}};
+	for(const std::pair<size_t, size_t> &range: termRanges)
+	{
+		if(range.first == range.second)
+		{
+			continue;
+		}
+
+		if(0 != range.first)
+		{
+			file->PrintfLine("");
+		}
+
+		file->PrintfLine("for(size_t term = %lu; term < %lu; term++)", range.first, range.second);
+		file->PrintfLine("{");
+		file->Indent();
+
+		if(1 < packed->freeLength)
+		{
+			file->PrintfLine("for(size_t free = 0; free < %lu; free++)", packed->freeLength);
+			file->PrintfLine("{");
+			file->Indent();
+		}
+
+		file->PrintfLine("%s %s= %s * %s;", opElement.c_str(), (0 == range.first) ? "+" : "-", packedElement.c_str(), argElement.c_str());
+
+		if(1 < packed->freeLength)
+		{
+			file->Outdent();
+			file->PrintfLine("}");
+		}
+
+		file->Outdent();
+		file->PrintfLine("}");
+	}
+
+	if(nullptr == epilogue)
+	{
+		return true;
+	}
+
+	file->PrintfLine("");
+	file->PrintfLine("// Epilogue: Node%u", epilogue->id);
+
+	std::string result = resultIsArray ? std::string{opId} + "[opIndex]" : std::string{opId};
+
+	std::string expr;
+	retFalseOnFalse(GetEpilogueExpression(&expr, epilogue, result), "Could not get epilogue of Node%u!\n", node->id);
+
+	if(resultIsArray)
+	{
+		file->PrintfLine("for(size_t opIndex = 0; opIndex < %lu; opIndex++)", varOp->Length());
+		file->PrintfLine("{");
+		file->PrintfLine("\tconst size_t dim __attribute__((unused)) = opIndex;");
+		file->PrintfLine("\t%s = %s;", result.c_str(), expr.c_str());
+		file->PrintfLine("}");
+	}
+	else
+	{
+		file->PrintfLine("%s = %s;", result.c_str(), expr.c_str());
+	}
+
+	return true;
+}
+
+bool CodeGenerator::GetSymmetricProduct(const Node * node, symmetricProduct_t * product) const
+{
+	if((Node::Type::VECTOR_CONTRACTION != node->GetType()) || (node->Parents()->at(0) != node->Parents()->at(1)) || IsFolded(node->id))
+	{
+		return false;
+	}
+
+	const Node * aNode = graph_->GetNode(node->Parents()->at(0));
+	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == aNode->GetType()) || IsPacked(aNode->id))
+	{
+		return false;
+	}
+
+	// a_ik a_jk: Both operands contract the same one of their two factors
+	auto aVec = (const Algebra::Module::VectorSpace::Vector *) aNode->GetObjectPt();
+	auto contractParams = (const Node::contractParameters_t *) node->TypeParameters();
+	if((2 != aVec->Space()->Factors()->size()) || (1 != contractParams->lfactors.size()) ||
+			(contractParams->lfactors != contractParams->rfactors))
+	{
+		return false;
+	}
+
+	// Large ones are left to the blocked kernel, which computes all elements
+	matrixProductShape_t shape;
+	if(GetMatrixProductShape(node, &shape))
+	{
+		return false;
+	}
+
+	view_t view;
+	if(!GetView(&view, aNode->id))
+	{
+		return false;
+	}
+
+	const uint32_t inner = contractParams->lfactors[0];
+	product->rowsNrOf = aVec->Space()->Factors()->at(1 - inner).Dim;
+	product->innerLength = aVec->Space()->Factors()->at(inner).Dim;
+	product->rowStride = view.strides[1 - inner];
+	product->innerStride = view.strides[inner];
+	product->offset = view.offset;
+
+	return 1 < product->rowsNrOf;
+}
+
+bool CodeGenerator::SymmetricProductCode(const Node* node, const symmetricProduct_t * product, FileWriter * file, const Node * epilogue)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	view_t view;
+	retFalseOnFalse(GetView(&view, node->Parents()->at(0)), "Could not get view of Node%u!\n", node->Parents()->at(0));
+
+	const Node::Id_t opNodeId = (nullptr != epilogue) ? epilogue->id : node->id;
+	getVarRetFalseOnError(varOp, opNodeId);
+	getVarRetFalseOnError(varA, view.base);
+
+	auto getElement = [&](const char * row)
+	{
+		std::string element = *varA->GetIdentifier() + "[";
+		if(product->offset)
+		{
+			element += std::to_string(product->offset) + " + ";
+		}
+
+		element += std::string{row} + ((1 == product->rowStride) ? "" : " * " + std::to_string(product->rowStride));
+		element += " + inner" + ((1 == product->innerStride) ? "" : " * " + std::to_string(product->innerStride));
+
+		return element + "]";
+	};
+
+	std::string result = "sum";
+	if(nullptr != epilogue)
+	{
+		retFalseOnFalse(GetEpilogueExpression(&result, epilogue, "sum"), "Could not get epilogue of Node%u!\n", node->id);
+	}
+
+	// Only the upper triangle is computed. A packed result stores it row by row, see PropagatePacking, else it is mirrored.
+	const bool isPacked = IsPacked(opNodeId);
+	if(isPacked)
+	{
+		file->PrintfLine("size_t element = 0;");
+	}
+
+	file->PrintfLine("for(size_t row = 0; row < %lu; row++)", product->rowsNrOf);
+	file->PrintfLine("{");
+	file->Indent();
+	file->PrintfLine("for(size_t col = row; col < %lu; col++)", product->rowsNrOf);
+	file->PrintfLine("{");
+	file->Indent();
+
+	file->PrintfLine("%s sum = 0;", varOp->GetTypeString());
+	file->PrintfLine("for(size_t inner = 0; inner < %lu; inner++)", product->innerLength);
+	file->PrintfLine("{");
+	file->PrintfLine("\tsum += %s * %s;", getElement("row").c_str(), getElement("col").c_str());
+	file->PrintfLine("}\n");
+
+	const char * opId = varOp->GetIdentifier()->c_str();
+	if(isPacked)
+	{
+		file->PrintfLine("const size_t dim __attribute__((unused)) = element++;");
+		file->PrintfLine("%s[dim] = %s;", opId, result.c_str());
+	}
+	else
+	{
+		file->PrintfLine("const size_t dim __attribute__((unused)) = row * %lu + col;", product->rowsNrOf);
+		file->PrintfLine("%s[dim] = %s;", opId, result.c_str());
+
+		if(nullptr == epilogue)
+		{
+			file->PrintfLine("%s[col * %lu + row] = sum;", opId, product->rowsNrOf);
+		}
+		else
+		{
+			// The epilogue's other operands need not be symmetric
+			file->PrintfLine("if(row != col)");
+			file->PrintfLine("{");
+			file->Indent();
+			file->PrintfLine("const size_t dim __attribute__((unused)) = col * %lu + row;", product->rowsNrOf);
+			file->PrintfLine("%s[dim] = %s;", opId, result.c_str());
+			file->Outdent();
+			file->PrintfLine("}");
+		}
+	}
+
+	file->Outdent();
+	file->PrintfLine("}");
+	file->Outdent();
+	file->PrintfLine("}");
+
+	return true;
+}
+
+bool CodeGenerator::VectorContractionCode(const Node* node, FileWriter * file, const Node * epilogue)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	auto nodes = graph_->GetNodes();
+	const auto lnode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == lnode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(0));
+		return false;
+	}
+
+	const auto rnode = nodes->find(node->Parents()->at(1));
+	if(nodes->end() == rnode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(1));
+		return false;
+	}
+
+	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lnode->second.GetType()) ||
+			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rnode->second.GetType()))
+	{
+		return VectorContractionKroneckerDeltaCode(node, file);
+	}
+
+	packedContraction_t packedContraction;
+	if(GetPackedContraction(node, &packedContraction))
+	{
+		return PackedContractionCode(node, &packedContraction, file, epilogue);
+	}
+
+	matrixProductShape_t matrixProductShape;
+	if(GetMatrixProductShape(node, &matrixProductShape))
+	{
+		return VectorMatrixProductCode(node, &matrixProductShape, file, epilogue);
+	}
+
+	symmetricProduct_t symmetricProduct;
+	if(GetSymmetricProduct(node, &symmetricProduct))
+	{
+		return SymmetricProductCode(node, &symmetricProduct, file, epilogue);
+	}
+
+	// Permuted, projected or joined operands are read in place
+	view_t lView;
+	retFalseOnFalse(GetView(&lView, node->Parents()->at(0)), "Could not get view of Node%u!\n", node->Parents()->at(0));
+
+	view_t rView;
+	retFalseOnFalse(GetView(&rView, node->Parents()->at(1)), "Could not get view of Node%u!\n", node->Parents()->at(1));
+
+	getVarRetFalseOnError(varOp, (nullptr != epilogue) ? epilogue->id : node->id);
+	getVarRetFalseOnError(varLVec, lView.base);
+	getVarRetFalseOnError(varRVec, rView.base);
+
+	const Algebra::Module::VectorSpace::Vector* lVec = (const Algebra::Module::VectorSpace::Vector*) lnode->second.GetObjectPt();
+	const Algebra::Module::VectorSpace::Vector* rVec = (const Algebra::Module::VectorSpace::Vector*) rnode->second.GetObjectPt();
+
+	const Algebra::Module::VectorSpace::Vector* opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+	const Node::contractParameters_t * contractValue = (Node::contractParameters_t *) node->TypeParameters();
+
+	const char * varOpId = varOp->GetIdentifier()->c_str();
+
+	bool resultIsArray = (1 < varOp->Length());
+
+	if(resultIsArray)
+	{
+		GenerateOpIndexLoop(file, opVec->Space());
+	}
+
+	file->PrintfLine("%s sum = 0;", varOp->GetTypeString());
+	for(uint32_t factorIndex = 0; factorIndex < contractValue->lfactors.size(); factorIndex++)
+	{
+		file->PrintfLine("for(int dim%u = 0; dim%u < %u; dim%u++)",
+				factorIndex, factorIndex,
+				lVec->Space()->Factors()->at(contractValue->lfactors[factorIndex]).Dim,
+				factorIndex);
+		file->PrintfLine("{");
+		file->Indent();
+	}
+
+	uint32_t opIndex = 0;
+	std::string lIndexTuple = "const uint32_t lIndexTuple[] = {";
+	for(uint32_t lDim = 0; lDim < lVec->Space()->Factors()->size(); lDim++)
+	{
+		auto it = std::find(
+				contractValue->lfactors.begin(),
+				contractValue->lfactors.end(),
+				lDim);
+
+		if(it == contractValue->lfactors.end())
+		{
+			lIndexTuple += "opIndexTuple[";
+			lIndexTuple += std::to_string(opIndex);
+			lIndexTuple += "], ";
+			opIndex++;
+		}
+		else
+		{
+			lIndexTuple += "dim" + std::to_string(std::distance(contractValue->lfactors.begin(), it));
+			lIndexTuple += ", ";
+		}
+	}
+
+	lIndexTuple.erase(lIndexTuple.end() - 2, lIndexTuple.end()); // remove last ", "
+	lIndexTuple += "};";
+	file->PrintfLine(lIndexTuple.c_str());
+
+	std::string rIndexTuple = "const uint32_t rIndexTuple[] = {";
+	for(uint32_t rDim = 0; rDim < rVec->Space()->Factors()->size(); rDim++)
+	{
+		auto it = std::find(
+				contractValue->rfactors.begin(),
+				contractValue->rfactors.end(),
+				rDim);
+
+		if(it == contractValue->rfactors.end())
+		{
+			rIndexTuple += "opIndexTuple[";
+			rIndexTuple += std::to_string(opIndex);
+			rIndexTuple += "], ";
+			opIndex++;
+		}
+		else
+		{
+			rIndexTuple += "dim" + std::to_string(std::distance(contractValue->rfactors.begin(), it));
+			rIndexTuple += ", ";
+		}
+	}
+
+	rIndexTuple.erase(rIndexTuple.end() - 2, rIndexTuple.end()); // remove last ", "
+	rIndexTuple += "};";
+	file->PrintfLine(rIndexTuple.c_str());
+
+	std::string sum = "sum += ";
+	sum += *(varLVec->GetIdentifier());
+	appendViewPosition(&sum, lView.strides, lView.offset, std::string{"lIndexTuple"});
+	sum += " * ";
+
+	sum += *(varRVec->GetIdentifier());
+	appendViewPosition(&sum, rView.strides, rView.offset, std::string{"rIndexTuple"});
+	sum += ";";
+
+	file->PrintfLine(sum.c_str());
+
+	for(uint32_t factorIndex = 0; factorIndex < contractValue->lfactors.size(); factorIndex++)
+	{
+		file->Outdent();
+		file->PrintfLine("}");
+	}
+
+	file->PrintfLine("");
+
+	std::string result = "sum";
+	if(nullptr != epilogue)
+	{
+		file->PrintfLine("// Epilogue: Node%u", epilogue->id);
+		if(resultIsArray)
+		{
+			file->PrintfLine("const size_t dim __attribute__((unused)) = opIndex;");
+		}
+
+		retFalseOnFalse(GetEpilogueExpression(&result, epilogue, "sum"), "Could not get epilogue of Node%u!\n", node->id);
+	}
+
+	if(resultIsArray)
+	{
+		file->PrintfLine("%s[opIndex] = %s;",
+				varOpId, result.c_str());
+
+		GenerateOpIndexLoopEnd(file, opVec->Space());
+	}
+	else
+	{
+		file->PrintfLine("%s = %s;", varOpId, result.c_str());
+	}
+
+	return true;
+}
+
+bool CodeGenerator::VectorComparisonIsSmallerCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	// TODO: Create extra Norm-Nodes for this.
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varLVec, node->Parents()->at(0));
+	getVarRetFalseOnError(varRVec, node->Parents()->at(1));
+
+	std::string lNormId;
+	lNormId += *(varLVec->GetIdentifier());
+	lNormId += "Norm";
+	lNormId += std::to_string(varLVec->GetNewRunningNumber());
+	file->PrintfLine("%s %s = 0;",
+			varLVec->GetTypeString(),
+			lNormId.c_str());
+
+	std::string rNormId;
+	rNormId += *(varRVec->GetIdentifier());
+	rNormId += "Norm";
+	rNormId += std::to_string(varRVec->GetNewRunningNumber());
+	file->PrintfLine("%s %s = 0;",
+			varRVec->GetTypeString(),
+			rNormId.c_str());
+
+	// Fused operands are computed on the fly
+	const Node * lNode = graph_->GetNode(node->Parents()->at(0));
+	const Node * rNode = graph_->GetNode(node->Parents()->at(1));
+
+	bool simdApplicable = IsSimdApplicable(varLVec, varLVec, varRVec);
+	for(const Node * operand: {lNode, rNode})
+	{
+		simdApplicable = simdApplicable && (!IsFused(operand->id) || IsFusedSimdApplicable(varLVec, operand));
+	}
+
+	if(simdApplicable)
+	{
+		// Accumulate the squares lane-wise, then sum up the lanes
+		for(const auto &norm: {std::make_pair(varLVec, &lNormId), std::make_pair(varRVec, &rNormId)})
+		{
+			const Node::Id_t operandId = (norm.first == varLVec) ? lNode->id : rNode->id;
+
+			const std::string vecNormId = *norm.second + "Vec";
+			file->PrintfLine("%s %s = {0};", GetSimdTypeString(norm.first).c_str(), vecNormId.c_str());
+
+			std::string elem;
+			retFalseOnFalse(GetOperandElement(&elem, operandId, true), "Could not get operand!\n");
+
+			std::string scalarElem;
+			retFalseOnFalse(GetOperandElement(&scalarElem, operandId, false), "Could not get operand!\n");
+
+			std::string vectorStatement = vecNormId + " += " + elem + " * " + elem + ";";
+			std::string scalarStatement = *norm.second + " += " + scalarElem + " * " + scalarElem + ";";
+
+			retFalseOnFalse(GenerateSimdLoop(file, norm.first, norm.first->Length(), &vectorStatement, &scalarStatement),
+					"Could not generate SIMD loop!\n");
+
+			file->PrintfLine("for(uint32_t lane = 0; lane < %lu; lane++)", GetSimdLanesNrOf(norm.first));
+			file->PrintfLine("{");
+			file->PrintfLine("\t%s += %s[lane];", norm.second->c_str(), vecNormId.c_str());
+			file->PrintfLine("}\n");
+		}
+	}
+	else
+	{
+		std::string lArrayElem;
+		retFalseOnFalse(GetOperandElement(&lArrayElem, lNode->id, false), "Could not get operand!\n");
+
+		file->PrintfLine("for(uint32_t dim = 0; dim < %u; dim++)",
+				varLVec->Length());
+		file->PrintfLine("{");
+		file->PrintfLine("\t %s += %s * %s;",
+				lNormId.c_str(),
+				lArrayElem.c_str(), lArrayElem.c_str());
+		file->PrintfLine("}\n");
+
+		std::string rArrayElem;
+		retFalseOnFalse(GetOperandElement(&rArrayElem, rNode->id, false), "Could not get operand!\n");
+
+		file->PrintfLine("for(uint32_t dim = 0; dim < %u; dim++)",
+				varRVec->Length());
+		file->PrintfLine("{");
+		file->PrintfLine("\t %s += %s * %s;",
+				rNormId.c_str(),
+				rArrayElem.c_str(), rArrayElem.c_str());
+		file->PrintfLine("}\n");
+	}
+
+	retFalseOnFalse(GenerateLocalVariableDeclaration(varOp), "Could not generate Var. Decl.\n");
+
+	file->PrintfLine("if(%s < %s)",
+			lNormId.c_str(), rNormId.c_str());
+	file->PrintfLine("{");
+	file->PrintfLine("\t %s = 1;",
+			varOp->GetIdentifier()->c_str());
+	file->PrintfLine("}");
+	file->PrintfLine("else");
+	file->PrintfLine("{");
+	file->PrintfLine("\t %s = 0;",
+			varOp->GetIdentifier()->c_str());
+	file->PrintfLine("}\n");
+
+	return true;
+}
+
+bool CodeGenerator::GetRootAncestorChildren(std::set<Node::Id_t> * rootChildren, Node::Id_t child) const
+{
+	// Get root ancestors. Those won't be instructions
+	std::set<Node::Id_t> rootAncestors;
+	bool success = graph_->GetRootAncestors(&rootAncestors, child);
+	if(!success)
+	{
+		Error("Could not get root ancestors!\n");
+		return false;
+	}
+
+	// Folded nodes computed from root ancestors only count as such
+	for(const Node::Id_t &foldedId: foldedOrder_)
+	{
+		const auto parents = graph_->GetNode(foldedId)->Parents();
+		if(std::all_of(parents->begin(), parents->end(), [&rootAncestors](Node::Id_t parent) {return rootAncestors.end() != rootAncestors.find(parent);}))
+		{
+			rootAncestors.insert(foldedId);
+		}
+	}
+
+	// Get all of rootAncestor's children
+	std::set<Node::Id_t> rootAncesorChildren;
+	for(const Node::Id_t &rootId: rootAncestors)
+	{
+		const Node * rootNode = graph_->GetNode(rootId);
+
+		for(const Node::Id_t &rootChildId: *rootNode->Children())
+		{
+			if(!IsFolded(rootChildId))
+			{
+				rootAncesorChildren.insert(GetFusionSink(rootChildId));
+			}
+		}
+	}
+
+	// Get all children who do not depend on non-root parents
+	for(const Node::Id_t &childId: rootAncesorChildren)
+	{
+		std::vector<Node::Id_t> operands;
+		GetFusedOperands(&operands, graph_->GetNode(childId));
+
+		bool allParentsRoot = true;
+		for(const Node::Id_t &parentId: operands)
+		{
+			if(rootAncestors.end() == rootAncestors.find(parentId))
+			{
+				allParentsRoot = false;
+				break;
+			}
+		}
+
+		if(allParentsRoot)
+		{
+			rootChildren->insert(childId);
+		}
+	}
+
+	return true;
+}
+
+bool CodeGenerator::GetRootAncestorInstructionPositions(std::set<uint32_t> * instructionPos, Node::Id_t child)
+{
+	std::set<Node::Id_t> rootChildren;
+	retFalseOnFalse(GetRootAncestorChildren(&rootChildren, child), "Could not get root ancestor children!\n");
+
+	for(const Node::Id_t rootChildId: rootChildren)
+	{
+		const auto &arrayPos = nodeArrayPos_.find(rootChildId);
+		if(nodeArrayPos_.end() == arrayPos)
+		{
+			Error("Couldn't find array position for Node%u\n", rootChildId);
+			return false;
+		}
+
+		instructionPos->insert(arrayPos->second.begin(), arrayPos->second.end());
+	}
+
+	return true;
+}
+
+bool CodeGenerator::GetControlTransferBranchTrue(std::set<Node::Id_t> * rootChildren, const Node * node) const
+{
+	auto whileParam = (const Node::ControlTransferParameters_t*) node->TypeParameters();
+
+	if(Node::ID_NONE != whileParam->BranchTrue)
+	{
+		retFalseOnFalse(GetRootAncestorChildren(rootChildren, whileParam->BranchTrue), "Could not get root ancestor children!\n");
+	}
+
+	// The condition is calculated again, too
+	retFalseOnFalse(GetRootAncestorChildren(rootChildren, node->Parents()->at(0)), "Could not get root ancestor children!\n");
+
+	return true;
+}
+
+bool CodeGenerator::HasInstruction(const Node * node) const
+{
+	// See GenerateInstructions
+	if(IsFused(node->id) || IsFolded(node->id))
+	{
+		return false;
+	}
+
+	switch(node->GetType())
+	{
+	case Node::Type::NONE: // no break intended
+	case Node::Type::VECTOR: // no break intended
+	case Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT:
+		return false;
+
+	default:
+		return true;
+	}
+}
+
+bool CodeGenerator::IsFused(Node::Id_t id) const
+{
+	return fusedInto_.end() != fusedInto_.find(id);
+}
+
+Node::Id_t CodeGenerator::GetFusionSink(Node::Id_t id) const
+{
+	for(auto fusedIt = fusedInto_.find(id); fusedInto_.end() != fusedIt; fusedIt = fusedInto_.find(id))
+	{
+		id = fusedIt->second;
+	}
+
+	return id;
+}
+
+void CodeGenerator::GetFusedOperands(std::vector<Node::Id_t> * operands, const Node * node) const
+{
+	for(const Node::Id_t &parent: *node->Parents())
+	{
+		if(IsFused(parent))
+		{
+			GetFusedOperands(operands, graph_->GetNode(parent));
+		}
+		else
+		{
+			pushBackUnique(operands, parent);
+		}
+	}
+}
+
+void CodeGenerator::GetInstructionParents(std::vector<Node::Id_t> * parents, const Node * node) const
+{
+	// The instructions whose results node's instruction reads
+	std::vector<Node::Id_t> operands;
+	GetFusedOperands(&operands, node);
+
+	for(const Node::Id_t &operand: operands)
+	{
+		if(nodesInstructionMap_.end() != nodesInstructionMap_.find(operand))
+		{
+			pushBackUnique(parents, operand);
+			continue;
+		}
+
+		// Maybe the operand is just a intermediate variable for e.g. an input
+		for(const Node::Id_t &grandParent: *graph_->GetNode(operand)->Parents())
+		{
+			if(nodesInstructionMap_.end() != nodesInstructionMap_.find(grandParent))
+			{
+				pushBackUnique(parents, grandParent);
+			}
+		}
+	}
+}
+
+const Node * CodeGenerator::GetFusedContraction(const Node * node) const
+{
+	for(const Node::Id_t &parent: *node->Parents())
+	{
+		if(!IsFused(parent))
+		{
+			continue;
+		}
+
+		const Node * parentNode = graph_->GetNode(parent);
+		if(Node::Type::VECTOR_CONTRACTION == parentNode->GetType())
+		{
+			return parentNode;
+		}
+
+		const Node * contraction = GetFusedContraction(parentNode);
+		if(nullptr != contraction)
+		{
+			return contraction;
+		}
+	}
+
+	return nullptr;
+}
+
+bool CodeGenerator::IsView(Node::Id_t id) const
+{
+	if(!IsFused(id))
+	{
+		return false;
+	}
+
+	switch(graph_->GetNode(id)->GetType())
+	{
+	case Node::Type::VECTOR_PERMUTATION: // no break intended
+	case Node::Type::VECTOR_PROJECTION: // no break intended
+	case Node::Type::VECTOR_JOIN_INDICES:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+bool CodeGenerator::GetView(view_t * view, Node::Id_t id) const
+{
+	const Node * node = graph_->GetNode(id);
+	if(nullptr == node)
+	{
+		Error("Could not find Node for id %u\n", id);
+		return false;
+	}
+
+	auto vec = (const Algebra::Module::VectorSpace::Vector *) node->GetObjectPt();
+
+	if(!IsView(id))
+	{
+		std::vector<uint32_t> strides;
+		vec->Space()->GetStrides(&strides);
+
+		view->base = id;
+		view->strides.assign(strides.begin(), strides.end());
+		view->offset = 0;
+
+		return true;
+	}
+
+	view_t argView;
+	retFalseOnFalse(GetView(&argView, node->Parents()->at(0)), "Could not get view of Node%u!\n", node->Parents()->at(0));
+
+	// Per factor of the argument: The factor of node it is indexed with and an offset.
+	// See VectorPermutationCode, VectorProjectionCode and VectorJoinIndicesCode.
+	const size_t argFactorsNrOf = argView.strides.size();
+	std::vector<std::pair<uint32_t, uint32_t>> indexMap(argFactorsNrOf);
+
+	switch(node->GetType())
+	{
+	case Node::Type::VECTOR_PERMUTATION:
+	{
+		auto param = (const Node::permuteParameters_t *) node->TypeParameters();
+		for(size_t argFactor = 0; argFactor < argFactorsNrOf; argFactor++)
+		{
+			indexMap[argFactor] = std::make_pair(param->indices[argFactor], 0);
+		}
+		break;
+	}
+
+	case Node::Type::VECTOR_PROJECTION:
+	{
+		auto param = (const Node::projectParameters_t *) node->TypeParameters();
+		for(size_t argFactor = 0; argFactor < argFactorsNrOf; argFactor++)
+		{
+			indexMap[argFactor] = std::make_pair(argFactor, param->range[argFactor].first);
+		}
+		break;
+	}
+
+	case Node::Type::VECTOR_JOIN_INDICES:
+	{
+		// Joined factors are indexed by the factor at the position of the lowest one
+		auto param = (const Node::joinIndicesParameters_t *) node->TypeParameters();
+		std::vector<uint32_t> joinedFactor(param->Indices.size(), UINT32_MAX);
+
+		uint32_t factor = 0;
+		for(size_t argFactor = 0; argFactor < argFactorsNrOf; argFactor++)
+		{
+			size_t joined;
+			for(joined = 0; joined < param->Indices.size(); joined++)
+			{
+				auto it = std::find(param->Indices[joined].begin(), param->Indices[joined].end(), argFactor);
+				if(param->Indices[joined].end() != it)
+				{
+					break;
+				}
+			}
+
+			if((param->Indices.size() > joined) && (UINT32_MAX != joinedFactor[joined]))
+			{
+				indexMap[argFactor] = std::make_pair(joinedFactor[joined], 0);
+				continue;
+			}
+
+			if(param->Indices.size() > joined)
+			{
+				joinedFactor[joined] = factor;
+			}
+
+			indexMap[argFactor] = std::make_pair(factor, 0);
+			factor++;
+		}
+		break;
+	}
+
+	default:
+		Error("Node%u of type %s is no view!\n", id, Node::getName(node->GetType()));
+		return false;
+	}
+
+	view->base = argView.base;
+	view->strides.assign(vec->Space()->Factors()->size(), 0);
+	view->offset = argView.offset;
+
+	for(size_t argFactor = 0; argFactor < argFactorsNrOf; argFactor++)
+	{
+		view->strides[indexMap[argFactor].first] += argView.strides[argFactor];
+		view->offset += argView.strides[argFactor] * indexMap[argFactor].second;
+	}
+
+	return true;
+}
+
+bool CodeGenerator::GetInstructionsTopologicalOrder(std::vector<Node::Id_t> * order) const
+{
+	// Kahn's algorithm on the whole graph, picking the lowest ready id first to keep the output stable.
+	auto nodes = graph_->GetNodes();
+
+	std::map<Node::Id_t, size_t> parentsRemaining;
+	std::set<Node::Id_t> ready;
+	for(const auto &nodePair: *nodes)
+	{
+		parentsRemaining[nodePair.first] = nodePair.second.Parents()->size();
+		if(0 == nodePair.second.Parents()->size())
+		{
+			ready.insert(nodePair.first);
+		}
+	}
+
+	size_t visitedNrOf = 0;
+	while(ready.size())
+	{
+		Node::Id_t nodeId = *ready.begin();
+		ready.erase(ready.begin());
+		visitedNrOf++;
+
+		const Node * node = graph_->GetNode(nodeId);
+		if(HasInstruction(node))
+		{
+			order->push_back(nodeId);
+		}
+
+		for(const Node::Id_t &childId: *node->Children())
+		{
+			// Parents may list the same node several times
+			size_t edgesNrOf = std::count(
+					graph_->GetNode(childId)->Parents()->begin(),
+					graph_->GetNode(childId)->Parents()->end(),
+					nodeId);
+
+			parentsRemaining[childId] -= edgesNrOf;
+			if(0 == parentsRemaining[childId])
+			{
+				ready.insert(childId);
+			}
+		}
+	}
+
+	if(visitedNrOf != nodes->size())
+	{
+		Error("Graph has a cycle!\n");
+		return false;
+	}
+
+	return true;
+}
+
+bool CodeGenerator::ControlTransferWhileCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	getVarRetFalseOnError(varCond, node->Parents()->at(0));
+
+	if(1 != varCond->Length())
+	{
+		Error("Control Transfer condition has more than one dim.!\n");
+		return false;
+	}
+
+	auto whileParam = (const Node::ControlTransferParameters_t*) node->TypeParameters();
+
+	if(Scheduling::DYNAMIC != scheduling_)
+	{
+		if(Node::ID_NONE != whileParam->BranchFalse)
+		{
+			Error("Sequential and static scheduling do not support a false-branch!\n");
+			return false;
+		}
+
+		// The run function repeats the loop body as long as this is set
+		std::string fctId;
+		GenerateInstructionId(&fctId, node->id);
+
+		file->PrintfLine("%sRepeat = (%s) ? 1 : 0;", fctId.c_str(), varCond->GetIdentifier()->c_str());
+
+		return true;
+	}
+
+	std::set<uint32_t> arrayPosTrue;
+	if(Node::ID_NONE != whileParam->BranchTrue)
+	{
+		bool success = GetRootAncestorInstructionPositions(&arrayPosTrue, whileParam->BranchTrue);
+		if(!success)
+		{
+			Error("Could not get root ancestor instructions!\n");
+			return false;
+		}
+	}
+
+	std::set<uint32_t> arrayPosFalse;
+	if(Node::ID_NONE != whileParam->BranchFalse)
+	{
+		bool success = GetRootAncestorInstructionPositions(&arrayPosFalse, whileParam->BranchFalse);
+		if(!success)
+		{
+			Error("Could not get root ancestor instructions!\n");
+			return false;
+		}
+	}
+
+	// Add the condition to the instruction calculated when true
+	std::set<uint32_t> arrayPosCondition;
+	bool success = GetRootAncestorInstructionPositions(&arrayPosCondition, node->Parents()->at(0));
+	if(!success)
+	{
+		Error("Could not get root ancestor instructions!\n");
+		return false;
+	}
+
+	arrayPosTrue.insert(arrayPosCondition.begin(), arrayPosCondition.end());
+
+	// Print the instructions
+	file->PrintfLine("if(%s)", varCond->GetIdentifier()->c_str());
+	file->PrintfLine("{");
+
+	if(arrayPosTrue.size())
+	{
+		for(const uint32_t &pos: arrayPosTrue)
+		{
+			file->PrintfLine("\tPushNode(instance, &nodes%s[%u]);",
+					graph_->Name().c_str(),
+					pos);
+		}
+	}
+	else
+	{
+		file->PrintfLine("; // Do nothing");
+	}
+
+	file->PrintfLine("}");
+	file->PrintfLine("else");
+	file->PrintfLine("{");
+
+	if(arrayPosFalse.size())
+	{
+		for(const uint32_t &pos: arrayPosFalse)
+		{
+			file->PrintfLine("\tPushNode(instance, &nodes%s[%u]);",
+					graph_->Name().c_str(),
+					pos);
+		}
+	}
+	else
+	{
+		file->PrintfLine("\t; // Do nothing");
+	}
+
+	file->PrintfLine("}");
+
+	return true;
+}
+
+bool CodeGenerator::VectorScalarProductKroneckerDeltaCode(const Node* node, FileWriter * file, bool divide)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	auto nodes = graph_->GetNodes();
+	const auto lVecNode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == lVecNode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(0));
+		return false;
+	}
+
+	const auto rVecNode = nodes->find(node->Parents()->at(1));
+	if(nodes->end() == rVecNode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(1));
+		return false;
+	}
+
+	Node::Id_t varScalarNodeId;
+	const Node * kronNode = nullptr;
+	if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lVecNode->second.GetType())
+	{
+		kronNode = &lVecNode->second;
+		varScalarNodeId = node->Parents()->at(1);
+	}
+	else
+	{
+		kronNode = &rVecNode->second;
+
+		if(divide)
+		{
+			Error("Can't divide by kronecker (division by zero)!\n");
+			return false;
+		}
+
+		varScalarNodeId = node->Parents()->at(0);
+	}
+
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varScalar, varScalarNodeId);
+
+	const Node::KroneckerDeltaParameters_t * kroneckerParam = (const Node::KroneckerDeltaParameters_t *) kronNode->TypeParameters();
+
+	retFalseOnFalse(GenerateLocalVariableDeclaration(varOp), "Could not generate Var. Decl.\n");
+
+	auto opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+
+	// TODO: This is a giant waste of resources: Every Node should have a "scaling" attached to it, so multiplication needs
+	// to only be performed on that.
+
+	std::string deltaPairs = "const uint32_t deltaPairs[] = {";
+	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	{
+		deltaPairs += std::to_string(kroneckerParam->DeltaPair[paramPos]) + ", ";
+	}
+	deltaPairs.erase(deltaPairs.end() - 2, deltaPairs.end()); // remove last ", "
+	deltaPairs += "};";
+	file->PrintfLine("%s", deltaPairs.c_str());
+
+	GenerateOpIndexLoop(file, opVec->Space());
+
+	std::string Result = *(varOp->GetIdentifier());
+	Result += "[opIndex] =";
+	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	{
+		if(kroneckerParam->DeltaPair[paramPos] > paramPos) // Remember, we save the partner for every factor, but only half the information is needed
+		{
+			Result += " (opIndexTuple[" + std::to_string(paramPos) + "] ==";
+			Result += " opIndexTuple[deltaPairs[" + std::to_string(paramPos) + "]]) *";
+		}
+	}
+	Result += " " + std::to_string(kroneckerParam->Scaling) + "f";
+
+	if(divide)
+	{
+		Result += " / ";
+	}
+	else
+	{
+		Result += " * ";
+	}
+
+	 Result += *varScalar->GetIdentifier() + ";";;
+
+	file->PrintfLine(Result.c_str());
+
+	GenerateOpIndexLoopEnd(file, opVec->Space());
+
+	return true;
+}
+
+bool CodeGenerator::VectorVectorProductKroneckerDeltaCode(const Node* node, FileWriter * file, bool divide)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	auto nodes = graph_->GetNodes();
+
+	const auto lnode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == lnode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(0));
+		return false;
+	}
+
+	const auto rnode = nodes->find(node->Parents()->at(1));
+	if(nodes->end() == rnode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(1));
+		return false;
+	}
+
+	bool lNodeIsKron = (Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lnode->second.GetType());
+	bool rNodeIsKron = (Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rnode->second.GetType());
+
+	if(lNodeIsKron && rNodeIsKron)
+	{
+		Error("Product of two KroneckerDeltas not supported: Should be handled in graph creation!\n");
+		return false;
+	}
+
+	if(divide && rNodeIsKron)
+	{
+		Error("Can't divide by Kronecker (division by zero)!\n");
+		return false;
+	}
+
+	Node::Id_t vecNodeId;
+	const Algebra::Module::VectorSpace::Vector* vec;
+	const Algebra::Module::VectorSpace::Vector* kronVec;
+	const Node::KroneckerDeltaParameters_t * kroneckerParam;
+	if(lNodeIsKron)
+	{
+		vecNodeId = node->Parents()->at(1);
+		kronVec = (const Algebra::Module::VectorSpace::Vector*) lnode->second.GetObjectPt();
+		vec = (const Algebra::Module::VectorSpace::Vector*) rnode->second.GetObjectPt();
+		kroneckerParam = (const Node::KroneckerDeltaParameters_t *) lnode->second.TypeParameters();
+	}
+	else
+	{
+		vecNodeId = node->Parents()->at(0);
+		kronVec = (const Algebra::Module::VectorSpace::Vector*) rnode->second.GetObjectPt();
+		vec = (const Algebra::Module::VectorSpace::Vector*) lnode->second.GetObjectPt();
+		kroneckerParam = (const Node::KroneckerDeltaParameters_t *) rnode->second.TypeParameters();
+	}
+
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varVec, vecNodeId);
+
+	const Algebra::Module::VectorSpace::Vector* opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+
+	std::string deltaPairs = "const uint32_t deltaPairs[] = {";
+	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	{
+		deltaPairs += std::to_string(kroneckerParam->DeltaPair[paramPos]) + ", ";
+	}
+	deltaPairs.erase(deltaPairs.end() - 2, deltaPairs.end()); // remove last ", "
+	deltaPairs += "};";
+	file->PrintfLine("%s", deltaPairs.c_str());
+
+	const char * varOpId = varOp->GetIdentifier()->c_str();
+
+	GenerateOpIndexLoop(file, opVec->Space());
+
+	uint32_t vecIndexOffset = 0;
+	if(lNodeIsKron)
+	{
+		vecIndexOffset = kronVec->Space()->Factors()->size();
+	}
+
+	std::string vecIndexTuple = "const uint32_t vecIndexTuple[] = {";
+	for(uint32_t lDim = 0; lDim < vec->Space()->Factors()->size(); lDim++)
+	{
+		vecIndexTuple += "opIndexTuple[";
+		vecIndexTuple += std::to_string(lDim + vecIndexOffset);
+		vecIndexTuple += "], ";
+	}
+
+	vecIndexTuple.erase(vecIndexTuple.end() - 2, vecIndexTuple.end()); // remove last ", "
+	vecIndexTuple += "};";
+	file->PrintfLine(vecIndexTuple.c_str());
+
+	uint32_t kronIndexOffset = vec->Space()->Factors()->size();
+	if(lNodeIsKron)
+	{
+		kronIndexOffset = 0;
+	}
+
+	std::string kronIndexTuple = "const uint32_t kronIndexTuple[] = {";
+	for(uint32_t rDim = 0; rDim < kronVec->Space()->Factors()->size(); rDim++)
+	{
+		kronIndexTuple += "opIndexTuple[";
+		kronIndexTuple += std::to_string(rDim + kronIndexOffset);
+		kronIndexTuple += "], ";
+	}
+
+	kronIndexTuple.erase(kronIndexTuple.end() - 2, kronIndexTuple.end()); // remove last ", "
+	kronIndexTuple += "};";
+	file->PrintfLine(kronIndexTuple.c_str());
+
+	std::string product = varOpId;
+	product += "[opIndex] =";
+
+	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	{
+		if(kroneckerParam->DeltaPair[paramPos] > paramPos) // Remember, we save the partner for every factor, but only half the information is needed
+		{
+			product += " (kronIndexTuple[" + std::to_string(paramPos) + "] ==";
+			product += " kronIndexTuple[deltaPairs[" + std::to_string(paramPos) + "]]) *";
+		}
+	}
+	product += " " + std::to_string(kroneckerParam->Scaling) + "f";
+
+	if(divide)
+	{
+		product += " / ";
+	}
+	else
+	{
+		product += " * ";
+	}
+
+	product += *(varVec->GetIdentifier());
+	appendArrayPosition(&product, vec->Space(), std::string{"vecIndexTuple"});
+	product += ";";
+
+	file->PrintfLine(product.c_str());
+
+	GenerateOpIndexLoopEnd(file, opVec->Space());
+
+	return true;
+}
+
+bool CodeGenerator::VectorVectorProductCode(const Node* node, FileWriter * file, bool divide)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	auto nodes = graph_->GetNodes();
 
-	sum += " *";
+	const auto lnode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == lnode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(0));
+		return false;
+	}
 
-	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	const auto rnode = nodes->find(node->Parents()->at(1));
+	if(nodes->end() == rnode)
 	{
-		if(kroneckerParam->DeltaPair[paramPos] > paramPos) // Remember, we save the partner for every factor, but only half the information is needed
-		{
-			sum += " (kronIndexTuple[" + std::to_string(paramPos) + "] ==";
-			sum += " kronIndexTuple[deltaPairs[" + std::to_string(paramPos) + "]]) *";
-		}
+		Error("Could not find Node for id %u\n", node->Parents()->at(1));
+		return false;
 	}
-	sum += " " + std::to_string(kroneckerParam->Scaling) + "f;";
 
-	file->PrintfLine(sum.c_str());
+	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lnode->second.GetType()) ||
+			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rnode->second.GetType()))
+	{
+		return VectorVectorProductKroneckerDeltaCode(node, file, divide);
+	}
 
-	for(uint32_t factorIndex = 0; factorIndex < contractValue->lfactors.size(); factorIndex++)
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varLVec, node->Parents()->at(0));
+	getVarRetFalseOnError(varRVec, node->Parents()->at(1));
+
+	const Algebra::Module::VectorSpace::Vector* lVec = (const Algebra::Module::VectorSpace::Vector*) lnode->second.GetObjectPt();
+	const Algebra::Module::VectorSpace::Vector* rVec = (const Algebra::Module::VectorSpace::Vector*) rnode->second.GetObjectPt();
+
+	const Algebra::Module::VectorSpace::Vector* opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+
+	const char * varOpId = varOp->GetIdentifier()->c_str();
+
+	GenerateOpIndexLoop(file, opVec->Space());
+
+	std::string lIndexTuple = "const uint32_t lIndexTuple[] = {";
+	for(uint32_t lDim = 0; lDim < lVec->Space()->Factors()->size(); lDim++)
 	{
-		file->Outdent();
-		file->PrintfLine("}");
+		lIndexTuple += "opIndexTuple[";
+		lIndexTuple += std::to_string(lDim);
+		lIndexTuple += "], ";
 	}
 
-	file->PrintfLine("");
+	lIndexTuple.erase(lIndexTuple.end() - 2, lIndexTuple.end()); // remove last ", "
+	lIndexTuple += "};";
+	file->PrintfLine(lIndexTuple.c_str());
 
-	if(resultIsArray)
+	std::string rIndexTuple = "const uint32_t rIndexTuple[] = {";
+	for(uint32_t rDim = 0; rDim < rVec->Space()->Factors()->size(); rDim++)
 	{
-		file->PrintfLine("%s[opIndex] = sum;",
-				varOpId);
+		rIndexTuple += "opIndexTuple[";
+		rIndexTuple += std::to_string(rDim + lVec->Space()->Factors()->size());
+		rIndexTuple += "], ";
+	}
 
-		file->Outdent();
-		file->PrintfLine("}");
+	rIndexTuple.erase(rIndexTuple.end() - 2, rIndexTuple.end()); // remove last ", "
+	rIndexTuple += "};";
+	file->PrintfLine(rIndexTuple.c_str());
+
+	std::string product = varOpId;
+	product += "[opIndex] = ";
+	product += *(varLVec->GetIdentifier());
+	appendArrayPosition(&product, lVec->Space(), std::string{"lIndexTuple"});
+
+	if(divide)
+	{
+		product += " / ";
 	}
 	else
 	{
-		file->PrintfLine("%s = sum;", varOpId);
+		product += " * ";
 	}
 
+	product += *(varRVec->GetIdentifier());
+	appendArrayPosition(&product, rVec->Space(), std::string{"rIndexTuple"});
+	product += ";";
+
+	file->PrintfLine(product.c_str());
+
+	GenerateOpIndexLoopEnd(file, opVec->Space());
+
 	return true;
 }
 
-bool CodeGenerator::VectorPermutationCode(const Node* node, FileWriter * file)
+bool CodeGenerator::VectorIndexSplitSumCode(const Node* node, FileWriter * file)
 {
 	file->PrintfLine("// %s\n", __func__);
 
-	const Node::permuteParameters_t * permuteParam = (const Node::permuteParameters_t *) node->TypeParameters();
+	// TODO: This is horribly wasteful! The beauty of using code generation is that
+	// we know this is just a different way of addressing indices, so we could continue using
+	// the old vector but just generate code which accesses the indices in the correct manner!
+
+	auto nodes = graph_->GetNodes();
+
+	const Node::splitSumIndicesParameters_t * param = (Node::splitSumIndicesParameters_t *) node->TypeParameters();
+
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varArg, node->Parents()->at(0));
+
+	const auto argNode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == argNode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(0));
+		return false;
+	}
+
+	const Algebra::Module::VectorSpace::Vector* vecArg = (const Algebra::Module::VectorSpace::Vector*) argNode->second.GetObjectPt();
+	const Algebra::Module::VectorSpace::Vector* vecOp = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+
+	GenerateOpIndexLoop(file, vecOp->Space());
+
+	std::string argIndexTuple = "const uint32_t argIndexTuple[] = {";
+
+	uint32_t opIndexPos = 0;
+	for(size_t factor = 0; factor < param->SplitPosition.size(); factor++)
+	{
+		argIndexTuple += "opIndexTuple[" + std::to_string(opIndexPos) + "]";
+
+		if(param->SplitPosition[factor])
+		{
+			opIndexPos++;
+			argIndexTuple += " + opIndexTuple[" + std::to_string(opIndexPos) + "]";
+		}
+
+		argIndexTuple += ", ";
+	}
+	argIndexTuple.erase(argIndexTuple.end() - 2, argIndexTuple.end()); // remove last ", "
+	argIndexTuple += "};\n";
+
+	file->PrintfLine("%s", argIndexTuple.c_str());
+
+	std::string equationStr = *varOp->GetIdentifier() + "[opIndex] = ";
+	equationStr += *varArg->GetIdentifier();
+	appendArrayPosition(&equationStr, vecArg->Space(), std::string{"argIndexTuple"});
+	equationStr += ";";
+
+	file->PrintfLine(equationStr.c_str());
+
+	GenerateOpIndexLoopEnd(file, vecOp->Space());
+
+	return true;
+}
+
+bool CodeGenerator::VectorJoinIndicesCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
 
 	auto nodes = graph_->GetNodes();
+
+	const Node::joinIndicesParameters_t * param = (Node::joinIndicesParameters_t *) node->TypeParameters();
+
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varArg, node->Parents()->at(0));
+
 	const auto argNode = nodes->find(node->Parents()->at(0));
 	if(nodes->end() == argNode)
 	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(0));
-		return false;
+		Error("Could not find Node for id %u\n", node->Parents()->at(0));
+		return false;
+	}
+
+	const Algebra::Module::VectorSpace::Vector* vecArg = (const Algebra::Module::VectorSpace::Vector*) argNode->second.GetObjectPt();
+	const Algebra::Module::VectorSpace::Vector* vecOp = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+
+	GenerateOpIndexLoop(file, vecOp->Space());
+
+	std::vector<uint32_t> opIndexPos(param->Indices.size(), UINT32_MAX);
+	std::string argIndexTuple = "const uint32_t argIndexTuple[] = {";
+	for(uint32_t dim = 0; dim < vecArg->Space()->Factors()->size(); dim++)
+	{
+		argIndexTuple += "opIndexTuple[";
+
+		// Is the factor joined?
+		size_t joinedIndices;
+		for(joinedIndices = 0; joinedIndices < param->Indices.size(); joinedIndices++)
+		{
+			auto it = std::find(param->Indices[joinedIndices].begin(), param->Indices[joinedIndices].end(), dim);
+
+			if(param->Indices[joinedIndices].end() != it) // Index is joined
+			{
+				if(param->Indices[joinedIndices].begin() == it) // Set op position of this index
+				{
+					opIndexPos[joinedIndices] = dim;
+				}
+
+				break; // Found index, no need to search further.
+			}
+		}
+
+		if(param->Indices.size() <= joinedIndices) // index not joined
+		{
+			argIndexTuple += std::to_string(dim);
+		}
+		else
+		{
+			argIndexTuple += std::to_string(opIndexPos[joinedIndices]);
+		}
+
+		argIndexTuple += "], ";
+	}
+
+	argIndexTuple.erase(argIndexTuple.end() - 2, argIndexTuple.end()); // remove last ", "
+	argIndexTuple += "};\n";
+	file->PrintfLine(argIndexTuple.c_str());
+
+	std::string equationStr = *varOp->GetIdentifier() + "[opIndex] = ";
+	equationStr += *varArg->GetIdentifier();
+	appendArrayPosition(&equationStr, vecArg->Space(), std::string{"argIndexTuple"});
+	equationStr += ";";
+
+	file->PrintfLine(equationStr.c_str());
+
+	GenerateOpIndexLoopEnd(file, vecOp->Space());
+
+	return true;
+}
+
+bool CodeGenerator::VectorMaxPoolCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
+
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varIn, node->Parents()->at(0));
+
+	const Node::PoolParameters_t * param = (const Node::PoolParameters_t *) node->TypeParameters();
+
+	const char * varOpId = varOp->GetIdentifier()->c_str();
+	const char * varInId = varIn->GetIdentifier()->c_str();
+
+	auto nodes = graph_->GetNodes();
+	const auto inNode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == inNode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(0));
+		return false;
+	}
+
+	auto inVec = (const Algebra::Module::VectorSpace::Vector*) inNode->second.GetObjectPt();
+	auto opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+
+	const char maxFunctions[][6] =
+	{
+			"fmaxf",
+	};
+
+	const char* maxFctString = nullptr;
+	switch(varIn->GetType())
+	{
+	case Variable::Type::uint8_: // no break intended
+	case Variable::Type::int8_: // no break intended
+	case Variable::Type::int32_: // no break intended
+		// TODO: Implement https://graphics.stanford.edu/~seander/bithacks.html#IntegerMinOrMax
+		return false; // TODO: #define something like #define max(m,n) ((m) > (n) ? (m) : (n))
+
+	case Variable::Type::float_:
+		maxFctString = maxFunctions[0];
+		break;
+
+	default: // no break intended
+	case Variable::Type::none: // no break intended
+	case Variable::Type::nrOf:
+		Error("Reached default case!\n");
+		return false;
+	}
+
+	// Get strides
+	std::vector<uint32_t> InStrides;
+	inVec->Space()->GetStrides(&InStrides);
+	const char inStridesId[] = "InStrides";
+	file->PrintfLine("const uint32_t %s[] = {", inStridesId);
+	for(const uint32_t &stride: InStrides)
+	{
+		file->PrintfLine("\t %u,", stride);
 	}
+	file->PrintfLine("};");
 
-	const Algebra::Module::VectorSpace::Vector* vec = (const Algebra::Module::VectorSpace::Vector*) argNode->second.GetObjectPt();
-
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varArg, node->Parents()->at(0));
-
-	const char * varOpId = varOp->GetIdentifier()->c_str();
-	const char * varArgId = varArg->GetIdentifier()->c_str();
+	// Generate all possible tuples
+	std::vector<std::pair<uint32_t, uint32_t>> ranges;
+	ranges.resize(inVec->Space()->Factors()->size());
 
-	file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-			varOpId, varOpId);
-	file->PrintfLine("{");
-	file->Indent();
+	for(size_t range = 0; range < ranges.size(); range++)
+	{
+		ranges[range].first = 0;
+		ranges[range].second = param->PoolSize[range];
+	}
 
-	std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-	appendIndexTuple(&opIndexTuple, vec->Space(), std::string{"opIndex"});
-	opIndexTuple += ";";
+	std::vector<std::vector<uint32_t>> tuples;
+	getAllTuples(tuples, ranges);
 
-	file->PrintfLine("%s", opIndexTuple.c_str());
+	// Loop over all result elements
+	GenerateOpIndexLoop(file, opVec->Space());
 
-	std::string argIndexTuple = "const uint32_t argIndexTuple[] = {";
+	std::string inPoolOrigin = "const uint32_t inPoolOrigin[] = {";
 
-	for(size_t argIndex = 0; argIndex < permuteParam->indices.size(); argIndex++)
+	for(size_t factor = 0; factor < opVec->Space()->Factors()->size(); factor++)
 	{
-		argIndexTuple += "opIndexTuple[" + std::to_string(permuteParam->indices[argIndex]) + "], ";
+		inPoolOrigin += "opIndexTuple[" + std::to_string(factor) + "] ";
+		inPoolOrigin += "* " + std::to_string(param->PoolSize[factor]) + ", ";
 	}
 
-	argIndexTuple.erase(argIndexTuple.end() - 2, argIndexTuple.end()); // remove last ", "
-	argIndexTuple += "};\n";
+	inPoolOrigin.erase(inPoolOrigin.end() - 2, inPoolOrigin.end()); // remove last ", "
+	inPoolOrigin += "};\n";
 
-	file->PrintfLine("%s", argIndexTuple.c_str());
+	file->PrintfLine("%s", inPoolOrigin.c_str());
 
-	std::string opValue = varOpId;
-	opValue += "[opIndex]";
-	opValue += " = ";
-	opValue += varArgId;
-	appendArrayPosition(&opValue, vec->Space(), std::string{"argIndexTuple"});
-	opValue += ";";
+	if(NeedsArgmax(node))
+	{
+		// Compare one by one to keep track of the maximum's position
+		file->PrintfLine("%s max = -INFINITY;", varIn->GetTypeString());
+		file->PrintfLine("uint32_t argmax = 0;");
 
-	file->PrintfLine("%s", opValue.c_str());
+		for(size_t tuple = 0; tuple < tuples.size(); tuple++)
+		{
+			std::string inIndex = "inIndex = ";
+			for(size_t factor = 0; factor < inVec->Space()->Factors()->size(); factor++)
+			{
+				inIndex += "(inPoolOrigin[" + std::to_string(factor) + "] + " + std::to_string(tuples[tuple][factor]) + ")";
+				inIndex += " * InStrides[" + std::to_string(factor) + "] + ";
+			}
+			inIndex.erase(inIndex.end() - 3, inIndex.end()); // remove last " + "
+			inIndex += ";";
 
-	file->Outdent();
-	file->PrintfLine("}");
+			file->PrintfLine("%s%s", (0 == tuple) ? "uint32_t " : "", inIndex.c_str());
+			file->PrintfLine("if(max < %s[inIndex])", varInId);
+			file->PrintfLine("{");
+			file->Indent();
+			file->PrintfLine("max = %s[inIndex];", varInId);
+			file->PrintfLine("argmax = inIndex;");
+			file->Outdent();
+			file->PrintfLine("}");
+		}
 
-	return true;
-}
+		file->PrintfLine("");
+		file->PrintfLine("%s[opIndex] = max;", varOpId);
+		file->PrintfLine("Node%uArgmax[opIndex] = argmax;", node->id);
 
-bool CodeGenerator::VectorContractionCode(const Node* node, FileWriter * file)
-{
-	file->PrintfLine("// %s\n", __func__);
+		GenerateOpIndexLoopEnd(file, opVec->Space());
 
-	auto nodes = graph_->GetNodes();
-	const auto lnode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == lnode)
-	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(0));
-		return false;
+		return true;
 	}
 
-	const auto rnode = nodes->find(node->Parents()->at(1));
-	if(nodes->end() == rnode)
-	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(1));
-		return false;
-	}
+	file->PrintfLine("%s[opIndex] =", varOpId);
+	file->Indent();
 
-	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lnode->second.GetType()) ||
-			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rnode->second.GetType()))
+	for(size_t tuple = 0; tuple < tuples.size(); tuple++)
 	{
-		return VectorContractionKroneckerDeltaCode(node, file);
-	}
-
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varLVec, node->Parents()->at(0));
-	getVarRetFalseOnError(varRVec, node->Parents()->at(1));
-
-	const Algebra::Module::VectorSpace::Vector* lVec = (const Algebra::Module::VectorSpace::Vector*) lnode->second.GetObjectPt();
-	const Algebra::Module::VectorSpace::Vector* rVec = (const Algebra::Module::VectorSpace::Vector*) rnode->second.GetObjectPt();
-
-	const Algebra::Module::VectorSpace::Vector* opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
-	const Node::contractParameters_t * contractValue = (Node::contractParameters_t *) node->TypeParameters();
+		std::string value;
 
-	const char * varOpId = varOp->GetIdentifier()->c_str();
+		if(tuple != tuples.size() - 1)
+		{
+			value +=  maxFctString;
+			value += "(";
+		}
 
-	bool resultIsArray = (1 < varOp->Length());
+		value += varInId;
+		value += "[";
 
-	if(resultIsArray)
-	{
-		file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-				varOpId, varOpId);
-		file->PrintfLine("{");
-		file->Indent();
+		for(size_t factor = 0; factor < inVec->Space()->Factors()->size(); factor++)
+		{
+			if(tuples[tuple][factor])
+			{
+				value += "(";
+			}
 
-		std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-		appendIndexTuple(&opIndexTuple, opVec->Space(), std::string{"opIndex"});
-		opIndexTuple += ";";
+			value += "inPoolOrigin[" + std::to_string(factor) + "]";
 
-		file->PrintfLine("%s", opIndexTuple.c_str());
-	}
+			if(tuples[tuple][factor])
+			{
+				value += " + " + std::to_string(tuples[tuple][factor]) + ")";
+			}
 
-	file->PrintfLine("%s sum = 0;", varOp->GetTypeString());
-	for(uint32_t factorIndex = 0; factorIndex < contractValue->lfactors.size(); factorIndex++)
-	{
-		file->PrintfLine("for(int dim%u = 0; dim%u < %u; dim%u++)",
-				factorIndex, factorIndex,
-				lVec->Space()->Factors()->at(contractValue->lfactors[factorIndex]).Dim,
-				factorIndex);
-		file->PrintfLine("{");
-		file->Indent();
-	}
+			value += " * InStrides[" + std::to_string(factor) + "] + ";
+		}
+		value.erase(value.end() - 3, value.end()); // remove last " + "
 
-	uint32_t opIndex = 0;
-	std::string lIndexTuple = "const uint32_t lIndexTuple[] = {";
-	for(uint32_t lDim = 0; lDim < lVec->Space()->Factors()->size(); lDim++)
-	{
-		auto it = std::find(
-				contractValue->lfactors.begin(),
-				contractValue->lfactors.end(),
-				lDim);
+		value += "]";
 
-		if(it == contractValue->lfactors.end())
+		if(tuple != tuples.size() - 1)
 		{
-			lIndexTuple += "opIndexTuple[";
-			lIndexTuple += std::to_string(opIndex);
-			lIndexTuple += "], ";
-			opIndex++;
+			value += ", ";
 		}
 		else
 		{
-			lIndexTuple += "dim" + std::to_string(std::distance(contractValue->lfactors.begin(), it));
-			lIndexTuple += ", ";
+			for(size_t tuple = 0; tuple < tuples.size() - 1; tuple++)
+			{
+				value += ")";
+			}
+			value += ";";
 		}
+
+		file->PrintfLine("%s", value.c_str());
 	}
 
-	lIndexTuple.erase(lIndexTuple.end() - 2, lIndexTuple.end()); // remove last ", "
-	lIndexTuple += "};";
-	file->PrintfLine(lIndexTuple.c_str());
+	file->Outdent();
 
-	std::string rIndexTuple = "const uint32_t rIndexTuple[] = {";
-	for(uint32_t rDim = 0; rDim < rVec->Space()->Factors()->size(); rDim++)
+	GenerateOpIndexLoopEnd(file, opVec->Space());
+
+	return true;
+}
+
+bool CodeGenerator::NeedsArgmax(const Node * node) const
+{
+	if(Node::Type::VECTOR_MAX_POOL != node->GetType())
 	{
-		auto it = std::find(
-				contractValue->rfactors.begin(),
-				contractValue->rfactors.end(),
-				rDim);
+		return false;
+	}
 
-		if(it == contractValue->rfactors.end())
-		{
-			rIndexTuple += "opIndexTuple[";
-			rIndexTuple += std::to_string(opIndex);
-			rIndexTuple += "], ";
-			opIndex++;
-		}
-		else
+	for(const Node::Id_t &child: *node->Children())
+	{
+		if(Node::Type::VECTOR_MAX_POOL_DERIVATIVE == graph_->GetNode(child)->GetType())
 		{
-			rIndexTuple += "dim" + std::to_string(std::distance(contractValue->rfactors.begin(), it));
-			rIndexTuple += ", ";
+			return true;
 		}
 	}
 
-	rIndexTuple.erase(rIndexTuple.end() - 2, rIndexTuple.end()); // remove last ", "
-	rIndexTuple += "};";
-	file->PrintfLine(rIndexTuple.c_str());
+	return false;
+}
 
-	std::string sum = "sum += ";
-	sum += *(varLVec->GetIdentifier());
-	appendArrayPosition(&sum, lVec->Space(), std::string{"lIndexTuple"});
-	sum += " * ";
+bool CodeGenerator::VectorMaxPoolDerivativeCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
 
-	sum += *(varRVec->GetIdentifier());
-	appendArrayPosition(&sum, rVec->Space(), std::string{"rIndexTuple"});
-	sum += ";";
+	getVarRetFalseOnError(varOp, node->id);
 
-	file->PrintfLine(sum.c_str());
+	const Node::Id_t maxPoolId = node->Parents()->at(0);
+	const size_t maxPoolLength = GetNodeLength(maxPoolId);
 
-	for(uint32_t factorIndex = 0; factorIndex < contractValue->lfactors.size(); factorIndex++)
+	// Derivative_ij = dMaxPool(j) / dIn(i), j being the fast index: One in row argmax(j) of column j
+	file->PrintfLine("for(size_t index = 0; index < %lu; index++)", varOp->Length());
+	file->PrintfLine("{");
+	file->Indent();
+	file->PrintfLine("%s[index] = 0;", varOp->GetIdentifier()->c_str());
+	file->Outdent();
+	file->PrintfLine("}\n");
+
+	file->PrintfLine("for(size_t poolIndex = 0; poolIndex < %lu; poolIndex++)", maxPoolLength);
+	file->PrintfLine("{");
+	file->Indent();
+	file->PrintfLine("%s[Node%uArgmax[poolIndex] * %lu + poolIndex] = 1;", varOp->GetIdentifier()->c_str(), maxPoolId, maxPoolLength);
+	file->Outdent();
+	file->PrintfLine("}");
+
+	return true;
+}
+
+const float * CodeGenerator::GetConstantKernel(const Node * node) const
+{
+	const Node * kernelNode = graph_->GetNode(node->Parents()->at(1));
+	if(IsFolded(kernelNode->id))
 	{
-		file->Outdent();
-		file->PrintfLine("}");
+		return GetConstantValue(kernelNode->id);
 	}
 
-	file->PrintfLine("");
-
-	if(resultIsArray)
+	if((Node::Type::VECTOR != kernelNode->GetType()) || kernelNode->UsedAsStorageByOthers())
 	{
-		file->PrintfLine("%s[opIndex] = sum;",
-				varOpId);
+		return nullptr;
+	}
 
-		file->Outdent();
-		file->PrintfLine("}");
+	const auto varIt = variables_.find(kernelNode->id);
+	if((variables_.end() == varIt) ||
+			!varIt->second.HasProperty(Variable::PROPERTY_CONST) ||
+			(Variable::Type::float_ != varIt->second.GetType()))
+	{
+		return nullptr;
 	}
-	else
+
+	auto kernelVec = (const Algebra::Module::VectorSpace::Vector *) kernelNode->GetObjectPt();
+	return (const float *) kernelVec->InitValue();
+}
+
+size_t CodeGenerator::GetCrossCorrelationTapsNrOf(const Node * node) const
+{
+	const size_t kernelLength = GetNodeLength(node->Parents()->at(1));
+
+	const float * kernelValues = GetConstantKernel(node);
+	if(nullptr == kernelValues)
 	{
-		file->PrintfLine("%s = sum;", varOpId);
+		return kernelLength;
 	}
 
-	return true;
+	return kernelLength - std::count(kernelValues, kernelValues + kernelLength, 0.f);
 }
 
-bool CodeGenerator::VectorComparisonIsSmallerCode(const Node* node, FileWriter * file)
+bool CodeGenerator::VectorCrossCorrelationCode(const Node* node, FileWriter * file)
 {
 	file->PrintfLine("// %s\n", __func__);
 
-	// TODO: Create extra Norm-Nodes for this.
 	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varLVec, node->Parents()->at(0));
-	getVarRetFalseOnError(varRVec, node->Parents()->at(1));
+	getVarRetFalseOnError(varIn, node->Parents()->at(0));
+	getVarRetFalseOnError(varKernel, node->Parents()->at(1));
 
-	std::string lNormId;
-	lNormId += *(varLVec->GetIdentifier());
-	lNormId += "Norm";
-	lNormId += std::to_string(varLVec->GetNewRunningNumber());
-	file->PrintfLine("%s %s = 0;",
-			varLVec->GetTypeString(),
-			lNormId.c_str());
+	const char * varOpId = varOp->GetIdentifier()->c_str();
+	const char * varInId = varIn->GetIdentifier()->c_str();
+	const char * varKernelId = varKernel->GetIdentifier()->c_str();
 
-	std::string rNormId;
-	rNormId += *(varRVec->GetIdentifier());
-	rNormId += "Norm";
-	rNormId += std::to_string(varRVec->GetNewRunningNumber());
-	file->PrintfLine("%s %s = 0;",
-			varRVec->GetTypeString(),
-			rNormId.c_str());
+	auto nodes = graph_->GetNodes();
+	const auto inNode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == inNode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(0));
+		return false;
+	}
 
-	std::string lArrayElem;
-	varLVec->GetElement(&lArrayElem, "dim");
+	const auto kernelNode = nodes->find(node->Parents()->at(1));
+	if(nodes->end() == kernelNode)
+	{
+		Error("Could not find Node for id %u\n", node->Parents()->at(1));
+		return false;
+	}
 
-	file->PrintfLine("for(uint32_t dim = 0; dim < %u; dim++)",
-			varLVec->Length());
-	file->PrintfLine("{");
-	file->PrintfLine("\t %s += %s * %s;",
-			lNormId.c_str(),
-			lArrayElem.c_str(), lArrayElem.c_str());
-	file->PrintfLine("}\n");
+	auto inVec = (const Algebra::Module::VectorSpace::Vector*) inNode->second.GetObjectPt();
+	auto KernelVec = (const Algebra::Module::VectorSpace::Vector*) kernelNode->second.GetObjectPt();
+	auto opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
 
-	std::string rArrayElem;
-	varRVec->GetElement(&rArrayElem, "dim");
+	// Kernels with more taps are looped over instead of unrolled
+	static const size_t CROSS_CORRELATION_UNROLL_MAX = 27; // E.g. 3 x 3 x 3
 
-	file->PrintfLine("for(uint32_t dim = 0; dim < %u; dim++)",
-			varRVec->Length());
-	file->PrintfLine("{");
-	file->PrintfLine("\t %s += %s * %s;",
-			rNormId.c_str(),
-			rArrayElem.c_str(), rArrayElem.c_str());
-	file->PrintfLine("}\n");
+	const float * kernelValues = GetConstantKernel(node);
+	if(CROSS_CORRELATION_UNROLL_MAX < GetCrossCorrelationTapsNrOf(node))
+	{
+		return CrossCorrelationLoopCode(node, file);
+	}
 
-	retFalseOnFalse(GenerateLocalVariableDeclaration(varOp), "Could not generate Var. Decl.\n");
+	// Get strides
+	std::vector<uint32_t> InStrides;
+	inVec->Space()->GetStrides(&InStrides);
+	const char inStridesId[] = "InStrides";
+	file->PrintfLine("const uint32_t %s[] = {", inStridesId);
+	for(const uint32_t &stride: InStrides)
+	{
+		file->PrintfLine("\t %u,", stride);
+	}
+	file->PrintfLine("};");
 
-	file->PrintfLine("if(%s < %s)",
-			lNormId.c_str(), rNormId.c_str());
-	file->PrintfLine("{");
-	file->PrintfLine("\t %s = 1;",
-			varOp->GetIdentifier()->c_str());
-	file->PrintfLine("}");
-	file->PrintfLine("else");
-	file->PrintfLine("{");
-	file->PrintfLine("\t %s = 0;",
-			varOp->GetIdentifier()->c_str());
-	file->PrintfLine("}\n");
+	std::vector<uint32_t> KernelStrides;
+	KernelVec->Space()->GetStrides(&KernelStrides);
 
-	return true;
-}
+	// Generate all possible tuples
+	std::vector<std::pair<uint32_t, uint32_t>> ranges;
+	ranges.resize(KernelVec->Space()->Factors()->size());
 
-bool CodeGenerator::GetRootAncestorInstructionPositions(std::set<uint32_t> * instructionPos, Node::Id_t child)
-{
-	// Get root ancestors. Those won't be instructions
-	std::set<Node::Id_t> rootAncestors;
-	bool success = graph_->GetRootAncestors(&rootAncestors, child);
-	if(!success)
+	for(size_t range = 0; range < ranges.size(); range++)
 	{
-		Error("Could not get root ancestors!\n");
-		return false;
+		ranges[range].first = 0;
+		ranges[range].second = KernelVec->Space()->Factors()->at(range).Dim;
 	}
 
-	// Get all of rootAncestor's children
-	std::set<Node::Id_t> rootAncesorChildren;
-	for(const Node::Id_t &rootId: rootAncestors)
+	std::vector<std::vector<uint32_t>> tuples;
+	getAllTuples(tuples, ranges);
+
+	// Loop over all result elements
+	GenerateOpIndexLoop(file, opVec->Space());
+
+	file->PrintfLine("%s[opIndex] =", varOpId);
+	file->Indent();
+
+	// Constant kernels are folded into the expression: Zero taps vanish, unit taps need no multiplication.
+	std::vector<std::string> terms;
+	for(size_t tuple = 0; tuple < tuples.size(); tuple++)
 	{
-		const Node * rootNode = graph_->GetNode(rootId);
+		size_t kernelIndex = 0;
+		std::string inElem = varInId;
+		inElem += "[";
+		for(size_t index = 0; index < tuples[tuple].size(); index++)
+		{
+			kernelIndex += tuples[tuple][index] * KernelStrides[index];
 
-		for(const Node::Id_t &rootChildId: *rootNode->Children())
+			if(tuples[tuple][index])
+			{
+				inElem += "(";
+			}
+
+			inElem += "opIndexTuple[" + std::to_string(index) + "]";
+
+			if(tuples[tuple][index])
+			{
+				inElem += " + " + std::to_string(tuples[tuple][index]) + ")";
+			}
+
+			inElem += " * InStrides[" + std::to_string(index) + "] + ";
+		}
+		inElem.erase(inElem.end() - 3, inElem.end()); // remove last " + "
+		inElem += "]";
+
+		if(nullptr == kernelValues)
 		{
-			rootAncesorChildren.insert(rootChildId);
+			terms.push_back("+ " + inElem + " * " + varKernelId + "[" + std::to_string(kernelIndex) + "]");
+		}
+		else if(1.f == kernelValues[kernelIndex])
+		{
+			terms.push_back("+ " + inElem);
+		}
+		else if(-1.f == kernelValues[kernelIndex])
+		{
+			terms.push_back("- " + inElem);
+		}
+		else if(0.f != kernelValues[kernelIndex])
+		{
+			char tmpBuff[64];
+			SNPRINTF(tmpBuff, sizeof(tmpBuff), "%.*ef", FLT_DECIMAL_DIG, (double) kernelValues[kernelIndex]);
+			terms.push_back("+ " + inElem + " * " + tmpBuff);
 		}
 	}
 
-	// Get all children who do not depend on non-root parents
-	std::set<Node::Id_t> rootChildren;
-	for(const Node::Id_t &childId: rootAncesorChildren)
+	if(terms.empty())
 	{
-		const Node * rootNode = graph_->GetNode(childId);
+		file->PrintfLine("0;");
+	}
 
-		bool allParentsRoot = true;
-		for(const Node::Id_t &parentId: *rootNode->Parents())
+	for(size_t term = 0; term < terms.size(); term++)
+	{
+		std::string line = terms[term];
+		if(0 == term)
 		{
-			if(rootAncestors.end() == rootAncestors.find(parentId))
+			if('+' == line[0])
 			{
-				allParentsRoot = false;
-				break;
+				line.erase(0, 2);
+			}
+			else
+			{
+				line.erase(1, 1); // "-x"
 			}
 		}
 
-		if(allParentsRoot)
+		if(terms.size() - 1 == term)
 		{
-			rootChildren.insert(childId);
+			line += ";";
 		}
+
+		file->PrintfLine("%s", line.c_str());
 	}
 
-	for(const Node::Id_t rootChildId: rootChildren)
-	{
-		const auto &arrayPos = nodeArrayPos_.find(rootChildId);
-		if(nodeArrayPos_.end() == arrayPos)
-		{
-			Error("Couldn't find array position for Node%u\n", rootChildId);
-			return false;
-		}
+	file->Outdent();
 
-		instructionPos->insert(arrayPos->second);
-	}
+	GenerateOpIndexLoopEnd(file, opVec->Space());
 
 	return true;
 }
 
-bool CodeGenerator::ControlTransferWhileCode(const Node* node, FileWriter * file)
+bool CodeGenerator::CrossCorrelationLoopCode(const Node* node, FileWriter * file)
 {
-	file->PrintfLine("// %s\n", __func__);
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varIn, node->Parents()->at(0));
+	getVarRetFalseOnError(varKernel, node->Parents()->at(1));
 
-	getVarRetFalseOnError(varCond, node->Parents()->at(0));
+	auto inVec = (const Algebra::Module::VectorSpace::Vector*) graph_->GetNode(node->Parents()->at(0))->GetObjectPt();
+	auto kernelVec = (const Algebra::Module::VectorSpace::Vector*) graph_->GetNode(node->Parents()->at(1))->GetObjectPt();
+	auto opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
 
-	if(1 != varCond->Length())
-	{
-		Error("Control Transfer condition has more than one dim.!\n");
-		return false;
-	}
+	std::vector<uint32_t> inStrides;
+	inVec->Space()->GetStrides(&inStrides);
 
-	auto whileParam = (const Node::ControlTransferParameters_t*) node->TypeParameters();
+	std::vector<uint32_t> kernelStrides;
+	kernelVec->Space()->GetStrides(&kernelStrides);
 
-	std::set<uint32_t> arrayPosTrue;
-	if(Node::ID_NONE != whileParam->BranchTrue)
-	{
-		bool success = GetRootAncestorInstructionPositions(&arrayPosTrue, whileParam->BranchTrue);
-		if(!success)
-		{
-			Error("Could not get root ancestor instructions!\n");
-			return false;
-		}
-	}
+	const size_t lastDim = kernelStrides.size() - 1;
 
-	std::set<uint32_t> arrayPosFalse;
-	if(Node::ID_NONE != whileParam->BranchFalse)
-	{
-		bool success = GetRootAncestorInstructionPositions(&arrayPosFalse, whileParam->BranchFalse);
-		if(!success)
-		{
-			Error("Could not get root ancestor instructions!\n");
-			return false;
-		}
-	}
+	// Direct cross-correlation: Loop over the kernel, the last dimension is contiguous in input and kernel.
+	GenerateOpIndexLoop(file, opVec->Space());
 
-	// Add the condition to the instruction calculated when true
-	std::set<uint32_t> arrayPosCondition;
-	bool success = GetRootAncestorInstructionPositions(&arrayPosCondition, node->Parents()->at(0));
-	if(!success)
+	file->PrintfLine("%s sum = 0;", varOp->GetTypeString());
+
+	std::string inRow = "const " + std::string(varIn->GetTypeString()) + " * inRow = &" + *varIn->GetIdentifier() + "[";
+	std::string kernelRow = "const " + std::string(varKernel->GetTypeString()) + " * kernelRow = &" + *varKernel->GetIdentifier() + "[";
+	for(size_t dim = 0; dim < lastDim; dim++)
 	{
-		Error("Could not get root ancestor instructions!\n");
-		return false;
-	}
+		file->PrintfLine("for(uint32_t kernel%lu = 0; kernel%lu < %u; kernel%lu++)",
+				dim, dim, kernelVec->Space()->Factors()->at(dim).Dim, dim);
+		file->PrintfLine("{");
+		file->Indent();
 
-	arrayPosTrue.insert(arrayPosCondition.begin(), arrayPosCondition.end());
+		inRow += "(opIndexTuple[" + std::to_string(dim) + "] + kernel" + std::to_string(dim) + ") * " + std::to_string(inStrides[dim]) + " + ";
+		kernelRow += "kernel" + std::to_string(dim) + " * " + std::to_string(kernelStrides[dim]) + " + ";
+	}
 
-	// Print the instructions
-	file->PrintfLine("if(%s)", varCond->GetIdentifier()->c_str());
-	file->PrintfLine("{");
+	inRow += "opIndexTuple[" + std::to_string(lastDim) + "]];";
+	kernelRow += "0];";
 
-	if(arrayPosTrue.size())
-	{
-		for(const uint32_t &pos: arrayPosTrue)
-		{
-			file->PrintfLine("\tPushNode(instance, &nodes%s[%u]);",
-					graph_->Name().c_str(),
-					pos);
-		}
-	}
-	else
-	{
-		file->PrintfLine("; // Do nothing");
-	}
+	file->PrintfLine("%s", inRow.c_str());
+	file->PrintfLine("%s", kernelRow.c_str());
 
-	file->PrintfLine("}");
-	file->PrintfLine("else");
+	file->PrintfLine("for(uint32_t kernel%lu = 0; kernel%lu < %u; kernel%lu++)",
+			lastDim, lastDim, kernelVec->Space()->Factors()->at(lastDim).Dim, lastDim);
 	file->PrintfLine("{");
+	file->Indent();
+	file->PrintfLine("sum += inRow[kernel%lu] * kernelRow[kernel%lu];", lastDim, lastDim);
+	file->Outdent();
+	file->PrintfLine("}");
 
-	if(arrayPosFalse.size())
-	{
-		for(const uint32_t &pos: arrayPosFalse)
-		{
-			file->PrintfLine("\tPushNode(instance, &nodes%s[%u]);",
-					graph_->Name().c_str(),
-					pos);
-		}
-	}
-	else
+	for(size_t dim = 0; dim < lastDim; dim++)
 	{
-		file->PrintfLine("\t; // Do nothing");
+		file->Outdent();
+		file->PrintfLine("}");
 	}
 
-	file->PrintfLine("}");
+	file->PrintfLine("");
+	file->PrintfLine("%s[opIndex] = sum;", varOp->GetIdentifier()->c_str());
+
+	GenerateOpIndexLoopEnd(file, opVec->Space());
 
 	return true;
 }
 
-bool CodeGenerator::VectorScalarProductKroneckerDeltaCode(const Node* node, FileWriter * file, bool divide)
+bool CodeGenerator::VectorProjectionCode(const Node* node, FileWriter * file)
 {
 	file->PrintfLine("// %s\n", __func__);
 
 	auto nodes = graph_->GetNodes();
-	const auto lVecNode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == lVecNode)
+
+	const Node::projectParameters_t * param = (const Node::projectParameters_t *) node->TypeParameters();
+
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(varArg, node->Parents()->at(0));
+
+	const auto argNode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == argNode)
 	{
 		Error("Could not find Node for id %u\n", node->Parents()->at(0));
 		return false;
 	}
 
-	const auto rVecNode = nodes->find(node->Parents()->at(1));
-	if(nodes->end() == rVecNode)
-	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(1));
-		return false;
-	}
+	const Algebra::Module::VectorSpace::Vector* vecArg = (const Algebra::Module::VectorSpace::Vector*) argNode->second.GetObjectPt();
+	const Algebra::Module::VectorSpace::Vector* vecOp = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
 
-	Node::Id_t varScalarNodeId;
-	const Node * kronNode = nullptr;
-	if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lVecNode->second.GetType())
-	{
-		kronNode = &lVecNode->second;
-		varScalarNodeId = node->Parents()->at(1);
-	}
-	else
+	GenerateOpIndexLoop(file, vecOp->Space());
+
+	std::string argIndexTuple = "const uint32_t argIndexTuple[] = {";
+	for(uint32_t dim = 0; dim < vecArg->Space()->Factors()->size(); dim++)
 	{
-		kronNode = &rVecNode->second;
+		argIndexTuple += "opIndexTuple[";
+		argIndexTuple += std::to_string(dim);
+		argIndexTuple += "]";
 
-		if(divide)
+		if(0 != param->range[dim].first)
 		{
-			Error("Can't divide by kronecker (division by zero)!\n");
-			return false;
+			argIndexTuple += " + " + std::to_string(param->range[dim].first);
 		}
 
-		varScalarNodeId = node->Parents()->at(0);
-	}
+		argIndexTuple += ", ";
+	}
+
+	argIndexTuple.erase(argIndexTuple.end() - 2, argIndexTuple.end()); // remove last ", "
+	argIndexTuple += "};\n";
+	file->PrintfLine(argIndexTuple.c_str());
+
+	std::string equationStr = *varOp->GetIdentifier() + "[opIndex] = ";
+	equationStr += *varArg->GetIdentifier();
+	appendArrayPosition(&equationStr, vecArg->Space(), std::string{"argIndexTuple"});
+	equationStr += ";";
+
+	file->PrintfLine(equationStr.c_str());
+
+	GenerateOpIndexLoopEnd(file, vecOp->Space());
+
+	return true;
+}
 
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varScalar, varScalarNodeId);
+bool CodeGenerator::VectorPowerCode(const Node* node, FileWriter * file)
+{
+	file->PrintfLine("// %s\n", __func__);
 
-	const Node::KroneckerDeltaParameters_t * kroneckerParam = (const Node::KroneckerDeltaParameters_t *) kronNode->TypeParameters();
+	getVarRetFalseOnError(varOp, node->id);
+	getVarRetFalseOnError(lVar, node->Parents()->at(0));
+	getVarRetFalseOnError(rVar, node->Parents()->at(1));
 
 	retFalseOnFalse(GenerateLocalVariableDeclaration(varOp), "Could not generate Var. Decl.\n");
 
-	auto opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
-
-	// TODO: This is a giant waste of resources: Every Node should have a "scaling" attached to it, so multiplication needs
-	// to only be performed on that.
+	bool lVarIsScalar = (1 == lVar->Length());
+	bool rVarIsScalar = (1 == rVar->Length());
 
-	std::string deltaPairs = "const uint32_t deltaPairs[] = {";
-	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	if(!rVarIsScalar)
 	{
-		deltaPairs += std::to_string(kroneckerParam->DeltaPair[paramPos]) + ", ";
+		Error("Can't take to non-scalar powers (have length %lu)!\n", rVar->Length());
+		return false;
 	}
-	deltaPairs.erase(deltaPairs.end() - 2, deltaPairs.end()); // remove last ", "
-	deltaPairs += "};";
-	file->PrintfLine("%s", deltaPairs.c_str());
 
-	file->PrintfLine("for(uint32_t opIndex = 0; opIndex < %u; opIndex++)",
-			opVec->Space()->GetDim());
-
-	file->PrintfLine("{");
-	file->Indent();
+	// TODO: If the exponent is a constant, it's probably faster to use sqrt in case of 0.5 and so forth
+	const char powFunctions[][6] =
+	{
+			"powf",
+			"pow",
+			"powl"
+	};
 
-	std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-	appendIndexTuple(&opIndexTuple, opVec->Space(), std::string{"opIndex"});
-	opIndexTuple += ";";
+	const char* powFctString;
+	switch(lVar->GetType())
+	{
+	case Variable::Type::uint8_: // no break intended
+	case Variable::Type::int8_: // no break intended
+	case Variable::Type::int32_: // no break intended
+	case Variable::Type::float_:
+		powFctString = powFunctions[0];
+		break;
 
-	file->PrintfLine("%s", opIndexTuple.c_str());
+	default: // no break intended
+	case Variable::Type::none: // no break intended
+	case Variable::Type::nrOf:
+		Error("Reached default case!\n");
+		return false;
+	}
 
-	std::string Result = *(varOp->GetIdentifier());
-	Result += "[opIndex] =";
-	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	// Constant integer exponents: Multiplications by repeated squaring, which unlike powf vectorize
+	std::string exponentString = *rVar->GetIdentifier();
+	int32_t exponent;
+	if(GetIntegerExponent(&exponent, node))
 	{
-		if(kroneckerParam->DeltaPair[paramPos] > paramPos) // Remember, we save the partner for every factor, but only half the information is needed
-		{
-			Result += " (opIndexTuple[" + std::to_string(paramPos) + "] ==";
-			Result += " opIndexTuple[deltaPairs[" + std::to_string(paramPos) + "]]) *";
-		}
+		powFctString = "__builtin_powif";
+		exponentString = std::to_string(exponent);
 	}
-	Result += " " + std::to_string(kroneckerParam->Scaling) + "f";
 
-	if(divide)
+	if(lVarIsScalar)
 	{
-		Result += " / ";
+		file->PrintfLine("%s = %s(%s, %s);",
+				varOp->GetIdentifier()->c_str(),
+				powFctString,
+				lVar->GetIdentifier()->c_str(),
+				exponentString.c_str());
+
+		return true;
 	}
-	else
+
+	if(IsSimdApplicable(varOp, lVar, rVar))
 	{
-		Result += " * ";
+		// There is no vector pow: Call it per lane in blocks of the vector width, which
+		// -ffast-math maps onto the vector math library.
+		std::string lanes = std::to_string(GetSimdLanesNrOf(varOp));
+		std::string vectorStatement = "for(uint32_t lane = 0; lane < " + lanes + "; lane++) { " +
+				*varOp->GetIdentifier() + "[dim + lane] = " + powFctString + "(" +
+				*lVar->GetIdentifier() + "[dim + lane], " + exponentString + "); }";
+		std::string scalarStatement = *varOp->GetIdentifier() + "[dim] = " + powFctString + "(" +
+				*lVar->GetIdentifier() + "[dim], " + exponentString + ");";
+
+		retFalseOnFalse(GenerateSimdLoop(file, varOp, GetSimdLoopLength(varOp, lVar, rVar), &vectorStatement, &scalarStatement),
+				"Could not generate SIMD loop!\n");
+
+		return true;
 	}
 
-	 Result += *varScalar->GetIdentifier() + ";";;
+	file->PrintfLine("for(size_t opIndex = 0; opIndex < %lu; opIndex++)",
+			varOp->Length());
+	file->PrintfLine("{");
+	file->Indent();
 
-	file->PrintfLine(Result.c_str());
+	file->PrintfLine("%s[%s] = %s(%s[%s], %s);",
+			varOp->GetIdentifier()->c_str(),
+			"opIndex",
+			powFctString,
+			lVar->GetIdentifier()->c_str(),
+			"opIndex",
+			exponentString.c_str());
 
 	file->Outdent();
-	file->PrintfLine("}\n");
+	file->PrintfLine("}");
 
 	return true;
 }
 
-bool CodeGenerator::VectorVectorProductKroneckerDeltaCode(const Node* node, FileWriter * file, bool divide)
+bool CodeGenerator::VectorScalarProductCode(const Node* node, FileWriter * file, bool divide)
 {
 	file->PrintfLine("// %s\n", __func__);
 
 	auto nodes = graph_->GetNodes();
 
-	const auto lnode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == lnode)
+	const auto lVecNode = nodes->find(node->Parents()->at(0));
+	if(nodes->end() == lVecNode)
 	{
 		Error("Could not find Node for id %u\n", node->Parents()->at(0));
 		return false;
 	}
 
-	const auto rnode = nodes->find(node->Parents()->at(1));
-	if(nodes->end() == rnode)
+	const auto rVecNode = nodes->find(node->Parents()->at(1));
+	if(nodes->end() == rVecNode)
 	{
 		Error("Could not find Node for id %u\n", node->Parents()->at(1));
 		return false;
 	}
 
-	bool lNodeIsKron = (Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lnode->second.GetType());
-	bool rNodeIsKron = (Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rnode->second.GetType());
-
-	if(lNodeIsKron && rNodeIsKron)
-	{
-		Error("Product of two KroneckerDeltas not supported: Should be handled in graph creation!\n");
-		return false;
-	}
-
-	if(divide && rNodeIsKron)
-	{
-		Error("Can't divide by Kronecker (division by zero)!\n");
-		return false;
-	}
-
-	Node::Id_t vecNodeId;
-	const Algebra::Module::VectorSpace::Vector* vec;
-	const Algebra::Module::VectorSpace::Vector* kronVec;
-	const Node::KroneckerDeltaParameters_t * kroneckerParam;
-	if(lNodeIsKron)
-	{
-		vecNodeId = node->Parents()->at(1);
-		kronVec = (const Algebra::Module::VectorSpace::Vector*) lnode->second.GetObjectPt();
-		vec = (const Algebra::Module::VectorSpace::Vector*) rnode->second.GetObjectPt();
-		kroneckerParam = (const Node::KroneckerDeltaParameters_t *) lnode->second.TypeParameters();
-	}
-	else
+	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lVecNode->second.GetType()) ||
+			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rVecNode->second.GetType()))
 	{
-		vecNodeId = node->Parents()->at(0);
-		kronVec = (const Algebra::Module::VectorSpace::Vector*) rnode->second.GetObjectPt();
-		vec = (const Algebra::Module::VectorSpace::Vector*) lnode->second.GetObjectPt();
-		kroneckerParam = (const Node::KroneckerDeltaParameters_t *) rnode->second.TypeParameters();
+		return VectorScalarProductKroneckerDeltaCode(node, file, divide);
 	}
 
 	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varVec, vecNodeId);
-
-	const Algebra::Module::VectorSpace::Vector* opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+	getVarRetFalseOnError(lVar, node->Parents()->at(0));
+	getVarRetFalseOnError(rVar, node->Parents()->at(1));
 
-	std::string deltaPairs = "const uint32_t deltaPairs[] = {";
-	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
-	{
-		deltaPairs += std::to_string(kroneckerParam->DeltaPair[paramPos]) + ", ";
-	}
-	deltaPairs.erase(deltaPairs.end() - 2, deltaPairs.end()); // remove last ", "
-	deltaPairs += "};";
-	file->PrintfLine("%s", deltaPairs.c_str());
+	retFalseOnFalse(GenerateLocalVariableDeclaration(varOp), "Could not generate Var. Decl.\n");
 
-	const char * varOpId = varOp->GetIdentifier()->c_str();
+	bool lVarIsScalar = (1 == lVar->Length());
+	bool rVarIsScalar = (1 == rVar->Length());
 
-	file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-			varOpId, varOpId);
-	file->PrintfLine("{");
-	file->Indent();
+	if((!lVarIsScalar || !rVarIsScalar) && IsSimdApplicable(varOp, lVar, rVar))
+	{
+		const char * operation = divide ? " / " : " * ";
 
-	std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-	appendIndexTuple(&opIndexTuple, opVec->Space(), std::string{"opIndex"});
-	opIndexTuple += ";";
+		std::string vectorStatement = GetSimdElement(varOp, true, false) + " = " +
+				GetSimdElement(lVar, true, true) + operation + GetSimdElement(rVar, true, true) + ";";
+		std::string scalarStatement = GetSimdElement(varOp, false, false) + " = " +
+				GetSimdElement(lVar, false, true) + operation + GetSimdElement(rVar, false, true) + ";";
 
-	file->PrintfLine("%s", opIndexTuple.c_str());
+		// Integer division by the padding would trap
+		size_t length = GetSimdLoopLength(varOp, lVar, rVar);
+		if(divide && (Variable::Type::float_ != varOp->GetType()))
+		{
+			length = varOp->Length();
+		}
 
-	uint32_t vecIndexOffset = 0;
-	if(lNodeIsKron)
-	{
-		vecIndexOffset = kronVec->Space()->Factors()->size();
-	}
+		retFalseOnFalse(GenerateSimdLoop(file, varOp, length, &vectorStatement, &scalarStatement),
+				"Could not generate SIMD loop!\n");
 
-	std::string vecIndexTuple = "const uint32_t vecIndexTuple[] = {";
-	for(uint32_t lDim = 0; lDim < vec->Space()->Factors()->size(); lDim++)
-	{
-		vecIndexTuple += "opIndexTuple[";
-		vecIndexTuple += std::to_string(lDim + vecIndexOffset);
-		vecIndexTuple += "], ";
+		return true;
 	}
 
-	vecIndexTuple.erase(vecIndexTuple.end() - 2, vecIndexTuple.end()); // remove last ", "
-	vecIndexTuple += "};";
-	file->PrintfLine(vecIndexTuple.c_str());
-
-	uint32_t kronIndexOffset = vec->Space()->Factors()->size();
-	if(lNodeIsKron)
+	if(!lVarIsScalar || !rVarIsScalar)
 	{
-		kronIndexOffset = 0;
-	}
+		file->PrintfLine("for(uint32_t dim = 0; dim < %lu; dim++)",
+				varOp->Length());
 
-	std::string kronIndexTuple = "const uint32_t kronIndexTuple[] = {";
-	for(uint32_t rDim = 0; rDim < kronVec->Space()->Factors()->size(); rDim++)
-	{
-		kronIndexTuple += "opIndexTuple[";
-		kronIndexTuple += std::to_string(rDim + kronIndexOffset);
-		kronIndexTuple += "], ";
+		file->PrintfLine("{");
+		file->Indent();
 	}
 
-	kronIndexTuple.erase(kronIndexTuple.end() - 2, kronIndexTuple.end()); // remove last ", "
-	kronIndexTuple += "};";
-	file->PrintfLine(kronIndexTuple.c_str());
-
-	std::string product = varOpId;
-	product += "[opIndex] =";
-
-	for(size_t paramPos = 0; paramPos < kroneckerParam->DeltaPair.size(); paramPos++)
+	if(divide)
 	{
-		if(kroneckerParam->DeltaPair[paramPos] > paramPos) // Remember, we save the partner for every factor, but only half the information is needed
+		if(lVarIsScalar && rVarIsScalar)
 		{
-			product += " (kronIndexTuple[" + std::to_string(paramPos) + "] ==";
-			product += " kronIndexTuple[deltaPairs[" + std::to_string(paramPos) + "]]) *";
+			file->PrintfLine("%s = %s / %s;",
+					varOp->GetIdentifier()->c_str(),
+					lVar->GetIdentifier()->c_str(),
+					rVar->GetIdentifier()->c_str());
+		}
+		else if(lVarIsScalar)
+		{
+			file->PrintfLine("%s[dim] = %s / %s[dim];",
+					varOp->GetIdentifier()->c_str(),
+					lVar->GetIdentifier()->c_str(),
+					rVar->GetIdentifier()->c_str());
+		}
+		else
+		{
+			file->PrintfLine("%s[dim] = %s[dim] / %s;",
+					varOp->GetIdentifier()->c_str(),
+					lVar->GetIdentifier()->c_str(),
+					rVar->GetIdentifier()->c_str());
 		}
-	}
-	product += " " + std::to_string(kroneckerParam->Scaling) + "f";
-
-	if(divide)
-	{
-		product += " / ";
 	}
 	else
 	{
-		product += " * ";
+		if(lVarIsScalar && rVarIsScalar)
+		{
+			file->PrintfLine("%s = %s * %s;",
+					varOp->GetIdentifier()->c_str(),
+					lVar->GetIdentifier()->c_str(),
+					rVar->GetIdentifier()->c_str());
+		}
+		else if(lVarIsScalar)
+		{
+			file->PrintfLine("%s[dim] = %s * %s[dim];",
+					varOp->GetIdentifier()->c_str(),
+					lVar->GetIdentifier()->c_str(),
+					rVar->GetIdentifier()->c_str());
+		}
+		else
+		{
+			file->PrintfLine("%s[dim] = %s[dim] * %s;",
+					varOp->GetIdentifier()->c_str(),
+					lVar->GetIdentifier()->c_str(),
+					rVar->GetIdentifier()->c_str());
+		}
 	}
 
-	product += *(varVec->GetIdentifier());
-	appendArrayPosition(&product, vec->Space(), std::string{"vecIndexTuple"});
-	product += ";";
-
-	file->PrintfLine(product.c_str());
-
-	file->PrintfLine("");
-
-	file->Outdent();
-	file->PrintfLine("}");
+	if(!lVarIsScalar || !rVarIsScalar)
+	{
+		file->Outdent();
+		file->PrintfLine("}\n");
+	}
 
 	return true;
 }
 
-bool CodeGenerator::VectorVectorProductCode(const Node* node, FileWriter * file, bool divide)
+bool CodeGenerator::FusedElementWiseCode(const Node* node, FileWriter * file)
 {
 	file->PrintfLine("// %s\n", __func__);
 
-	auto nodes = graph_->GetNodes();
-
-	const auto lnode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == lnode)
-	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(0));
-		return false;
-	}
-
-	const auto rnode = nodes->find(node->Parents()->at(1));
-	if(nodes->end() == rnode)
-	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(1));
-		return false;
-	}
-
-	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lnode->second.GetType()) ||
-			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rnode->second.GetType()))
+	// The contraction's loop computes the element-wise nodes when storing its result
+	const Node * contraction = GetFusedContraction(node);
+	if(nullptr != contraction)
 	{
-		return VectorVectorProductKroneckerDeltaCode(node, file, divide);
+		return VectorContractionCode(contraction, file, node);
 	}
 
 	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varLVec, node->Parents()->at(0));
-	getVarRetFalseOnError(varRVec, node->Parents()->at(1));
-
-	const Algebra::Module::VectorSpace::Vector* lVec = (const Algebra::Module::VectorSpace::Vector*) lnode->second.GetObjectPt();
-	const Algebra::Module::VectorSpace::Vector* rVec = (const Algebra::Module::VectorSpace::Vector*) rnode->second.GetObjectPt();
-
-	const Algebra::Module::VectorSpace::Vector* opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
-
-	const char * varOpId = varOp->GetIdentifier()->c_str();
-
-	file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-			varOpId, varOpId);
-	file->PrintfLine("{");
-	file->Indent();
 
-	std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-	appendIndexTuple(&opIndexTuple, opVec->Space(), std::string{"opIndex"});
-	opIndexTuple += ";";
+	retFalseOnFalse(GenerateLocalVariableDeclaration(varOp), "Could not generate Var. Decl.\n");
 
-	file->PrintfLine("%s", opIndexTuple.c_str());
+	std::string scalarExpression;
+	retFalseOnFalse(GetElementWiseExpression(&scalarExpression, node, false), "Could not get expression of Node%u!\n", node->id);
 
-	std::string lIndexTuple = "const uint32_t lIndexTuple[] = {";
-	for(uint32_t lDim = 0; lDim < lVec->Space()->Factors()->size(); lDim++)
+	if(1 == varOp->Length())
 	{
-		lIndexTuple += "opIndexTuple[";
-		lIndexTuple += std::to_string(lDim);
-		lIndexTuple += "], ";
+		file->PrintfLine("%s = %s;", varOp->GetIdentifier()->c_str(), scalarExpression.c_str());
+		return true;
 	}
 
-	lIndexTuple.erase(lIndexTuple.end() - 2, lIndexTuple.end()); // remove last ", "
-	lIndexTuple += "};";
-	file->PrintfLine(lIndexTuple.c_str());
+	std::string scalarStatement = GetSimdElement(varOp, false, false) + " = " + scalarExpression + ";";
 
-	std::string rIndexTuple = "const uint32_t rIndexTuple[] = {";
-	for(uint32_t rDim = 0; rDim < rVec->Space()->Factors()->size(); rDim++)
+	if(IsFusedSimdApplicable(varOp, node))
 	{
-		rIndexTuple += "opIndexTuple[";
-		rIndexTuple += std::to_string(rDim + lVec->Space()->Factors()->size());
-		rIndexTuple += "], ";
-	}
-
-	rIndexTuple.erase(rIndexTuple.end() - 2, rIndexTuple.end()); // remove last ", "
-	rIndexTuple += "};";
-	file->PrintfLine(rIndexTuple.c_str());
+		std::string vectorExpression;
+		retFalseOnFalse(GetElementWiseExpression(&vectorExpression, node, true), "Could not get expression of Node%u!\n", node->id);
 
-	std::string product = varOpId;
-	product += "[opIndex] = ";
-	product += *(varLVec->GetIdentifier());
-	appendArrayPosition(&product, lVec->Space(), std::string{"lIndexTuple"});
+		std::string vectorStatement = GetSimdElement(varOp, true, false) + " = " + vectorExpression + ";";
 
-	if(divide)
-	{
-		product += " / ";
-	}
-	else
-	{
-		product += " * ";
-	}
+		std::vector<Node::Id_t> operands;
+		GetFusedOperands(&operands, node);
 
-	product += *(varRVec->GetIdentifier());
-	appendArrayPosition(&product, rVec->Space(), std::string{"rIndexTuple"});
-	product += ";";
+		size_t length = varOp->LengthAllocated();
+		for(const Node::Id_t &operand: operands)
+		{
+			getVarRetFalseOnError(var, operand);
+			length = std::min(length, GetSimdLoopLength(varOp, var, var));
+		}
 
-	file->PrintfLine(product.c_str());
+		retFalseOnFalse(GenerateSimdLoop(file, varOp, length, &vectorStatement, &scalarStatement),
+				"Could not generate SIMD loop!\n");
 
-	file->PrintfLine("");
+		return true;
+	}
 
-	file->Outdent();
-	file->PrintfLine("}");
+	file->PrintfLine("for(uint32_t dim = 0; dim < %lu; dim++)", varOp->Length());
+	file->PrintfLine("{");
+	file->PrintfLine("\t%s", scalarStatement.c_str());
+	file->PrintfLine("}\n");
 
 	return true;
 }
 
-bool CodeGenerator::VectorIndexSplitSumCode(const Node* node, FileWriter * file)
+bool CodeGenerator::GetElementWiseExpression(std::string * expr, const Node * node, bool vector)
 {
-	file->PrintfLine("// %s\n", __func__);
-
-	// TODO: This is horribly wasteful! The beauty of using code generation is that
-	// we know this is just a different way of addressing indices, so we could continue using
-	// the old vector but just generate code which accesses the indices in the correct manner!
+	std::string lElem;
+	retFalseOnFalse(GetOperandElement(&lElem, node->Parents()->at(0), vector), "Could not get operand!\n");
 
-	auto nodes = graph_->GetNodes();
-
-	const Node::splitSumIndicesParameters_t * param = (Node::splitSumIndicesParameters_t *) node->TypeParameters();
-
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varArg, node->Parents()->at(0));
+	std::string rElem;
+	retFalseOnFalse(GetOperandElement(&rElem, node->Parents()->at(1), vector), "Could not get operand!\n");
 
-	const auto argNode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == argNode)
+	switch(node->GetType())
 	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(0));
-		return false;
-	}
+	case Node::Type::VECTOR_ADDITION:
+		*expr = lElem + " + " + rElem;
+		break;
 
-	const Algebra::Module::VectorSpace::Vector* vecArg = (const Algebra::Module::VectorSpace::Vector*) argNode->second.GetObjectPt();
-	const Algebra::Module::VectorSpace::Vector* vecOp = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+	case Node::Type::VECTOR_SCALAR_PRODUCT:
+		*expr = lElem + " * " + rElem;
+		break;
 
-	file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-			varOp->GetIdentifier()->c_str(), varOp->GetIdentifier()->c_str());
-	file->PrintfLine("{");
-	file->Indent();
+	case Node::Type::VECTOR_POWER:
+		if(vector || (1 != GetNodeLength(node->Parents()->at(1))))
+		{
+			Error("Can only take scalar elements to scalar powers!\n");
+			return false;
+		}
 
-	std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-	appendIndexTuple(&opIndexTuple, vecOp->Space(), std::string{"opIndex"});
-	opIndexTuple += ";";
+		{
+			int32_t exponent;
+			if(GetIntegerExponent(&exponent, node))
+			{
+				*expr = "__builtin_powif(" + lElem + ", " + std::to_string(exponent) + ")"; // See VectorPowerCode
+				break;
+			}
+		}
 
-	file->PrintfLine("%s", opIndexTuple.c_str());
+		*expr = "powf(" + lElem + ", " + rElem + ")"; // See VectorPowerCode
+		break;
 
-	std::string argIndexTuple = "const uint32_t argIndexTuple[] = {";
+	default:
+		Error("Node%u of type %s is not element-wise!\n", node->id, Node::getName(node->GetType()));
+		return false;
+	}
 
-	uint32_t opIndexPos = 0;
-	for(size_t factor = 0; factor < param->SplitPosition.size(); factor++)
-	{
-		argIndexTuple += "opIndexTuple[" + std::to_string(opIndexPos) + "]";
+	return true;
+}
 
-		if(param->SplitPosition[factor])
+bool CodeGenerator::GetOperandElement(std::string * elem, Node::Id_t id, bool vector)
+{
+	if(IsFused(id) && (Node::Type::VECTOR_CONTRACTION == graph_->GetNode(id)->GetType()))
+	{
+		if(contractionElement_.empty())
 		{
-			opIndexPos++;
-			argIndexTuple += " + opIndexTuple[" + std::to_string(opIndexPos) + "]";
+			Error("Node%u is only computed by a contraction's epilogue!\n", id);
+			return false;
 		}
 
-		argIndexTuple += ", ";
+		*elem = contractionElement_;
+		return true;
 	}
-	argIndexTuple.erase(argIndexTuple.end() - 2, argIndexTuple.end()); // remove last ", "
-	argIndexTuple += "};\n";
-
-	file->PrintfLine("%s", argIndexTuple.c_str());
 
-	std::string equationStr = *varOp->GetIdentifier() + "[opIndex] = ";
-	equationStr += *varArg->GetIdentifier();
-	appendArrayPosition(&equationStr, vecArg->Space(), std::string{"argIndexTuple"});
-	equationStr += ";";
+	if(IsFused(id))
+	{
+		std::string expr;
+		retFalseOnFalse(GetElementWiseExpression(&expr, graph_->GetNode(id), vector), "Could not get expression of Node%u!\n", id);
 
-	file->PrintfLine(equationStr.c_str());
+		*elem = "(" + expr + ")";
+		return true;
+	}
 
-	file->Outdent();
-	file->PrintfLine("}");
+	getVarRetFalseOnError(var, id);
+	*elem = GetSimdElement(var, vector, true);
 
 	return true;
 }
 
-bool CodeGenerator::VectorJoinIndicesCode(const Node* node, FileWriter * file)
+bool CodeGenerator::GetEpilogueExpression(std::string * expr, const Node * epilogue, const std::string &result)
 {
-	file->PrintfLine("// %s\n", __func__);
-
-	auto nodes = graph_->GetNodes();
-
-	const Node::joinIndicesParameters_t * param = (Node::joinIndicesParameters_t *) node->TypeParameters();
+	contractionElement_ = result;
+	bool success = GetElementWiseExpression(expr, epilogue, false);
+	contractionElement_.clear();
 
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varArg, node->Parents()->at(0));
+	return success;
+}
 
-	const auto argNode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == argNode)
+bool CodeGenerator::IsFusedSimdApplicable(const Variable * varOp, const Node * node)
+{
+	if((1 == GetSimdLanesNrOf(varOp)) || (Node::Type::VECTOR_POWER == node->GetType()))
 	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(0));
-		return false;
+		return false; // There is no vector pow
 	}
 
-	const Algebra::Module::VectorSpace::Vector* vecArg = (const Algebra::Module::VectorSpace::Vector*) argNode->second.GetObjectPt();
-	const Algebra::Module::VectorSpace::Vector* vecOp = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+	for(const Node::Id_t &parent: *node->Parents())
+	{
+		if(IsFused(parent))
+		{
+			if(!IsFusedSimdApplicable(varOp, graph_->GetNode(parent)))
+			{
+				return false;
+			}
 
-	file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-			varOp->GetIdentifier()->c_str(), varOp->GetIdentifier()->c_str());
-	file->PrintfLine("{");
-	file->Indent();
+			continue;
+		}
 
-	std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-	appendIndexTuple(&opIndexTuple, vecOp->Space(), std::string{"opIndex"});
-	opIndexTuple += ";";
+		const Variable * var = GetVariable(parent);
+		if((nullptr == var) || ((1 < var->Length()) && (var->GetType() != varOp->GetType())))
+		{
+			return false;
+		}
+	}
 
-	file->PrintfLine("%s", opIndexTuple.c_str());
+	return true;
+}
 
-	std::vector<uint32_t> opIndexPos(param->Indices.size(), UINT32_MAX);
-	std::string argIndexTuple = "const uint32_t argIndexTuple[] = {";
-	for(uint32_t dim = 0; dim < vecArg->Space()->Factors()->size(); dim++)
+bool CodeGenerator::GenerateConstantDeclarations()
+{
+	for(const std::pair<Node::Id_t, Variable> &varPair: variables_)
 	{
-		argIndexTuple += "opIndexTuple[";
-
-		// Is the factor joined?
-		size_t joinedIndices;
-		for(joinedIndices = 0; joinedIndices < param->Indices.size(); joinedIndices++)
+		const Variable * var = &varPair.second;
+		if(var->HasProperty(Variable::PROPERTY_GLOBAL) && var->HasProperty(Variable::PROPERTY_CONST))
 		{
-			auto it = std::find(param->Indices[joinedIndices].begin(), param->Indices[joinedIndices].end(), dim);
+			std::string decl;
+			retFalseOnFalse(var->GetDeclaration(&decl), "Could not get declaration!\n");
 
-			if(param->Indices[joinedIndices].end() != it) // Index is joined
-			{
-				if(param->Indices[joinedIndices].begin() == it) // Set op position of this index
-				{
-					opIndexPos[joinedIndices] = dim;
-				}
+			fileInstructions_.PrintfLine("%s", decl.c_str());
+		}
+	}
 
-				break; // Found index, no need to search further.
-			}
+	// Where the stored elements of packed operands are multiplied and summed, see PackedContractionCode
+	for(const auto &nodePair: *graph_->GetNodes())
+	{
+		packedContraction_t packed;
+		if(!GetPackedContraction(&nodePair.second, &packed))
+		{
+			continue;
 		}
 
-		if(param->Indices.size() <= joinedIndices) // index not joined
+		std::map<std::string, std::vector<int32_t>> arrays = {
+				{"Op", std::vector<int32_t>(packed.opOffsets.begin(), packed.opOffsets.end())},
+				{"Arg", std::vector<int32_t>(packed.argOffsets.begin(), packed.argOffsets.end())}};
+
+		// Only needed if stored elements are used more than once
+		if(!isEachElementOnce(packed.elements))
 		{
-			argIndexTuple += std::to_string(dim);
+			arrays["Element"] = std::vector<int32_t>(packed.elements.begin(), packed.elements.end());
 		}
-		else
+
+		for(const auto &arrayPair: arrays)
 		{
-			argIndexTuple += std::to_string(opIndexPos[joinedIndices]);
+			const Variable::properties_t properties = (Variable::properties_t) (Variable::PROPERTY_GLOBAL | Variable::PROPERTY_STATIC | Variable::PROPERTY_CONST);
+			const std::string id = "Node" + std::to_string(nodePair.first) + "Packed" + arrayPair.first;
+
+			std::string decl;
+			retFalseOnFalse(Variable(&id, properties, Variable::Type::int32_, arrayPair.second.size(), arrayPair.second.data()).GetDeclaration(&decl),
+					"Could not get declaration!\n");
+			fileInstructions_.PrintfLine("%s", decl.c_str());
 		}
+	}
 
-		argIndexTuple += "], ";
+	return true;
+}
+
+bool CodeGenerator::GenerateStaticVariableDeclarations()
+{
+	for(const auto &arena: arenas_)
+	{
+		fileInstructions_.PrintfLine("static %s arena%s_%s[%lu] __attribute__((aligned(%lu))); // %s",
+				arena.first.c_str(), graph_->Name().c_str(), arena.first.c_str(),
+				arena.second, Variable::ALIGNMENT, memoryPlanReport_.c_str());
 	}
 
-	argIndexTuple.erase(argIndexTuple.end() - 2, argIndexTuple.end()); // remove last ", "
-	argIndexTuple += "};\n";
-	file->PrintfLine(argIndexTuple.c_str());
+	// Positions of the window maxima, written by max pools and read by their derivatives
+	for(const auto &nodePair: *graph_->GetNodes())
+	{
+		if(NeedsArgmax(&nodePair.second))
+		{
+			fileInstructions_.PrintfLine("static uint32_t Node%uArgmax[%lu];", nodePair.first, GetNodeLength(nodePair.first));
+		}
+	}
 
-	std::string equationStr = *varOp->GetIdentifier() + "[opIndex] = ";
-	equationStr += *varArg->GetIdentifier();
-	appendArrayPosition(&equationStr, vecArg->Space(), std::string{"argIndexTuple"});
-	equationStr += ";";
+	for(const std::pair<Node::Id_t, Variable> &varPair: variables_)
+	{
+		const Variable * var = &varPair.second;
+		if(var->HasProperty(Variable::PROPERTY_CONST))
+		{
+			// Constants are handled in another function
+			continue;
+		}
 
-	file->PrintfLine(equationStr.c_str());
+		if(var->IsInArena())
+		{
+			continue; // See GenerateArenaViews
+		}
+
+		if(IsFused(varPair.first))
+		{
+			continue; // Only lives in registers, see FuseElementWiseNodes
+		}
+
+		if(var->HasProperty(Variable::PROPERTY_GLOBAL) && var->HasProperty(Variable::PROPERTY_STATIC))
+		{
+			std::string decl;
+			retFalseOnFalse(var->GetDeclaration(&decl), "Could not get declaration!\n");
 
-	file->Outdent();
-	file->PrintfLine("}");
+			fileInstructions_.PrintfLine("%s", decl.c_str());
+		}
+	}
 
 	return true;
 }
 
-bool CodeGenerator::VectorMaxPoolCode(const Node* node, FileWriter * file)
+Variable* CodeGenerator::GetVariable(Node::Id_t id)
 {
-	file->PrintfLine("// %s\n", __func__);
-
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varIn, node->Parents()->at(0));
-
-	const Node::PoolParameters_t * param = (const Node::PoolParameters_t *) node->TypeParameters();
-
-	const char * varOpId = varOp->GetIdentifier()->c_str();
-	const char * varInId = varIn->GetIdentifier()->c_str();
-
 	auto nodes = graph_->GetNodes();
-	const auto inNode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == inNode)
+	const auto nodeIt = nodes->find(id);
+	if(nodes->end() == nodeIt)
 	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(0));
-		return false;
+		Error("Could not find Node for id %u\n", id);
+		return nullptr;
 	}
 
-	auto inVec = (const Algebra::Module::VectorSpace::Vector*) inNode->second.GetObjectPt();
-	auto opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
-
-	const char maxFunctions[][6] =
+	Node::Id_t storageNodeId;
+	if(Node::ID_NONE != nodeIt->second.IsStoredIn())
 	{
-			"fmaxf",
-	};
+		storageNodeId = nodeIt->second.IsStoredIn();
+	}
+	else
+	{
+		storageNodeId = id;
+	}
 
-	const char* maxFctString = nullptr;
-	switch(varIn->GetType())
+	auto varIt = variables_.find(storageNodeId);
+	if(variables_.end() == varIt)
 	{
-	case Variable::Type::uint8_: // no break intended
-	case Variable::Type::int8_: // no break intended
-	case Variable::Type::int32_: // no break intended
-		// TODO: Implement https://graphics.stanford.edu/~seander/bithacks.html#IntegerMinOrMax
-		return false; // TODO: #define something like #define max(m,n) ((m) > (n) ? (m) : (n))
+		Error("Node %u does not have a variable!\n", storageNodeId);
+		return nullptr;
+	}
 
-	case Variable::Type::float_:
-		maxFctString = maxFunctions[0];
-		break;
+	return &varIt->second;
+}
 
-	default: // no break intended
-	case Variable::Type::none: // no break intended
-	case Variable::Type::nrOf:
-		Error("Reached default case!\n");
-		return false;
+bool CodeGenerator::FoldConstants()
+{
+	if(!constantFolding_)
+	{
+		return true;
 	}
 
-	// Get strides
-	std::vector<uint32_t> InStrides;
-	inVec->Space()->GetStrides(&InStrides);
-	const char inStridesId[] = "InStrides";
-	file->PrintfLine("const uint32_t %s[] = {", inStridesId);
-	for(const uint32_t &stride: InStrides)
+	// Nodes whose operands are all known at generation time are computed here and stored as constants
+	// like the ones they are computed from: They leave the schedule and are not recomputed on each run.
+	std::vector<Node::Id_t> order;
+	retFalseOnFalse(GetInstructionsTopologicalOrder(&order), "Could not sort instructions!\n");
+
+	for(const Node::Id_t &nodeId: order) // Operands first, so whole subgraphs fold
 	{
-		file->PrintfLine("\t %u,", stride);
+		std::vector<float> values;
+		if(EvaluateNode(&values, graph_->GetNode(nodeId)))
+		{
+			foldedValues_[nodeId] = values;
+			foldedOrder_.push_back(nodeId);
+		}
 	}
-	file->PrintfLine("};");
 
-	// Generate all possible tuples
-	std::vector<std::pair<uint32_t, uint32_t>> ranges;
-	ranges.resize(inVec->Space()->Factors()->size());
+	DEBUG("Folded %lu constant nodes of %s\n", foldedValues_.size(), graph_->Name().c_str());
 
-	for(size_t range = 0; range < ranges.size(); range++)
+	return true;
+}
+
+bool CodeGenerator::IsFolded(Node::Id_t id) const
+{
+	return foldedValues_.end() != foldedValues_.find(id);
+}
+
+const float * CodeGenerator::GetConstantValue(Node::Id_t id) const
+{
+	const auto foldedIt = foldedValues_.find(id);
+	if(foldedValues_.end() != foldedIt)
 	{
-		ranges[range].first = 0;
-		ranges[range].second = param->PoolSize[range];
+		return foldedIt->second.data();
 	}
 
-	std::vector<std::vector<uint32_t>> tuples;
-	getAllTuples(tuples, ranges);
+	const Node * node = graph_->GetNode(id);
+	if((Node::Object_t::MODULE_VECTORSPACE_VECTOR != node->GetObject()) || (Node::Type::VECTOR != node->GetType()) ||
+			(Node::ID_NONE != node->IsStoredIn()) || node->UsedAsStorageByOthers())
+	{
+		return nullptr;
+	}
 
-	// Loop over all result elements
-	file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-			varOpId, varOpId);
-	file->PrintfLine("{");
-	file->Indent();
+	auto vec = (const Algebra::Module::VectorSpace::Vector *) node->GetObjectPt();
+	auto properties = vec->Properties();
+	if((Algebra::Ring::Float32 != vec->Space()->GetRing()) ||
+			(properties->end() != properties->find(Algebra::Module::VectorSpace::Vector::Property::ExternalInput)))
+	{
+		return nullptr;
+	}
 
-	std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-	appendIndexTuple(&opIndexTuple, opVec->Space(), std::string{"opIndex"});
-	opIndexTuple += ";";
+	return (const float *) vec->InitValue();
+}
 
-	file->PrintfLine("%s", opIndexTuple.c_str());
+bool CodeGenerator::GetIntegerExponent(int32_t * exponent, const Node * node) const
+{
+	// Beyond, the multiplications of repeated squaring add up to a powf
+	static const int32_t INTEGER_EXPONENT_MAX = 64;
 
-	std::string inPoolOrigin = "const uint32_t inPoolOrigin[] = {";
+	if((Node::Type::VECTOR_POWER != node->GetType()) || (1 != GetNodeLength(node->Parents()->at(1))))
+	{
+		return false;
+	}
 
-	for(size_t factor = 0; factor < opVec->Space()->Factors()->size(); factor++)
+	const float * value = GetConstantValue(node->Parents()->at(1));
+	if((nullptr == value) || (truncf(*value) != *value) || (INTEGER_EXPONENT_MAX < fabsf(*value)))
 	{
-		inPoolOrigin += "opIndexTuple[" + std::to_string(factor) + "] ";
-		inPoolOrigin += "* " + std::to_string(param->PoolSize[factor]) + ", ";
+		return false;
 	}
 
-	inPoolOrigin.erase(inPoolOrigin.end() - 2, inPoolOrigin.end()); // remove last ", "
-	inPoolOrigin += "};\n";
+	*exponent = (int32_t) *value;
 
-	file->PrintfLine("%s", inPoolOrigin.c_str());
+	return true;
+}
 
-	file->PrintfLine("%s[opIndex] =", varOpId);
-	file->Indent();
+bool CodeGenerator::EvaluateNode(std::vector<float> * result, const Node * node) const
+{
+	// Bound the size of the generated constants and the time spent computing them
+	static const size_t FOLDED_LENGTH_MAX = 1 << 16;
+	static const size_t FOLDED_OPERATIONS_MAX = 1 << 24;
 
-	for(size_t tuple = 0; tuple < tuples.size(); tuple++)
+	if((Node::Object_t::MODULE_VECTORSPACE_VECTOR != node->GetObject()) ||
+			(Node::ID_NONE != node->IsStoredIn()) || node->UsedAsStorageByOthers())
 	{
-		std::string value;
+		return false;
+	}
 
-		if(tuple != tuples.size() - 1)
+	auto opVec = (const Algebra::Module::VectorSpace::Vector *) node->GetObjectPt();
+	const Algebra::Module::VectorSpace * opSpace = opVec->Space();
+	const size_t length = opSpace->GetDim();
+	if((Algebra::Ring::Float32 != opSpace->GetRing()) || (FOLDED_LENGTH_MAX < length))
+	{
+		return false;
+	}
+
+	// Operands are constants, folded nodes or Kronecker deltas, which are written out
+	std::vector<const Algebra::Module::VectorSpace *> argSpaces;
+	std::vector<std::vector<float>> deltas(node->Parents()->size());
+	std::vector<const float *> args;
+	for(size_t parent = 0; parent < node->Parents()->size(); parent++)
+	{
+		const Node * parentNode = graph_->GetNode(node->Parents()->at(parent));
+		if(Node::Object_t::MODULE_VECTORSPACE_VECTOR != parentNode->GetObject())
 		{
-			value +=  maxFctString;
-			value += "(";
+			return false;
 		}
 
-		value += varInId;
-		value += "[";
+		const Algebra::Module::VectorSpace * argSpace = ((const Algebra::Module::VectorSpace::Vector *) parentNode->GetObjectPt())->Space();
+		argSpaces.push_back(argSpace);
 
-		for(size_t factor = 0; factor < inVec->Space()->Factors()->size(); factor++)
+		if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != parentNode->GetType())
 		{
-			if(tuples[tuple][factor])
-			{
-				value += "(";
-			}
-
-			value += "inPoolOrigin[" + std::to_string(factor) + "]";
-
-			if(tuples[tuple][factor])
+			args.push_back(GetConstantValue(parentNode->id));
+			if(nullptr == args.back())
 			{
-				value += " + " + std::to_string(tuples[tuple][factor]) + ")";
+				return false;
 			}
 
-			value += " * InStrides[" + std::to_string(factor) + "] + ";
+			continue;
 		}
-		value.erase(value.end() - 3, value.end()); // remove last " + "
-
-		value += "]";
 
-		if(tuple != tuples.size() - 1)
-		{
-			value += ", ";
-		}
-		else
+		if(FOLDED_LENGTH_MAX < argSpace->GetDim())
 		{
-			for(size_t tuple = 0; tuple < tuples.size() - 1; tuple++)
-			{
-				value += ")";
-			}
-			value += ";";
+			return false;
 		}
 
-		file->PrintfLine("%s", value.c_str());
-	}
-
-	file->Outdent();
-
-	file->Outdent();
-	file->PrintfLine("}");
-
-	return true;
-}
-
-bool CodeGenerator::VectorCrossCorrelationCode(const Node* node, FileWriter * file)
-{
-	file->PrintfLine("// %s\n", __func__);
-
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varIn, node->Parents()->at(0));
-	getVarRetFalseOnError(varKernel, node->Parents()->at(1));
-
-	const char * varOpId = varOp->GetIdentifier()->c_str();
-	const char * varInId = varIn->GetIdentifier()->c_str();
-	const char * varKernelId = varKernel->GetIdentifier()->c_str();
+		const Node::KroneckerDeltaParameters_t * kroneckerParam = (const Node::KroneckerDeltaParameters_t *) parentNode->TypeParameters();
 
-	auto nodes = graph_->GetNodes();
-	const auto inNode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == inNode)
-	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(0));
-		return false;
-	}
+		std::vector<uint32_t> tuple;
+		deltas[parent].resize(argSpace->GetDim());
+		for(size_t position = 0; position < deltas[parent].size(); position++)
+		{
+			getIndexTuple(&tuple, position, argSpace);
 
-	const auto kernelNode = nodes->find(node->Parents()->at(1));
-	if(nodes->end() == kernelNode)
-	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(1));
-		return false;
-	}
+			bool onDiagonal = true;
+			for(size_t factor = 0; factor < tuple.size(); factor++)
+			{
+				onDiagonal = onDiagonal && (tuple[factor] == tuple[kroneckerParam->DeltaPair[factor]]);
+			}
 
-	auto inVec = (const Algebra::Module::VectorSpace::Vector*) inNode->second.GetObjectPt();
-	auto KernelVec = (const Algebra::Module::VectorSpace::Vector*) kernelNode->second.GetObjectPt();
-	auto opVec = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+			deltas[parent][position] = onDiagonal ? kroneckerParam->Scaling : 0.f;
+		}
 
-	// Get strides
-	std::vector<uint32_t> InStrides;
-	inVec->Space()->GetStrides(&InStrides);
-	const char inStridesId[] = "InStrides";
-	file->PrintfLine("const uint32_t %s[] = {", inStridesId);
-	for(const uint32_t &stride: InStrides)
-	{
-		file->PrintfLine("\t %u,", stride);
+		args.push_back(deltas[parent].data());
 	}
-	file->PrintfLine("};");
 
-	std::vector<uint32_t> KernelStrides;
-	KernelVec->Space()->GetStrides(&KernelStrides);
-	const char kernelStridesId[] = "KernelStrides";
-	file->PrintfLine("const uint32_t %s[] = {", kernelStridesId);
-	for(const uint32_t &stride: KernelStrides)
-	{
-		file->PrintfLine("\t %u,", stride);
-	}
-	file->PrintfLine("};");
+	// Operands of element-wise nodes may be scalars
+	auto element = [&](size_t arg, size_t position) {return (1 == argSpaces[arg]->GetDim()) ? args[arg][0] : args[arg][position];};
+	auto elementAt = [&](size_t arg, const std::vector<uint32_t> &tuple) {return args[arg][getArrayPosition(argSpaces[arg], tuple)];};
 
-	// Generate all possible tuples
-	std::vector<std::pair<uint32_t, uint32_t>> ranges;
-	ranges.resize(KernelVec->Space()->Factors()->size());
+	result->assign(length, 0.f);
+	std::vector<uint32_t> opTuple;
 
-	for(size_t range = 0; range < ranges.size(); range++)
+	// Each computes what the generated instruction would, see the respective *Code function
+	switch(node->GetType())
 	{
-		ranges[range].first = 0;
-		ranges[range].second = KernelVec->Space()->Factors()->at(range).Dim;
-	}
-
-	std::vector<std::vector<uint32_t>> tuples;
-	getAllTuples(tuples, ranges);
-
-	// Loop over all result elements
-	file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-			varOpId, varOpId);
-	file->PrintfLine("{");
-	file->Indent();
+	case Node::Type::VECTOR_ADDITION:
+		for(size_t position = 0; position < length; position++)
+		{
+			result->at(position) = element(0, position) + element(1, position);
+		}
+		return true;
 
-	std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-	appendIndexTuple(&opIndexTuple, opVec->Space(), std::string{"opIndex"});
-	opIndexTuple += ";";
+	case Node::Type::VECTOR_SCALAR_PRODUCT:
+		for(size_t position = 0; position < length; position++)
+		{
+			result->at(position) = element(0, position) * element(1, position);
+		}
+		return true;
 
-	file->PrintfLine("%s", opIndexTuple.c_str());
+	case Node::Type::VECTOR_POWER:
+		if(1 != argSpaces[1]->GetDim())
+		{
+			return false;
+		}
 
-	file->PrintfLine("%s[opIndex] =", varOpId);
-	file->Indent();
+		for(size_t position = 0; position < length; position++)
+		{
+			result->at(position) = powf(element(0, position), args[1][0]);
+		}
+		return true;
 
-	for(size_t tuple = 0; tuple < tuples.size(); tuple++)
+	case Node::Type::VECTOR_VECTOR_PRODUCT:
 	{
-		std::string kernelMult = varInId;
+		const size_t lFactorsNrOf = argSpaces[0]->Factors()->size();
+		for(size_t position = 0; position < length; position++)
+		{
+			getIndexTuple(&opTuple, position, opSpace);
 
-		kernelMult += "[";
-		for(size_t index = 0; index < tuples[tuple].size(); index++)
+			const std::vector<uint32_t> lTuple(opTuple.begin(), opTuple.begin() + lFactorsNrOf);
+			const std::vector<uint32_t> rTuple(opTuple.begin() + lFactorsNrOf, opTuple.end());
+			result->at(position) = elementAt(0, lTuple) * elementAt(1, rTuple);
+		}
+		return true;
+	}
+
+	case Node::Type::VECTOR_PERMUTATION:
+	{
+		// Result factor indices[a] is argument factor a
+		const Node::permuteParameters_t * param = (const Node::permuteParameters_t *) node->TypeParameters();
+		const auto factors = argSpaces[0]->Factors();
+		std::vector<uint32_t> argTuple(param->indices.size());
+		for(size_t factor = 0; factor < argTuple.size(); factor++)
 		{
-			if(tuples[tuple][index])
+			if(factors->at(factor).Dim < factors->at(param->indices[factor]).Dim)
 			{
-				kernelMult += "(";
+				return false;
 			}
+		}
 
-			kernelMult += "opIndexTuple[" + std::to_string(index) + "]";
+		for(size_t position = 0; position < length; position++)
+		{
+			getIndexTuple(&opTuple, position, argSpaces[0]);
 
-			if(tuples[tuple][index])
+			for(size_t factor = 0; factor < argTuple.size(); factor++)
 			{
-				kernelMult += " + " + std::to_string(tuples[tuple][index]) + ")";
+				argTuple[factor] = opTuple[param->indices[factor]];
 			}
 
-			kernelMult += " * InStrides[" + std::to_string(index) + "] + ";
+			result->at(position) = elementAt(0, argTuple);
 		}
-		kernelMult.erase(kernelMult.end() - 3, kernelMult.end()); // remove last " + "
-
-		kernelMult += "]";
+		return true;
+	}
 
-		kernelMult += " * ";
-		kernelMult += varKernelId;
-		kernelMult += "[";
-		for(size_t index = 0; index < tuples[tuple].size(); index++)
+	case Node::Type::VECTOR_PROJECTION:
+	{
+		const Node::projectParameters_t * param = (const Node::projectParameters_t *) node->TypeParameters();
+		for(size_t position = 0; position < length; position++)
 		{
-			if(tuples[tuple][index])
-			{
-				kernelMult += std::to_string(tuples[tuple][index]);
-				kernelMult += " * KernelStrides[" + std::to_string(index) + "] + ";
-			}
-			else
+			getIndexTuple(&opTuple, position, opSpace);
+
+			for(size_t factor = 0; factor < opTuple.size(); factor++)
 			{
-				kernelMult += "0 + ";
+				opTuple[factor] += param->range[factor].first;
 			}
-		}
-		kernelMult.erase(kernelMult.end() - 3, kernelMult.end()); // remove last " + "
-		kernelMult += "]";
 
-		if(tuple != tuples.size() - 1)
-		{
-			kernelMult += " +";
-		}
-		else
-		{
-			kernelMult += ";";
+			result->at(position) = elementAt(0, opTuple);
 		}
-
-		file->PrintfLine(kernelMult.c_str());
+		return true;
 	}
 
-	file->Outdent();
-
-	file->Outdent();
-	file->PrintfLine("}");
-
-	return true;
-}
-
-bool CodeGenerator::VectorProjectionCode(const Node* node, FileWriter * file)
-{
-	file->PrintfLine("// %s\n", __func__);
-
-	auto nodes = graph_->GetNodes();
-
-	const Node::projectParameters_t * param = (const Node::projectParameters_t *) node->TypeParameters();
-
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(varArg, node->Parents()->at(0));
-
-	const auto argNode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == argNode)
+	case Node::Type::VECTOR_JOIN_INDICES:
 	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(0));
-		return false;
-	}
+		// All indices of a join take the value of its first one
+		const Node::joinIndicesParameters_t * param = (const Node::joinIndicesParameters_t *) node->TypeParameters();
+		std::vector<uint32_t> opFactor(argSpaces[0]->Factors()->size());
+		for(uint32_t factor = 0; factor < opFactor.size(); factor++)
+		{
+			opFactor[factor] = factor;
+			for(const auto &joined: param->Indices)
+			{
+				if(joined.end() != std::find(joined.begin(), joined.end(), factor))
+				{
+					opFactor[factor] = joined.front();
+				}
+			}
 
-	const Algebra::Module::VectorSpace::Vector* vecArg = (const Algebra::Module::VectorSpace::Vector*) argNode->second.GetObjectPt();
-	const Algebra::Module::VectorSpace::Vector* vecOp = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+			if(opSpace->Factors()->size() <= opFactor[factor])
+			{
+				return false;
+			}
+		}
 
-	file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-			varOp->GetIdentifier()->c_str(), varOp->GetIdentifier()->c_str());
-	file->PrintfLine("{");
-	file->Indent();
+		std::vector<uint32_t> argTuple(opFactor.size());
+		for(size_t position = 0; position < length; position++)
+		{
+			getIndexTuple(&opTuple, position, opSpace);
 
-	std::string opIndexTuple = "const uint32_t opIndexTuple[] = ";
-	appendIndexTuple(&opIndexTuple, vecOp->Space(), std::string{"opIndex"});
-	opIndexTuple += ";";
+			for(size_t factor = 0; factor < argTuple.size(); factor++)
+			{
+				argTuple[factor] = opTuple[opFactor[factor]];
+			}
 
-	file->PrintfLine("%s", opIndexTuple.c_str());
+			result->at(position) = elementAt(0, argTuple);
+		}
+		return true;
+	}
 
-	std::string argIndexTuple = "const uint32_t argIndexTuple[] = {";
-	for(uint32_t dim = 0; dim < vecArg->Space()->Factors()->size(); dim++)
+	case Node::Type::VECTOR_CONTRACTION:
 	{
-		argIndexTuple += "opIndexTuple[";
-		argIndexTuple += std::to_string(dim);
-		argIndexTuple += "]";
+		const Node::contractParameters_t * param = (const Node::contractParameters_t *) node->TypeParameters();
 
-		if(0 != param->range[dim].first)
+		std::vector<uint32_t> contractedDims;
+		size_t contractedLength = 1;
+		for(const uint32_t &factor: param->lfactors)
 		{
-			argIndexTuple += " + " + std::to_string(param->range[dim].first);
+			contractedDims.push_back(argSpaces[0]->Factors()->at(factor).Dim);
+			contractedLength *= contractedDims.back();
 		}
 
-		argIndexTuple += ", ";
-	}
-
-	argIndexTuple.erase(argIndexTuple.end() - 2, argIndexTuple.end()); // remove last ", "
-	argIndexTuple += "};\n";
-	file->PrintfLine(argIndexTuple.c_str());
-
-	std::string equationStr = *varOp->GetIdentifier() + "[opIndex] = ";
-	equationStr += *varArg->GetIdentifier();
-	appendArrayPosition(&equationStr, vecArg->Space(), std::string{"argIndexTuple"});
-	equationStr += ";";
-
-	file->PrintfLine(equationStr.c_str());
+		if(FOLDED_OPERATIONS_MAX < length * contractedLength)
+		{
+			return false;
+		}
 
-	file->Outdent();
-	file->PrintfLine("}");
+		// Free factors of the left, then of the right operand, summed in the order of the generic loop
+		std::vector<uint32_t> lTuple(argSpaces[0]->Factors()->size());
+		std::vector<uint32_t> rTuple(argSpaces[1]->Factors()->size());
+		std::vector<uint32_t> contractedTuple(contractedDims.size());
+		for(size_t position = 0; position < length; position++)
+		{
+			getIndexTuple(&opTuple, position, opSpace);
 
-	return true;
-}
+			float sum = 0.f;
+			for(size_t contracted = 0; contracted < contractedLength; contracted++)
+			{
+				size_t remainder = contracted;
+				for(size_t factor = contractedDims.size(); 0 < factor; factor--)
+				{
+					contractedTuple[factor - 1] = remainder % contractedDims[factor - 1];
+					remainder /= contractedDims[factor - 1];
+				}
 
-bool CodeGenerator::VectorPowerCode(const Node* node, FileWriter * file)
-{
-	file->PrintfLine("// %s\n", __func__);
+				size_t opFactor = 0;
+				for(uint32_t factor = 0; factor < lTuple.size(); factor++)
+				{
+					auto it = std::find(param->lfactors.begin(), param->lfactors.end(), factor);
+					lTuple[factor] = (param->lfactors.end() == it) ? opTuple[opFactor++] : contractedTuple[std::distance(param->lfactors.begin(), it)];
+				}
 
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(lVar, node->Parents()->at(0));
-	getVarRetFalseOnError(rVar, node->Parents()->at(1));
+				for(uint32_t factor = 0; factor < rTuple.size(); factor++)
+				{
+					auto it = std::find(param->rfactors.begin(), param->rfactors.end(), factor);
+					rTuple[factor] = (param->rfactors.end() == it) ? opTuple[opFactor++] : contractedTuple[std::distance(param->rfactors.begin(), it)];
+				}
 
-	retFalseOnFalse(GenerateLocalVariableDeclaration(varOp), "Could not generate Var. Decl.\n");
+				sum += elementAt(0, lTuple) * elementAt(1, rTuple);
+			}
 
-	bool lVarIsScalar = (1 == lVar->Length());
-	bool rVarIsScalar = (1 == rVar->Length());
+			result->at(position) = sum;
+		}
+		return true;
+	}
 
-	if(!rVarIsScalar)
-	{
-		Error("Can't take to non-scalar powers (have length %lu)!\n", rVar->Length());
+	default:
 		return false;
 	}
+}
 
-	// TODO: If the exponent is a constant, it's probably faster to use sqrt in case of 0.5 and so forth
-	const char powFunctions[][6] =
+bool CodeGenerator::FoldViews()
+{
+	// A permutation, projection or index join whose only consumer is a contraction is not copied:
+	// The contraction reads the argument's array with the remapped strides, see GetView.
+	std::vector<Node::Id_t> order;
+	retFalseOnFalse(GetInstructionsTopologicalOrder(&order), "Could not sort instructions!\n");
+
+	auto hasKroneckerDeltaParent = [this](const Node * node)
 	{
-			"powf",
-			"pow",
-			"powl"
+		return std::any_of(node->Parents()->begin(), node->Parents()->end(),
+				[this](Node::Id_t parent) {return Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == graph_->GetNode(parent)->GetType();});
 	};
 
-	const char* powFctString;
-	switch(lVar->GetType())
+	size_t foldedNrOf = 0;
+	for(auto nodeIt = order.rbegin(); nodeIt != order.rend(); nodeIt++) // Consumers first, so chains of views fold, too
 	{
-	case Variable::Type::uint8_: // no break intended
-	case Variable::Type::int8_: // no break intended
-	case Variable::Type::int32_: // no break intended
-		// TODO: Implement https://en.wikipedia.org/wiki/Exponentiation_by_squaring
-	case Variable::Type::float_:
-		powFctString = powFunctions[0];
-		break;
+		const Node * node = graph_->GetNode(*nodeIt);
 
-	default: // no break intended
-	case Variable::Type::none: // no break intended
-	case Variable::Type::nrOf:
-		Error("Reached default case!\n");
-		return false;
-	}
+		switch(node->GetType())
+		{
+		case Node::Type::VECTOR_PERMUTATION: // no break intended
+		case Node::Type::VECTOR_PROJECTION: // no break intended
+		case Node::Type::VECTOR_JOIN_INDICES:
+			break;
 
-	if(lVarIsScalar)
-	{
-		file->PrintfLine("%s = %s(%s, %s);",
-				varOp->GetIdentifier()->c_str(),
-				powFctString,
-				lVar->GetIdentifier()->c_str(),
-				rVar->GetIdentifier()->c_str());
+		default:
+			continue;
+		}
 
-		return true;
-	}
+		auto vec = (const Algebra::Module::VectorSpace::Vector *) node->GetObjectPt();
+		if((1 != node->Children()->size()) || (1 >= vec->Space()->GetDim()) || hasKroneckerDeltaParent(node) ||
+				(Node::ID_NONE != node->IsStoredIn()) || node->UsedAsStorageByOthers())
+		{
+			continue;
+		}
 
-	file->PrintfLine("for(size_t opIndex = 0; opIndex < sizeof(%s) / sizeof(%s[0]); opIndex++)",
-			varOp->GetIdentifier()->c_str(), varOp->GetIdentifier()->c_str());
-	file->PrintfLine("{");
-	file->Indent();
+		// The argument must not be overwritten before the consumer has read it
+		const Node * arg = graph_->GetNode(node->Parents()->at(0));
+		if(arg->UsedAsStorageByOthers())
+		{
+			continue;
+		}
 
-	file->PrintfLine("%s[%s] = %s(%s[%s], %s);",
-			varOp->GetIdentifier()->c_str(),
-			"opIndex",
-			powFctString,
-			lVar->GetIdentifier()->c_str(),
-			"opIndex",
-			rVar->GetIdentifier()->c_str());
+		const Node::Id_t childId = *node->Children()->begin();
+		const Node * consumer = graph_->GetNode(GetFusionSink(childId));
+		if((!IsView(childId) && (Node::Type::VECTOR_CONTRACTION != graph_->GetNode(childId)->GetType())) ||
+				(Node::Type::VECTOR_CONTRACTION != consumer->GetType()) || hasKroneckerDeltaParent(consumer))
+		{
+			continue;
+		}
 
-	file->Outdent();
-	file->PrintfLine("}");
+		// The blocked matrix product needs rows and columns at constant strides, else the copy is cheaper
+		matrixProductShape_t shape;
+		const bool isMatrixProduct = GetMatrixProductShape(consumer, &shape);
+
+		fusedInto_[node->id] = childId;
+		if(isMatrixProduct && !GetMatrixProductShape(consumer, &shape))
+		{
+			fusedInto_.erase(node->id);
+			continue;
+		}
+
+		foldedNrOf++;
+	}
+
+	DEBUG("Folded %lu views of %s\n", foldedNrOf, graph_->Name().c_str());
 
 	return true;
 }
 
-bool CodeGenerator::VectorScalarProductCode(const Node* node, FileWriter * file, bool divide)
+bool CodeGenerator::IsPacked(Node::Id_t id) const
 {
-	file->PrintfLine("// %s\n", __func__);
+	return packing_.end() != packing_.find(id);
+}
 
-	auto nodes = graph_->GetNodes();
+bool CodeGenerator::PropagatePacking()
+{
+	// Densest constant stored compressed if only declared sparse: Fewer operations, but indirect accesses
+	static const double SPARSE_DENSITY_MAX = 0.25;
 
-	const auto lVecNode = nodes->find(node->Parents()->at(0));
-	if(nodes->end() == lVecNode)
+	// Constants declared sparse only store their non-zeros, diagonal ones their diagonal and (anti-)symmetric ones a triangle ...
+	for(const auto &nodePair: *graph_->GetNodes())
 	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(0));
-		return false;
-	}
+		const Node * node = &nodePair.second;
+		if((Node::Object_t::MODULE_VECTORSPACE_VECTOR != node->GetObject()) || (Node::Type::VECTOR != node->GetType()) ||
+				(Node::ID_NONE != node->IsStoredIn()) || node->UsedAsStorageByOthers())
+		{
+			continue;
+		}
 
-	const auto rVecNode = nodes->find(node->Parents()->at(1));
-	if(nodes->end() == rVecNode)
-	{
-		Error("Could not find Node for id %u\n", node->Parents()->at(1));
-		return false;
-	}
+		auto vec = (const Algebra::Module::VectorSpace::Vector *) node->GetObjectPt();
+		auto properties = vec->Properties();
+		if((nullptr == vec->InitValue()) || (Algebra::Ring::Float32 != vec->Space()->GetRing()) ||
+				(properties->end() != properties->find(Algebra::Module::VectorSpace::Vector::Property::ExternalInput)))
+		{
+			continue;
+		}
 
-	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == lVecNode->second.GetType()) ||
-			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == rVecNode->second.GetType()))
-	{
-		return VectorScalarProductKroneckerDeltaCode(node, file, divide);
-	}
+		const auto diagonalIt = properties->find(Algebra::Module::VectorSpace::Vector::Property::Diagonal);
+		const auto symmetricIt = properties->find(Algebra::Module::VectorSpace::Vector::Property::Symmetric);
+		const auto antisymmetricIt = properties->find(Algebra::Module::VectorSpace::Vector::Property::Antisymmetric);
+		const bool isSparse = (properties->end() != properties->find(Algebra::Module::VectorSpace::Vector::Property::Sparse));
+		const bool isDiagonal = (properties->end() != diagonalIt);
+		const bool isAntisymmetric = (properties->end() != antisymmetricIt);
+		const bool isStructured = isDiagonal || isAntisymmetric || (properties->end() != symmetricIt);
+		if(!isSparse && !isStructured)
+		{
+			continue;
+		}
 
-	getVarRetFalseOnError(varOp, node->id);
-	getVarRetFalseOnError(lVar, node->Parents()->at(0));
-	getVarRetFalseOnError(rVar, node->Parents()->at(1));
+		// The two factors a structure applies to, both of a matrix if none are declared
+		const std::pair<uint32_t, uint32_t> * declaredPair = nullptr;
+		if(isDiagonal && (nullptr != diagonalIt->second))
+		{
+			declaredPair = &((const Algebra::Module::VectorSpace::Vector::propertyParameterDiagonal_t *) diagonalIt->second)->Pairs;
+		}
+		else if(isAntisymmetric && (nullptr != antisymmetricIt->second))
+		{
+			declaredPair = &((const Algebra::Module::VectorSpace::Vector::propertyParameterSymmetric_t *) antisymmetricIt->second)->Pairs;
+		}
+		else if((properties->end() != symmetricIt) && (nullptr != symmetricIt->second))
+		{
+			declaredPair = &((const Algebra::Module::VectorSpace::Vector::propertyParameterSymmetric_t *) symmetricIt->second)->Pairs;
+		}
 
-	retFalseOnFalse(GenerateLocalVariableDeclaration(varOp), "Could not generate Var. Decl.\n");
+		const auto factors = vec->Space()->Factors();
+		std::pair<uint32_t, uint32_t> pair = {0, 1};
+		if((nullptr != declaredPair) && (declaredPair->first != declaredPair->second))
+		{
+			pair = *declaredPair;
+		}
+		else if(isStructured && (2 != factors->size()))
+		{
+			continue;
+		}
+
+		if(isStructured && ((factors->size() <= std::max(pair.first, pair.second)) || (factors->at(pair.first).Dim != factors->at(pair.second).Dim)))
+		{
+			continue;
+		}
 
-	auto vecOp = (const Algebra::Module::VectorSpace::Vector*) node->GetObjectPt();
+		std::vector<uint32_t> strides;
+		vec->Space()->GetStrides(&strides);
 
-	bool lVarIsScalar = (1 == lVar->Length());
-	bool rVarIsScalar = (1 == rVar->Length());
+		const float * values = (const float *) vec->InitValue();
 
-	if(!lVarIsScalar || !rVarIsScalar)
-	{
-		file->PrintfLine("for(uint32_t dim = 0; dim < %u; dim++)",
-				vecOp->Space()->GetDim());
+		packing_t packing;
+		packing.mirrorSign = isAntisymmetric ? -1.f : 1.f;
+		std::vector<float> storedValues;
+		for(uint32_t position = 0; position < vec->Space()->GetDim(); position++)
+		{
+			uint32_t mirror = position;
+			if(isStructured)
+			{
+				const uint32_t first = (position / strides[pair.first]) % factors->at(pair.first).Dim;
+				const uint32_t second = (position / strides[pair.second]) % factors->at(pair.second).Dim;
+				if((second < first) || (isDiagonal && (first != second)) || (isAntisymmetric && (first == second)))
+				{
+					continue; // Mirror image or zero
+				}
+
+				mirror = position - first * strides[pair.first] - second * strides[pair.second] + second * strides[pair.first] + first * strides[pair.second];
+			}
+
+			if(isSparse && (0.f == values[position]))
+			{
+				continue;
+			}
 
-		file->PrintfLine("{");
-		file->Indent();
+			packing.positions.push_back(position);
+			packing.mirrors.push_back(mirror);
+			storedValues.push_back(values[position]);
+		}
+
+		if((1 < packing.positions.size()) &&
+				(isStructured || ((double) packing.positions.size() <= SPARSE_DENSITY_MAX * (double) vec->Space()->GetDim())))
+		{
+			packing_[node->id] = packing;
+			packedValues_[node->id] = storedValues;
+		}
 	}
 
-	if(divide)
+	// ... and so do their products with scalars and sums with the same packing. Products a a^T only store the upper triangle.
+	auto getPacking = [this](const Node * node, packing_t * packing)
 	{
-		if(lVarIsScalar && rVarIsScalar)
+		if((Node::ID_NONE != node->IsStoredIn()) || node->UsedAsStorageByOthers())
 		{
-			file->PrintfLine("%s = %s / %s;",
-					varOp->GetIdentifier()->c_str(),
-					lVar->GetIdentifier()->c_str(),
-					rVar->GetIdentifier()->c_str());
+			return false;
 		}
-		else if(lVarIsScalar)
+
+		auto isScalar = [](const Node * operand)
 		{
-			file->PrintfLine("%s[dim] = %s / %s[dim];",
-					varOp->GetIdentifier()->c_str(),
-					lVar->GetIdentifier()->c_str(),
-					rVar->GetIdentifier()->c_str());
-		}
-		else
+			auto vec = (const Algebra::Module::VectorSpace::Vector *) operand->GetObjectPt();
+			return (Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != operand->GetType()) && (1 == vec->Space()->GetDim());
+		};
+
+		switch(node->GetType())
 		{
-			file->PrintfLine("%s[dim] = %s[dim] / %s;",
-					varOp->GetIdentifier()->c_str(),
-					lVar->GetIdentifier()->c_str(),
-					rVar->GetIdentifier()->c_str());
+		case Node::Type::VECTOR_SCALAR_PRODUCT:
+		{
+			const Node * lNode = graph_->GetNode(node->Parents()->at(0));
+			const Node * rNode = graph_->GetNode(node->Parents()->at(1));
+			if(IsPacked(lNode->id) && isScalar(rNode))
+			{
+				*packing = packing_.at(lNode->id);
+				return true;
+			}
+
+			if(IsPacked(rNode->id) && isScalar(lNode))
+			{
+				*packing = packing_.at(rNode->id);
+				return true;
+			}
+
+			return false;
 		}
-	}
-	else
-	{
-		if(lVarIsScalar && rVarIsScalar)
+
+		case Node::Type::VECTOR_ADDITION:
 		{
-			file->PrintfLine("%s = %s * %s;",
-					varOp->GetIdentifier()->c_str(),
-					lVar->GetIdentifier()->c_str(),
-					rVar->GetIdentifier()->c_str());
+			const Node::Id_t lId = node->Parents()->at(0);
+			const Node::Id_t rId = node->Parents()->at(1);
+			if(!IsPacked(lId) || !IsPacked(rId))
+			{
+				return false;
+			}
+
+			const packing_t &lPacking = packing_.at(lId);
+			const packing_t &rPacking = packing_.at(rId);
+			if((lPacking.positions != rPacking.positions) || (lPacking.mirrors != rPacking.mirrors) || (lPacking.mirrorSign != rPacking.mirrorSign))
+			{
+				return false;
+			}
+
+			*packing = lPacking;
+			return true;
 		}
-		else if(lVarIsScalar)
+
+		case Node::Type::VECTOR_CONTRACTION:
 		{
-			file->PrintfLine("%s[dim] = %s * %s[dim];",
-					varOp->GetIdentifier()->c_str(),
-					lVar->GetIdentifier()->c_str(),
-					rVar->GetIdentifier()->c_str());
+			symmetricProduct_t product;
+			if(!GetSymmetricProduct(node, &product))
+			{
+				return false;
+			}
+
+			// Row by row, as computed by SymmetricProductCode
+			packing->positions.clear();
+			packing->mirrors.clear();
+			packing->mirrorSign = 1.f;
+			for(uint32_t row = 0; row < product.rowsNrOf; row++)
+			{
+				for(uint32_t col = row; col < product.rowsNrOf; col++)
+				{
+					packing->positions.push_back(row * product.rowsNrOf + col);
+					packing->mirrors.push_back(col * product.rowsNrOf + row);
+				}
+			}
+
+			return true;
 		}
-		else
+
+		default:
+			return false;
+		}
+	};
+
+	std::vector<Node::Id_t> order;
+	retFalseOnFalse(GetInstructionsTopologicalOrder(&order), "Could not sort instructions!\n");
+
+	for(const Node::Id_t &nodeId: order)
+	{
+		packing_t packing;
+		if(getPacking(graph_->GetNode(nodeId), &packing))
 		{
-			file->PrintfLine("%s[dim] = %s[dim] * %s;",
-					varOp->GetIdentifier()->c_str(),
-					lVar->GetIdentifier()->c_str(),
-					rVar->GetIdentifier()->c_str());
+			packing_[nodeId] = packing;
 		}
 	}
 
-	if(!lVarIsScalar || !rVarIsScalar)
+	// Every reader has to handle the packed array, else the vector is stored dense.
+	// Dropping one may invalidate the nodes computed from it or its other operands, so repeat until nothing changes.
+	bool changed = true;
+	while(changed)
 	{
-		file->Outdent();
-		file->PrintfLine("}\n");
+		changed = false;
+
+		for(auto packedIt = packing_.begin(); packedIt != packing_.end();)
+		{
+			const Node * node = graph_->GetNode(packedIt->first);
+
+			packing_t packing;
+			bool isPacked = (Node::Type::VECTOR == node->GetType()) || getPacking(node, &packing);
+
+			for(const Node::Id_t &child: *node->Children())
+			{
+				packedContraction_t packed;
+				isPacked = isPacked && (IsFolded(child) || (!IsFused(child) && (IsPacked(child) || GetPackedContraction(graph_->GetNode(child), &packed))));
+			}
+
+			if(isPacked)
+			{
+				packedIt++;
+			}
+			else
+			{
+				packedIt = packing_.erase(packedIt);
+				changed = true;
+			}
+		}
 	}
 
+	DEBUG("%lu packed vectors in %s\n", packing_.size(), graph_->Name().c_str());
+
 	return true;
 }
 
-bool CodeGenerator::GenerateConstantDeclarations()
+bool CodeGenerator::FuseElementWiseNodes()
 {
-	for(const std::pair<Node::Id_t, Variable> &varPair: variables_)
+	// Bounds the size of the fused expression and the registers it needs
+	static const size_t FUSED_NODES_NR_OF_MAX = 8;
+
+	// An element-wise node whose only child is element-wise, too, is computed in the child's loop.
+	// Its result is then only kept in registers: No variable, no instruction and no pass over memory.
+	// Likewise, a contraction computes the element-wise nodes following it (e.g. bias and activation)
+	// where it stores its result.
+	auto isFusable = [this](const Node * node, bool contraction)
 	{
-		const Variable * var = &varPair.second;
-		if(var->HasProperty(Variable::PROPERTY_GLOBAL) && var->HasProperty(Variable::PROPERTY_CONST))
+		if(IsFolded(node->id))
 		{
-			std::string decl;
-			retFalseOnFalse(var->GetDeclaration(&decl), "Could not get declaration!\n");
+			return false;
+		}
 
-			fileInstructions_.PrintfLine("%s", decl.c_str());
+		switch(node->GetType())
+		{
+		case Node::Type::VECTOR_ADDITION: // no break intended
+		case Node::Type::VECTOR_SCALAR_PRODUCT: // no break intended
+		case Node::Type::VECTOR_POWER:
+			break;
+
+		case Node::Type::VECTOR_CONTRACTION:
+			if(contraction)
+			{
+				break;
+			}
+			return false;
+
+		default:
+			return false;
 		}
-	}
 
-	return true;
-}
+		return std::none_of(node->Parents()->begin(), node->Parents()->end(),
+				[this](Node::Id_t parent) {return Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == graph_->GetNode(parent)->GetType();});
+	};
 
-bool CodeGenerator::GenerateStaticVariableDeclarations()
-{
-	for(const std::pair<Node::Id_t, Variable> &varPair: variables_)
+	std::vector<Node::Id_t> order;
+	retFalseOnFalse(GetInstructionsTopologicalOrder(&order), "Could not sort instructions!\n");
+
+	std::map<Node::Id_t, size_t> fusedNodesNrOf; // Including the node itself
+	for(const Node::Id_t &nodeId: order)
 	{
-		const Variable * var = &varPair.second;
-		if(var->HasProperty(Variable::PROPERTY_CONST))
+		const Node * node = graph_->GetNode(nodeId);
+
+		// Comparisons reduce their operands, which may still be computed on the fly
+		const bool isReduction = (Node::Type::VECTOR_COMPARISON_IS_SMALLER == node->GetType());
+		if(!isReduction && !isFusable(node, false))
 		{
-			// Constants are handled in another function
 			continue;
 		}
 
-		if(var->HasProperty(Variable::PROPERTY_GLOBAL) && var->HasProperty(Variable::PROPERTY_STATIC))
+		auto vec = (const Algebra::Module::VectorSpace::Vector *) node->GetObjectPt();
+		fusedNodesNrOf[nodeId] = 1;
+
+		for(const Node::Id_t &parentId: *node->Parents())
 		{
-			std::string decl;
-			retFalseOnFalse(var->GetDeclaration(&decl), "Could not get declaration!\n");
+			const Node * parent = graph_->GetNode(parentId);
+			if(IsFused(parentId) || !isFusable(parent, !isReduction) || (1 != parent->Children()->size()) ||
+					(Node::ID_NONE != parent->IsStoredIn()) || parent->UsedAsStorageByOthers())
+			{
+				continue;
+			}
 
-			fileInstructions_.PrintfLine("%s", decl.c_str());
-		}
-	}
+			// The loop is the one of the contraction, if any, so there can only be one.
+			const bool hasContraction = (Node::Type::VECTOR_CONTRACTION == parent->GetType()) || (nullptr != GetFusedContraction(parent));
+			if(hasContraction && (isReduction || (nullptr != GetFusedContraction(node))))
+			{
+				continue;
+			}
 
-	return true;
-}
+			// Each element only depends on the same element of the operands
+			auto parentVec = (const Algebra::Module::VectorSpace::Vector *) parent->GetObjectPt();
+			if(!isReduction && ((parentVec->Space()->GetDim() != vec->Space()->GetDim()) ||
+					(parentVec->Space()->GetRing() != vec->Space()->GetRing())))
+			{
+				continue;
+			}
 
-Variable* CodeGenerator::GetVariable(Node::Id_t id)
-{
-	auto nodes = graph_->GetNodes();
-	const auto nodeIt = nodes->find(id);
-	if(nodes->end() == nodeIt)
-	{
-		Error("Could not find Node for id %u\n", id);
-		return nullptr;
-	}
+			// An operand overwritten by a node storing in it might change before the child runs
+			if(std::any_of(parent->Parents()->begin(), parent->Parents()->end(),
+					[this](Node::Id_t operand) {return graph_->GetNode(operand)->UsedAsStorageByOthers();}))
+			{
+				continue;
+			}
 
-	Node::Id_t storageNodeId;
-	if(Node::ID_NONE != nodeIt->second.IsStoredIn())
-	{
-		storageNodeId = nodeIt->second.IsStoredIn();
+			const size_t parentNodesNrOf = fusedNodesNrOf.count(parentId) ? fusedNodesNrOf[parentId] : 1;
+			if(FUSED_NODES_NR_OF_MAX < fusedNodesNrOf[nodeId] + parentNodesNrOf)
+			{
+				continue;
+			}
+
+			fusedInto_[parentId] = nodeId;
+			fusedNodesNrOf[nodeId] += parentNodesNrOf;
+		}
 	}
-	else
+
+	// A contraction accumulates in the array of its sink, or reads other elements than the one
+	// it stores: Its operands and those of the epilogue must not be that array.
+	auto storageOf = [this](Node::Id_t id)
 	{
-		storageNodeId = id;
-	}
+		const Node * node = graph_->GetNode(id);
+		return (Node::ID_NONE != node->IsStoredIn()) ? node->IsStoredIn() : id;
+	};
 
-	auto varIt = variables_.find(storageNodeId);
-	if(variables_.end() == varIt)
+	for(auto fusedIt = fusedInto_.begin(); fusedIt != fusedInto_.end();)
 	{
-		Error("Node %u does not have a variable!\n", storageNodeId);
-		return nullptr;
+		if(Node::Type::VECTOR_CONTRACTION != graph_->GetNode(fusedIt->first)->GetType())
+		{
+			fusedIt++;
+			continue;
+		}
+
+		const Node::Id_t sink = GetFusionSink(fusedIt->first);
+
+		std::vector<Node::Id_t> operands;
+		GetFusedOperands(&operands, graph_->GetNode(sink));
+
+		if(std::any_of(operands.begin(), operands.end(),
+				[&](Node::Id_t operand) {return storageOf(operand) == storageOf(sink);}))
+		{
+			fusedIt = fusedInto_.erase(fusedIt); // Computed on its own
+		}
+		else
+		{
+			fusedIt++;
+		}
 	}
 
-	return &varIt->second;
+	DEBUG("Fused %lu element-wise nodes of %s\n",
+			std::count_if(fusedInto_.begin(), fusedInto_.end(), [this](const std::pair<Node::Id_t, Node::Id_t> &fused) {return !IsView(fused.first);}),
+			graph_->Name().c_str());
+
+	return true;
 }
 
 bool CodeGenerator::FetchVariables()
@@ -2833,6 +6433,12 @@ bool CodeGenerator::FetchVariables()
 			continue; // This node is not stored in its own variable or doesn't require storage
 		}
 
+		const auto children = nodePair.second.Children();
+		if(IsFolded(nodePair.first) && std::all_of(children->begin(), children->end(), [this](Node::Id_t child) {return IsFolded(child);}))
+		{
+			continue; // Only read at generation time
+		}
+
 		std::string identifier;
 		Variable::properties_t properties = Variable::PROPERTY_NONE;
 		Variable::Type type = Variable::Type::none;
@@ -2863,6 +6469,22 @@ bool CodeGenerator::FetchVariables()
 
 			value = vector->InitValue();
 			length = vector->Space()->GetDim();
+
+			// Computed at generation time, see FoldConstants
+			if(IsFolded(nodePair.first))
+			{
+				value = foldedValues_.at(nodePair.first).data();
+			}
+
+			// Only the stored elements, see PropagatePacking
+			if(IsPacked(nodePair.first))
+			{
+				length = packing_[nodePair.first].positions.size();
+				if(nullptr != value)
+				{
+					value = packedValues_[nodePair.first].data();
+				}
+			}
 			switch(vector->Space()->GetRing())
 			{
 			case Algebra::Ring::Float32:
@@ -2879,7 +6501,7 @@ bool CodeGenerator::FetchVariables()
 				return false;
 			}
 
-			if(nullptr != vector->InitValue())
+			if(nullptr != value)
 			{
 				properties = (Variable::properties_t) (
 						properties |
@@ -2917,6 +6539,11 @@ bool CodeGenerator::FetchVariables()
 			Error("Variable already exists!\n");
 			return false;
 		}
+
+		if(padding_)
+		{
+			retFalseOnFalse(insertRet.first->second.PadToAlignment(), "Could not pad Node%u!\n", nodePair.second.id);
+		}
 	}
 
 	// Identify interfaces and mark their variables as such
@@ -3201,6 +6828,7 @@ Variable::Variable(const std::string* identifier, properties_t properties, Type
 
 	type_ = type;
 	length_ = length;
+	lengthAllocated_ = length;
 
 	if(nullptr == identifier)
 	{
@@ -3213,6 +6841,16 @@ Variable::Variable(const std::string* identifier, properties_t properties, Type
 
 bool Variable::GetDeclaration(std::string* decl) const
 {
+	if(arena_.length())
+	{
+		// A view, declared by the instructions using it: Arrays used by the same instruction never overlap.
+		char tmpBuff[256];
+		SNPRINTF(tmpBuff, sizeof(tmpBuff), "%s * const restrict %s __attribute__((unused)) = __builtin_assume_aligned(&%s[%lu], %lu);",
+				GetTypeString(), identifier_.c_str(), arena_.c_str(), arenaOffset_, ALIGNMENT);
+		decl->append(tmpBuff);
+		return true;
+	}
+
 	if(properties_ & PROPERTY_STATIC)
 	{
 		decl->append("static ");
@@ -3233,6 +6871,7 @@ bool Variable::GetDeclaration(std::string* decl) const
 	decl->append(typeStr);
 	decl->append(" ");
 
+
 	if(properties_ & PROPERTY_POINTER)
 	{
 		decl->append("* ");
@@ -3250,10 +6889,15 @@ bool Variable::GetDeclaration(std::string* decl) const
 	{
 		if(1 < length_) // this is an array
 		{
-			char tmpBuff[40];
-			SNPRINTF(tmpBuff, sizeof(tmpBuff), "[%lu]", length_);
+			char tmpBuff[64];
+			SNPRINTF(tmpBuff, sizeof(tmpBuff), "[%lu] __attribute__((aligned(%lu)))", lengthAllocated_, ALIGNMENT);
 			decl->append(tmpBuff);
 		}
+
+		if(properties_ & PROPERTY_CONST)
+		{
+			decl->append(" __attribute__((unused))"); // Instructions may have folded the values in, or their readers been folded
+		}
 	}
 
 	// Any initializer supplied?
@@ -3371,4 +7015,66 @@ size_t Variable::Length() const
 	return length_;
 }
 
+bool Variable::IsInArena() const
+{
+	return 0 != arena_.length();
+}
+
+bool Variable::PlaceInArena(const std::string * arena, size_t offset)
+{
+	if((properties_ & (PROPERTY_POINTER | PROPERTY_CONST)) || (1 >= length_))
+	{
+		Error("Only mutable arrays can be placed in an arena!\n");
+		return false;
+	}
+
+	arena_ = *arena;
+	arenaOffset_ = offset;
+
+	return true;
+}
+
+size_t Variable::LengthAllocated() const
+{
+	return lengthAllocated_;
+}
+
+bool Variable::PadToAlignment()
+{
+	if((properties_ & PROPERTY_POINTER) || (1 >= length_))
+	{
+		return true; // Not allocated here or no array
+	}
+
+	const size_t elementSize = ElementSize();
+	if(0 == elementSize)
+	{
+		Error("Unknown type!\n");
+		return false;
+	}
+
+	const size_t elementsPerAlignment = ALIGNMENT / elementSize;
+	lengthAllocated_ = ((length_ + elementsPerAlignment - 1) / elementsPerAlignment) * elementsPerAlignment;
+
+	return true;
+}
+
+size_t Variable::ElementSize() const
+{
+	switch(type_)
+	{
+	case Type::uint8_: // no break intended
+	case Type::int8_:
+		return 1;
+
+	case Type::int32_: // no break intended
+	case Type::float_:
+		return 4;
+
+	default: // no break intended
+	case Type::none:
+		return 0;
+	}
+}
+
 
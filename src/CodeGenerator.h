@@ -29,6 +29,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <stdint.h>
 
 #include "Graph.h"
 #include "Module.h"
@@ -67,12 +68,19 @@ public:
 		nrOf,
 	};
 
+	static const size_t ALIGNMENT = 64; // Bytes, arrays start at a cache line
+
 	Variable(const std::string* identifier, properties_t properties, Type type, size_t length = 1, const void* value = nullptr);
 
 	bool GetDeclaration(std::string* decl) const;
 	const std::string * GetIdentifier() const;
 	bool GetElement(std::string* elem,  const char *elemIndex) const;
 	size_t Length() const;
+	size_t LengthAllocated() const; // Length plus padding
+	bool PadToAlignment(); // Allocate whole multiples of ALIGNMENT
+	bool PlaceInArena(const std::string * arena, size_t offset); // Use arena[offset] instead of an own array
+	bool IsInArena() const;
+	size_t ElementSize() const;
 	bool HasProperty(properties_t property) const;
 	bool AddProperty(properties_t property);
 	Type GetType() const;
@@ -83,6 +91,9 @@ private:
 	properties_t properties_;
 	Type type_;
 	size_t length_;
+	size_t lengthAllocated_;
+	std::string arena_; // Empty if not placed in an arena
+	size_t arenaOffset_ = 0;
 	std::string identifier_;
 	const void* value_;
 	uint32_t runningNumber_ = 0; // To make declarations unique
@@ -107,14 +118,19 @@ class CodeGenerator {
 	bool GenerateStaticVariableDeclarations();
 	bool GenerateLocalVariableDeclaration(const Variable * var);
 	bool GenerateRunFunction();
+	bool GenerateSequentialRunFunction();
+	bool GenerateStaticRunFunction();
 	bool GenerateInstructions();
 	bool GenerateNodesArray();
-	bool GenerateInstructionId(std::string * instrId, const Node::Id_t nodeId);
+	bool GenerateInstructionId(std::string * instrId, const Node::Id_t nodeId, const size_t tile = SIZE_MAX); // tile: Tile of a split node
+	bool GenerateEdgeArray(const char * arrayName, const char * type, const std::vector<uint32_t> * arrayPositions);
 	bool GenerateNodesElem(
+			const std::string * instrId,
 			const Node::Id_t nodeId,
-			const std::vector<Node::Id_t> * parents,
-			const std::vector<Node::Id_t> * children);
+			const std::pair<size_t, size_t> * parentsSlice,
+			const std::pair<size_t, size_t> * childrenSlice);
 
+	bool GenerateArenaViews(const Node * node, FileWriter * file); // Declare the arena arrays used by node's instruction
 	bool GenerateOperationCode(const Node* node, FileWriter * file);
 	bool OutputCode(const Node* node, FileWriter * file);
 	bool InputCode(const Node* node, FileWriter * file);
@@ -126,34 +142,160 @@ class CodeGenerator {
 	bool VectorPowerCode(const Node* node, FileWriter * file);
 	bool VectorVectorProductKroneckerDeltaCode(const Node* node, FileWriter * file, bool divide = false);
 	bool VectorComparisonIsSmallerCode(const Node* node, FileWriter * file);
-	bool VectorContractionCode(const Node* node, FileWriter * file);
+	bool VectorContractionCode(const Node* node, FileWriter * file, const Node * epilogue = nullptr); // epilogue: Element-wise sink computed from the result
 	bool VectorContractionKroneckerDeltaCode(const Node* node, FileWriter * file);
+	bool VectorAdditionKroneckerDeltaCode(const Node* node, FileWriter * file);
+
+	typedef struct {
+		size_t M, N, K; // op[M][N] = l[M][K] * r[K][N]
+		size_t lStrideRow, lStrideInner; // l[m][k] = l[m * lStrideRow + k * lStrideInner]
+		size_t rStrideInner, rStrideCol; // r[k][n] = r[k * rStrideInner + n * rStrideCol]
+		size_t lOffset, rOffset; // Of the first element, in case the operands are views
+	} matrixProductShape_t;
+
+	bool GetMatrixProductShape(const Node * node, matrixProductShape_t * shape) const; // false if not a (large) matrix product
+	bool VectorMatrixProductCode(const Node* node, const matrixProductShape_t * shape, FileWriter * file, const Node * epilogue = nullptr);
+
+	typedef struct {
+		size_t operand; // Position of the packed operand in the parents
+		size_t freeLength; // Elements of the dense operand's factors which are not contracted
+		size_t opStride, argStride; // Between those elements, in the result and in the dense operand
+		std::vector<uint32_t> elements; // Per term: Stored element of the packed operand
+		std::vector<uint32_t> opOffsets, argOffsets; // Per term: First element of the result and the dense operand it is multiplied with
+		size_t addedNrOf; // Terms added, the remaining ones are mirror images of antisymmetric elements and subtracted
+	} packedContraction_t;
+
+	bool GetPackedContraction(const Node * node, packedContraction_t * packed) const; // false if not exactly one operand is packed
+	bool PackedContractionCode(const Node* node, const packedContraction_t * packed, FileWriter * file, const Node * epilogue = nullptr);
+
+	typedef struct {
+		size_t rowsNrOf; // Of the square result
+		size_t innerLength; // Of the contracted factor
+		size_t rowStride, innerStride; // a[i][k] = a[offset + i * rowStride + k * innerStride]
+		size_t offset;
+	} symmetricProduct_t;
+
+	bool GetSymmetricProduct(const Node * node, symmetricProduct_t * product) const; // false if not a (small) product a a^T
+	bool SymmetricProductCode(const Node* node, const symmetricProduct_t * product, FileWriter * file, const Node * epilogue = nullptr);
 	bool ControlTransferWhileCode(const Node* node, FileWriter * file);
 	bool VectorPermutationCode(const Node* node, FileWriter * file);
 	bool VectorProjectionCode(const Node* node, FileWriter * file);
 	bool VectorJoinIndicesCode(const Node* node, FileWriter * file);
 	bool VectorIndexSplitSumCode(const Node* node, FileWriter * file);
 	bool VectorCrossCorrelationCode(const Node* node, FileWriter * file);
+	bool CrossCorrelationLoopCode(const Node* node, FileWriter * file);
+	const float * GetConstantKernel(const Node * node) const; // Cross-correlation kernel values known at generation time, else nullptr
+	size_t GetCrossCorrelationTapsNrOf(const Node * node) const;
 	bool VectorMaxPoolCode(const Node* node, FileWriter * file);
+	bool NeedsArgmax(const Node * node) const; // Whether a max pool has to record the positions of its maxima
+	bool VectorMaxPoolDerivativeCode(const Node* node, FileWriter * file);
+	bool FusedElementWiseCode(const Node* node, FileWriter * file);
+	bool GetElementWiseExpression(std::string * expr, const Node * node, bool vector); // Element dim of node, computed from its operands
+	bool GetOperandElement(std::string * elem, Node::Id_t id, bool vector);
+	bool IsFusedSimdApplicable(const Variable * varOp, const Node * node);
+	bool GetEpilogueExpression(std::string * expr, const Node * epilogue, const std::string &result); // result: Element of the fused contraction
+
+	size_t GetSimdWidth() const;
+	size_t GetSimdLanesNrOf(const Variable * var) const; // 1 if not vectorized
+	std::string GetSimdTypeString(const Variable * var, bool unaligned = false) const;
+	bool GenerateSimdTypes();
+	std::string GetSimdElement(const Variable * var, bool vector, bool isConst) const;
+	bool GenerateSimdLoop(FileWriter * file, const Variable * varOp, size_t length, const std::string * vectorStatement, const std::string * scalarStatement);
+	size_t GetSimdLoopLength(const Variable * varOp, const Variable * lVar, const Variable * rVar) const;
+	bool IsSimdApplicable(const Variable * varOp, const Variable * lVar, const Variable * rVar) const;
+	void GenerateOpIndexLoop(FileWriter * file, const Algebra::Module::VectorSpace * vspace) const; // Opens a loop over opIndex and its opIndexTuple
+	void GenerateOpIndexLoopEnd(FileWriter * file, const Algebra::Module::VectorSpace * vspace) const;
 
+	typedef struct {
+		Node::Id_t base; // Node whose array is read
+		std::vector<size_t> strides; // Per factor of the viewed vector, in elements of base
+		size_t offset;
+	} view_t;
+
+	bool FoldConstants();
+	bool IsFolded(Node::Id_t id) const;
+	const float * GetConstantValue(Node::Id_t id) const; // Elements known at generation time, i.e. of constants and folded nodes, else nullptr
+	bool GetIntegerExponent(int32_t * exponent, const Node * node) const; // Constant, small integer exponent of a power
+	bool EvaluateNode(std::vector<float> * result, const Node * node) const; // Reference interpreter, false if node can't be computed at generation time
+	bool FoldViews();
+	typedef struct {
+		std::vector<uint32_t> positions; // Per stored element: Its position in the dense vector
+		std::vector<uint32_t> mirrors; // Per stored element: Position of its mirror image, its own position if it has none
+		float mirrorSign; // Mirror image / stored element: 1 if symmetric, -1 if antisymmetric
+	} packing_t;
+
+	bool PropagatePacking();
+	bool IsPacked(Node::Id_t id) const;
+	bool IsView(Node::Id_t id) const; // Permutation, projection or join read in place by its consumer
+	bool GetView(view_t * view, Node::Id_t id) const; // Where the elements of node id are stored
+	bool FuseElementWiseNodes();
 	bool FetchVariables();
 	bool GetFirstNodesToExecute(std::set<Node::Id_t> * nodeSet);
+	bool GetInstructionsTopologicalOrder(std::vector<Node::Id_t> * order) const;
+	bool GetStaticOrder(std::vector<Node::Id_t> * order, const Node ** controlTransfer, std::set<Node::Id_t> * loopBody) const;
+	bool HasInstruction(const Node * node) const;
+	bool IsFused(Node::Id_t id) const;
+	Node::Id_t GetFusionSink(Node::Id_t id) const; // The instruction computing a (fused) node
+	void GetFusedOperands(std::vector<Node::Id_t> * operands, const Node * node) const; // Parents, fused ones replaced by their operands
+	void GetInstructionParents(std::vector<Node::Id_t> * parents, const Node * node) const;
+	const Node * GetFusedContraction(const Node * node) const; // The contraction whose loop computes node, if any
+	bool PlanMemory();
+	size_t GetNodeLength(Node::Id_t id) const;
+	double EstimateCost(const Node * node) const;
+	size_t GetTilesNrOf(const Node * node) const;
+	size_t GetTileGranularity(const Node * node) const;
 
+	bool GetRootAncestorChildren(std::set<Node::Id_t> * rootChildren, Node::Id_t child) const;
 	bool GetRootAncestorInstructionPositions(std::set<uint32_t> * instructionPos, Node::Id_t child);
+	bool GetControlTransferBranchTrue(std::set<Node::Id_t> * rootChildren, const Node * node) const;
 
 	std::map<Node::Id_t, Variable> variables_;
 	Variable* GetVariable(Node::Id_t id);
 
+	std::map<Node::Id_t, std::vector<float>> foldedValues_; // Nodes computed at generation time, see FoldConstants
+	std::vector<Node::Id_t> foldedOrder_; // Folded nodes, operands first
+	std::map<Node::Id_t, Node::Id_t> fusedInto_; // Element-wise node or view, its only child which computes or reads it in place
+	std::map<Node::Id_t, packing_t> packing_; // Vectors only storing their non-zeros, diagonal or a triangle
+	std::map<Node::Id_t, std::vector<float>> packedValues_; // Stored elements of packed constants
 	std::map<Node::Id_t, const Node*> nodesInstructionMap_;
-	std::map<Node::Id_t, uint32_t> nodeArrayPos_;
+	std::map<Node::Id_t, std::vector<uint32_t>> nodeArrayPos_; // More than one if the node is split into tiles
+	std::map<std::string, size_t> arenas_; // Element type, length
+	std::string memoryPlanReport_;
+	std::pair<size_t, size_t> opIndexRange_ = {0, 0}; // Result elements of the tile being generated, empty for all
+	std::string contractionElement_; // Replaces the fused contraction in the epilogue being generated
 
-	size_t ThreadsNrOf_;
+	size_t ThreadsNrOf_ = 1;
 
 public:
+	enum class Scheduling {
+		DYNAMIC, // Thread pool executing ready nodes, see NodeExecutor
+		SEQUENTIAL, // Single-threaded, instructions called in topological order. No thread pool.
+		STATIC, // Instructions partitioned across threadsNrOf threads at generation time.
+	};
+
+	enum class Simd {
+		GENERIC, // Scalar loops, vectorization is up to the compiler
+		SSE2, // Explicit vectors of the ISA's width, the generated code has to be compiled for it.
+		AVX2,
+		AVX512,
+	};
+
 	CodeGenerator(const std::string* path);
 	virtual ~CodeGenerator();
 
+	void SetScheduling(Scheduling scheduling, size_t threadsNrOf = 1);
+	void SetSimd(Simd simd);
+	void SetPadding(bool padding); // Pad arrays to a multiple of the alignment, vector loops may then skip the remainder.
+	void SetMemoryPlanning(bool memoryPlanning); // Sequential scheduling only: Intermediate arrays with disjoint lifetimes share memory.
+	void SetConstantFolding(bool constantFolding); // Nodes only depending on constants are computed at generation time.
 	bool Generate(const Graph* graph);
+
+private:
+	Scheduling scheduling_ = Scheduling::DYNAMIC;
+	Simd simd_ = Simd::GENERIC;
+	bool padding_ = false;
+	bool memoryPlanning_ = false;
+	bool constantFolding_ = false;
 };
 
 #endif /* SRC_CODEGENERATOR_H_ */
@@ -20,6 +20,10 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <math.h>
+#include <unordered_map>
+
 #include "GlobalDefines.h"
 #include "Graph.h"
 
@@ -202,6 +206,9 @@ const char* Node::getName(Type type)
 	case Type::VECTOR_MAX_POOL:
 		return "VECTOR_MAX_POOL";
 
+	case Type::VECTOR_MAX_POOL_DERIVATIVE:
+		return "VECTOR_MAX_POOL_DERIVATIVE";
+
 	case Type::VECTOR_JOIN_INDICES:
 		return "VECTOR_JOIN_INDICES";
 
@@ -309,9 +316,16 @@ bool Node::sameObject(const Node &lNode, const Node &rNode)
 		break;
 
 	case Object_t::INTERFACE_OUTPUT:
-		// TODO: currently, interface objects only contain the name
-		// so technically they are the same with different names.
-		// with this code we are simply replacing one of them, which might be unexpected.
+	{
+		// Each name has its own callback: Outputs of one node under different names all stay
+		auto lOut = (const Interface::Output *) lNode.ObjectPt_;
+		auto rOut = (const Interface::Output *) rNode.ObjectPt_;
+
+		if(*lOut->GetName() != *rOut->GetName())
+		{
+			return false;
+		}
+	}
 		break;
 
 	case Object_t::INTERFACE_INPUT:
@@ -360,6 +374,7 @@ bool Node::sameType(const Node &lNode, const Node &rNode)
 	case Type::OUTPUT: // no break intended
 	case Type::INPUT: // no break intended
 	case Type::VECTOR_CROSS_CORRELATION: // no break intended
+	case Type::VECTOR_MAX_POOL_DERIVATIVE: // no break intended
 		Error("Error comparing node types!\n");
 		return false;
 
@@ -470,7 +485,7 @@ bool Node::sameType(const Node &lNode, const Node &rNode)
 
 bool Node::areDuplicate(const Node &lNode, const Node &rNode)
 {
-	if(!std::equal(lNode.parents.begin(), lNode.parents.end(), rNode.parents.begin()))
+	if(lNode.parents != rNode.parents)
 	{
 		return false;
 	}
@@ -480,7 +495,7 @@ bool Node::areDuplicate(const Node &lNode, const Node &rNode)
 		return false;
 	}
 
-	if(!std::equal(lNode.usedAsStorageBy_.begin(), lNode.usedAsStorageBy_.end(), rNode.usedAsStorageBy_.begin()))
+	if(lNode.usedAsStorageBy_ != rNode.usedAsStorageBy_)
 	{
 		return false;
 	}
@@ -598,161 +613,1100 @@ bool Graph::GetRootAncestors(std::set<Node::Id_t> * rootParents, Node::Id_t chil
 
 void Graph::RemoveDuplicates()
 {
-	size_t infLoopTimein = nodes_.size();
-	size_t nodesRemoved;
-	do {
-		nodesRemoved = 0; // As long as nodes are removed do this.
+	// Visiting parents before children, the parents of every node are already free of duplicates:
+	// Equal nodes then have equal parents and one pass through a hash index finds them all.
+	std::vector<Node::Id_t> order;
+	GetTopologicalOrder(&order);
+
+	std::vector<Node::Id_t> referencing;
+	GetReferencingNodes(&referencing);
+
+	std::unordered_map<size_t, std::vector<Node::Id_t>> hashMap;
+	hashMap.reserve(nodes_.size());
+
+	size_t nodesRemoved = 0;
+	for(const Node::Id_t &id: order)
+	{
+		const Node &node = nodes_.at(id);
+		std::vector<Node::Id_t> &candidates = hashMap[node.getPartialHash()];
+
+		const auto duplicate = std::find_if(candidates.begin(), candidates.end(),
+				[&](Node::Id_t candidate) {return Node::areDuplicate(nodes_.at(candidate), node);});
+
+		if(candidates.end() == duplicate)
+		{
+			candidates.push_back(id);
+			continue;
+		}
+
+		MergeNode(id, *duplicate, referencing);
+		nodesRemoved++;
+	}
+
+	printf("Removed %lu duplicate Nodes\n", nodesRemoved);
+}
+
+void Graph::GetTopologicalOrder(std::vector<Node::Id_t> * order) const
+{
+	order->clear();
+	order->reserve(nodes_.size());
+
+	std::map<Node::Id_t, size_t> parentsLeft;
+	std::set<Node::Id_t> ready;
+	for(const auto &nodePair: nodes_)
+	{
+		const size_t parentsNrOf = nodePair.second.Parents()->size();
+		if(parentsNrOf)
+		{
+			parentsLeft[nodePair.first] = parentsNrOf;
+		}
+		else
+		{
+			ready.insert(nodePair.first);
+		}
+	}
+
+	while(!ready.empty())
+	{
+		const Node::Id_t id = *ready.begin();
+		ready.erase(ready.begin());
+		order->push_back(id);
+
+		for(const Node::Id_t &child: *nodes_.at(id).Children())
+		{
+			const auto *parents = nodes_.at(child).Parents();
+			size_t &left = parentsLeft.at(child);
+			left -= std::count(parents->begin(), parents->end(), id);
+
+			if(0 == left)
+			{
+				ready.insert(child);
+			}
+		}
+	}
+}
+
+// Nodes referring to others other than as parent, i.e. as branch or storage
+void Graph::GetReferencingNodes(std::vector<Node::Id_t> * referencing) const
+{
+	referencing->clear();
+	for(const auto &nodePair: nodes_)
+	{
+		if((Node::Type::CONTROL_TRANSFER_WHILE == nodePair.second.GetType()) ||
+				(Node::ID_NONE != nodePair.second.IsStoredIn()) || nodePair.second.UsedAsStorageByOthers())
+		{
+			referencing->push_back(nodePair.first);
+		}
+	}
+}
+
+void Graph::MergeNode(Node::Id_t id, Node::Id_t into, const std::vector<Node::Id_t> &referencing)
+{
+	for(const Node::Id_t &refId: referencing)
+	{
+		auto refIt = nodes_.find(refId);
+		if(nodes_.end() == refIt)
+		{
+			continue; // merged itself
+		}
+
+		Node &ref = refIt->second;
+		if(Node::Type::CONTROL_TRANSFER_WHILE == ref.GetType())
+		{
+			auto pWhile = (Node::ControlTransferParameters_t*) ref.TypeParametersModifiable();
+			if(id == pWhile->BranchTrue)
+			{
+				pWhile->BranchTrue = into;
+			}
+
+			if(id == pWhile->BranchFalse)
+			{
+				pWhile->BranchFalse = into;
+			}
+		}
+
+		if(id == ref.IsStoredIn())
+		{
+			ref.StoreIn(into);
+		}
 
-		if(0 == infLoopTimein--)
+		if(ref.RemoveStorageFor(id))
 		{
-			Error("RemoveDuplicates() did not finish!\n");
-			break;
+			ref.UseAsStorageFor(into);
 		}
+	}
+
+	ReplaceNode(id, into);
+}
+
+// The value of a constant scalar, false if node is none
+static bool getConstantScalar(const Node &node, float * value)
+{
+	if((Node::Object_t::MODULE_VECTORSPACE_VECTOR != node.GetObject()) || (Node::Type::VECTOR != node.GetType()) ||
+			(Node::ID_NONE != node.IsStoredIn()) || node.UsedAsStorageByOthers())
+	{
+		return false;
+	}
+
+	auto vec = (const Algebra::Module::VectorSpace::Vector *) node.GetObjectPt();
+	if((nullptr == vec->InitValue()) || (1 != vec->Space()->GetDim()))
+	{
+		return false;
+	}
+
+	switch(vec->Space()->GetRing())
+	{
+	case Algebra::Ring::Float32:
+		*value = *((const float *) vec->InitValue());
+		return true;
+
+	case Algebra::Ring::Int32:
+		*value = (float) *((const int32_t *) vec->InitValue());
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+static bool sameSpace(const Node &lNode, const Node &rNode)
+{
+	if((Node::Object_t::MODULE_VECTORSPACE_VECTOR != lNode.GetObject()) || (Node::Object_t::MODULE_VECTORSPACE_VECTOR != rNode.GetObject()))
+	{
+		return false;
+	}
+
+	auto lVec = (const Algebra::Module::VectorSpace::Vector *) lNode.GetObjectPt();
+	auto rVec = (const Algebra::Module::VectorSpace::Vector *) rNode.GetObjectPt();
+
+	return Algebra::Module::VectorSpace::AreEqual(lVec->Space(), rVec->Space());
+}
+
+void Graph::Simplify()
+{
+	// Derivatives multiply by one, add zeros, contract with unit deltas and permute back and forth.
+	// Such nodes are replaced by the operand they copy, then nodes no one reads are removed.
+	size_t rewrittenNrOf = 0;
+	size_t removedNrOf = 0;
+
+	bool changed = true;
+	while(changed)
+	{
+		changed = false;
 
-		// Search for all Nodes of same type with same parents
-		// Get all nodes with equal partial hash
-		std::map<size_t, std::vector<Node::Id_t>> hashMap;
+		std::vector<Node::Id_t> ids;
 		for(const auto &nodePair: nodes_)
 		{
-			const auto insertRet = hashMap.insert(std::pair<size_t, std::vector<Node::Id_t>>{
-				nodePair.second.getPartialHash(),
-						std::vector<Node::Id_t>{nodePair.first}});
+			ids.push_back(nodePair.first);
+		}
+
+		for(const Node::Id_t &id: ids)
+		{
+			auto nodeIt = nodes_.find(id);
+			if(nodes_.end() == nodeIt)
+			{
+				continue; // Removed in this pass
+			}
+
+			Node * node = &nodeIt->second;
+
+			const Node::Id_t replacement = GetReplacement(*node);
+			if(Node::ID_NONE != replacement)
+			{
+				ReplaceNode(id, replacement);
+				rewrittenNrOf++;
+				changed = true;
+				continue;
+			}
 
-			if(!insertRet.second) // hash already present.
+			if(ComposePermutations(node))
 			{
-				insertRet.first->second.push_back(nodePair.first);
+				rewrittenNrOf++;
+				changed = true;
 			}
 		}
 
-		for(auto &hashPair: hashMap)
+		for(const Node::Id_t &id: ids)
 		{
-			if(1 >= hashPair.second.size())
+			auto nodeIt = nodes_.find(id);
+			if((nodes_.end() != nodeIt) && IsUnread(nodeIt->second))
 			{
-				continue; // no duplicate!
+				RemoveNode(id);
+				removedNrOf++;
+				changed = true;
 			}
+		}
+	}
+
+	printf("Simplified %lu Nodes, removed %lu unread Nodes\n", rewrittenNrOf, removedNrOf);
+}
+
+Node::Id_t Graph::GetReplacement(const Node &node) const
+{
+	if((Node::Object_t::MODULE_VECTORSPACE_VECTOR != node.GetObject()) || (0 == node.Parents()->size()) ||
+			(Node::ID_NONE != node.IsStoredIn()) || node.UsedAsStorageByOthers() || IsBranch(node.id))
+	{
+		return Node::ID_NONE;
+	}
+
+	// The children would read the operand later than the node did: It must not be overwritten in between.
+	// Deltas have no array to read.
+	auto copies = [this, &node](Node::Id_t operand)
+	{
+		const Node * operandNode = GetNode(operand);
+		return !operandNode->UsedAsStorageByOthers() && sameSpace(node, *operandNode) &&
+				(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != operandNode->GetType());
+	};
 
-			printf("Found %lu possible duplicates Nodes: ", hashPair.second.size());
+	const std::vector<Node::Id_t> * parents = node.Parents();
+	float value;
 
-			std::vector<std::vector<Node::Id_t>> duplicates;
-			for(auto currNodeIt = hashPair.second.begin(); currNodeIt < hashPair.second.end() - 1; currNodeIt++)
+	switch(node.GetType())
+	{
+	case Node::Type::VECTOR_ADDITION:
+		for(size_t operand = 0; operand < 2; operand++)
+		{
+			if(IsZero(parents->at(operand)) && copies(parents->at(1 - operand)))
 			{
-				std::vector<Node::Id_t> currentDup{*currNodeIt};
+				return parents->at(1 - operand);
+			}
+		}
+		return Node::ID_NONE;
 
-				const auto hashNode = nodes_.find(*currNodeIt);
+	case Node::Type::VECTOR_SCALAR_PRODUCT:
+		for(size_t operand = 0; operand < 2; operand++)
+		{
+			if(getConstantScalar(*GetNode(parents->at(operand)), &value) && (1.f == value) && copies(parents->at(1 - operand)))
+			{
+				return parents->at(1 - operand);
+			}
+		}
+		return Node::ID_NONE;
 
-				for(auto cmpNodeIt = currNodeIt + 1; cmpNodeIt < hashPair.second.end(); cmpNodeIt++)
-				{
-					const auto cmpNode = nodes_.find(*cmpNodeIt);
+	case Node::Type::VECTOR_POWER:
+		if(getConstantScalar(*GetNode(parents->at(1)), &value) && (1.f == value) && copies(parents->at(0)))
+		{
+			return parents->at(0);
+		}
+		return Node::ID_NONE;
 
-					if(Node::areDuplicate(hashNode->second, cmpNode->second))
-					{
-						currentDup.push_back(*cmpNodeIt);
-						cmpNodeIt = hashPair.second.erase(cmpNodeIt);
-					}
-				}
+	case Node::Type::VECTOR_PERMUTATION:
+	{
+		// Result factor indices[a] is argument factor a: Identities, also of two permutations, copy
+		std::vector<uint32_t> indices = ((const Node::permuteParameters_t *) node.TypeParameters())->indices;
+		Node::Id_t operand = parents->at(0);
 
-				duplicates.push_back(currentDup);
+		const Node * operandNode = GetNode(operand);
+		if(Node::Type::VECTOR_PERMUTATION == operandNode->GetType())
+		{
+			const std::vector<uint32_t> &operandIndices = ((const Node::permuteParameters_t *) operandNode->TypeParameters())->indices;
+			std::vector<uint32_t> composed(operandIndices.size());
+			for(size_t factor = 0; factor < composed.size(); factor++)
+			{
+				composed[factor] = indices[operandIndices[factor]];
 			}
 
-			printf("Reduced to %lu Nodes\n", duplicates.size());
+			indices = composed;
+			operand = operandNode->Parents()->at(0);
+		}
 
-			for(const auto &equalNodes: duplicates)
+		for(uint32_t factor = 0; factor < indices.size(); factor++)
+		{
+			if(factor != indices[factor])
 			{
-				if(1 >= equalNodes.size())
-				{
-					continue; // nothing to do.
-				}
+				return Node::ID_NONE;
+			}
+		}
+
+		return copies(operand) ? operand : Node::ID_NONE;
+	}
+
+	case Node::Type::VECTOR_CONTRACTION:
+	{
+		const Node::Id_t operand = GetDeltaContractionOperand(node);
+		return ((Node::ID_NONE != operand) && copies(operand)) ? operand : Node::ID_NONE;
+	}
+
+	default:
+		return Node::ID_NONE;
+	}
+}
+
+Node::Id_t Graph::GetDeltaContractionOperand(const Node &node) const
+{
+	// Contracting one index of each unit delta only renames the other operand's indices.
+	// It's a copy if they keep their order.
+	const Node::contractParameters_t * param = (const Node::contractParameters_t *) node.TypeParameters();
+
+	for(size_t deltaSide = 0; deltaSide < 2; deltaSide++)
+	{
+		const Node * deltaNode = GetNode(node.Parents()->at(deltaSide));
+		const Node * denseNode = GetNode(node.Parents()->at(1 - deltaSide));
+		if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != deltaNode->GetType()) ||
+				(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == denseNode->GetType()))
+		{
+			continue;
+		}
+
+		const Node::KroneckerDeltaParameters_t * deltaParam = (const Node::KroneckerDeltaParameters_t *) deltaNode->TypeParameters();
+		if(1.f != deltaParam->Scaling)
+		{
+			continue;
+		}
+
+		const std::vector<uint32_t> &deltaContracted = (0 == deltaSide) ? param->lfactors : param->rfactors;
+		const std::vector<uint32_t> &denseContracted = (0 == deltaSide) ? param->rfactors : param->lfactors;
+		auto isContracted = [&deltaContracted](uint32_t factor)
+		{
+			return deltaContracted.end() != std::find(deltaContracted.begin(), deltaContracted.end(), factor);
+		};
+
+		// Result factors: Free ones of the left, then of the right operand
+		std::vector<uint32_t> deltaFreePos(deltaParam->DeltaPair.size());
+		uint32_t deltaFreeNrOf = 0;
+		bool oneOfEachPair = true;
+		for(uint32_t factor = 0; factor < deltaParam->DeltaPair.size(); factor++)
+		{
+			oneOfEachPair = oneOfEachPair && (isContracted(factor) != isContracted(deltaParam->DeltaPair[factor]));
+			if(!isContracted(factor))
+			{
+				deltaFreePos[factor] = deltaFreeNrOf++;
+			}
+		}
 
-				nodesRemoved += equalNodes.size() - 1;
+		auto denseVec = (const Algebra::Module::VectorSpace::Vector *) denseNode->GetObjectPt();
+		const uint32_t denseFactorsNrOf = denseVec->Space()->Factors()->size();
+		if(!oneOfEachPair || (denseFactorsNrOf < denseContracted.size()))
+		{
+			continue;
+		}
 
-				ReduceToOne(equalNodes);
+		const uint32_t deltaOffset = (0 == deltaSide) ? 0 : denseFactorsNrOf - denseContracted.size();
+		uint32_t densePos = (0 == deltaSide) ? deltaFreeNrOf : 0;
+
+		bool inOrder = true;
+		for(uint32_t factor = 0; factor < denseFactorsNrOf; factor++)
+		{
+			auto it = std::find(denseContracted.begin(), denseContracted.end(), factor);
+			if(denseContracted.end() == it)
+			{
+				inOrder = inOrder && (factor == densePos++);
+				continue;
 			}
+
+			// Takes the index of the delta factor paired with the one it is contracted with
+			const uint32_t partner = deltaParam->DeltaPair[deltaContracted[std::distance(denseContracted.begin(), it)]];
+			inOrder = inOrder && (factor == deltaOffset + deltaFreePos[partner]);
 		}
 
-	} while(nodesRemoved);
+		if(inOrder)
+		{
+			return denseNode->id;
+		}
+	}
 
-	return;
+	return Node::ID_NONE;
 }
 
-bool Graph::ReduceToOne(const std::vector<Node::Id_t> &nodes)
+bool Graph::ComposePermutations(Node * node)
 {
-	if(1 >= nodes.size())
+	// A permutation of a permutation reads the latter's operand with the composed indices
+	if(Node::Type::VECTOR_PERMUTATION != node->GetType())
 	{
-		return true; // nothing to do
+		return false;
 	}
 
-	printf("Replacing ");
-	for(size_t nodePos = 1; nodePos < nodes.size(); nodePos++)
+	const Node * operandNode = GetNode(node->Parents()->at(0));
+	if((Node::Type::VECTOR_PERMUTATION != operandNode->GetType()) || GetNode(operandNode->Parents()->at(0))->UsedAsStorageByOthers())
 	{
-		printf("%u, ", nodes[nodePos]);
+		return false;
 	}
-	printf("with %u\n", nodes[0]);
 
-	const Node::Id_t newNodeId = nodes[0];
-	auto newNodeIt = nodes_.find(newNodeId);
+	auto indices = &((Node::permuteParameters_t *) node->TypeParametersModifiable())->indices;
+	const std::vector<uint32_t> &operandIndices = ((const Node::permuteParameters_t *) operandNode->TypeParameters())->indices;
 
-	// Remove nodes (we'll keep the first one and replace the others with it)
-	for(size_t nodePos = 1; nodePos < nodes.size(); nodePos++)
+	std::vector<uint32_t> composed(operandIndices.size());
+	for(size_t factor = 0; factor < composed.size(); factor++)
+	{
+		composed[factor] = indices->at(operandIndices[factor]);
+	}
+
+	const Node::Id_t operand = operandNode->Parents()->at(0);
+	GetNodeModifyable(operandNode->id)->ChildrenModifiable()->erase(node->id);
+	GetNodeModifyable(operand)->ChildrenModifiable()->insert(node->id);
+
+	node->ParentsModifiable()->at(0) = operand;
+	*indices = composed;
+
+	return true;
+}
+
+bool Graph::IsZero(Node::Id_t id) const
+{
+	const Node * node = GetNode(id);
+
+	switch(node->GetType())
+	{
+	case Node::Type::VECTOR:
+	{
+		auto vec = (const Algebra::Module::VectorSpace::Vector *) node->GetObjectPt();
+		if((nullptr == vec->InitValue()) || (Node::ID_NONE != node->IsStoredIn()) || node->UsedAsStorageByOthers())
+		{
+			return false;
+		}
+
+		for(dimension_t element = 0; element < vec->Space()->GetDim(); element++)
+		{
+			const bool isZero = (Algebra::Ring::Float32 == vec->Space()->GetRing()) ?
+					(0.f == ((const float *) vec->InitValue())[element]) :
+					((Algebra::Ring::Int32 == vec->Space()->GetRing()) && (0 == ((const int32_t *) vec->InitValue())[element]));
+
+			if(!isZero)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	case Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT:
+		return 0.f == ((const Node::KroneckerDeltaParameters_t *) node->TypeParameters())->Scaling;
+
+	case Node::Type::VECTOR_SCALAR_PRODUCT: // no break intended
+	case Node::Type::VECTOR_VECTOR_PRODUCT: // no break intended
+	case Node::Type::VECTOR_CONTRACTION:
+		return IsZero(node->Parents()->at(0)) || IsZero(node->Parents()->at(1));
+
+	default:
+		return false;
+	}
+}
+
+bool Graph::IsBranch(Node::Id_t id) const
+{
+	for(const auto &nodePair: nodes_)
 	{
-		// Carry over children
-		auto eraseNodeIt = nodes_.find(nodes[nodePos]);
-		newNodeIt->second.ChildrenModifiable()->insert(
-				eraseNodeIt->second.Children()->begin(),
-				eraseNodeIt->second.Children()->end());
+		if(Node::Type::CONTROL_TRANSFER_WHILE != nodePair.second.GetType())
+		{
+			continue;
+		}
+
+		auto pWhile = (const Node::ControlTransferParameters_t *) nodePair.second.TypeParameters();
+		if((id == pWhile->BranchTrue) || (id == pWhile->BranchFalse))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
 
-		nodes_.erase(eraseNodeIt);
+bool Graph::IsUnread(const Node &node) const
+{
+	// Roots and vectors of inputs are kept, they are interfaces
+	if(node.Children()->size() || (0 == node.Parents()->size()) ||
+			(Node::Object_t::MODULE_VECTORSPACE_VECTOR != node.GetObject()) ||
+			(Node::Type::CONTROL_TRANSFER_WHILE == node.GetType()))
+	{
+		return false;
 	}
 
-	// Go through all nodes and replace occurrences of node ids from nodes with newNodeId:
-	for(auto &nodePair: nodes_)
+	for(const Node::Id_t &parent: *node.Parents())
 	{
-		// Go through all class Node::Id_t objects and replace instances of nodes with newNodeId
-		for(size_t nodePos = 1; nodePos < nodes.size(); nodePos++)
+		if(Node::Object_t::MODULE_VECTORSPACE_VECTOR != GetNode(parent)->GetObject())
 		{
-			const Node::Id_t cmpId = nodes[nodePos];
+			return false;
+		}
+	}
+
+	return (Node::ID_NONE == node.IsStoredIn()) && !node.UsedAsStorageByOthers() && !IsBranch(node.id);
+}
+
+void Graph::ReplaceNode(Node::Id_t id, Node::Id_t by)
+{
+	Node * node = GetNodeModifyable(id);
+	Node * byNode = GetNodeModifyable(by);
 
-			for(Node::Id_t &parent: *nodePair.second.ParentsModifiable())
+	for(const Node::Id_t &child: *node->Children())
+	{
+		for(Node::Id_t &parent: *GetNodeModifyable(child)->ParentsModifiable())
+		{
+			if(id == parent)
 			{
-				if(cmpId == parent)
-				{
-					parent = newNodeId;
-				}
+				parent = by;
+			}
+		}
+
+		byNode->ChildrenModifiable()->insert(child);
+	}
+
+	node->ChildrenModifiable()->clear();
+	RemoveNode(id);
+}
+
+void Graph::RemoveNode(Node::Id_t id)
+{
+	for(const Node::Id_t &parent: *GetNode(id)->Parents())
+	{
+		GetNodeModifyable(parent)->ChildrenModifiable()->erase(id);
+	}
+
+	nodes_.erase(id);
+}
+
+// Tensor network of a tree of contractions: Every factor of an operand carries a label, contracted factors share theirs.
+struct contractionNetwork_s {
+	std::vector<Node::Id_t> Leaves; // Operands of the tree, once per read
+	std::vector<std::vector<uint32_t>> LeafLabels;
+	std::vector<double> LabelDims;
+	std::vector<uint32_t> OutputLabels; // In the order of the root's factors
+	std::vector<Node::Id_t> Inner; // Contractions only read inside the tree, children first
+	double Cost = 0.; // Multiply-adds in the order written
+};
+
+typedef Algebra::Module::VectorSpace::Vector vector_t;
+
+// Labels of the contraction of a subset of leaves, i.e. those not contracted inside it
+static void getOpenLabels(std::vector<uint32_t> * labels, const contractionNetwork_s &network, uint64_t mask)
+{
+	std::map<uint32_t, size_t> count;
+	labels->clear();
+	for(size_t leaf = 0; leaf < network.Leaves.size(); leaf++)
+	{
+		if(0 == (mask & ((uint64_t) 1 << leaf)))
+		{
+			continue;
+		}
+
+		for(const uint32_t &label: network.LeafLabels[leaf])
+		{
+			if(1 == ++count[label])
+			{
+				labels->push_back(label);
+			}
+		}
+	}
+
+	labels->erase(std::remove_if(labels->begin(), labels->end(), [&count](uint32_t label){return 1 != count[label];}), labels->end());
+}
+
+static bool containsLabel(const std::vector<uint32_t> &labels, uint32_t label)
+{
+	return labels.end() != std::find(labels.begin(), labels.end(), label);
+}
+
+// Multiply-adds of contracting two subsets: One per element of the product of both
+static double getJoinCost(const contractionNetwork_s &network, const std::vector<uint32_t> &lLabels, const std::vector<uint32_t> &rLabels)
+{
+	double cost = 1.;
+	for(const uint32_t &label: lLabels)
+	{
+		cost *= network.LabelDims[label];
+	}
+
+	for(const uint32_t &label: rLabels)
+	{
+		if(!containsLabel(lLabels, label))
+		{
+			cost *= network.LabelDims[label];
+		}
+	}
+
+	return cost;
+}
+
+static bool shareLabel(const std::vector<uint32_t> &lLabels, const std::vector<uint32_t> &rLabels)
+{
+	for(const uint32_t &label: lLabels)
+	{
+		if(containsLabel(rLabels, label))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Labels of the left operand not contracted with the right one
+static void getResidualLabels(std::vector<uint32_t> * residual, const std::vector<uint32_t> &labels, const std::vector<uint32_t> &otherLabels)
+{
+	residual->clear();
+	for(const uint32_t &label: labels)
+	{
+		if(!containsLabel(otherLabels, label))
+		{
+			residual->push_back(label);
+		}
+	}
+}
+
+// The root keeps its factors: The left residual labels must be the first ones of the output, the right ones the others.
+static bool isRootSplit(const contractionNetwork_s &network, const std::vector<uint32_t> &lLabels, const std::vector<uint32_t> &rLabels)
+{
+	std::vector<uint32_t> lResidual;
+	std::vector<uint32_t> rResidual;
+	getResidualLabels(&lResidual, lLabels, rLabels);
+	getResidualLabels(&rResidual, rLabels, lLabels);
+
+	if(lResidual.size() + rResidual.size() != network.OutputLabels.size())
+	{
+		return false;
+	}
+
+	for(size_t pos = 0; pos < network.OutputLabels.size(); pos++)
+	{
+		if(!containsLabel((pos < lResidual.size()) ? lResidual : rResidual, network.OutputLabels[pos]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Cheapest order by dynamic programming over all subsets of leaves, INFINITY if none
+static double getOptimalOrder(std::map<uint64_t, uint64_t> * split, const contractionNetwork_s &network)
+{
+	const uint64_t all = ((uint64_t) 1 << network.Leaves.size()) - 1;
+
+	std::vector<std::vector<uint32_t>> openLabels(all + 1);
+	for(uint64_t mask = 1; mask <= all; mask++)
+	{
+		getOpenLabels(&openLabels[mask], network, mask);
+	}
+
+	std::vector<double> cost(all + 1, INFINITY);
+	for(size_t leaf = 0; leaf < network.Leaves.size(); leaf++)
+	{
+		cost[(uint64_t) 1 << leaf] = 0.;
+	}
+
+	for(uint64_t mask = 1; mask <= all; mask++)
+	{
+		const uint64_t first = mask & (~mask + 1); // The left operand holds the first leaf, so factors stay in the order written
+
+		for(uint64_t lMask = (mask - 1) & mask; lMask; lMask = (lMask - 1) & mask)
+		{
+			const uint64_t rMask = mask ^ lMask;
+			if((0 == (lMask & first)) || isinf(cost[lMask]) || isinf(cost[rMask]) ||
+					!shareLabel(openLabels[lMask], openLabels[rMask])) // No outer products
+			{
+				continue;
+			}
+
+			if((all == mask) &&
+					!isRootSplit(network, openLabels[lMask], openLabels[rMask]) &&
+					!isRootSplit(network, openLabels[rMask], openLabels[lMask]))
+			{
+				continue;
 			}
 
-			if(nodePair.second.ChildrenModifiable()->erase(cmpId))
+			const double splitCost = cost[lMask] + cost[rMask] + getJoinCost(network, openLabels[lMask], openLabels[rMask]);
+			if(splitCost < cost[mask])
 			{
-				nodePair.second.ChildrenModifiable()->insert(newNodeId);
+				cost[mask] = splitCost;
+				(*split)[mask] = lMask;
 			}
+		}
+	}
+
+	return cost[all];
+}
+
+// Greedy order for large trees: The cheapest pair of operands sharing a label first, INFINITY if none
+static double getGreedyOrder(std::map<uint64_t, uint64_t> * split, const contractionNetwork_s &network)
+{
+	std::vector<uint64_t> operands;
+	std::vector<std::vector<uint32_t>> openLabels;
+	for(size_t leaf = 0; leaf < network.Leaves.size(); leaf++)
+	{
+		operands.push_back((uint64_t) 1 << leaf);
+		openLabels.push_back(network.LeafLabels[leaf]);
+	}
 
-			if(Node::Type::CONTROL_TRANSFER_WHILE == nodePair.second.GetType())
+	double cost = 0.;
+	while(2 < operands.size())
+	{
+		double pairCostMin = INFINITY;
+		size_t lMin = 0;
+		size_t rMin = 0;
+		for(size_t lOperand = 0; lOperand < operands.size(); lOperand++)
+		{
+			for(size_t rOperand = lOperand + 1; rOperand < operands.size(); rOperand++)
 			{
-				auto pWhile = (Node::ControlTransferParameters_t*) nodePair.second.TypeParametersModifiable();
-				if(cmpId == pWhile->BranchTrue)
+				if(!shareLabel(openLabels[lOperand], openLabels[rOperand]))
 				{
-					pWhile->BranchTrue = newNodeId;
+					continue;
 				}
 
-				if(cmpId == pWhile->BranchFalse)
+				const double pairCost = getJoinCost(network, openLabels[lOperand], openLabels[rOperand]);
+				if(pairCost < pairCostMin)
 				{
-					pWhile->BranchFalse = newNodeId;
+					pairCostMin = pairCost;
+					lMin = lOperand;
+					rMin = rOperand;
 				}
 			}
+		}
 
-			if(cmpId == nodePair.second.IsStoredIn())
-			{
-				nodePair.second.StoreIn(newNodeId);
-			}
+		if(isinf(pairCostMin))
+		{
+			return INFINITY;
+		}
 
-			if(nodePair.second.RemoveStorageFor(cmpId))
-			{
-				nodePair.second.UseAsStorageFor(newNodeId);
-			}
+		(*split)[operands[lMin] | operands[rMin]] = operands[lMin];
+		operands[lMin] |= operands[rMin];
+		getOpenLabels(&openLabels[lMin], network, operands[lMin]);
+		cost += pairCostMin;
+
+		operands.erase(operands.begin() + rMin);
+		openLabels.erase(openLabels.begin() + rMin);
+	}
+
+	if(!isRootSplit(network, openLabels[0], openLabels[1]) && !isRootSplit(network, openLabels[1], openLabels[0]))
+	{
+		return INFINITY;
+	}
+
+	(*split)[operands[0] | operands[1]] = operands[0];
+
+	return cost + getJoinCost(network, openLabels[0], openLabels[1]);
+}
+
+static void getContractedFactors(
+		std::vector<uint32_t> * lfactors, std::vector<uint32_t> * rfactors,
+		const std::vector<uint32_t> &lLabels, const std::vector<uint32_t> &rLabels)
+{
+	lfactors->clear();
+	rfactors->clear();
+	for(size_t lPos = 0; lPos < lLabels.size(); lPos++)
+	{
+		auto rIt = std::find(rLabels.begin(), rLabels.end(), lLabels[lPos]);
+		if(rLabels.end() != rIt)
+		{
+			lfactors->push_back(lPos);
+			rfactors->push_back(std::distance(rLabels.begin(), rIt));
+		}
+	}
+}
+
+// Contracts the labels both vectors share, *labels are the result's
+static const vector_t * contractLabeled(
+		std::vector<uint32_t> * labels,
+		const vector_t * lVec, const std::vector<uint32_t> &lLabels,
+		const vector_t * rVec, const std::vector<uint32_t> &rLabels)
+{
+	std::vector<uint32_t> lfactors;
+	std::vector<uint32_t> rfactors;
+	getContractedFactors(&lfactors, &rfactors, lLabels, rLabels);
+
+	std::vector<uint32_t> rResidual;
+	getResidualLabels(labels, lLabels, rLabels);
+	getResidualLabels(&rResidual, rLabels, lLabels);
+	labels->insert(labels->end(), rResidual.begin(), rResidual.end());
+
+	return lVec->Contract(rVec, lfactors, rfactors);
+}
+
+static const vector_t * buildContraction(
+		std::vector<uint32_t> * labels,
+		const Graph * graph, const contractionNetwork_s &network, const std::map<uint64_t, uint64_t> &split, uint64_t mask)
+{
+	if(0 == (mask & (mask - 1)))
+	{
+		size_t leaf = 0;
+		while(0 == (mask & ((uint64_t) 1 << leaf)))
+		{
+			leaf++;
+		}
+
+		*labels = network.LeafLabels[leaf];
+		return (const vector_t *) graph->GetNode(network.Leaves[leaf])->GetObjectPt();
+	}
+
+	auto splitIt = split.find(mask);
+	if(split.end() == splitIt)
+	{
+		Error("No order for contraction!\n");
+		return nullptr;
+	}
+
+	std::vector<uint32_t> lLabels;
+	std::vector<uint32_t> rLabels;
+	const vector_t * lVec = buildContraction(&lLabels, graph, network, split, splitIt->second);
+	const vector_t * rVec = buildContraction(&rLabels, graph, network, split, mask ^ splitIt->second);
+	if((nullptr == lVec) || (nullptr == rVec))
+	{
+		return nullptr;
+	}
+
+	return contractLabeled(labels, lVec, lLabels, rVec, rLabels);
+}
+
+// Residual labels in the given order, contracted ones behind. A permutation only read by a contraction is not copied.
+static const vector_t * permuteLabels(
+		std::vector<uint32_t> * labels, const vector_t * vec, const std::vector<uint32_t> &otherLabels,
+		std::vector<uint32_t>::const_iterator residualBegin, std::vector<uint32_t>::const_iterator residualEnd)
+{
+	std::vector<uint32_t> residual;
+	getResidualLabels(&residual, *labels, otherLabels);
+	if(std::equal(residual.begin(), residual.end(), residualBegin))
+	{
+		return vec;
+	}
+
+	std::vector<uint32_t> ordered(residualBegin, residualEnd);
+	for(const uint32_t &label: *labels)
+	{
+		if(containsLabel(otherLabels, label))
+		{
+			ordered.push_back(label);
+		}
+	}
+
+	std::vector<uint32_t> indices;
+	for(const uint32_t &label: *labels)
+	{
+		indices.push_back(std::distance(ordered.begin(), std::find(ordered.begin(), ordered.end(), label)));
+	}
+
+	*labels = ordered;
+	return vec->Permute(indices);
+}
+
+void Graph::OrderContractions()
+{
+	// Chains of contractions are evaluated as written, yet e.g. (A_ij B_jk) v_k costs |i||j||k| multiply-adds where A_ij (B_jk v_k) costs |j||k| + |i||j|.
+	// Every tree of contractions is rewritten in its cheapest order, found over all subsets of its operands for small trees and greedily for large ones.
+	static const size_t OPTIMAL_LEAVES_MAX = 10;
+	static const size_t LEAVES_MAX = 63; // Subsets of leaves are bitmasks
+
+	std::vector<Node::Id_t> roots;
+	for(const auto &nodePair: nodes_)
+	{
+		if((Node::Type::VECTOR_CONTRACTION == nodePair.second.GetType()) && !IsInnerContraction(nodePair.first))
+		{
+			roots.push_back(nodePair.first);
+		}
+	}
+
+	size_t reorderedNrOf = 0;
+	for(const Node::Id_t &root: roots)
+	{
+		contractionNetwork_s network;
+		if(!GetContractionNetwork(&network, &network.OutputLabels, root, true) ||
+				(3 > network.Leaves.size()) || (LEAVES_MAX < network.Leaves.size()))
+		{
+			continue;
+		}
+
+		std::map<uint64_t, uint64_t> split; // Subset of leaves by the subset its left operand contracts
+		const double cost = (OPTIMAL_LEAVES_MAX >= network.Leaves.size()) ?
+				getOptimalOrder(&split, network) : getGreedyOrder(&split, network);
+
+		if(!(cost < network.Cost))
+		{
+			continue; // Already cheapest, rounding stays as written
+		}
+
+		if(!RewriteContractions(network, split, root))
+		{
+			Error("Could not reorder contractions of Node %u!\n", root);
+			continue;
+		}
+
+		reorderedNrOf++;
+	}
+
+	printf("Reordered %lu trees of contractions\n", reorderedNrOf);
+}
+
+bool Graph::IsInnerContraction(Node::Id_t id) const
+{
+	const Node * node = GetNode(id);
+	if((Node::Type::VECTOR_CONTRACTION != node->GetType()) || (1 != node->Children()->size()) ||
+			(Node::ID_NONE != node->IsStoredIn()) || node->UsedAsStorageByOthers() || IsBranch(id))
+	{
+		return false;
+	}
+
+	const Node * child = GetNode(*node->Children()->begin());
+
+	return (Node::Type::VECTOR_CONTRACTION == child->GetType()) &&
+			(1 == std::count(child->Parents()->begin(), child->Parents()->end(), id));
+}
+
+bool Graph::GetContractionNetwork(contractionNetwork_s * network, std::vector<uint32_t> * labels, Node::Id_t id, bool isRoot) const
+{
+	const Node * node = GetNode(id);
+	if(Node::Object_t::MODULE_VECTORSPACE_VECTOR != node->GetObject())
+	{
+		return false;
+	}
+
+	labels->clear();
+
+	if(!isRoot && !IsInnerContraction(id))
+	{
+		// Deltas have no array to contract, products with them are rewritten when built
+		if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == node->GetType())
+		{
+			return false;
+		}
+
+		auto vec = (const vector_t *) node->GetObjectPt();
+		for(const auto &factor: *vec->Space()->Factors())
+		{
+			labels->push_back(network->LabelDims.size());
+			network->LabelDims.push_back(factor.Dim);
+		}
+
+		network->Leaves.push_back(id);
+		network->LeafLabels.push_back(*labels);
+		return true;
+	}
+
+	auto param = (const Node::contractParameters_t *) node->TypeParameters();
+	if((nullptr == param) || (2 != node->Parents()->size()))
+	{
+		return false;
+	}
+
+	if(!isRoot)
+	{
+		network->Inner.push_back(id);
+	}
+
+	std::vector<uint32_t> lLabels;
+	std::vector<uint32_t> rLabels;
+	if(!GetContractionNetwork(network, &lLabels, (*node->Parents())[0], false) ||
+			!GetContractionNetwork(network, &rLabels, (*node->Parents())[1], false))
+	{
+		return false;
+	}
+
+	// Contracted factors share the left label
+	for(size_t pair = 0; pair < param->lfactors.size(); pair++)
+	{
+		if((lLabels.size() <= param->lfactors[pair]) || (rLabels.size() <= param->rfactors[pair]))
+		{
+			return false;
+		}
+
+		const uint32_t rLabel = rLabels[param->rfactors[pair]];
+		const uint32_t lLabel = lLabels[param->lfactors[pair]];
+		for(auto &leafLabels: network->LeafLabels)
+		{
+			std::replace(leafLabels.begin(), leafLabels.end(), rLabel, lLabel);
+		}
+
+		std::replace(rLabels.begin(), rLabels.end(), rLabel, lLabel);
+	}
+
+	network->Cost += getJoinCost(*network, lLabels, rLabels);
+
+	std::vector<uint32_t> rResidual;
+	getResidualLabels(labels, lLabels, rLabels);
+	getResidualLabels(&rResidual, rLabels, lLabels);
+	labels->insert(labels->end(), rResidual.begin(), rResidual.end());
+
+	return true;
+}
+
+bool Graph::RewriteContractions(const contractionNetwork_s &network, const std::map<uint64_t, uint64_t> &split, Node::Id_t root)
+{
+	const uint64_t all = ((uint64_t) 1 << network.Leaves.size()) - 1;
+
+	auto splitIt = split.find(all);
+	if(split.end() == splitIt)
+	{
+		Error("No order for contraction!\n");
+		return false;
+	}
+
+	uint64_t lMask = splitIt->second;
+	uint64_t rMask = all ^ lMask;
+
+	std::vector<uint32_t> lOpen;
+	std::vector<uint32_t> rOpen;
+	getOpenLabels(&lOpen, network, lMask);
+	getOpenLabels(&rOpen, network, rMask);
+	if(!isRootSplit(network, lOpen, rOpen))
+	{
+		std::swap(lMask, rMask);
+		std::swap(lOpen, rOpen);
+	}
+
+	std::vector<uint32_t> lLabels;
+	std::vector<uint32_t> rLabels;
+	const vector_t * lVec = buildContraction(&lLabels, this, network, split, lMask);
+	const vector_t * rVec = buildContraction(&rLabels, this, network, split, rMask);
+	if((nullptr == lVec) || (nullptr == rVec))
+	{
+		return false;
+	}
+
+	std::vector<uint32_t> lResidual;
+	getResidualLabels(&lResidual, lLabels, rLabels);
+
+	const auto outputSplit = network.OutputLabels.begin() + lResidual.size();
+	lVec = permuteLabels(&lLabels, lVec, rLabels, network.OutputLabels.begin(), outputSplit);
+	rVec = permuteLabels(&rLabels, rVec, lLabels, outputSplit, network.OutputLabels.end());
+
+	// The root keeps its id, space and children, only its operands change
+	Node::contractParameters_t * param = (Node::contractParameters_t *) GetNodeModifyable(root)->TypeParametersModifiable();
+	getContractedFactors(&param->lfactors, &param->rfactors, lLabels, rLabels);
+
+	Node * rootNode = GetNodeModifyable(root);
+	for(const Node::Id_t &parent: *rootNode->Parents())
+	{
+		GetNodeModifyable(parent)->ChildrenModifiable()->erase(root);
+	}
+
+	*rootNode->ParentsModifiable() = std::vector<Node::Id_t>{lVec->Id(), rVec->Id()};
+	GetNodeModifyable(lVec->Id())->ChildrenModifiable()->insert(root);
+	GetNodeModifyable(rVec->Id())->ChildrenModifiable()->insert(root);
+
+	// Children first: Each is unread once its child is removed
+	for(const Node::Id_t &inner: network.Inner)
+	{
+		if(0 == GetNode(inner)->Children()->size())
+		{
+			RemoveNode(inner);
 		}
 	}
 
 	return true;
 }
 
+bool Graph::ReduceToOne(const std::vector<Node::Id_t> &nodes)
+{
+	if(1 >= nodes.size())
+	{
+		return true; // nothing to do
+	}
+
+	printf("Replacing ");
+	for(size_t nodePos = 1; nodePos < nodes.size(); nodePos++)
+	{
+		printf("%u, ", nodes[nodePos]);
+	}
+	printf("with %u\n", nodes[0]);
+
+	std::vector<Node::Id_t> referencing;
+	GetReferencingNodes(&referencing);
+
+	// Keep the first one and replace the others with it
+	for(size_t nodePos = 1; nodePos < nodes.size(); nodePos++)
+	{
+		MergeNode(nodes[nodePos], nodes[0], referencing);
+	}
+
+	return true;
+}
+
 void NodeRef::SetNodeRef(Graph* graph, Node::Id_t id)
 {
 	graph_ = graph;
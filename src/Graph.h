@@ -47,6 +47,7 @@ public:
 		VECTOR_PROJECTION,
 		VECTOR_CROSS_CORRELATION,
 		VECTOR_MAX_POOL,
+		VECTOR_MAX_POOL_DERIVATIVE, // Parent is the max pool, whose window maxima's positions it scatters
 		OUTPUT,
 		INPUT,
 		CONTROL_TRANSFER_WHILE,
@@ -145,6 +146,8 @@ private:
 	std::set<Id_t> children;
 };
 
+struct contractionNetwork_s; // See Graph::OrderContractions()
+
 class Graph {
 public:
 	Graph(const std::string &name);
@@ -165,6 +168,8 @@ public:
 	bool GetRootAncestors(std::set<Node::Id_t> * rootParents, Node::Id_t child) const;
 
 	void RemoveDuplicates();
+	void Simplify(); // Rewrites redundant nodes, e.g. of derivatives, until none is left. Call once the graph is complete.
+	void OrderContractions(); // Rewrites trees of contractions in their cheapest order. Call once the graph is complete.
 
 private:
 	std::map<Node::Id_t, Node> nodes_;
@@ -174,6 +179,22 @@ private:
 
 	void Init(const std::string &name);
 	bool AddChild(Node::Id_t parent, Node::Id_t child);
+
+	Node::Id_t GetReplacement(const Node &node) const; // Node computing the same, ID_NONE if none
+	Node::Id_t GetDeltaContractionOperand(const Node &node) const;
+	bool ComposePermutations(Node * node);
+	bool IsZero(Node::Id_t id) const;
+	bool IsBranch(Node::Id_t id) const;
+	bool IsUnread(const Node &node) const;
+	void ReplaceNode(Node::Id_t id, Node::Id_t by);
+	void RemoveNode(Node::Id_t id);
+	void GetTopologicalOrder(std::vector<Node::Id_t> * order) const;
+	void GetReferencingNodes(std::vector<Node::Id_t> * referencing) const;
+	void MergeNode(Node::Id_t id, Node::Id_t into, const std::vector<Node::Id_t> &referencing); // Nodes in referencing may hold id as branch or storage
+
+	bool IsInnerContraction(Node::Id_t id) const;
+	bool GetContractionNetwork(contractionNetwork_s * network, std::vector<uint32_t> * labels, Node::Id_t id, bool isRoot) const;
+	bool RewriteContractions(const contractionNetwork_s &network, const std::map<uint64_t, uint64_t> &split, Node::Id_t root);
 };
 
 class NodeRef {
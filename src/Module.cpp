@@ -21,6 +21,7 @@
  */
 
 #include <stdlib.h>
+#include <math.h>
 #include <cstring>
 #include <type_traits>
 #include <iostream>
@@ -65,6 +66,45 @@ template const VectorSpace::Vector * VectorSpace::Homomorphism<float>(
 template const VectorSpace::Vector* VectorSpace::Vector::Power<float>(float exp) const;
 template const VectorSpace::Vector* VectorSpace::Vector::Multiply<float>(float factor) const;
 
+// Value of a constant scalar, false if it is none or not a positive integer
+static bool getPositiveInteger(uint32_t * value, const VectorSpace::Vector * vec)
+{
+	if((nullptr == vec->InitValue()) || (1 != vec->Space()->GetDim()))
+	{
+		return false;
+	}
+
+	switch(vec->Space()->GetRing())
+	{
+	case Ring::Float32:
+	{
+		const float scalar = *((const float *) vec->InitValue());
+		if((1.f > scalar) || (truncf(scalar) != scalar) || ((float) UINT32_MAX < scalar))
+		{
+			return false;
+		}
+
+		*value = (uint32_t) scalar;
+		return true;
+	}
+
+	case Ring::Int32:
+	{
+		const int32_t scalar = *((const int32_t *) vec->InitValue());
+		if(1 > scalar)
+		{
+			return false;
+		}
+
+		*value = (uint32_t) scalar;
+		return true;
+	}
+
+	default:
+		return false;
+	}
+}
+
 template<typename T>
 static bool hasDuplicates(const std::vector<T> &vec)
 {
@@ -191,8 +231,19 @@ const VectorSpace::Vector * VectorSpace::Homomorphism(
 		return nullptr;
 	}
 
-	// For now, simply create the full matrix
 	const size_t dimensions = GetDim();
+	if(initializer.size() != dimensions)
+	{
+		Error("Initializer dimensions do not match (%lu vs %lu)!\n",
+				initializer.size(), dimensions);
+		return nullptr;
+	}
+
+	if(!Ring::IsCompatible(GetRing(), initializer))
+	{
+		Error("Initializer for Homomorphism of incompatible Type!\n");
+		return nullptr;
+	}
 
 	auto newInitiliazer = new std::vector<inType>(dimensions * dimensions, 0.f);
 
@@ -202,7 +253,20 @@ const VectorSpace::Vector * VectorSpace::Homomorphism(
 		newInitiliazer->at(dim * dimensions + dim) = initializer[dim];
 	}
 
-	return Homomorphism(graph, *newInitiliazer);
+	// The code generator only stores the diagonal. The parameter is copied, the caller's may not live as long as the graph.
+	auto param = (const Vector::propertyParameterDiagonal_t *) properties.at(Vector::Property::Diagonal);
+
+	Vector * retVec = new Vector(graph, new VectorSpace(*this, 2), newInitiliazer->data(),
+			std::map<Vector::Property, const void *>{{
+				Vector::Property::Diagonal,
+				(nullptr == param) ? nullptr : new Vector::propertyParameterDiagonal_t(*param)}});
+	if(nullptr == retVec)
+	{
+		Error("Could not malloc Vec\n");
+		return nullptr;
+	}
+
+	return retVec;
 }
 
 template<typename inType>
@@ -276,49 +340,157 @@ const VectorSpace::Vector * VectorSpace::Element(
 			Vector::Property property,
 			const void * parameter) const
 {
-	// TODO: Implement properties. For now this is just an interface to test usability in application
-	if(Vector::Property::Sparse != property)
+	return Element(graph, initializer, std::map<Vector::Property, const void *>{{property, parameter}});
+}
+
+template<typename inType>
+const VectorSpace::Vector * VectorSpace::Element(
+			Graph* graph,
+			const std::vector<inType> &initializer,
+			const std::map<Vector::Property, const void *> &properties) const
+{
+	if(nullptr == graph)
 	{
-		Error("Not implemented!\n");
+		Error("nullptr\n");
 		return nullptr;
 	}
 
-	if(nullptr == parameter)
+	if(!Ring::IsCompatible(GetRing(), initializer))
 	{
-		Error("Nullpointer!\n");
+		Error("Initializer for Vector of incompatible Type!\n");
 		return nullptr;
 	}
 
-	const Vector::propertyParameterSparse_t * param = (const Vector::propertyParameterSparse_t *) parameter;
-	if(param->DENSE != param->Initializer)
+	// The code generator only stores the non-zeros of sparse vectors and a triangle of (anti-)symmetric ones.
+	// Parameters are copied, the caller's may not live as long as the graph.
+	std::map<Vector::Property, const void *> retProperties;
+	const Vector::propertyParameterSymmetric_t * symmetric = nullptr;
+	int mirrorSign = 0; // Mirror image / element, 0 if not (anti-)symmetric
+	for(const auto &propertyPair: properties)
 	{
-		Error("Not implemented!\n");
-		return nullptr;
+		switch(propertyPair.first)
+		{
+		case Vector::Property::Sparse:
+		{
+			auto param = (const Vector::propertyParameterSparse_t *) propertyPair.second;
+			if((nullptr == param) || (param->DENSE != param->Initializer))
+			{
+				Error("Not implemented!\n");
+				return nullptr;
+			}
+
+			retProperties[propertyPair.first] = new Vector::propertyParameterSparse_t(*param);
+			break;
+		}
+
+		case Vector::Property::Symmetric: // no break intended
+		case Vector::Property::Antisymmetric:
+			if(0 != mirrorSign)
+			{
+				Error("Vector can not be symmetric and antisymmetric!\n");
+				return nullptr;
+			}
+
+			mirrorSign = (Vector::Property::Symmetric == propertyPair.first) ? 1 : -1;
+			symmetric = (const Vector::propertyParameterSymmetric_t *) propertyPair.second;
+			retProperties[propertyPair.first] = (nullptr == symmetric) ? nullptr : new Vector::propertyParameterSymmetric_t(*symmetric);
+			break;
+
+		default:
+			Error("Not implemented!\n");
+			return nullptr;
+		}
 	}
 
-	// Ignore sparse..
+	const std::vector<inType> * values = &initializer;
+	if(0 != mirrorSign)
+	{
+		// The two factors swapped by the mirror image, both of a matrix if not declared
+		std::pair<uint32_t, uint32_t> pair = {0, 1};
+		if((nullptr != symmetric) && (symmetric->Pairs.first != symmetric->Pairs.second))
+		{
+			pair = symmetric->Pairs;
+		}
+		else if(2 != Factors_.size())
+		{
+			Error("Complete symmetry of %lu factors not implemented!\n", Factors_.size());
+			return nullptr;
+		}
 
-	return Element(graph, initializer);
-}
+		if((Factors_.size() <= std::max(pair.first, pair.second)) || (Factors_[pair.first].Dim != Factors_[pair.second].Dim))
+		{
+			Error("Factors %u and %u can not be swapped!\n", pair.first, pair.second);
+			return nullptr;
+		}
 
-template<typename inType>
-const VectorSpace::Vector * VectorSpace::Element(
-			Graph* graph,
-			const std::vector<inType> &initializer,
-			const std::map<Vector::Property, const void *> &properties) const
-{
-	// TODO: Implement properties. For now this is just an interface to test usability in application
+		std::vector<uint32_t> strides;
+		GetStrides(&strides);
+
+		// LEFTMOST_INDICES: Only the elements whose first index is the smaller one are supplied
+		const bool isLeftmostOnly = (nullptr != symmetric) && (symmetric->LEFTMOST_INDICES == symmetric->Initializer);
+		if(isLeftmostOnly)
+		{
+			values = new std::vector<inType>(GetDim(), (inType) 0);
+		}
+		else if(initializer.size() != GetDim())
+		{
+			Error("Initializer dimensions do not match (%lu vs %i)!\n",
+					initializer.size(), GetDim());
+			return nullptr;
+		}
+
+		size_t supplied = 0;
+		for(uint32_t position = 0; position < GetDim(); position++)
+		{
+			const uint32_t first = (position / strides[pair.first]) % Factors_[pair.first].Dim;
+			const uint32_t second = (position / strides[pair.second]) % Factors_[pair.second].Dim;
+			const uint32_t mirror = position - first * strides[pair.first] - second * strides[pair.second] + second * strides[pair.first] + first * strides[pair.second];
+
+			if(!isLeftmostOnly)
+			{
+				if(values->at(mirror) != (inType) mirrorSign * values->at(position))
+				{
+					Error("Initializer is not %ssymmetric at %u!\n", (0 < mirrorSign) ? "" : "anti", position);
+					return nullptr;
+				}
+			}
+			else if((first < second) || ((first == second) && (0 < mirrorSign)))
+			{
+				if(initializer.size() <= supplied)
+				{
+					Error("Initializer too short!\n");
+					return nullptr;
+				}
 
-	if((2 == properties.size()) &&
-			(properties.end() != properties.find(Vector::Property::Sparse)) &&
-			(properties.end() != properties.find(Vector::Property::Antisymmetric)))
+				auto dense = (std::vector<inType> *) values;
+				dense->at(position) = initializer[supplied];
+				dense->at(mirror) = (inType) mirrorSign * initializer[supplied];
+				supplied++;
+			}
+		}
+
+		if(isLeftmostOnly && (initializer.size() != supplied))
+		{
+			Error("Initializer dimensions do not match (%lu vs %lu)!\n",
+					initializer.size(), supplied);
+			return nullptr;
+		}
+	}
+	else if(initializer.size() != GetDim())
 	{
-		// Ignore properties
-		return Element(graph, initializer);
+		Error("Initializer dimensions do not match (%lu vs %i)!\n",
+				initializer.size(), GetDim());
+		return nullptr;
 	}
 
-	Error("Not implemented!\n");
-	return nullptr;
+	Vector * retVec = new Vector(graph, this, values->data(), retProperties);
+	if(nullptr == retVec)
+	{
+		Error("Could not malloc Vec\n");
+		return nullptr;
+	}
+
+	return retVec;
 }
 
 template<typename inType>
@@ -583,7 +755,6 @@ const void * VectorSpace::Vector::InitValue() const
 
 const VectorSpace::Vector* VectorSpace::Vector::Power(const Vector* vec, const std::vector<uint32_t> &lfactors, const std::vector<uint32_t> &rfactors) const
 {
-	// TODO: Catch exponent of 0?
 	if(GetGraph() != vec->GetGraph())
 	{
 		Error("Not on the same Graph!\n");
@@ -625,7 +796,7 @@ const VectorSpace::Vector* VectorSpace::Vector::Power(const Vector* vec, const s
 			Error("At least one contraction index-pair has different dimension! Factor %u with %u, |lFactor| = %u, |rFactor| = %u\n",
 					lfactors[index], rfactors[index],
 					Space_->Factors_[lfactors[index]].Dim,
-					vec->Space_->Factors_[rfactors[index]].Dim);
+					Space_->Factors_[rfactors[index]].Dim);
 
 			return nullptr;
 		}
@@ -638,15 +809,62 @@ const VectorSpace::Vector* VectorSpace::Vector::Power(const Vector* vec, const s
 		return nullptr;
 	}
 
+	uint32_t exponent;
+	if(!getPositiveInteger(&exponent, vec))
+	{
+		Error("Can only take contraction powers to constant, positive integers!\n");
+		return nullptr;
+	}
 
-	Vector* retVec = new Vector(
-			GetGraph(), Space_,
-			Node::Type::VECTOR_POWER, nullptr);
+	// Squaring regroups the product, which needs it to be associative as it is for matrices:
+	// The left operand's trailing factors are contracted with the right operand's leading ones.
+	bool associative = true;
+	for(size_t index = 0; index < lfactors.size(); index++)
+	{
+		associative = associative &&
+				(lfactors.size() <= lfactors[index]) && (lfactors.size() > rfactors[index]);
+	}
 
-	retVec->PushParent(Id());
-	retVec->PushParent(vec->Id());
+	const Vector * power = this;
+	if(!associative)
+	{
+		for(uint32_t factor = 1; (factor < exponent) && (nullptr != power); factor++)
+		{
+			power = power->Contract(this, lfactors, rfactors);
+		}
 
-	return retVec;
+		return power;
+	}
+
+	// B^n by repeated squaring: About 2 log2(n) contractions instead of n - 1
+	power = nullptr;
+	const Vector * square = this;
+	for(uint32_t remaining = exponent; ; remaining >>= 1)
+	{
+		if(remaining & 1)
+		{
+			power = (nullptr == power) ? square : power->Contract(square, lfactors, rfactors);
+			if(nullptr == power)
+			{
+				Error("Could not contract!\n");
+				return nullptr;
+			}
+		}
+
+		if(1 == remaining)
+		{
+			break;
+		}
+
+		square = square->Contract(square, lfactors, rfactors);
+		if(nullptr == square)
+		{
+			Error("Could not contract!\n");
+			return nullptr;
+		}
+	}
+
+	return power;
 }
 
 template<typename inType>
@@ -711,6 +929,18 @@ const VectorSpace::Vector* VectorSpace::Vector::Divide(const Vector* vec) const
 template<typename inType>
 const VectorSpace::Vector* VectorSpace::Vector::Multiply(inType factor) const
 {
+	// Deltas absorb constant factors
+	const Node * thisNode = GetGraph()->GetNode(Id());
+	if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == thisNode->GetType())
+	{
+		auto opParameters = new Node::KroneckerDeltaParameters_t(*(const Node::KroneckerDeltaParameters_t *) thisNode->TypeParameters());
+		opParameters->Scaling *= (float) factor;
+
+		return new Vector(
+				GetGraph(), Space_,
+				Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT, opParameters);
+	}
+
 	auto factorVec = Space_->Scalar(GetGraph(), factor);
 
 	return Multiply(factorVec);
@@ -770,6 +1000,12 @@ const VectorSpace::Vector* VectorSpace::Vector::Multiply(const Vector* vec) cons
 		return retVec;
 	}
 
+	const Vector * deltaProduct = MultiplyKroneckerDelta(vec);
+	if(nullptr != deltaProduct)
+	{
+		return deltaProduct;
+	}
+
 	VectorSpace * retSpace = nullptr;
 	retSpace = new VectorSpace(std::initializer_list<const VectorSpace*>{Space_, vec->Space_});
 
@@ -1294,6 +1530,9 @@ const VectorSpace::Vector* VectorSpace::Vector::CreateDerivative(const Vector* v
 	case Node::Type::VECTOR_CROSS_CORRELATION:
 		return CrossCorrelationDerivative(vecValuedFct, arg);
 
+	case Node::Type::VECTOR_MAX_POOL:
+		return MaxPoolDerivative(vecValuedFct, arg);
+
 	default:
 		Error("Node Type %s does not support taking its derivative!\n", Node::getName(fctNode->GetType()));
 		return nullptr;
@@ -1395,6 +1634,12 @@ const VectorSpace::Vector* VectorSpace::Vector::Contract(const Vector* vec, cons
 		return nullptr;
 	}
 
+	const Vector * relabeled = ContractKroneckerDelta(vec, lfactors, rfactors);
+	if(nullptr != relabeled)
+	{
+		return relabeled;
+	}
+
 	Vector* retVec = nullptr;
 
 	const Node * thisNode = GetGraph()->GetNode(Id());
@@ -1517,6 +1762,154 @@ const VectorSpace::Vector* VectorSpace::Vector::Contract(const Vector* vec, uint
 	return Contract(vec, lfactors, rfactors);
 }
 
+const VectorSpace::Vector* VectorSpace::Vector::ContractKroneckerDelta(const Vector* vec, const std::vector<uint32_t> &lfactors, const std::vector<uint32_t> &rfactors) const
+{
+	// If exactly one factor of each delta pair is contracted, the other operand's indices are only renamed:
+	// d_ij d_kl A_jlm = A_ikm, i.e. no contraction has to be computed
+	const Node * thisNode = GetGraph()->GetNode(Id());
+	const Node * vecNode = GetGraph()->GetNode(vec->Id());
+
+	const bool thisIsDelta = (Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == thisNode->GetType());
+	if(thisIsDelta == (Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT == vecNode->GetType()))
+	{
+		return nullptr; // Neither or both
+	}
+
+	const Vector * dense = thisIsDelta ? vec : this;
+	const std::vector<uint32_t> &deltaFactors = thisIsDelta ? lfactors : rfactors;
+	const std::vector<uint32_t> &denseFactors = thisIsDelta ? rfactors : lfactors;
+	auto deltaParam = (const Node::KroneckerDeltaParameters_t *) (thisIsDelta ? thisNode : vecNode)->TypeParameters();
+
+	// Remaining factors of the delta: The dense factor contracted with their partner
+	std::vector<uint32_t> deltaResultFactors;
+	for(uint32_t factor = 0; factor < deltaParam->DeltaPair.size(); factor++)
+	{
+		auto factorIt = std::find(deltaFactors.begin(), deltaFactors.end(), factor);
+		auto partnerIt = std::find(deltaFactors.begin(), deltaFactors.end(), deltaParam->DeltaPair[factor]);
+		if((deltaFactors.end() == factorIt) == (deltaFactors.end() == partnerIt))
+		{
+			return nullptr; // A delta remains or a trace is taken
+		}
+
+		if(deltaFactors.end() == factorIt)
+		{
+			deltaResultFactors.push_back(denseFactors[std::distance(deltaFactors.begin(), partnerIt)]);
+		}
+	}
+
+	std::vector<uint32_t> resultFactors; // Factor of dense at each position of the result
+	for(uint32_t factor = 0; factor < dense->Space_->Factors_.size(); factor++)
+	{
+		if(denseFactors.end() == std::find(denseFactors.begin(), denseFactors.end(), factor))
+		{
+			resultFactors.push_back(factor);
+		}
+	}
+
+	resultFactors.insert(thisIsDelta ? resultFactors.begin() : resultFactors.end(), deltaResultFactors.begin(), deltaResultFactors.end());
+
+	std::vector<uint32_t> indices(resultFactors.size());
+	bool isIdentity = true;
+	for(uint32_t position = 0; position < resultFactors.size(); position++)
+	{
+		// The permutation keeps the space of its argument
+		if(dense->Space_->Factors_[resultFactors[position]].Dim != dense->Space_->Factors_[position].Dim)
+		{
+			return nullptr;
+		}
+
+		indices[resultFactors[position]] = position;
+		isIdentity = isIdentity && (resultFactors[position] == position);
+	}
+
+	const Vector * retVec = isIdentity ? dense : dense->Permute(indices);
+	if((nullptr != retVec) && (1.f != deltaParam->Scaling))
+	{
+		retVec = retVec->Multiply(deltaParam->Scaling);
+	}
+
+	return retVec;
+}
+
+const VectorSpace::Vector* VectorSpace::Vector::MultiplyKroneckerDelta(const Vector* vec) const
+{
+	// d_ij * d_kl is a product of deltas again, the pairs of vec follow those of this
+	const Node * thisNode = GetGraph()->GetNode(Id());
+	const Node * vecNode = GetGraph()->GetNode(vec->Id());
+	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != thisNode->GetType()) ||
+			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != vecNode->GetType()))
+	{
+		return nullptr;
+	}
+
+	auto thisParam = (const Node::KroneckerDeltaParameters_t *) thisNode->TypeParameters();
+	auto vecParam = (const Node::KroneckerDeltaParameters_t *) vecNode->TypeParameters();
+
+	auto opParameters = new Node::KroneckerDeltaParameters_t(*thisParam);
+	opParameters->Scaling *= vecParam->Scaling;
+	for(const uint32_t &partner: vecParam->DeltaPair)
+	{
+		opParameters->DeltaPair.push_back(partner + thisParam->DeltaPair.size());
+	}
+
+	return new Vector(
+			GetGraph(), new VectorSpace(std::initializer_list<const VectorSpace*>{Space_, vec->Space_}),
+			Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT, opParameters);
+}
+
+const VectorSpace::Vector* VectorSpace::Vector::AddKroneckerDelta(const Vector* vec) const
+{
+	// a d_ij + b d_ij = (a + b) d_ij
+	const Node * thisNode = GetGraph()->GetNode(Id());
+	const Node * vecNode = GetGraph()->GetNode(vec->Id());
+	if((Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != thisNode->GetType()) ||
+			(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != vecNode->GetType()))
+	{
+		return nullptr;
+	}
+
+	auto thisParam = (const Node::KroneckerDeltaParameters_t *) thisNode->TypeParameters();
+	auto vecParam = (const Node::KroneckerDeltaParameters_t *) vecNode->TypeParameters();
+	if(thisParam->DeltaPair != vecParam->DeltaPair)
+	{
+		return nullptr;
+	}
+
+	auto opParameters = new Node::KroneckerDeltaParameters_t(*thisParam);
+	opParameters->Scaling += vecParam->Scaling;
+
+	return new Vector(
+			GetGraph(), Space_,
+			Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT, opParameters);
+}
+
+const VectorSpace::Vector* VectorSpace::Vector::PermuteKroneckerDelta(const std::vector<uint32_t> &indices) const
+{
+	// Factor a moves to position indices[a], and so does its partner
+	const Node * thisNode = GetGraph()->GetNode(Id());
+	if(Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT != thisNode->GetType())
+	{
+		return nullptr;
+	}
+
+	auto thisParam = (const Node::KroneckerDeltaParameters_t *) thisNode->TypeParameters();
+	if((indices.size() != thisParam->DeltaPair.size()) || hasDuplicates(indices) ||
+			(thisParam->DeltaPair.size() <= *std::max_element(indices.begin(), indices.end())))
+	{
+		return nullptr;
+	}
+
+	auto opParameters = new Node::KroneckerDeltaParameters_t(*thisParam);
+	for(uint32_t factor = 0; factor < indices.size(); factor++)
+	{
+		opParameters->DeltaPair[indices[factor]] = indices[thisParam->DeltaPair[factor]];
+	}
+
+	return new Vector(
+			GetGraph(), Space_,
+			Node::Type::VECTOR_KRONECKER_DELTA_PRODUCT, opParameters);
+}
+
 const VectorSpace::Vector* VectorSpace::Vector::Project(const std::pair<uint32_t, uint32_t> &range) const
 {
 	if(1 != Space_->Factors_.size())
@@ -1596,6 +1989,12 @@ const VectorSpace::Vector* VectorSpace::Vector::Permute(const std::vector<uint32
 		Error("Number of permutation indices does not match number of factors!\n");
 	}
 
+	const Vector * permutedDelta = PermuteKroneckerDelta(indices);
+	if(nullptr != permutedDelta)
+	{
+		return permutedDelta;
+	}
+
 	Node::permuteParameters_t * opParameters = new Node::permuteParameters_t;
 	opParameters->indices = indices;
 
@@ -1697,6 +2096,27 @@ const VectorSpace::Vector* VectorSpace::Vector::CrossCorrelationDerivative(const
 	return retVec;
 }
 
+const VectorSpace::Vector* VectorSpace::Vector::MaxPoolDerivative(const Vector* vecValuedFct, const Vector* arg)
+{
+	if(Ring::Float32 != arg->Space_->GetRing())
+	{
+		Error("Non implemented!\n");
+		return nullptr;
+	}
+
+	// Derivative_ijkl = dOut(k, l) / dIn(i, j) = 1 if In(i, j) is the maximum of Out(k, l)'s window, else 0.
+	// The max pool records the positions of its maxima, so the derivative does not need to search the windows again.
+	auto retSpace = new VectorSpace(std::vector<const VectorSpace*>{arg->Space_, vecValuedFct->Space_});
+
+	Vector* retVec = new Vector(
+			arg->GetGraph(), retSpace,
+			Node::Type::VECTOR_MAX_POOL_DERIVATIVE, nullptr);
+
+	retVec->PushParent(vecValuedFct->Id());
+
+	return retVec;
+}
+
 const VectorSpace::Vector* VectorSpace::Vector::ProjectDerivative(const Vector* vecValuedFct, const Vector* arg)
 {
 	if(Ring::Float32 != arg->Space_->GetRing())
@@ -2153,14 +2573,7 @@ const VectorSpace::Vector* VectorSpace::Vector::Subtract(const Vector* vec) cons
 		return nullptr;
 	}
 
-	const Vector * minusOne = vec->Space_->Scalar(vec->GetGraph(), -1.f);
-	if(nullptr == minusOne)
-	{
-		Error("Could not create scalar!\n");
-		return nullptr;
-	}
-
-	const Vector * minusVec = minusOne->Multiply(vec);
+	const Vector * minusVec = vec->Multiply(-1.f);
 	if(nullptr == minusVec)
 	{
 		Error("Could not multiply!\n");
@@ -2193,6 +2606,12 @@ const VectorSpace::Vector* VectorSpace::Vector::Add(const Vector* vec) const
 		return nullptr;
 	}
 
+	const Vector * deltaSum = AddKroneckerDelta(vec);
+	if(nullptr != deltaSum)
+	{
+		return deltaSum;
+	}
+
 	const VectorSpace * retSpace;
 	if(inferredRing == Space_->GetRing())
 	{
@@ -76,7 +76,7 @@ public:
 		template<typename inType>
 		const Vector* Power(inType exp) const; // element-wise power, e.g. c_ij^2 = c_ij * c_ij (no sum)
 		const Vector* Power(const Vector* vec) const; // element-wise power, e.g. c_ij^2 = c_ij * c_ij (no sum)
-		const Vector* Power(const Vector* vec, const std::vector<uint32_t> &lfactors, const std::vector<uint32_t> &rfactors) const; // contraction power, e.g. B_ij^n = A_ij = B_ik B_kl B_lo ... n times
+		const Vector* Power(const Vector* vec, const std::vector<uint32_t> &lfactors, const std::vector<uint32_t> &rfactors) const; // contraction power, e.g. B_ij^n = A_ij = B_ik B_kl B_lo ... n times, n a constant positive integer
 
 		const Vector* IsSmaller(const Vector* vec) const;
 
@@ -150,6 +150,12 @@ public:
 
 		static bool AreCompatible(const Vector* vec1, const Vector* vec2);
 
+		// Rewrite rules keeping Kronecker delta products structured, nullptr if not applicable
+		const Vector* ContractKroneckerDelta(const Vector* vec, const std::vector<uint32_t> &lfactors, const std::vector<uint32_t> &rfactors) const;
+		const Vector* MultiplyKroneckerDelta(const Vector* vec) const;
+		const Vector* AddKroneckerDelta(const Vector* vec) const;
+		const Vector* PermuteKroneckerDelta(const std::vector<uint32_t> &indices) const;
+
 		typedef struct depNode_s {
 			std::set<Node::Id_t> parents;
 			std::set<Node::Id_t> children;
@@ -165,6 +171,7 @@ public:
 		static const Vector* PowerDerivative(const Vector* vecValuedFct, const Vector* arg);
 		static const Vector* ProjectDerivative(const Vector* vecValuedFct, const Vector* arg);
 		static const Vector* CrossCorrelationDerivative(const Vector* vecValuedFct, const Vector* arg);
+		static const Vector* MaxPoolDerivative(const Vector* vecValuedFct, const Vector* arg);
 	};
 
 	const Vector * Element(Graph* graph, const std::map<Vector::Property, const void *> &properties) const;
@@ -47,354 +47,394 @@
 	printf(__VA_ARGS__); \
 	fflush(stdout);
 
-typedef struct {
-	pthread_mutex_t mutex;
-	pthread_cond_t condition;
-	node_t * jobs[42];
-	node_t * deferredJobs[42];
-	uint16_t jobsNrOf;
-	uint16_t deferredJobsNrOf;
-} jobPool_t;
+// Scheduling
+// Every thread owns a Chase-Lev work-stealing deque. Ready nodes are pushed to and taken from
+// the bottom of the own deque (LIFO, cache-friendly), idle threads steal from the top of other
+// threads' deques (FIFO). See Chase & Lev, "Dynamic Circular Work-Stealing Deque" (SPAA '05) and
+// Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP '13).
+//
+// Instead of scanning parents and children whenever a node finishes, each node counts the
+// readiness signals it received for its next execution in node_t::readyCnt:
+// - one per parent which finished the execution the node is waiting for,
+// - one per child which consumed the node's previous execution (i.e. not for the first execution),
+// - one external trigger for nodes without parents (initial job or PushNode by a control transfer).
+// The thread delivering the last signal pushes the node.
+
+#define CACHE_LINE_SIZE 64u
+#define STEAL_ROUNDS_BEFORE_SLEEP 64u
+#define SPINS_BEFORE_YIELD 64u
 
 typedef struct {
-	pthread_t * pthreads;
-	atomic_uchar * threadActive;
-	size_t threadsNrOf;
-	jobPool_t jobPool;
-} threads_t;
+	atomic_long top;
+	char paddingTop[CACHE_LINE_SIZE - sizeof(atomic_long)];
+	atomic_long bottom;
+	char paddingBottom[CACHE_LINE_SIZE - sizeof(atomic_long)];
+	node_t * _Atomic * buffer;
+	size_t size; // Power of two, sized by the generated jobPoolInit_t::JobsNrOfMax
+} jobDeque_t;
+
+struct threads_s;
 
 typedef struct {
-	threads_t * threads;
+	jobDeque_t deque;
+	struct threads_s * threads;
+	uint32_t randomState;
 	uint16_t arrayPos;
-} threadInit_t;
+} worker_t;
 
-static const uint16_t ALL_JOBS_COMPLETED = UINT16_MAX;
+typedef struct threads_s {
+	pthread_t * pthreads;
+	worker_t * workers;
+	size_t threadsNrOf;
+	atomic_size_t jobsInFlight; // pushed but not yet finished
+	atomic_uchar done;
+	atomic_size_t sleepersNrOf;
+	atomic_size_t wakeupEpoch;
+	pthread_mutex_t mutex;
+	pthread_cond_t sleepCondition;
+	// Between runs the workers are parked. Protected by mutex:
+	pthread_cond_t runStartCondition;
+	pthread_cond_t runDoneCondition;
+	size_t runGeneration;
+	size_t activeWorkersNrOf;
+	uint8_t shutdown;
+} threads_t;
 
-static uint8_t allChildrenConsumedParent(const node_t* parent)
+static void lockMutex(pthread_mutex_t * mutex)
 {
-	// Go through all children and check that they have already consumed this child
-	for(uint32_t child = 0; child < parent->childrenNrOf; child++)
+	int mutexLockRet = pthread_mutex_lock(mutex);
+	if(0 != mutexLockRet)
 	{
-		if(parent->children[child]->exeCnt < parent->exeCnt)
-		{
-			return 0;
-		}
+		errExitEN(mutexLockRet, "pthread_mutex_lock");
 	}
-
-	return 1;
 }
 
-static void removeDeferredJobWithinMutex(threads_t * threads, const node_t* node)
+static void unlockMutex(pthread_mutex_t * mutex)
 {
-	for(size_t job = 0; job < threads->jobPool.deferredJobsNrOf; job++)
+	int mutexUnlockRet = pthread_mutex_unlock(mutex);
+	if(0 != mutexUnlockRet)
 	{
-		if(threads->jobPool.deferredJobs[job] == node)
-		{
-			for(size_t jobAfter = job + 1; jobAfter < threads->jobPool.deferredJobsNrOf; jobAfter++)
-			{
-				threads->jobPool.deferredJobs[jobAfter - 1] = threads->jobPool.deferredJobs[jobAfter];
-			}
-
-			threads->jobPool.deferredJobsNrOf--;
-
-			return;
-		}
+		errExitEN(mutexUnlockRet, "pthread_mutex_unlock");
 	}
 }
 
-static void addDeferredJobWithinMutex(threads_t * threads, node_t* node)
+static void waitCondition(pthread_cond_t * condition, pthread_mutex_t * mutex)
 {
-	// Job already in pool?
-	for(size_t job = 0; job < threads->jobPool.deferredJobsNrOf; job++)
+	int waitRet = pthread_cond_wait(condition, mutex);
+	if(0 != waitRet)
 	{
-		if(threads->jobPool.deferredJobs[job] == node)
-		{
-			return;
-		}
+		errExitEN(waitRet, "pthread_cond_wait");
 	}
+}
 
-	if(sizeof(threads->jobPool.deferredJobs) / sizeof(threads->jobPool.deferredJobs[0]) > threads->jobPool.deferredJobsNrOf)
+static void broadcastCondition(pthread_cond_t * condition)
+{
+	int condBroadcastRet = pthread_cond_broadcast(condition);
+	if(0 != condBroadcastRet)
 	{
-		threads->jobPool.deferredJobs[threads->jobPool.deferredJobsNrOf] = node;
-		threads->jobPool.deferredJobsNrOf++;
+		errExitEN(condBroadcastRet, "pthread_cond_broadcast");
 	}
-	else
+}
+
+static void dequePush(jobDeque_t * deque, node_t * node)
+{
+	long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+	long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+	if(deque->size <= (unsigned long) (bottom - top))
 	{
-		fatal("Deferred Job Pool does not have enough slots!");
+		fatal("Job Deque does not have enough slots!");
 	}
+
+	atomic_store_explicit(&deque->buffer[bottom & (deque->size - 1)], node, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
 }
 
-static void pushJobWithinMutex(threads_t * threads, node_t* node)
+// Owner side: returns NULL if the deque is empty
+static node_t * dequeTake(jobDeque_t * deque)
 {
-	// Go through all parents and check if they already executed
-	for(uint32_t parent = 0; parent < node->parentsNrOf; parent++)
+	long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+	atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	long top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+	if(top > bottom)
 	{
-		if(node->parents[parent]->exeCnt > node->exeCnt + 1)
-		{
-			fatal("Parent Node%u was executed without its child Node%u afterwards!",
-					node->parents[parent]->id,
-					node->id);
-		}
+		// Empty
+		atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+		return NULL;
+	}
 
-		if(node->parents[parent]->exeCnt != node->exeCnt + 1)
+	node_t * node = atomic_load_explicit(&deque->buffer[bottom & (deque->size - 1)], memory_order_relaxed);
+	if(top == bottom)
+	{
+		// Last element: Race against thieves
+		if(!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+				memory_order_seq_cst, memory_order_relaxed))
 		{
-			return; // parent hasn't been executed yet
+			node = NULL;
 		}
-	}
 
-	if(!allChildrenConsumedParent(node))
-	{
-		// Defer this job, as parents are ready and we are only waiting for children to consume this job!
-		addDeferredJobWithinMutex(threads, node);
-		return;
+		atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
 	}
 
-	// Child is ready for execution!
-	// Job already in deferred pool?
-	removeDeferredJobWithinMutex(threads, node);
+	return node;
+}
 
-	// Job already in pool?
-	for(size_t job = 0; job < threads->jobPool.jobsNrOf; job++)
+// Thief side: returns NULL if the deque is empty or we lost the race for the top element
+static node_t * dequeSteal(jobDeque_t * deque)
+{
+	long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+	atomic_thread_fence(memory_order_seq_cst);
+	long bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+	if(top >= bottom)
 	{
-		if(threads->jobPool.jobs[job] == node)
-		{
-			fatal("Tried adding job Node%u which was already in pool!\n", node->id);
-		}
+		return NULL;
 	}
 
-	if(sizeof(threads->jobPool.jobs) / sizeof(threads->jobPool.jobs[0]) > threads->jobPool.jobsNrOf)
+	node_t * node = atomic_load_explicit(&deque->buffer[top & (deque->size - 1)], memory_order_relaxed);
+	if(!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+			memory_order_seq_cst, memory_order_relaxed))
 	{
-		threads->jobPool.jobs[threads->jobPool.jobsNrOf] = node;
-		threads->jobPool.jobsNrOf++;
+		return NULL;
 	}
-	else if(ALL_JOBS_COMPLETED == threads->jobPool.jobsNrOf)
+
+	return node;
+}
+
+static uint32_t readinessSignalsRequired(const node_t * node)
+{
+	uint32_t required = node->parentsNrOf;
+
+	if(0 == node->parentsNrOf)
 	{
-		fatal("Program terminated before being done! Node%u missing!", node->id);
+		required++; // External trigger
 	}
-	else
+
+	if(0 != node->exeCnt)
 	{
-		fatal("Job Pool does not have enough slots!");
+		required += node->childrenNrOf; // Previous execution has to be consumed
 	}
+
+	return required;
 }
 
-static void pushJob(threads_t * threads, node_t* node)
+static void wakeSleepingThreads(threads_t * threads)
 {
-	int mutexLockRet;
-	mutexLockRet = pthread_mutex_lock(&threads->jobPool.mutex);
-	if(0 != mutexLockRet)
+	atomic_fetch_add(&threads->wakeupEpoch, 1);
+
+	if(0 == atomic_load(&threads->sleepersNrOf))
 	{
-		errExitEN(mutexLockRet, "pthread_mutex_lock");
+		return;
 	}
 
-	pushJobWithinMutex(threads, node);
+	lockMutex(&threads->mutex);
+	broadcastCondition(&threads->sleepCondition);
+	unlockMutex(&threads->mutex);
+}
 
-	int mutexUnlockRet;
-	mutexUnlockRet = pthread_mutex_unlock(&threads->jobPool.mutex);
-	if(0 != mutexUnlockRet)
+static void pushJob(worker_t * worker, node_t * node)
+{
+	DPRINTF("Thread %2u: pushing Node %u\n", worker->arrayPos, node->id);
+
+	atomic_fetch_add_explicit(&worker->threads->jobsInFlight, 1, memory_order_relaxed);
+	dequePush(&worker->deque, node);
+	wakeSleepingThreads(worker->threads);
+}
+
+static void signalNode(worker_t * worker, node_t * node)
+{
+	// acq_rel: The thread pushing the node has to see the results of all signaling threads
+	uint32_t signalsReceived = atomic_fetch_add_explicit(&node->readyCnt, 1, memory_order_acq_rel) + 1;
+
+	if(signalsReceived == readinessSignalsRequired(node))
 	{
-		errExitEN(mutexUnlockRet, "pthread_mutex_unlock");
+		pushJob(worker, node);
 	}
 }
 
 static void pushJobExported(void * instance, struct node_s * node)
 {
-	pushJob((threads_t *) instance, node);
+	if(0 != node->parentsNrOf)
+	{
+		// Nodes with parents are pushed once their parents finished.
+		return;
+	}
+
+	signalNode((worker_t *) instance, node);
 }
 
-void checkDeferredJobs(threads_t * threads)
+static void finishJob(worker_t * worker, node_t * node)
 {
-	for(int defJob = threads->jobPool.deferredJobsNrOf - 1; defJob >= 0; defJob--)
+	// Consume the signals of this execution. Subtracting (instead of resetting) keeps early triggers.
+	atomic_fetch_sub_explicit(&node->readyCnt, readinessSignalsRequired(node), memory_order_relaxed);
+	node->exeCnt++;
+
+	DPRINTF("Thread %2u: updated node %u exe cnt to %u.\n", worker->arrayPos, node->id, node->exeCnt);
+
+	for(uint32_t child = 0; child < node->childrenNrOf; child++)
 	{
-		node_t * pDefJob = threads->jobPool.deferredJobs[defJob];
-		if(allChildrenConsumedParent(pDefJob))
-		{
-			pushJobWithinMutex(threads, pDefJob);
-			DPRINTF("%u ", pDefJob->id);
-		}
+		signalNode(worker, node->children[child]);
+	}
+
+	for(uint32_t parent = 0; parent < node->parentsNrOf; parent++)
+	{
+		// The parent's output has been consumed, it may execute again.
+		signalNode(worker, (node_t *) node->parents[parent]);
+	}
+
+	threads_t * threads = worker->threads;
+	if(1 == atomic_fetch_sub_explicit(&threads->jobsInFlight, 1, memory_order_acq_rel))
+	{
+		// Program is done: Let other threads know
+		DPRINTF("Thread %2u: executed last instruction!\n", worker->arrayPos);
+		atomic_store(&threads->done, 1);
+		wakeSleepingThreads(threads);
 	}
 }
 
-void * threadFunction(void * arg)
+static node_t * stealJob(worker_t * worker)
 {
-	threadInit_t * init = (threadInit_t *) arg;
-
-	const uint16_t threadArrayIndex = init->arrayPos;
-	threads_t * threads = init->threads;
+	threads_t * threads = worker->threads;
 
-	node_t * nodeJob = NULL;
+	// xorshift32 to pick the first victim
+	uint32_t random = worker->randomState;
+	random ^= random << 13;
+	random ^= random >> 17;
+	random ^= random << 5;
+	worker->randomState = random;
 
-	while(1)
+	for(size_t victim = 0; victim < threads->threadsNrOf; victim++)
 	{
-		int mutexLockRet;
-		mutexLockRet = pthread_mutex_lock(&threads->jobPool.mutex);
-		if(0 != mutexLockRet)
+		size_t victimPos = (random + victim) % threads->threadsNrOf;
+		if(victimPos == worker->arrayPos)
 		{
-			errExitEN(mutexLockRet, "pthread_mutex_lock");
+			continue;
 		}
 
-		// Check if new jobs have been made available with last job
-		uint16_t oldJobsNrOf = threads->jobPool.jobsNrOf;
-		if(NULL != nodeJob)
+		node_t * node = dequeSteal(&threads->workers[victimPos].deque);
+		if(NULL != node)
 		{
-			nodeJob->exeCnt++;
-			DPRINTF("Thread %2u: updated node %u exe cnt to %u. ",
-					threadArrayIndex, nodeJob->id, nodeJob->exeCnt);
+			DPRINTF("Thread %2u: stole Node %u from thread %lu\n", worker->arrayPos, node->id, victimPos);
+			return node;
+		}
+	}
 
-			for(uint32_t child = 0; child < nodeJob->childrenNrOf; child++)
-			{
-				pushJobWithinMutex(threads, nodeJob->children[child]);
-			}
+	return NULL;
+}
 
-			// Check out all deferred jobs
-			checkDeferredJobs(threads);
+static void sleepUntilWork(threads_t * threads, size_t wakeupEpoch)
+{
+	lockMutex(&threads->mutex);
 
-			DPRINTF("Added nodes {")
-			for(uint16_t newJob = oldJobsNrOf; newJob < threads->jobPool.jobsNrOf; newJob++)
-			{
-				DPRINTF("%u, ", threads->jobPool.jobs[newJob]->id);
-			}
-			DPRINTF("} to job list\n");
+	atomic_fetch_add(&threads->sleepersNrOf, 1);
 
-			if(0 == threads->jobPool.jobsNrOf)
-			{
-				// Any other thread still working or are we out of work?
-				uint8_t stillWorking = 0;
-				for(uint16_t thread = 0; thread < threads->threadsNrOf; thread++)
-				{
-					if(threadArrayIndex == thread)
-					{
-						continue; // this is us
-					}
-
-					if(threads->threadActive[thread])
-					{
-						stillWorking = 1;
-						break;
-					}
-				}
-
-				if(!stillWorking)
-				{
-					// Program is done: Let other threads know and return
-					DPRINTF("Thread %2u: executed last instruction!\n", threadArrayIndex);
-
-					if(threads->jobPool.deferredJobsNrOf)
-					{
-						fatal("Deferred Job Pool still has jobs!\n");
-					}
-
-					goto SIGNAL_DONE_AND_TERMINATE;
-				}
-			}
-		}
+	// Anything pushed since we last looked for work? Pushers increment the epoch before checking
+	// for sleepers, so either they see us sleeping or we see their epoch.
+	while((wakeupEpoch == atomic_load(&threads->wakeupEpoch)) && !atomic_load(&threads->done))
+	{
+		waitCondition(&threads->sleepCondition, &threads->mutex);
+	}
 
-		while (0 == threads->jobPool.jobsNrOf)
-		{
-			threads->threadActive[threadArrayIndex] = 0;
+	atomic_fetch_sub(&threads->sleepersNrOf, 1);
 
-			int waitRet = pthread_cond_wait(&threads->jobPool.condition, &threads->jobPool.mutex);
-			if(waitRet != 0)
-			{
-				errExitEN(waitRet, "pthread_cond_wait");
-			}
-		}
+	unlockMutex(&threads->mutex);
+}
 
-		if(ALL_JOBS_COMPLETED == threads->jobPool.jobsNrOf)
-		{
-			goto SIGNAL_DONE_AND_TERMINATE;
-		}
-		else
-		{
-			nodeJob = threads->jobPool.jobs[threads->jobPool.jobsNrOf - 1];
-			threads->jobPool.jobsNrOf--;
+static void executeJobs(worker_t * worker)
+{
+	threads_t * threads = worker->threads;
 
-			threads->threadActive[threadArrayIndex] = 1;
+	uint32_t failedStealRounds = 0;
+	while(!atomic_load(&threads->done))
+	{
+		size_t wakeupEpoch = atomic_load(&threads->wakeupEpoch);
 
-			DPRINTF("Thread %2u: picking up Node %2u. ", threadArrayIndex, nodeJob->id);
+		node_t * nodeJob = dequeTake(&worker->deque);
+		if(NULL == nodeJob)
+		{
+			nodeJob = stealJob(worker);
+		}
 
-			DPRINTF("%2u Nodes remaining: ", threads->jobPool.jobsNrOf);
-			for(uint32_t node = 0; node < threads->jobPool.jobsNrOf; node++)
+		if(NULL == nodeJob)
+		{
+			failedStealRounds++;
+			if(STEAL_ROUNDS_BEFORE_SLEEP > failedStealRounds)
 			{
-				DPRINTF("%u, ", (threads->jobPool.jobs[node])->id);
+				sched_yield();
 			}
-
-			DPRINTF("%2u deferred Nodes remaining: ", threads->jobPool.deferredJobsNrOf);
-			for(uint32_t node = 0; node < threads->jobPool.deferredJobsNrOf; node++)
+			else
 			{
-				DPRINTF("%u, ", (threads->jobPool.deferredJobs[node])->id);
+				sleepUntilWork(threads, wakeupEpoch);
+				failedStealRounds = 0;
 			}
 
-			DPRINTF("\tThread active: ");
-			for(uint16_t thread = 0; thread < threads->threadsNrOf; thread++)
-			{
-				if(threads->threadActive[thread])
-				{
-					DPRINTF("1 ");
-				}
-				else
-				{
-					DPRINTF("0 ");
-				}
-			}
-			DPRINTF("\n\n");
+			continue;
 		}
 
-		uint8_t signalJobsAvailable = 0;
-		if((oldJobsNrOf == 0) && threads->jobPool.jobsNrOf)
-		{
-			signalJobsAvailable = 1;
-		}
+		failedStealRounds = 0;
+
+		DPRINTF("Thread %2u: picking up Node %2u.\n", worker->arrayPos, nodeJob->id);
 
-		int mutexUnlockRet;
-		mutexUnlockRet = pthread_mutex_unlock(&threads->jobPool.mutex);
-		if(0 != mutexUnlockRet)
+		// Run instruction
+		nodeJob->instruction(worker, &pushJobExported);
+
+		finishJob(worker, nodeJob);
+	}
+}
+
+void * threadFunction(void * arg)
+{
+	worker_t * worker = (worker_t *) arg;
+	threads_t * threads = worker->threads;
+
+	size_t runGeneration = 0;
+	while(1)
+	{
+		// Park until the next run
+		lockMutex(&threads->mutex);
+		while((runGeneration == threads->runGeneration) && !threads->shutdown)
 		{
-			errExitEN(mutexUnlockRet, "pthread_mutex_unlock");
+			waitCondition(&threads->runStartCondition, &threads->mutex);
 		}
 
-		if(signalJobsAvailable)
+		if(threads->shutdown)
 		{
-			int condSignalReturn = pthread_cond_signal(&threads->jobPool.condition); // Wake sleeping consumer
-			if (condSignalReturn != 0)
-			{
-				errExitEN(condSignalReturn, "pthread_cond_signal");
-			}
+			unlockMutex(&threads->mutex);
+			break;
 		}
 
-		// Run instruction
-		nodeJob->instruction(threads, &pushJobExported);
-	}
-
-	SIGNAL_DONE_AND_TERMINATE:
-	threads->jobPool.jobsNrOf = ALL_JOBS_COMPLETED;
+		runGeneration = threads->runGeneration;
+		unlockMutex(&threads->mutex);
 
-	int mutexUnlockRet;
-	mutexUnlockRet = pthread_mutex_unlock(&threads->jobPool.mutex);
-	if(0 != mutexUnlockRet)
-	{
-		errExitEN(mutexUnlockRet, "pthread_mutex_unlock");
-	}
+		executeJobs(worker);
 
-	int condSignalReturn = pthread_cond_signal(&threads->jobPool.condition); // Wake sleeping consumer
-	if (condSignalReturn != 0)
-	{
-		errExitEN(condSignalReturn, "pthread_cond_signal");
+		lockMutex(&threads->mutex);
+		threads->activeWorkersNrOf--;
+		if(0 == threads->activeWorkersNrOf)
+		{
+			broadcastCondition(&threads->runDoneCondition);
+		}
+		unlockMutex(&threads->mutex);
 	}
 
 	return NULL;
 }
 
-void StartThreads(void ** instance, size_t threadsNrOf, jobPoolInit_t * jobPoolInit)
+void * CreateThreads(size_t threadsNrOf)
 {
-	// Why this weird way of assigning the pointer? Because otherwise we can't hand it over to
-	// to JoinThreads. See https://www.viva64.com/en/b/0576/
-	*instance = malloc(sizeof(threads_t));
-	if(NULL == *instance)
+	if(0 == threadsNrOf)
 	{
-		fatal("Could not malloc threads_t!\n");
+		fatal("At least one thread is required!\n");
 	}
 
-	threads_t * threads = (threads_t*) *instance;
+	threads_t * threads = malloc(sizeof(threads_t));
+	if(NULL == threads)
+	{
+		fatal("Could not malloc threads_t!\n");
+	}
 
 	threads->threadsNrOf = threadsNrOf;
 
@@ -406,46 +446,41 @@ void StartThreads(void ** instance, size_t threadsNrOf, jobPoolInit_t * jobPoolI
 
 	threads->pthreads = pthreads;
 
-	atomic_uchar * threadActive = malloc(sizeof(atomic_uchar) * threadsNrOf);
-	if(NULL == threadActive)
+	worker_t * workers = malloc(sizeof(worker_t) * threadsNrOf);
+	if(NULL == workers)
 	{
-		fatal("Could not malloc atomic_uchar!\n");
+		fatal("Could not malloc worker_t!\n");
 	}
 
-	threads->threadActive = threadActive;
+	threads->workers = workers;
 
-	for(size_t thread = 0; thread < threads->threadsNrOf; thread++)
+	for(uint16_t arrayPos = 0; arrayPos < threads->threadsNrOf; arrayPos++)
 	{
-		threads->threadActive[thread] = 0;
+		atomic_init(&workers[arrayPos].deque.top, 0);
+		atomic_init(&workers[arrayPos].deque.bottom, 0);
+		workers[arrayPos].deque.buffer = NULL;
+		workers[arrayPos].deque.size = 0;
+		workers[arrayPos].threads = threads;
+		workers[arrayPos].randomState = 2463534242u + arrayPos; // xorshift32 must not start at zero
+		workers[arrayPos].arrayPos = arrayPos;
 	}
 
-	pthread_mutex_init(&threads->jobPool.mutex, NULL);
-	pthread_cond_init(&threads->jobPool.condition, NULL);
-
-	if(sizeof(threads->jobPool.jobs) / sizeof(threads->jobPool.jobs[0]) < jobPoolInit->NodesNrOf)
-	{
-		fatal("Too many jobs to initialize job pool!");
-	}
+	atomic_init(&threads->jobsInFlight, 0);
+	atomic_init(&threads->done, 1);
+	atomic_init(&threads->sleepersNrOf, 0);
+	atomic_init(&threads->wakeupEpoch, 0);
 
-	DPRINTF("Job pool is initialized with nodes {");
-	for(uint16_t node = 0; node < jobPoolInit->NodesNrOf; node++)
-	{
-		threads->jobPool.jobs[node] = jobPoolInit->Nodes[node];
-		DPRINTF("%u ", jobPoolInit->Nodes[node]->id);
-	}
-	threads->jobPool.jobsNrOf = jobPoolInit->NodesNrOf;
-	DPRINTF("}\n");
+	pthread_mutex_init(&threads->mutex, NULL);
+	pthread_cond_init(&threads->sleepCondition, NULL);
+	pthread_cond_init(&threads->runStartCondition, NULL);
+	pthread_cond_init(&threads->runDoneCondition, NULL);
 
-	threads->jobPool.deferredJobsNrOf = 0;
+	threads->runGeneration = 0;
+	threads->activeWorkersNrOf = 0;
+	threads->shutdown = 0;
 
 	DPRINTF("Starting %lu threads\n", threads->threadsNrOf);
 
-	threadInit_t* threadInits = malloc(sizeof(threadInit_t) * threads->threadsNrOf);
-	if(NULL == threadInits)
-	{
-		fatal("Could not malloc threadInit_t!\n");
-	}
-
 	// Set thread attributes: Priority & scheduler
 	// Checking whether this process is allowed to change schedulers requires an external library,
 	// check the man-pages for libcap.
@@ -486,17 +521,14 @@ void StartThreads(void ** instance, size_t threadsNrOf, jobPoolInit_t * jobPoolI
 	uint8_t have_cap_sys_nice = 1;
 	for(uint16_t arrayPos = 0; arrayPos < threads->threadsNrOf; arrayPos++)
 	{
-		threadInits[arrayPos].threads = threads;
-		threadInits[arrayPos].arrayPos = arrayPos;
-
 		int threadCreateRet;
 		if(have_cap_sys_nice)
 		{
-			threadCreateRet = pthread_create(&threads->pthreads[arrayPos], &threadAttribute, threadFunction, &threadInits[arrayPos]);
+			threadCreateRet = pthread_create(&threads->pthreads[arrayPos], &threadAttribute, threadFunction, &workers[arrayPos]);
 		}
 		else
 		{
-			threadCreateRet = pthread_create(&threads->pthreads[arrayPos], NULL, threadFunction, &threadInits[arrayPos]);
+			threadCreateRet = pthread_create(&threads->pthreads[arrayPos], NULL, threadFunction, &workers[arrayPos]);
 		}
 
 		if(threadCreateRet)
@@ -504,22 +536,129 @@ void StartThreads(void ** instance, size_t threadsNrOf, jobPoolInit_t * jobPoolI
 			if((EPERM == threadCreateRet) && have_cap_sys_nice && (0 == arrayPos)) // We are not allowed to set the thread attribues: Create threads with standard values.
 			{
 				INFO("No CAP_SYS_NICE capability. Defaulting to standard thread attributes.\n")
-				threadCreateRet = pthread_create(&threads->pthreads[arrayPos], NULL, threadFunction, &threadInits[arrayPos]);
+				threadCreateRet = pthread_create(&threads->pthreads[arrayPos], NULL, threadFunction, &workers[arrayPos]);
 				have_cap_sys_nice = 0;
 			}
-			else
+
+			if(threadCreateRet)
 			{
 				errExitEN(threadCreateRet, "pthread_create");
 			}
 		}
 	}
 
-	return;
+	int attrDestroyRet = pthread_attr_destroy(&threadAttribute);
+	if(attrDestroyRet)
+	{
+		errExitEN(attrDestroyRet, "pthread_attr_destroy");
+	}
+
+	return threads;
 }
 
-void JoinThreads(void * instance)
+static void waitForRun(threads_t * threads)
+{
+	lockMutex(&threads->mutex);
+	while(0 != threads->activeWorkersNrOf)
+	{
+		waitCondition(&threads->runDoneCondition, &threads->mutex);
+	}
+	unlockMutex(&threads->mutex);
+}
+
+static void reserveDeques(threads_t * threads, size_t jobsNrOfMax)
 {
-	threads_t * threads = (threads_t * ) instance;
+	size_t size = 1;
+	while(size < jobsNrOfMax)
+	{
+		size <<= 1;
+	}
+
+	for(size_t thread = 0; thread < threads->threadsNrOf; thread++)
+	{
+		jobDeque_t * deque = &threads->workers[thread].deque;
+		if(deque->size >= size)
+		{
+			continue;
+		}
+
+		// Deques are empty between runs, so the buffer can simply be replaced
+		free(deque->buffer);
+
+		deque->buffer = malloc(sizeof(deque->buffer[0]) * size);
+		if(NULL == deque->buffer)
+		{
+			fatal("Could not malloc job deque!\n");
+		}
+
+		deque->size = size;
+	}
+}
+
+static void startRun(threads_t * threads, jobPoolInit_t * jobPoolInit)
+{
+	// All workers are parked and do not touch their deques, so we may push to them.
+	// The mutex hands the pushed jobs over to the workers. Note that there are no sleepers
+	// between runs, so pushing won't try to lock the mutex again.
+	lockMutex(&threads->mutex);
+
+	if(0 != threads->activeWorkersNrOf)
+	{
+		fatal("Run started while previous run is still active!\n");
+	}
+
+	atomic_store(&threads->done, 0);
+
+	reserveDeques(threads, jobPoolInit->JobsNrOfMax);
+
+	// Distribute the initial jobs round robin
+	DPRINTF("Job pool is initialized with nodes {");
+	for(size_t node = 0; node < jobPoolInit->NodesNrOf; node++)
+	{
+		node_t * initNode = jobPoolInit->Nodes[node];
+		if(0 != initNode->parentsNrOf)
+		{
+			fatal("Initial Node%u has parents!\n", initNode->id);
+		}
+
+		signalNode(&threads->workers[node % threads->threadsNrOf], initNode);
+		DPRINTF("%u ", initNode->id);
+	}
+	DPRINTF("}\n");
+
+	if(0 == atomic_load(&threads->jobsInFlight))
+	{
+		// Nothing to do
+		atomic_store(&threads->done, 1);
+		unlockMutex(&threads->mutex);
+		return;
+	}
+
+	threads->activeWorkersNrOf = threads->threadsNrOf;
+	threads->runGeneration++;
+	broadcastCondition(&threads->runStartCondition);
+
+	unlockMutex(&threads->mutex);
+}
+
+void RunJobs(void * instance, jobPoolInit_t * jobPoolInit)
+{
+	threads_t * threads = (threads_t *) instance;
+
+	startRun(threads, jobPoolInit);
+	waitForRun(threads);
+}
+
+void DestroyThreads(void * instance)
+{
+	threads_t * threads = (threads_t *) instance;
+
+	waitForRun(threads);
+
+	lockMutex(&threads->mutex);
+	threads->shutdown = 1;
+	broadcastCondition(&threads->runStartCondition);
+	unlockMutex(&threads->mutex);
 
 	for(uint16_t thread = 0; thread < threads->threadsNrOf; thread++)
 	{
@@ -531,6 +670,44 @@ void JoinThreads(void * instance)
 		}
 	}
 
-	// TODO: Free stuff!
+	pthread_cond_destroy(&threads->runDoneCondition);
+	pthread_cond_destroy(&threads->runStartCondition);
+	pthread_cond_destroy(&threads->sleepCondition);
+	pthread_mutex_destroy(&threads->mutex);
+
+	for(size_t thread = 0; thread < threads->threadsNrOf; thread++)
+	{
+		free(threads->workers[thread].deque.buffer);
+	}
+
+	free(threads->workers);
+	free(threads->pthreads);
+	free(threads);
 }
 
+void StartThreads(void ** instance, size_t threadsNrOf, jobPoolInit_t * jobPoolInit)
+{
+	// Why this weird way of assigning the pointer? Because otherwise we can't hand it over to
+	// to JoinThreads. See https://www.viva64.com/en/b/0576/
+	*instance = CreateThreads(threadsNrOf);
+
+	startRun((threads_t *) *instance, jobPoolInit);
+}
+
+void JoinThreads(void * instance)
+{
+	DestroyThreads(instance);
+}
+
+void WaitForCount(atomic_uint * counter, uint32_t count)
+{
+	uint32_t spins = 0;
+	while(atomic_load_explicit(counter, memory_order_acquire) < count)
+	{
+		spins++;
+		if(SPINS_BEFORE_YIELD < spins)
+		{
+			sched_yield();
+		}
+	}
+}
@@ -27,25 +27,35 @@
 #include <pthread.h>
 #include <stdint.h>
 
-#define NODE_T_MAX_EDGE_NUMBER 42u
-
 typedef struct node_s {
 	void (*instruction)(void * instance, void (*PushNode)(void * instance, struct node_s * node));
-	const struct node_s * parents[NODE_T_MAX_EDGE_NUMBER];
-	struct node_s * children[NODE_T_MAX_EDGE_NUMBER];
+	const struct node_s * const * parents; // Slice of the generated parents array, parentsNrOf long
+	struct node_s * const * children; // Slice of the generated children array, childrenNrOf long
 	uint32_t exeCnt;
 	const uint16_t parentsNrOf;
 	const uint16_t childrenNrOf;
 	const uint16_t id;
+	atomic_uint readyCnt; // Readiness signals received for the next execution. Zero-initialized, owned by the executor.
 } node_t;
 
 typedef struct jobPoolInit_s {
 	node_t ** Nodes;
 	size_t NodesNrOf;
+	size_t JobsNrOfMax; // Maximum number of jobs queued at the same time
 } jobPoolInit_t;
 
 extern void * threadFunction(void * arg);
+
+// Persistent thread pool: Workers are parked between runs and reused.
+extern void * CreateThreads(size_t threadsNrOf);
+extern void RunJobs(void * instance, jobPoolInit_t * jobPoolInit); // Blocks until all jobs are done
+extern void DestroyThreads(void * instance);
+
+// One-shot: Create threads and start running, JoinThreads waits for the run and destroys the threads.
 extern void StartThreads(void ** instance, size_t threadsNrOf, jobPoolInit_t * jobPoolInit);
 extern void JoinThreads(void * instance);
 
+// Spins (and eventually yields) until counter >= count. Used by statically scheduled graphs.
+extern void WaitForCount(atomic_uint * counter, uint32_t count);
+
 #endif /* SRC_NODEEXECUTOR_H_ */